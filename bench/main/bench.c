@@ -0,0 +1,524 @@
+// SPDX-License-Identifier: MIT
+
+// Benchmark of the flashing code against the simulated target.
+// Every run prints one JSON object per line to stdout, or to the file named by ET2_BENCH_OUT.
+// Set ET2_BENCH_QUICK to run with smaller images.
+
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "esp_log.h"
+#include "esp_rom_md5.h"
+#include "esptoolsquared.h"
+#include "et2_macros.h"
+#include "et2_sim.h"
+#include "et2_slip.h"
+#include "et2_transport.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+static char const TAG[] = "ET2 BENCH";
+
+#define BENCH_OFFSET     0x10000
+#define BENCH_SLIP_BYTES (8 * 1024 * 1024)
+#define BENCH_SLIP_FRAME 0x4000
+
+// Output of the results.
+static FILE* out;
+// Divisor for the image sizes in quick mode.
+static uint32_t size_div = 1;
+
+/* ==== Allocation counting ==== */
+
+// Every allocation made by the code linked into the benchmark goes through these wrappers.
+static atomic_size_t alloc_count;
+static atomic_size_t alloc_bytes;
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+    atomic_fetch_add(&alloc_count, 1);
+    atomic_fetch_add(&alloc_bytes, size);
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    atomic_fetch_add(&alloc_count, 1);
+    atomic_fetch_add(&alloc_bytes, count * size);
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    atomic_fetch_add(&alloc_count, 1);
+    atomic_fetch_add(&alloc_bytes, size);
+    return __real_realloc(ptr, size);
+}
+
+/* ==== Test data ==== */
+
+// Kinds of image contents, from incompressible to mostly empty.
+typedef enum {
+    DATA_RANDOM,
+    DATA_TEXT,
+    DATA_SPARSE,
+} bench_data_t;
+
+static char const* const data_names[] = {"random", "text", "sparse"};
+
+static uint32_t bench_rand(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+// Generate an image; the same kind and size always give the same contents.
+static uint8_t* bench_image(bench_data_t kind, uint32_t size) {
+    static char const* const words[] = {"flash ", "erase ", "block ", "stub ", "write ", "0x4000 ", "ESP32\n", "sync "};
+    uint8_t*                 data    = malloc(size);
+    uint32_t                 rng     = 0x2545F491 + size;
+    if (!data) {
+        return NULL;
+    }
+    if (kind == DATA_RANDOM) {
+        for (uint32_t i = 0; i < size; i++) {
+            data[i] = bench_rand(&rng);
+        }
+    } else if (kind == DATA_TEXT) {
+        for (uint32_t i = 0; i < size;) {
+            char const* word = words[bench_rand(&rng) % 8];
+            for (size_t j = 0; word[j] && i < size; j++) {
+                data[i++] = word[j];
+            }
+        }
+    } else {
+        // Erased flash with an occasional 4 KiB block of code.
+        memset(data, 0xFF, size);
+        for (uint32_t block = 0; block < size; block += 0x1000) {
+            if (bench_rand(&rng) % 8 == 0) {
+                for (uint32_t i = block; i < block + 0x1000 && i < size; i++) {
+                    data[i] = bench_rand(&rng);
+                }
+            }
+        }
+    }
+    return data;
+}
+
+/* ==== End-to-end runs ==== */
+
+typedef enum {
+    OP_WRITE,
+    OP_WRITE_COMPRESSED,
+    OP_WRITE_PIPELINED,
+    OP_READ,
+    OP_VERIFY,
+} bench_op_t;
+
+static char const* const op_names[] = {"write", "write_compressed", "write_pipelined", "read", "verify"};
+
+// One benchmark run.
+typedef struct {
+    bench_op_t   op;
+    bench_data_t data;
+    uint32_t     size;
+    // Flash writer window for writes, packet size for reads; 0 for the default.
+    uint32_t     block;
+    // Simulated link rate; 0 for an unlimited link.
+    uint32_t     baudrate;
+    // Simulated response latency.
+    uint32_t     latency_us;
+    // Chance of a corrupted response, in parts per million.
+    uint32_t     corrupt_ppm;
+} bench_run_t;
+
+static esp_err_t bench_sink(void* cookie, uint32_t offset, uint8_t const* data, size_t len) {
+    *(uint64_t*)cookie += len;
+    return ESP_OK;
+}
+
+// Perform the operation being measured, including the finish command that makes the target write its last block.
+static esp_err_t bench_op(et2_session_t* session, bench_run_t const* run, uint8_t const* image) {
+    switch (run->op) {
+        case OP_WRITE: {
+            et2_flash_writer_t writer;
+            esp_err_t          res = et2_session_cmd_flash_begin(session, run->size, BENCH_OFFSET);
+            et2_session_flash_writer_init(session, &writer, ET2_CMD_FLASH_DATA, run->block);
+            for (uint32_t pos = 0; pos < run->size && res == ESP_OK; pos += ET2_FLASH_WRITE_SIZE) {
+                uint32_t chunk = run->size - pos < ET2_FLASH_WRITE_SIZE ? run->size - pos : ET2_FLASH_WRITE_SIZE;
+                res            = et2_flash_writer_write(&writer, image + pos, chunk);
+            }
+            if (res == ESP_OK) {
+                res = et2_flash_writer_wait(&writer);
+            }
+            if (res == ESP_OK) {
+                res = et2_session_cmd_flash_finish(session, false);
+            }
+            return res;
+        }
+        case OP_WRITE_COMPRESSED:
+            RETURN_ON_ERR(et2_session_write_flash_compressed(session, BENCH_OFFSET, image, run->size, -1, NULL));
+            return et2_session_cmd_deflate_finish(session, false);
+        case OP_WRITE_PIPELINED:
+            RETURN_ON_ERR(
+                et2_session_write_flash_pipelined(session, BENCH_OFFSET, image, run->size, NULL, NULL, NULL));
+            return et2_session_cmd_deflate_finish(session, false);
+        case OP_READ: {
+            uint64_t received = 0;
+            return et2_session_read_flash_stream(session, BENCH_OFFSET, run->size, run->block, 0, bench_sink, &received,
+                                                 NULL);
+        }
+        case OP_VERIFY: {
+            uint8_t       local[16];
+            md5_context_t context;
+            esp_rom_md5_init(&context);
+            esp_rom_md5_update(&context, image, run->size);
+            esp_rom_md5_final(local, &context);
+            return et2_session_verify_flash(session, BENCH_OFFSET, run->size, local);
+        }
+    }
+    return ESP_ERR_INVALID_ARG;
+}
+
+// Run one benchmark against a fresh simulated target and print the result.
+static esp_err_t bench_run(bench_run_t const* run) {
+    static et2_cmd_t const cmds[] = {
+        ET2_CMD_FLASH_BEGIN, ET2_CMD_FLASH_DATA, ET2_CMD_FLASH_END,    ET2_CMD_DEFL_BEGIN,
+        ET2_CMD_DEFL_DATA,   ET2_CMD_DEFL_END,   ET2_CMD_READ_FLASH,   ET2_CMD_SPI_FLASH_MD5,
+    };
+
+    uint8_t* image = bench_image(run->data, run->size);
+    if (!image) {
+        return ESP_ERR_NO_MEM;
+    }
+    et2_sim_config_t config = {
+        .baudrate    = run->baudrate,
+        .latency_us  = run->latency_us,
+        .corrupt_ppm = run->corrupt_ppm,
+        .seed        = 1,
+    };
+    int              fd;
+    et2_sim_t*       sim;
+    et2_transport_t* tp      = NULL;
+    et2_session_t*   session = NULL;
+    esp_err_t        res     = et2_sim_create(&config, &fd, &sim);
+    if (res != ESP_OK) {
+        free(image);
+        return res;
+    }
+    res = et2_transport_fd_create(fd, fd, &tp);
+    if (res == ESP_OK) {
+        res = et2_session_create(tp, &session);
+    }
+    if (res == ESP_OK) {
+        res = et2_session_sync(session);
+    }
+    if (res == ESP_OK) {
+        res = et2_session_run_stub(session);
+    }
+    if (res == ESP_OK && (run->op == OP_READ || run->op == OP_VERIFY)) {
+        // Reads and verifies need the image in flash; write it over an error-free path.
+        memcpy(et2_sim_flash(sim) + BENCH_OFFSET, image, run->size);
+    }
+    if (res != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to set up the simulated target");
+    }
+
+    esp_err_t op_res = res;
+    int64_t   time   = 0;
+    size_t    allocs = 0;
+    size_t    bytes  = 0;
+    if (res == ESP_OK) {
+        et2_session_reset_stats(session);
+        size_t  allocs_start = atomic_load(&alloc_count);
+        size_t  bytes_start  = atomic_load(&alloc_bytes);
+        int64_t start        = et2_time_us();
+        op_res               = bench_op(session, run, image);
+        time                 = et2_time_us() - start;
+        allocs               = atomic_load(&alloc_count) - allocs_start;
+        bytes                = atomic_load(&alloc_bytes) - bytes_start;
+    }
+    if (op_res == ESP_OK && run->op <= OP_WRITE_PIPELINED &&
+        memcmp(et2_sim_flash(sim) + BENCH_OFFSET, image, run->size)) {
+        op_res = ESP_ERR_INVALID_CRC;
+    }
+
+    // Sum the counters of every command involved.
+    et2_cmd_stats_t total = {0};
+    for (size_t i = 0; session && i < sizeof(cmds) / sizeof(cmds[0]); i++) {
+        et2_cmd_stats_t stats;
+        if (et2_session_get_cmd_stats(session, cmds[i], &stats) != ESP_OK) {
+            break;
+        }
+        total.calls      += stats.calls;
+        total.tx_payload += stats.tx_payload;
+        total.tx_wire    += stats.tx_wire;
+        total.rx_payload += stats.rx_payload;
+        total.rx_wire    += stats.rx_wire;
+        total.discarded  += stats.discarded;
+        total.timeouts   += stats.timeouts;
+        total.rx_errors  += stats.rx_errors;
+        total.failures   += stats.failures;
+    }
+
+    double seconds = time / 1e6;
+    fprintf(out,
+            "{\"bench\":\"%s\",\"data\":\"%s\",\"size\":%" PRIu32 ",\"block\":%" PRIu32 ",\"baudrate\":%" PRIu32
+            ",\"latency_us\":%" PRIu32 ",\"corrupt_ppm\":%" PRIu32 ",\"ok\":%s,\"error\":\"%s\",\"seconds\":%.6f"
+            ",\"mb_per_s\":%.3f,\"allocs\":%zu,\"alloc_bytes\":%zu,\"commands\":%" PRIu32 ",\"tx_payload\":%" PRIu64
+            ",\"tx_wire\":%" PRIu64 ",\"rx_payload\":%" PRIu64 ",\"rx_wire\":%" PRIu64 ",\"discarded\":%" PRIu32
+            ",\"timeouts\":%" PRIu32 ",\"rx_errors\":%" PRIu32 ",\"failures\":%" PRIu32 "}\n",
+            op_names[run->op], data_names[run->data], run->size, run->block, run->baudrate, run->latency_us,
+            run->corrupt_ppm, op_res == ESP_OK ? "true" : "false", esp_err_to_name(op_res), seconds,
+            seconds > 0 ? run->size / seconds / 1e6 : 0.0, allocs, bytes, total.calls, total.tx_payload,
+            total.tx_wire, total.rx_payload, total.rx_wire, total.discarded, total.timeouts, total.rx_errors,
+            total.failures);
+    fflush(out);
+
+    et2_session_destroy(session);
+    et2_transport_destroy(tp);
+    et2_sim_destroy(sim);
+    close(fd);
+    free(image);
+    return op_res;
+}
+
+/* ==== SLIP encoding and decoding ==== */
+
+// Transport that discards what is written and reads back a fixed buffer.
+typedef struct {
+    et2_transport_t base;
+    uint8_t*        data;
+    size_t          len;
+    size_t          cap;
+    size_t          pos;
+    // Whether writes are kept, to prepare the buffer to read back.
+    bool            record;
+} bench_mem_t;
+
+static esp_err_t bench_mem_write(et2_transport_t* tp, uint8_t const* data, size_t len) {
+    bench_mem_t* mem = (bench_mem_t*)tp;
+    if (!mem->record) {
+        return ESP_OK;
+    } else if (mem->len + len > mem->cap) {
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(mem->data + mem->len, data, len);
+    mem->len += len;
+    return ESP_OK;
+}
+
+static esp_err_t bench_mem_read(et2_transport_t* tp, uint8_t* out_data, size_t len, size_t* out_len,
+                                int64_t deadline) {
+    bench_mem_t* mem = (bench_mem_t*)tp;
+    if (mem->pos == mem->len) {
+        return ESP_ERR_TIMEOUT;
+    }
+    if (len > mem->len - mem->pos) {
+        len = mem->len - mem->pos;
+    }
+    memcpy(out_data, mem->data + mem->pos, len);
+    mem->pos += len;
+    *out_len  = len;
+    return ESP_OK;
+}
+
+// Cycle counter, or nanoseconds where there is none.
+static uint64_t bench_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return et2_time_us() * 1000;
+#endif
+}
+
+// Measure the cost of encoding and decoding frames of one kind of data.
+static esp_err_t bench_slip(bench_data_t kind) {
+    // SLIP at most doubles the data, plus two frame delimiters per frame.
+    uint8_t*    image = bench_image(kind, BENCH_SLIP_FRAME);
+    bench_mem_t mem   = {
+        .base = {.write = bench_mem_write, .read = bench_mem_read},
+        .cap  = 2 * BENCH_SLIP_BYTES + 2 * (BENCH_SLIP_BYTES / BENCH_SLIP_FRAME),
+    };
+    mem.data = malloc(mem.cap);
+    if (!image || !mem.data) {
+        free(image);
+        free(mem.data);
+        return ESP_ERR_NO_MEM;
+    }
+    static et2_slip_t slip;
+    et2_slip_init(&slip, &mem.base);
+    uint32_t  frames = BENCH_SLIP_BYTES / BENCH_SLIP_FRAME;
+    esp_err_t res    = ESP_OK;
+
+    // Record one pass to have something to decode, then measure a pass that only encodes.
+    mem.record = true;
+    for (uint32_t i = 0; i < frames && res == ESP_OK; i++) {
+        res = et2_slip_send_frame(&slip, &(et2_iov_t){image, BENCH_SLIP_FRAME}, 1);
+    }
+    mem.record        = false;
+    int64_t  start_us = et2_time_us();
+    uint64_t start    = bench_cycles();
+    for (uint32_t i = 0; i < frames && res == ESP_OK; i++) {
+        res = et2_slip_send_frame(&slip, &(et2_iov_t){image, BENCH_SLIP_FRAME}, 1);
+    }
+    uint64_t encode    = bench_cycles() - start;
+    int64_t  encode_us = et2_time_us() - start_us;
+
+    start_us = et2_time_us();
+    start    = bench_cycles();
+    for (uint32_t i = 0; i < frames && res == ESP_OK; i++) {
+        uint8_t const* frame;
+        size_t         frame_len;
+        res = et2_slip_receive(&slip, &frame, &frame_len);
+        if (res == ESP_OK && (frame_len != BENCH_SLIP_FRAME || memcmp(frame, image, frame_len))) {
+            res = ESP_ERR_INVALID_RESPONSE;
+        }
+    }
+    uint64_t decode    = bench_cycles() - start;
+    int64_t  decode_us = et2_time_us() - start_us;
+
+    fprintf(out,
+            "{\"bench\":\"slip\",\"data\":\"%s\",\"size\":%d,\"wire\":%zu,\"ok\":%s,\"encode_cycles_per_byte\":%.3f"
+            ",\"decode_cycles_per_byte\":%.3f,\"encode_mb_per_s\":%.1f,\"decode_mb_per_s\":%.1f}\n",
+            data_names[kind], BENCH_SLIP_BYTES, mem.len, res == ESP_OK ? "true" : "false",
+            (double)encode / BENCH_SLIP_BYTES, (double)decode / BENCH_SLIP_BYTES,
+            encode_us ? (double)BENCH_SLIP_BYTES / encode_us : 0.0,
+            decode_us ? (double)BENCH_SLIP_BYTES / decode_us : 0.0);
+    fflush(out);
+
+    et2_slip_deinit(&slip);
+    free(mem.data);
+    free(image);
+    return res;
+}
+
+/* ==== Connecting ==== */
+
+// Measure the time et2_connect takes to get a response from a target that does not print a boot message.
+static esp_err_t bench_connect(uint32_t baudrate, uint32_t latency_us) {
+    et2_sim_config_t config = {
+        .no_banner  = true,
+        .baudrate   = baudrate,
+        .latency_us = latency_us,
+    };
+    int              fd;
+    et2_sim_t*       sim;
+    et2_transport_t* tp         = NULL;
+    et2_session_t*   session    = NULL;
+    int64_t          connect_us = 0;
+    RETURN_ON_ERR(et2_sim_create(&config, &fd, &sim));
+    esp_err_t res = et2_transport_fd_create(fd, fd, &tp);
+    if (res == ESP_OK) {
+        res = et2_session_create(tp, &session);
+    }
+    if (res == ESP_OK) {
+        et2_connect_config_t connect = ET2_CONNECT_CONFIG_DEFAULT();
+        connect.reset                = ET2_RESET_NONE;
+        res                          = et2_session_connect(session, &connect, &connect_us);
+    }
+
+    fprintf(out,
+            "{\"bench\":\"connect\",\"baudrate\":%" PRIu32 ",\"latency_us\":%" PRIu32
+            ",\"ok\":%s,\"error\":\"%s\",\"connect_us\":%" PRId64 "}\n",
+            baudrate, latency_us, res == ESP_OK ? "true" : "false", esp_err_to_name(res), connect_us);
+    fflush(out);
+
+    et2_session_destroy(session);
+    et2_transport_destroy(tp);
+    et2_sim_destroy(sim);
+    close(fd);
+    return res;
+}
+
+/* ==== Sweeps ==== */
+
+// Image sizes, contents and operations on an unlimited link.
+static void bench_sweep_size(void) {
+    static uint32_t const sizes[] = {64 * 1024, 512 * 1024, 2 * 1024 * 1024};
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        for (bench_data_t data = DATA_RANDOM; data <= DATA_SPARSE; data++) {
+            for (bench_op_t op = OP_WRITE; op <= OP_VERIFY; op++) {
+                bench_run(&(bench_run_t){.op = op, .data = data, .size = sizes[i] / size_div});
+            }
+        }
+    }
+}
+
+// Link rates.
+static void bench_sweep_baudrate(void) {
+    static uint32_t const baudrates[] = {460800, 921600, 2000000, 3000000};
+    for (size_t i = 0; i < sizeof(baudrates) / sizeof(baudrates[0]); i++) {
+        for (bench_op_t op = OP_WRITE; op <= OP_WRITE_COMPRESSED; op++) {
+            bench_run(&(bench_run_t){
+                .op = op, .data = DATA_TEXT, .size = 256 * 1024 / size_div, .baudrate = baudrates[i]});
+        }
+    }
+}
+
+// Blocks in flight for writes and packet sizes for reads, on a fast link with latency.
+static void bench_sweep_block(void) {
+    static uint32_t const windows[]      = {1, 2, 4, 8};
+    static uint32_t const packet_sizes[] = {1024, 4096, 16384};
+    for (size_t i = 0; i < sizeof(windows) / sizeof(windows[0]); i++) {
+        bench_run(&(bench_run_t){.op         = OP_WRITE,
+                                 .data       = DATA_RANDOM,
+                                 .size       = 256 * 1024 / size_div,
+                                 .block      = windows[i],
+                                 .latency_us = 2000});
+    }
+    for (size_t i = 0; i < sizeof(packet_sizes) / sizeof(packet_sizes[0]); i++) {
+        bench_run(&(bench_run_t){.op         = OP_READ,
+                                 .data       = DATA_RANDOM,
+                                 .size       = 256 * 1024 / size_div,
+                                 .block      = packet_sizes[i],
+                                 .latency_us = 2000});
+    }
+}
+
+// Injected errors.
+static void bench_sweep_errors(void) {
+    static uint32_t const rates[] = {0, 1000, 10000, 50000};
+    for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        bench_run(&(bench_run_t){
+            .op = OP_WRITE, .data = DATA_RANDOM, .size = 1024 * 1024 / size_div, .corrupt_ppm = rates[i]});
+        bench_run(&(bench_run_t){
+            .op = OP_READ, .data = DATA_RANDOM, .size = 1024 * 1024 / size_div, .corrupt_ppm = rates[i]});
+    }
+}
+
+void app_main(void) {
+    esp_log_level_set("*", ESP_LOG_ERROR);
+    char const* path = getenv("ET2_BENCH_OUT");
+    out              = path ? fopen(path, "w") : stdout;
+    if (!out) {
+        ESP_LOGE(TAG, "Cannot open %s", path);
+        exit(1);
+    }
+    if (getenv("ET2_BENCH_QUICK")) {
+        size_div = 4;
+    }
+
+    for (bench_data_t data = DATA_RANDOM; data <= DATA_SPARSE; data++) {
+        bench_slip(data);
+    }
+    bench_connect(115200, 0);
+    bench_connect(115200, 5000);
+    bench_sweep_size();
+    bench_sweep_baudrate();
+    bench_sweep_block();
+    bench_sweep_errors();
+
+    if (out != stdout) {
+        fclose(out);
+    }
+    exit(0);
+}
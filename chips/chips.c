@@ -30,6 +30,7 @@ et2_chip_t const et2_chip_esp32c6 = {
     .ram_block   = DEFAULT_RAM_BLOCK,
     .flash_block = DEFAULT_FLASH_BLOCK,
     .status_len  = 4,
+    .stub_attr   = &et2_chip_esp32c6_stub,
 };
 et2_chip_t const et2_chip_esp32c6_stub = {
     .stub        = &stub_esp32c6,
@@ -8,18 +8,23 @@
 #include <stddef.h>
 #include <stdint.h>
 
+// Flasher stub; the segments are stored as zlib streams, `*_zlen` is their compressed and `*_len` their inflated size.
 typedef struct {
     uint8_t const* text;
+    size_t         text_zlen;
     size_t         text_len;
     size_t         text_start;
     uint8_t const* data;
+    size_t         data_zlen;
     size_t         data_len;
     size_t         data_start;
     size_t         bss_start;
     size_t         entry;
 } et2_stub_t;
 
-typedef struct {
+typedef struct et2_chip et2_chip_t;
+
+struct et2_chip {
     // Flasher stub.
     et2_stub_t const* stub;
     // Chip supports FLASH encryption.
@@ -30,7 +35,17 @@ typedef struct {
     uint32_t          flash_block;
     // Number of status bytes, either 2 or 4.
     uint8_t           status_len;
-} et2_chip_t;
+    // Attributes to use once the flasher stub runs, NULL if they stay the same.
+    et2_chip_t const* stub_attr;
+};
+
+// Chip IDs as reported by the ROM in the security info.
+#define ET2_CHIP_ID_ESP32S2 0x0002
+#define ET2_CHIP_ID_ESP32C3 0x0005
+#define ET2_CHIP_ID_ESP32S3 0x0009
+#define ET2_CHIP_ID_ESP32C2 0x000C
+#define ET2_CHIP_ID_ESP32C6 0x000D
+#define ET2_CHIP_ID_ESP32P4 0x0012
 
 #define DEFAULT_RAM_BLOCK   0x1800
 #define DEFAULT_FLASH_BLOCK 0x4000
@@ -1,17 +1,20 @@
 // WARNING: This is a generated file, do not edit it!
 // clang-format off
 // Generated from esp-idf-tools/python_env/idf5.3_py3.12_env/lib/python3.12/site-packages/esptool/targets/stub_flasher/stub_flasher_32c2.json
+// The text and data segments are zlib streams with a 1024 byte window
 
 #include "chips.h"
 
 et2_stub_t const stub_esp32c2 = {
     .text = (uint8_t const[]){
-        0x01, 0x11, 0xB7, 0x07, 0x00, 0x60, 0x4E, 0xC6, 0x83, 0xA9, 0x87, 0x00, 0x4A, 0xC8, 0x37, 0x49, 0xCA, 0x3F, 0x26, 0xCA, 0x52, 0xC4, 0x06, 0xCE, 0x22, 0xCC, 0xB7, 0x04, 0x00, 0x60, 0x7D, 0x5A, 0x13, 0x09, 0x09, 0x00, 0xC0, 0x4C, 0x13, 0x74, 0xF4, 0x3F, 0x0D, 0xE0, 0xF2, 0x40, 0x62, 0x44, 0x23, 0xA8, 0x34, 0x01, 0x42, 0x49, 0xD2, 0x44, 0xB2, 0x49, 0x22, 0x4A, 0x05, 0x61, 0x82, 0x80, 0x88, 0x40, 0x83, 0x27, 0x09, 0x00, 0x13, 0x75, 0xF5, 0x0F, 0x82, 0x97, 0x7D, 0x14, 0xE3, 0x19, 0x44, 0xFF, 0xC9, 0xBF, 0x13, 0x07, 0x00, 0x0C, 0x94, 0x41, 0xAA, 0x87, 0x63, 0x18, 0xE5, 0x00, 0x85, 0x47, 0x85, 0xC6, 0x23, 0xA0, 0x05, 0x00, 0x79, 0x55, 0x82, 0x80, 0x05, 0x47, 0x63, 0x87, 0xE6, 0x00, 0x09, 0x46, 0x63, 0x8D, 0xC6, 0x00, 0x7D, 0x55, 0x82, 0x80, 0x42, 0x05, 0x13, 0x07, 0xB0, 0x0D, 0x41, 0x85, 0x63, 0x95, 0xE7, 0x02, 0x89, 0x47, 0x9C, 0xC1, 0xF5, 0xB7, 0x93, 0x06, 0xC0, 0x0D, 0x63, 0x16, 0xD5, 0x00, 0x98, 0xC1, 0x13, 0x05, 0x00, 0x0C, 0x82, 0x80, 0x93, 0x06, 0xD0, 0x0D, 0x7D, 0x55, 0x63, 0x95, 0xD7, 0x00, 0x98, 0xC1, 0x13, 0x05, 0xB0, 0x0D, 0x82, 0x80, 0xB7, 0x75, 0xCB, 0x3F, 0x41, 0x11, 0x93, 0x85, 0x05, 0xBA, 0x06, 0xC6, 0x61, 0x3F, 0x63, 0x45, 0x05, 0x06, 0xB7, 0x77, 0xCB, 0x3F, 0x93, 0x87, 0x87, 0xB1, 0x03, 0xA7, 0x07, 0x08, 0x03, 0xD6, 0x47, 0x08, 0x13, 0x75, 0xF5, 0x0F, 0x93, 0x06, 0x16, 0x00, 0xC2, 0x06, 0xC1, 0x82, 0x23, 0x92, 0xD7, 0x08, 0x32, 0x97, 0x23, 0x00, 0xA7, 0x00, 0x03, 0xD7, 0x47, 0x08, 0x91, 0x67, 0x93, 0x87, 0x07, 0x04, 0x63, 0x1E, 0xF7, 0x02, 0x37, 0xF7, 0xCA, 0x3F, 0x13, 0x07, 0x87, 0xB1, 0xA1, 0x67, 0xBA, 0x97, 0x03, 0xA6, 0x07, 0x08, 0xB7, 0x36, 0xCB, 0x3F, 0xB7, 0x77, 0xCB, 0x3F, 0x93, 0x87, 0x87, 0xB1, 0x93, 0x86, 0x86, 0xB5, 0x63, 0x1F, 0xE6, 0x00, 0x23, 0xA6, 0xC7, 0x08, 0x23, 0xA0, 0xD7, 0x08, 0x23, 0x92, 0x07, 0x08, 0x21, 0xA0, 0xF9, 0x57, 0xE3, 0x06, 0xF5, 0xFC, 0xB2, 0x40, 0x41, 0x01, 0x82, 0x80, 0x23, 0xA6, 0xD7, 0x08, 0x23, 0xA0, 0xE7, 0x08, 0xDD, 0xB7, 0x37, 0x27, 0x00, 0x60, 0x7C, 0x4B, 0x9D, 0x8B, 0xF5, 0xFF, 0x37, 0x37, 0x00, 0x60, 0x7C, 0x4B, 0x9D, 0x8B, 0xF5, 0xFF, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0xDD, 0x37, 0xB7, 0x27, 0x00, 0x60, 0x23, 0xA6, 0x07, 0x02, 0x37, 0x07, 0x00, 0x08, 0x98, 0xC3, 0x98, 0x43, 0x7D, 0xFF, 0xC8, 0x57, 0xB2, 0x40, 0x13, 0x45, 0xF5, 0xFF, 0x05, 0x89, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0xD9, 0x3F, 0x7D, 0xDD, 0x37, 0x07, 0x00, 0x40, 0xB7, 0x27, 0x00, 0x60, 0x98, 0xC3, 0x37, 0x27, 0x00, 0x60, 0x1C, 0x43, 0xFD, 0xFF, 0xB2, 0x40, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x22, 0xC4, 0x37, 0xC4, 0xCA, 0x3F, 0x93, 0x07, 0xC4, 0x00, 0x4A, 0xC0, 0x03, 0xA9, 0x07, 0x01, 0x06, 0xC6, 0x26, 0xC2, 0x63, 0x0A, 0x09, 0x04, 0x45, 0x37, 0x39, 0xC5, 0xBD, 0x47, 0x13, 0x04, 0xC4, 0x00, 0x81, 0x44, 0x63, 0xD6, 0x27, 0x01, 0x04, 0x44, 0xBD, 0x88, 0x93, 0xB4, 0x14, 0x00, 0x7D, 0x37, 0x85, 0x3F, 0x1C, 0x44, 0x37, 0x06, 0x80, 0x00, 0x13, 0x97, 0xC7, 0x00, 0x99, 0xE0, 0x37, 0x06, 0x00, 0x01, 0xB7, 0xF6, 0xFF, 0x00, 0x75, 0x8F, 0xB7, 0x26, 0x00, 0x60, 0xD8, 0xC2, 0x90, 0xC2, 0x98, 0x42, 0x7D, 0xFF, 0x41, 0x47, 0x91, 0xE0, 0x05, 0x47, 0x33, 0x09, 0xE9, 0x40, 0xBA, 0x97, 0x23, 0x28, 0x24, 0x01, 0x1C, 0xC4, 0xB2, 0x40, 0x22, 0x44, 0x92, 0x44, 0x02, 0x49, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0x13, 0x07, 0x00, 0x0C, 0x63, 0x10, 0xE5, 0x02, 0x13, 0x05, 0xB0, 0x0D, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x80, 0xE3, 0x13, 0x05, 0xC0, 0x0D, 0xB2, 0x40, 0x41, 0x01, 0x17, 0x03, 0xC8, 0xFF, 0x67, 0x00, 0x83, 0xE2, 0x13, 0x07, 0xB0, 0x0D, 0xE3, 0x18, 0xE5, 0xFE, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x80, 0xE1, 0x13, 0x05, 0xD0, 0x0D, 0xC5, 0xB7, 0x41, 0x11, 0x22, 0xC4, 0x26, 0xC2, 0x06, 0xC6, 0x2A, 0x84, 0xB3, 0x04, 0xB5, 0x00, 0x63, 0x17, 0x94, 0x00, 0xB2, 0x40, 0x22, 0x44, 0x92, 0x44, 0x41, 0x01, 0x82, 0x80, 0x03, 0x45, 0x04, 0x00, 0x05, 0x04, 0x45, 0x37, 0xED, 0xB7, 0x13, 0x05, 0x00, 0x0C, 0x17, 0x03, 0xC8, 0xFF, 0x67, 0x00, 0x03, 0xDE, 0x75, 0x71, 0x26, 0xC3, 0xCE, 0xDE, 0xFD, 0x74, 0x85, 0x69, 0xFD, 0x72, 0x93, 0x84, 0x84, 0xFA, 0x93, 0x87, 0x09, 0x07, 0x22, 0xC5, 0x4A, 0xC1, 0xD2, 0xDC, 0xD6, 0xDA, 0xA6, 0x97, 0x06, 0xC7, 0x16, 0x91, 0xB3, 0x84, 0x27, 0x00, 0x2A, 0x89, 0x26, 0x85, 0x2E, 0x84, 0x97, 0x30, 0xC8, 0xFF, 0xE7, 0x80, 0x80, 0x93, 0x93, 0x87, 0x09, 0x07, 0x05, 0x6A, 0x8A, 0x97, 0xB3, 0x8A, 0x47, 0x41, 0x29, 0xE4, 0x05, 0x67, 0x7D, 0x75, 0x13, 0x04, 0x85, 0xF9, 0x93, 0x07, 0x07, 0x07, 0xA2, 0x97, 0x33, 0x84, 0x27, 0x00, 0x13, 0x05, 0x85, 0xFA, 0x93, 0x07, 0x07, 0x07, 0xAA, 0x97, 0xA2, 0x85, 0x33, 0x85, 0x27, 0x00, 0x97, 0x30, 0xC8, 0xFF, 0xE7, 0x80, 0x80, 0x90, 0x22, 0x85, 0xC1, 0x45, 0xB9, 0x3F, 0x01, 0x45, 0x85, 0x62, 0x16, 0x91, 0xBA, 0x40, 0x2A, 0x44, 0x9A, 0x44, 0x0A, 0x49, 0xF6, 0x59, 0x66, 0x5A, 0xD6, 0x5A, 0x49, 0x61, 0x82, 0x80, 0xA2, 0x89, 0x63, 0x73, 0x8A, 0x00, 0x85, 0x69, 0x4E, 0x86, 0xD6, 0x85, 0x4A, 0x85, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x40, 0xE2, 0x13, 0x75, 0xF5, 0x0F, 0x01, 0xED, 0x4E, 0x86, 0xD6, 0x85, 0x26, 0x85, 0x97, 0x30, 0xC8, 0xFF, 0xE7, 0x80, 0xC0, 0x8B, 0x4E, 0x99, 0x33, 0x04, 0x34, 0x41, 0x59, 0xB7, 0x13, 0x05, 0x30, 0x06, 0x55, 0xBF, 0x71, 0x71, 0xFD, 0x72, 0x4E, 0xCF, 0x52, 0xCD, 0x56, 0xCB, 0x5E, 0xC7, 0x06, 0xD7, 0x22, 0xD5, 0x26, 0xD3, 0x4A, 0xD1, 0x5A, 0xC9, 0x62, 0xC5, 0x66, 0xC3, 0x6A, 0xC1, 0xEE, 0xDE, 0xAA, 0x89, 0x16, 0x91, 0x13, 0x05, 0x00, 0x02, 0x2E, 0x8A, 0xB2, 0x8A, 0xB6, 0x8B, 0x02, 0xC2, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x40, 0x48, 0x85, 0x67, 0x63, 0xEC, 0x57, 0x11, 0x85, 0x64, 0x7D, 0x74, 0x13, 0x04, 0x84, 0xFA, 0x93, 0x87, 0x04, 0x07, 0xA2, 0x97, 0x33, 0x84, 0x27, 0x00, 0x22, 0x85, 0x97, 0x30, 0xC8, 0xFF, 0xE7, 0x80, 0x20, 0x85, 0x7D, 0x7B, 0x13, 0x0C, 0x3B, 0xF9, 0x93, 0x0C, 0x8B, 0xF9, 0x13, 0x87, 0x04, 0x07, 0x93, 0x87, 0x04, 0x07, 0x62, 0x97, 0xE6, 0x97, 0x01, 0x49, 0x33, 0x0C, 0x27, 0x00, 0xB3, 0x8C, 0x27, 0x00, 0x12, 0x4D, 0x63, 0x7B, 0x4D, 0x09, 0x63, 0x71, 0xA9, 0x03, 0x79, 0xA0, 0x7D, 0x35, 0xA6, 0x85, 0x88, 0x18, 0x49, 0x35, 0x5D, 0x35, 0x26, 0x86, 0x8C, 0x18, 0x22, 0x85, 0x97, 0x30, 0xC8, 0xFF, 0xE7, 0x80, 0x20, 0x81, 0xA6, 0x99, 0x26, 0x99, 0x63, 0x75, 0x49, 0x03, 0xB3, 0x07, 0xA9, 0x41, 0x63, 0xF1, 0x77, 0x03, 0xB3, 0x04, 0x2A, 0x41, 0x63, 0xF3, 0x9A, 0x00, 0xD6, 0x84, 0x26, 0x86, 0x8C, 0x18, 0x4E, 0x85, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xE0, 0xD3, 0x13, 0x75, 0xF5, 0x0F, 0x55, 0xDD, 0x02, 0xC4, 0x81, 0x44, 0x79, 0x5D, 0x8D, 0x4D, 0xA3, 0x01, 0x01, 0x00, 0x62, 0x85, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x60, 0xC4, 0x7D, 0xF9, 0x03, 0x45, 0x31, 0x00, 0xE6, 0x85, 0x2D, 0x31, 0x63, 0x4E, 0x05, 0x00, 0xE3, 0xE2, 0x9D, 0xFE, 0x85, 0x67, 0x93, 0x87, 0x07, 0x07, 0xA6, 0x97, 0x8A, 0x97, 0xDA, 0x97, 0x23, 0x8A, 0xA7, 0xF8, 0x85, 0x04, 0xF9, 0xB7, 0xE3, 0x16, 0xA5, 0xFD, 0x91, 0x47, 0xE3, 0x86, 0xF4, 0xF6, 0x05, 0x67, 0x7D, 0x75, 0x93, 0x07, 0x07, 0x07, 0x13, 0x04, 0x85, 0xF9, 0xA2, 0x97, 0x33, 0x84, 0x27, 0x00, 0x13, 0x05, 0x85, 0xFA, 0x93, 0x07, 0x07, 0x07, 0xAA, 0x97, 0x33, 0x85, 0x27, 0x00, 0xA2, 0x85, 0x97, 0x20, 0xC8, 0xFF, 0xE7, 0x80, 0x80, 0x77, 0xE5, 0x3B, 0x22, 0x85, 0xC1, 0x45, 0xF1, 0x33, 0xC5, 0x3B, 0x13, 0x05, 0x00, 0x02, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xE0, 0x36, 0x85, 0x62, 0x16, 0x91, 0xBA, 0x50, 0x2A, 0x54, 0x9A, 0x54, 0x0A, 0x59, 0xFA, 0x49, 0x6A, 0x4A, 0xDA, 0x4A, 0x4A, 0x4B, 0xBA, 0x4B, 0x2A, 0x4C, 0x9A, 0x4C, 0x0A, 0x4D, 0xF6, 0x5D, 0x4D, 0x61, 0x82, 0x80, 0x01, 0x11, 0x06, 0xCE, 0x22, 0xCC, 0x51, 0x31, 0x37, 0x04, 0xCE, 0x3F, 0x6C, 0x00, 0x13, 0x05, 0x44, 0xFF, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xA0, 0xCA, 0xAA, 0x87, 0x05, 0x45, 0x95, 0xE7, 0xB2, 0x47, 0x93, 0xF7, 0x07, 0x20, 0x3E, 0xC6, 0x79, 0x39, 0x37, 0x27, 0x00, 0x60, 0x1C, 0x47, 0xB7, 0x06, 0x40, 0x00, 0x13, 0x05, 0x44, 0xFF, 0xD5, 0x8F, 0x1C, 0xC7, 0xB2, 0x45, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x20, 0xC8, 0x33, 0x35, 0xA0, 0x00, 0xF2, 0x40, 0x62, 0x44, 0x05, 0x61, 0x82, 0x80, 0x41, 0x11, 0xB7, 0xC7, 0xCA, 0x3F, 0x06, 0xC6, 0x93, 0x87, 0xC7, 0x00, 0x05, 0x47, 0x23, 0x80, 0xE7, 0x00, 0x13, 0xD7, 0xC5, 0x00, 0x98, 0xC7, 0x05, 0x67, 0x7D, 0x17, 0xCC, 0xC3, 0xC8, 0xC7, 0xF9, 0x8D, 0x3A, 0x95, 0xAA, 0x95, 0xB1, 0x81, 0x8C, 0xCB, 0x23, 0xAA, 0x07, 0x00, 0x41, 0x37, 0x19, 0xC1, 0x13, 0x05, 0x50, 0x0C, 0xB2, 0x40, 0x41, 0x01, 0x82, 0x80, 0x01, 0x11, 0x22, 0xCC, 0x37, 0xC4, 0xCA, 0x3F, 0x93, 0x07, 0xC4, 0x00, 0x26, 0xCA, 0xC4, 0x47, 0x4E, 0xC6, 0x06, 0xCE, 0x4A, 0xC8, 0xAA, 0x89, 0x13, 0x04, 0xC4, 0x00, 0x63, 0xF3, 0x95, 0x00, 0xAE, 0x84, 0xA9, 0xC0, 0x03, 0x29, 0x44, 0x00, 0x26, 0x99, 0x13, 0x59, 0xC9, 0x00, 0x1C, 0x48, 0x63, 0x55, 0xF0, 0x00, 0x1C, 0x44, 0x63, 0x5E, 0xF9, 0x02, 0xE1, 0x3E, 0x7D, 0xDD, 0x48, 0x40, 0x26, 0x86, 0xCE, 0x85, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x20, 0xBB, 0x13, 0x75, 0xF5, 0x0F, 0x01, 0xC5, 0x93, 0x07, 0x40, 0x0C, 0x5C, 0xC8, 0x5C, 0x40, 0xA6, 0x97, 0x5C, 0xC0, 0x5C, 0x44, 0x85, 0x8F, 0x5C, 0xC4, 0xF2, 0x40, 0x62, 0x44, 0xD2, 0x44, 0x42, 0x49, 0xB2, 0x49, 0x05, 0x61, 0x82, 0x80, 0xDD, 0x36, 0x6D, 0xBF, 0xB7, 0x57, 0x41, 0x49, 0x19, 0x71, 0x93, 0x87, 0xF7, 0x84, 0x01, 0x45, 0x3E, 0xCE, 0x86, 0xDE, 0xA2, 0xDC, 0xA6, 0xDA, 0xCA, 0xD8, 0xCE, 0xD6, 0xD2, 0xD4, 0xD6, 0xD2, 0xDA, 0xD0, 0xDE, 0xCE, 0xE2, 0xCC, 0xE6, 0xCA, 0xEA, 0xC8, 0xEE, 0xC6, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x80, 0xAD, 0xB7, 0x47, 0xCA, 0x3F, 0x37, 0x77, 0xCB, 0x3F, 0x93, 0x87, 0x07, 0x00, 0x13, 0x07, 0x87, 0xBA, 0x63, 0xE0, 0xE7, 0x14, 0xA5, 0x39, 0x91, 0x45, 0x68, 0x08, 0xB1, 0x31, 0x85, 0x39, 0xB7, 0xF7, 0xCA, 0x3F, 0x93, 0x87, 0x87, 0xB1, 0x21, 0x67, 0x3E, 0x97, 0x23, 0x20, 0xF7, 0x08, 0xB7, 0x05, 0x38, 0x40, 0xB7, 0x07, 0x38, 0x40, 0x01, 0x46, 0x93, 0x87, 0x07, 0x0B, 0x93, 0x85, 0x05, 0x00, 0x37, 0x49, 0xCA, 0x3F, 0x15, 0x45, 0x23, 0x20, 0xF9, 0x00, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xE0, 0x1B, 0x37, 0x07, 0x00, 0x60, 0x5C, 0x47, 0x13, 0x05, 0x00, 0x02, 0xB7, 0xC4, 0xCA, 0x3F, 0x93, 0xE7, 0x17, 0x10, 0x5C, 0xC7, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xA0, 0x1A, 0xB7, 0x47, 0x00, 0x60, 0x88, 0x5F, 0x81, 0x45, 0xB7, 0x79, 0xCB, 0x3F, 0x71, 0x89, 0x61, 0x15, 0x13, 0x35, 0x15, 0x00, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xE0, 0xB0, 0xC1, 0x67, 0xFD, 0x17, 0x13, 0x07, 0x00, 0x10, 0x85, 0x66, 0x41, 0x66, 0xB7, 0x05, 0x00, 0x01, 0x01, 0x45, 0x93, 0x84, 0xC4, 0x00, 0xB7, 0x4A, 0xCA, 0x3F, 0x0D, 0x6A, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xE0, 0xAB, 0x93, 0x89, 0x89, 0xB1, 0x13, 0x09, 0x09, 0x00, 0x13, 0x8B, 0xCA, 0x00, 0x26, 0x9A, 0x83, 0xA7, 0xC9, 0x08, 0xF5, 0xDF, 0x83, 0xAB, 0xC9, 0x08, 0x85, 0x47, 0x23, 0xA6, 0x09, 0x08, 0x23, 0x02, 0xF1, 0x02, 0x83, 0xC7, 0x1B, 0x00, 0x09, 0x47, 0x23, 0x13, 0xE1, 0x02, 0xA3, 0x02, 0xF1, 0x02, 0x02, 0xD4, 0x4D, 0x47, 0x63, 0x8B, 0xE7, 0x06, 0x51, 0x47, 0x63, 0x89, 0xE7, 0x06, 0x29, 0x47, 0x63, 0x9F, 0xE7, 0x00, 0x83, 0xC7, 0x3B, 0x00, 0x03, 0xC7, 0x2B, 0x00, 0xA2, 0x07, 0xD9, 0x8F, 0x11, 0x47, 0x63, 0x96, 0xE7, 0x00, 0x83, 0xA7, 0x8B, 0x00, 0x9C, 0x43, 0x3E, 0xD4, 0x41, 0x36, 0xA1, 0x45, 0x48, 0x10, 0x91, 0x3E, 0x83, 0xC7, 0x3B, 0x00, 0x03, 0xC7, 0x2B, 0x00, 0xA2, 0x07, 0xD9, 0x8F, 0x11, 0x67, 0x41, 0x07, 0x63, 0x7E, 0xF7, 0x02, 0x13, 0x05, 0xB0, 0x0D, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x40, 0x94, 0x13, 0x05, 0xC0, 0x0D, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x80, 0x93, 0x13, 0x05, 0xE0, 0x0E, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xC0, 0x92, 0x81, 0x36, 0xBD, 0xB7, 0x23, 0xA0, 0x07, 0x00, 0x91, 0x07, 0x6D, 0xBD, 0xC9, 0x47, 0x23, 0x13, 0xF1, 0x02, 0x7D, 0xB7, 0x03, 0xC7, 0x1B, 0x00, 0xD1, 0x46, 0x63, 0xE7, 0xE6, 0x02, 0x85, 0x46, 0x63, 0xE6, 0xE6, 0x00, 0x01, 0x4C, 0x13, 0x04, 0xF0, 0x0F, 0x9D, 0xA8, 0x79, 0x17, 0x13, 0x77, 0xF7, 0x0F, 0xC9, 0x46, 0xE3, 0xE8, 0xE6, 0xFE, 0xB7, 0x76, 0xCB, 0x3F, 0x0A, 0x07, 0x93, 0x86, 0xC6, 0xBA, 0x36, 0x97, 0x18, 0x43, 0x02, 0x87, 0x93, 0x06, 0x07, 0x03, 0x93, 0xF6, 0xF6, 0x0F, 0x11, 0x46, 0xE3, 0x69, 0xD6, 0xFC, 0x13, 0x07, 0xF7, 0x02, 0x13, 0x77, 0xF7, 0x0F, 0x8D, 0x46, 0x63, 0xEE, 0xE6, 0x08, 0xB7, 0x76, 0xCB, 0x3F, 0x0A, 0x07, 0x93, 0x86, 0x86, 0xBF, 0x36, 0x97, 0x18, 0x43, 0x02, 0x87, 0x13, 0x07, 0x40, 0x02, 0x63, 0x9A, 0xE7, 0x10, 0x02, 0xD4, 0x1D, 0x44, 0x01, 0x45, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x20, 0x8A, 0x01, 0x45, 0x81, 0x3C, 0x4D, 0x3C, 0x45, 0x3C, 0xA1, 0x45, 0x48, 0x10, 0x7D, 0x14, 0x49, 0x34, 0x7D, 0xF0, 0x01, 0x4C, 0x01, 0x44, 0x13, 0x75, 0xF4, 0x0F, 0x25, 0x3C, 0x13, 0x75, 0xFC, 0x0F, 0x0D, 0x3C, 0x51, 0x3C, 0xE3, 0x11, 0x04, 0xEC, 0x83, 0xC7, 0x1B, 0x00, 0x49, 0x47, 0x63, 0x65, 0xF7, 0x30, 0x09, 0x47, 0xE3, 0x79, 0xF7, 0xEA, 0xF5, 0x17, 0x93, 0xF7, 0xF7, 0x0F, 0x3D, 0x47, 0xE3, 0x63, 0xF7, 0xEA, 0x37, 0x77, 0xCB, 0x3F, 0x8A, 0x07, 0x13, 0x07, 0x87, 0xC0, 0xBA, 0x97, 0x9C, 0x43, 0x82, 0x87, 0x05, 0x44, 0x9D, 0xEB, 0x70, 0x10, 0x81, 0x45, 0x01, 0x45, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x40, 0x89, 0x1D, 0xE1, 0xD1, 0x45, 0x68, 0x10, 0x15, 0x34, 0x01, 0x44, 0x31, 0xA8, 0x05, 0x44, 0x81, 0xEF, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xC0, 0x8D, 0x33, 0x34, 0xA0, 0x00, 0x29, 0xA0, 0x21, 0x47, 0x63, 0x85, 0xE7, 0x00, 0x05, 0x44, 0x01, 0x4C, 0x61, 0xB7, 0x03, 0xAC, 0x8B, 0x00, 0x03, 0xA4, 0xCB, 0x00, 0xB3, 0x67, 0x8C, 0x00, 0xD2, 0x07, 0xF5, 0xF7, 0x99, 0x39, 0x65, 0xF5, 0xC1, 0x6C, 0x22, 0x9C, 0xFD, 0x1C, 0x7D, 0x7D, 0x33, 0x05, 0x8C, 0x40, 0x5D, 0xDC, 0xB3, 0x77, 0x95, 0x01, 0x95, 0xE3, 0xC1, 0x6C, 0x33, 0x05, 0x8C, 0x40, 0x63, 0xE6, 0x8C, 0x02, 0xFD, 0x7C, 0x33, 0x05, 0x8C, 0x40, 0x5D, 0xD0, 0x31, 0x81, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x60, 0x8A, 0x5D, 0xF9, 0x66, 0x94, 0xF5, 0xB7, 0x31, 0x81, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x60, 0x89, 0x5D, 0xF1, 0x6A, 0x94, 0xD1, 0xB7, 0x41, 0x81, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xA0, 0x88, 0x59, 0xF9, 0x33, 0x04, 0x94, 0x41, 0xC1, 0xB7, 0x21, 0x47, 0xE3, 0x8A, 0xE7, 0xF0, 0x01, 0x4C, 0x13, 0x04, 0x00, 0x0C, 0x39, 0xB7, 0x41, 0x47, 0xCD, 0xBF, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x9D, 0xE7, 0xF6, 0x83, 0xA5, 0xCB, 0x00, 0x03, 0xA5, 0x8B, 0x00, 0x55, 0x32, 0xB9, 0xBF, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x93, 0xE7, 0xF6, 0x03, 0xA7, 0x0B, 0x01, 0x91, 0x67, 0x63, 0xE8, 0xE7, 0x1E, 0x83, 0xA5, 0x4B, 0x01, 0x03, 0xA5, 0x8B, 0x00, 0x31, 0x31, 0x81, 0xB7, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x94, 0xE7, 0xF4, 0x83, 0xA7, 0x0B, 0x01, 0x11, 0x67, 0x63, 0x69, 0xF7, 0x1C, 0x03, 0xA7, 0xCB, 0x00, 0x83, 0xA5, 0x4B, 0x01, 0x03, 0xA5, 0x8B, 0x00, 0x33, 0x84, 0xE7, 0x02, 0xDD, 0x36, 0x23, 0xAC, 0x04, 0x00, 0x23, 0x24, 0x8A, 0xB0, 0x09, 0xBF, 0x03, 0xC7, 0x04, 0x00, 0x63, 0x03, 0x07, 0x14, 0x03, 0xA7, 0x8B, 0x00, 0xC1, 0x17, 0x13, 0x04, 0x00, 0x0C, 0x63, 0x13, 0xF7, 0x00, 0xC0, 0x48, 0x01, 0x47, 0x93, 0x06, 0xF0, 0x0E, 0x63, 0x46, 0xF7, 0x02, 0x83, 0xC7, 0x5B, 0x00, 0x03, 0xC7, 0x4B, 0x00, 0x01, 0x4C, 0xA2, 0x07, 0xD9, 0x8F, 0x03, 0xC7, 0x6B, 0x00, 0x42, 0x07, 0x5D, 0x8F, 0x83, 0xC7, 0x7B, 0x00, 0xE2, 0x07, 0xD9, 0x8F, 0xE3, 0x84, 0xF6, 0xE6, 0x13, 0x04, 0x10, 0x0C, 0x85, 0xB5, 0x33, 0x86, 0xEB, 0x00, 0x03, 0x46, 0x86, 0x01, 0x05, 0x07, 0xB1, 0x8E, 0xE1, 0xB7, 0x83, 0xC7, 0x04, 0x00, 0xFD, 0xC7, 0xDC, 0x44, 0x63, 0x9D, 0x07, 0x14, 0xC0, 0x48, 0x23, 0x80, 0x04, 0x00, 0x55, 0xBD, 0x61, 0x47, 0x63, 0x96, 0xE7, 0x02, 0x83, 0xA7, 0xCB, 0x01, 0x03, 0xA7, 0x8B, 0x01, 0x83, 0xA6, 0x4B, 0x01, 0x03, 0xA6, 0x0B, 0x01, 0x83, 0xA5, 0xCB, 0x00, 0x03, 0xA5, 0x8B, 0x00, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x60, 0x79, 0x2A, 0x8C, 0x33, 0x34, 0xA0, 0x00, 0x01, 0xBD, 0x01, 0x4C, 0x05, 0x44, 0x29, 0xB5, 0x11, 0x47, 0x05, 0x44, 0xE3, 0x9D, 0xE7, 0xE6, 0xB7, 0x97, 0x00, 0x60, 0xB4, 0x43, 0x65, 0x77, 0x7D, 0x17, 0x05, 0x66, 0xF9, 0x8E, 0xD1, 0x8E, 0x03, 0xA5, 0x8B, 0x00, 0xB4, 0xC3, 0xB4, 0x47, 0x81, 0x45, 0xF9, 0x8E, 0xD1, 0x8E, 0xB4, 0xC7, 0xF4, 0x43, 0xF9, 0x8E, 0xD1, 0x8E, 0xF4, 0xC3, 0xD4, 0x5F, 0x75, 0x8F, 0x51, 0x8F, 0xD8, 0xDF, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x40, 0x77, 0x05, 0xB5, 0x13, 0xF7, 0xF7, 0x00, 0xE3, 0x17, 0x07, 0xEA, 0x93, 0xDC, 0x47, 0x00, 0x13, 0x84, 0x8B, 0x00, 0x01, 0x4C, 0x7D, 0x5D, 0xE3, 0x77, 0x9C, 0xDB, 0x48, 0x44, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xC0, 0x61, 0x18, 0x44, 0x54, 0x40, 0x10, 0x40, 0xF9, 0x8E, 0x63, 0x07, 0xA7, 0x01, 0x1C, 0x42, 0x13, 0x47, 0xF7, 0xFF, 0x7D, 0x8F, 0xD9, 0x8E, 0x14, 0xC2, 0x05, 0x0C, 0x41, 0x04, 0xD9, 0xBF, 0x11, 0x47, 0xB5, 0xB5, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x9A, 0xE7, 0xDE, 0x83, 0xA7, 0x8B, 0x00, 0x03, 0xA7, 0x4B, 0x01, 0x23, 0x24, 0xF9, 0x00, 0x23, 0x22, 0xE9, 0x00, 0xC9, 0xB3, 0x83, 0x25, 0x49, 0x00, 0xC1, 0x17, 0x91, 0xE5, 0x89, 0xCF, 0x01, 0x4C, 0x13, 0x04, 0x60, 0x0C, 0xA1, 0xBB, 0x03, 0x27, 0x89, 0x00, 0x63, 0x66, 0xF7, 0x06, 0x13, 0xF7, 0x37, 0x00, 0xE3, 0x1B, 0x07, 0xE2, 0x03, 0x28, 0x89, 0x00, 0x01, 0x46, 0x01, 0x47, 0x33, 0x05, 0xE8, 0x40, 0xB3, 0x86, 0xE5, 0x00, 0x63, 0x69, 0xF7, 0x00, 0xE3, 0x07, 0x06, 0xD2, 0x23, 0x24, 0xA9, 0x00, 0x23, 0x22, 0xD9, 0x00, 0x0D, 0xB3, 0x33, 0x86, 0xEB, 0x00, 0x10, 0x4E, 0x11, 0x07, 0x90, 0xC2, 0x05, 0x46, 0xE9, 0xBF, 0x21, 0x47, 0x05, 0x44, 0xE3, 0x94, 0xE7, 0xD8, 0x03, 0x24, 0x89, 0x00, 0x19, 0xC0, 0x13, 0x04, 0x80, 0x0C, 0x23, 0x24, 0x09, 0x00, 0x23, 0x22, 0x09, 0x00, 0x33, 0x34, 0x80, 0x00, 0xBD, 0xB3, 0x01, 0x4C, 0x13, 0x04, 0x20, 0x0C, 0xC5, 0xB9, 0x01, 0x4C, 0x13, 0x04, 0x80, 0x0C, 0xE5, 0xB1, 0x01, 0x4C, 0x13, 0x04, 0x90, 0x0C, 0xC5, 0xB1, 0x13, 0x07, 0x20, 0x0D, 0x63, 0x83, 0xE7, 0x0C, 0x13, 0x07, 0x40, 0x0D, 0xE3, 0x91, 0xE7, 0xBA, 0x03, 0xC4, 0x3B, 0x00, 0x83, 0xC7, 0x2B, 0x00, 0x22, 0x04, 0x5D, 0x8C, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x60, 0x5F, 0x03, 0xAC, 0xC4, 0x00, 0x41, 0x14, 0x63, 0x73, 0x84, 0x01, 0x22, 0x8C, 0xE3, 0x0F, 0x0C, 0xB6, 0xC0, 0x40, 0x62, 0x94, 0x31, 0x80, 0x9C, 0x48, 0x63, 0x55, 0xF0, 0x00, 0x9C, 0x44, 0x63, 0x5A, 0xF4, 0x0A, 0xEF, 0xF0, 0x8F, 0xE1, 0x75, 0xDD, 0xC8, 0x40, 0x62, 0x86, 0x93, 0x85, 0x8B, 0x01, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x60, 0x5B, 0x01, 0xC5, 0x93, 0x07, 0x40, 0x0C, 0xDC, 0xC8, 0xDC, 0x40, 0xE2, 0x97, 0xDC, 0xC0, 0xDC, 0x44, 0xB3, 0x87, 0x87, 0x41, 0xDC, 0xC4, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x40, 0x5A, 0x15, 0xBE, 0x09, 0x65, 0x13, 0x05, 0x05, 0x71, 0x03, 0xAC, 0xCB, 0x00, 0x03, 0xA4, 0x8B, 0x00, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x40, 0x4C, 0xB7, 0x07, 0x00, 0x60, 0xD8, 0x4B, 0xB7, 0x06, 0x00, 0x01, 0xC1, 0x16, 0x93, 0x57, 0x47, 0x01, 0x12, 0x07, 0x75, 0x8F, 0xBD, 0x8B, 0xD9, 0x8F, 0xB3, 0x87, 0x87, 0x03, 0x01, 0x45, 0xB3, 0xD5, 0x87, 0x02, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xE0, 0x4C, 0x13, 0x05, 0x80, 0x3E, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xE0, 0x48, 0xDD, 0xB4, 0x83, 0xA6, 0x4B, 0x01, 0x03, 0xA6, 0x0B, 0x01, 0x83, 0xA5, 0xCB, 0x00, 0x03, 0xA5, 0x8B, 0x00, 0xEF, 0xF0, 0x2F, 0xF7, 0xC1, 0xBC, 0x83, 0xC5, 0x3B, 0x00, 0x83, 0xC7, 0x2B, 0x00, 0x13, 0x85, 0x8B, 0x01, 0xA2, 0x05, 0xDD, 0x8D, 0xC1, 0x15, 0xA9, 0x3A, 0x6D, 0xBC, 0xEF, 0xF0, 0xEF, 0xDA, 0x81, 0xB7, 0x03, 0xC4, 0x3B, 0x00, 0x83, 0xC7, 0x2B, 0x00, 0x13, 0x8C, 0x8B, 0x01, 0x22, 0x04, 0x5D, 0x8C, 0xDC, 0x44, 0x41, 0x14, 0xC5, 0xE3, 0x91, 0x47, 0x85, 0x4B, 0x63, 0xFE, 0x87, 0x08, 0x93, 0x07, 0x90, 0x0C, 0xDC, 0xC8, 0x79, 0xB4, 0x03, 0xA7, 0x0D, 0x00, 0x22, 0xD0, 0x05, 0x48, 0xB3, 0x87, 0xEC, 0x40, 0x3E, 0xD6, 0x83, 0x27, 0x8A, 0xB0, 0x63, 0x73, 0xF4, 0x00, 0x0D, 0x48, 0x42, 0xC6, 0x3A, 0xC4, 0xEF, 0xF0, 0x6F, 0xD6, 0x22, 0x47, 0x32, 0x48, 0x37, 0xC5, 0xCA, 0x3F, 0xE2, 0x85, 0x7C, 0x10, 0x93, 0x86, 0xCA, 0x00, 0x10, 0x10, 0x13, 0x05, 0x45, 0x02, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xE0, 0x49, 0x37, 0xF7, 0xCA, 0x3F, 0x93, 0x08, 0xC7, 0x00, 0x82, 0x57, 0x03, 0xA7, 0x88, 0xB0, 0x83, 0xA5, 0x0D, 0x00, 0x1D, 0x8C, 0x1D, 0x8F, 0x3E, 0x9C, 0xB2, 0x57, 0x23, 0xA4, 0xE8, 0xB0, 0xAA, 0x8B, 0xBE, 0x95, 0x23, 0xA0, 0xBD, 0x00, 0x93, 0x87, 0xCA, 0x00, 0x9D, 0x8D, 0x01, 0xC5, 0xA1, 0x67, 0x63, 0x96, 0xF5, 0x00, 0x5A, 0x85, 0x5D, 0x38, 0x23, 0xA0, 0x6D, 0x01, 0x09, 0xC4, 0xDC, 0x44, 0x99, 0xC3, 0xE3, 0x40, 0x70, 0xF9, 0x63, 0xDF, 0x0B, 0x00, 0x93, 0x07, 0x70, 0x0C, 0x85, 0xBF, 0x85, 0x4B, 0xB7, 0x7D, 0xCB, 0x3F, 0xB7, 0xCC, 0xCA, 0x3F, 0x93, 0x8D, 0x8D, 0xBA, 0x93, 0x8C, 0xCC, 0x00, 0xE9, 0xBF, 0xE3, 0x95, 0x0B, 0x9E, 0xDC, 0x44, 0xE3, 0x82, 0x07, 0x9E, 0x93, 0x07, 0x80, 0x0C, 0xB1, 0xB7, 0x83, 0xA7, 0x8B, 0x00, 0xE3, 0x9B, 0x07, 0x9C, 0x01, 0x45, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xC0, 0x39, 0x09, 0x65, 0x13, 0x05, 0x05, 0x71, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x20, 0x36, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xE0, 0x39, 0x4D, 0xBA, 0x03, 0xA4, 0xCB, 0x00, 0xE3, 0x06, 0x04, 0x9A, 0x01, 0x45, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x20, 0x37, 0x13, 0x05, 0x80, 0x3E, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xA0, 0x33, 0x02, 0x94, 0x41, 0xBA, 0xF6, 0x50, 0x66, 0x54, 0xD6, 0x54, 0x46, 0x59, 0xB6, 0x59, 0x26, 0x5A, 0x96, 0x5A, 0x06, 0x5B, 0xF6, 0x4B, 0x66, 0x4C, 0xD6, 0x4C, 0x46, 0x4D, 0xB6, 0x4D, 0x09, 0x61, 0x82, 0x80
+        0x28, 0xCF, 0x5D, 0x52, 0x7D, 0x50, 0x13, 0x67, 0x1E, 0x7E, 0x37, 0x9B, 0xCD, 0x26, 0x9A, 0x1C, 0xD0, 0x45, 0xD1, 0x2B, 0xF6, 0x30, 0x6B, 0x43, 0xB5, 0x73, 0xBD, 0xD2, 0x28, 0x29, 0xD5, 0x23, 0x1B, 0xDD, 0xB0, 0x84, 0xAF, 0xA9, 0x1D, 0x39, 0x47, 0x2A, 0x2D, 0xB0, 0x27, 0x54, 0xAF, 0xCE, 0xD5, 0xB6, 0x1C, 0xC3, 0xB4, 0xB9, 0x09, 0x84, 0x25, 0x86, 0x0F, 0x11, 0x17, 0x1A, 0xE5, 0xB0, 0x87, 0x54, 0xA1, 0x50, 0xEF, 0x06, 0x88, 0xBA, 0x53, 0x5A, 0x4A, 0x02, 0x81, 0x40, 0xB0, 0x54, 0xAD, 0xE2, 0xC7, 0x81, 0x55, 0x72, 0x12, 0xB5, 0x1F, 0x62, 0x0B, 0xE4, 0xD2, 0x29, 0x72, 0xBB, 0x24, 0xF4, 0xE6, 0xFA, 0xD7, 0xEE, 0xEF, 0x7D, 0x9F, 0xF7, 0xF9, 0x3D, 0xBF, 0xDF, 0xF3, 0x40, 0x11, 0x1C, 0x0A, 0x72, 0x32, 0x06, 0xCD, 0x6D, 0x16, 0x90, 0x32, 0xA4, 0x31, 0x78, 0xB4, 0x2A, 0xCF, 0x4B, 0x2E, 0xC9, 0xA8, 0xF2, 0x3C, 0x27, 0x06, 0x39, 0xC6, 0x2C, 0x4C, 0x26, 0x03, 0x8E, 0x34, 0xEC, 0xED, 0x19, 0xAD, 0xE2, 0xD6, 0xF7, 0x44, 0x1E, 0x89, 0x7F, 0xB8, 0x11, 0xDA, 0x6A, 0xB8, 0x44, 0x76, 0x19, 0x94, 0x29, 0x48, 0x6E, 0xA9, 0xE9, 0x20, 0x61, 0x8E, 0x95, 0x01, 0xAC, 0x70, 0x36, 0xAC, 0xD4, 0x66, 0x8C, 0xF4, 0xAE, 0x26, 0x17, 0x86, 0x7B, 0x31, 0x14, 0xC8, 0xEB, 0x74, 0xED, 0x16, 0x7A, 0xD5, 0x1D, 0xC0, 0x50, 0xCC, 0x20, 0xDE, 0x84, 0x80, 0xE2, 0xCC, 0x52, 0x13, 0x42, 0xD1, 0x96, 0x29, 0x20, 0x4B, 0xA2, 0xAB, 0x07, 0x81, 0x91, 0xAF, 0xB7, 0x22, 0x18, 0xDA, 0xA1, 0xD0, 0x31, 0x74, 0xBD, 0x4F, 0x64, 0xA5, 0x1A, 0x9D, 0xB3, 0x1C, 0x2B, 0x71, 0x28, 0xE8, 0x95, 0x57, 0xC0, 0x51, 0x27, 0x86, 0x00, 0x79, 0xA9, 0x89, 0x95, 0x5C, 0x50, 0x18, 0x33, 0xE9, 0xFA, 0xAB, 0x8B, 0x27, 0x1D, 0x8A, 0x52, 0x13, 0x57, 0x38, 0xA2, 0xD5, 0x45, 0xB0, 0x0C, 0xD2, 0x2D, 0x19, 0xCC, 0xD5, 0xD2, 0x7A, 0x44, 0xC2, 0x15, 0x8D, 0x68, 0x59, 0x8B, 0xA5, 0x13, 0x6E, 0x45, 0xA5, 0xF0, 0x18, 0x25, 0x15, 0xB4, 0xB0, 0x92, 0x95, 0xA0, 0x4F, 0xE2, 0x2C, 0xC5, 0x8F, 0x5C, 0x95, 0x3E, 0x67, 0xC3, 0x41, 0x2B, 0x80, 0xAF, 0x52, 0xD2, 0xDA, 0x02, 0xD6, 0x82, 0x8A, 0xE9, 0x27, 0xFC, 0x22, 0x8D, 0xDF, 0xA3, 0xC5, 0x50, 0x4B, 0xE7, 0x89, 0x82, 0x6E, 0x1B, 0xDC, 0x82, 0x4A, 0xB9, 0xF8, 0x11, 0xED, 0x12, 0x0F, 0x5B, 0x5E, 0x7E, 0x96, 0xFE, 0xCD, 0x14, 0xC0, 0x5B, 0xDC, 0x52, 0xBC, 0xE9, 0xAA, 0x14, 0x3F, 0x82, 0x4A, 0xD7, 0x36, 0x05, 0x76, 0x7A, 0x25, 0xB3, 0x3F, 0x75, 0x11, 0x3A, 0xA8, 0xD4, 0x84, 0xB7, 0xF0, 0xA7, 0x4D, 0x3E, 0xE9, 0x04, 0xA7, 0x89, 0x05, 0x39, 0xEF, 0xA6, 0x1E, 0xAF, 0x9C, 0x5D, 0xD0, 0x68, 0x96, 0xFE, 0x4A, 0x4D, 0xBA, 0x08, 0xC9, 0xE0, 0x84, 0x86, 0xE3, 0xEF, 0xF0, 0x16, 0x54, 0xA4, 0x41, 0x81, 0xF4, 0x68, 0xFF, 0xD1, 0x6D, 0xC6, 0x85, 0xA1, 0x9D, 0x5D, 0x04, 0xA6, 0x9F, 0x5D, 0x40, 0xAC, 0x02, 0x8B, 0x80, 0xBA, 0xAE, 0x35, 0x4E, 0xF0, 0xF7, 0x84, 0x80, 0x3D, 0xDA, 0x2F, 0xB0, 0x45, 0x6F, 0x9B, 0x5F, 0x08, 0x76, 0xD1, 0x45, 0x28, 0x5D, 0x1A, 0x97, 0x47, 0xCB, 0xA2, 0x2E, 0x90, 0xE2, 0x80, 0xDB, 0x50, 0x48, 0x32, 0xA8, 0xEA, 0xA3, 0x97, 0xC9, 0xC4, 0x7A, 0x4D, 0xC2, 0x40, 0x0F, 0x85, 0x89, 0x5D, 0xA0, 0x84, 0xA4, 0xC7, 0x62, 0x21, 0x31, 0xD9, 0x73, 0x90, 0x3D, 0x13, 0x09, 0x8C, 0x1A, 0x46, 0x1B, 0x4D, 0x6A, 0x24, 0x26, 0x80, 0xD9, 0xDC, 0xE0, 0xD8, 0x2D, 0x8D, 0x04, 0x40, 0xDC, 0xDC, 0x02, 0x28, 0xAC, 0xE1, 0x54, 0x20, 0xE7, 0x5A, 0xDF, 0xE1, 0xBE, 0xA3, 0x5B, 0x8D, 0x0B, 0x3A, 0xAA, 0xF6, 0x16, 0x42, 0xA9, 0x65, 0xF7, 0x88, 0x6E, 0x1B, 0xFE, 0xD4, 0x3A, 0x28, 0xDA, 0xD5, 0x45, 0x28, 0xC9, 0x23, 0xA4, 0xC8, 0xB0, 0xA4, 0x4A, 0xF0, 0x8F, 0x0E, 0xBF, 0x23, 0x12, 0x36, 0x6E, 0x03, 0x43, 0x0B, 0x3E, 0x93, 0xC9, 0x8B, 0x21, 0x0E, 0x85, 0xA0, 0x2B, 0x0A, 0x1E, 0x5A, 0x28, 0x00, 0xE6, 0x49, 0xC1, 0x39, 0xEF, 0xAA, 0x3B, 0x8F, 0x42, 0xF7, 0xB7, 0x31, 0xE4, 0x82, 0x62, 0x80, 0x13, 0x34, 0xAB, 0xFA, 0x24, 0x83, 0x1B, 0xCA, 0xEC, 0xE2, 0xB3, 0x80, 0x8E, 0xAA, 0x03, 0x41, 0x6E, 0x81, 0x19, 0xD6, 0x8B, 0x01, 0xC2, 0x6B, 0xFF, 0x96, 0x13, 0xBC, 0x0D, 0xF2, 0xC0, 0x37, 0x0B, 0x0F, 0xA8, 0xFA, 0x47, 0x6F, 0xCE, 0xBF, 0xCD, 0xEC, 0x9D, 0x7F, 0x93, 0x2D, 0x2B, 0xFB, 0x91, 0xB5, 0xC8, 0x50, 0xE5, 0x40, 0x8A, 0xF3, 0xD2, 0xF8, 0xD8, 0x8D, 0x16, 0x9B, 0xC4, 0xBD, 0xB2, 0xD6, 0x5E, 0x16, 0x0B, 0x36, 0x58, 0x55, 0xCC, 0x33, 0x65, 0xB6, 0x67, 0x17, 0x7B, 0xB1, 0x02, 0x06, 0xD9, 0x57, 0x61, 0xB3, 0x57, 0x50, 0xBA, 0xF5, 0xFF, 0x46, 0x0A, 0x8C, 0x85, 0x98, 0x98, 0x09, 0xB0, 0x28, 0x8A, 0x36, 0xDB, 0xD4, 0x3C, 0x1A, 0x43, 0x98, 0x1F, 0x85, 0xAA, 0xDD, 0xD6, 0xCC, 0xA8, 0x99, 0x58, 0x10, 0x7A, 0x77, 0x58, 0xC9, 0x38, 0xF5, 0x1F, 0x6B, 0x21, 0x3D, 0x93, 0xB7, 0xB2, 0xB6, 0x9B, 0xD8, 0x40, 0x36, 0x90, 0xCB, 0x0C, 0x73, 0xBB, 0xF2, 0xB3, 0xC6, 0xB2, 0x0C, 0x7C, 0x92, 0x9B, 0xAD, 0xF4, 0x5B, 0x15, 0x80, 0xD9, 0x9B, 0x51, 0x3E, 0xC6, 0xA4, 0x30, 0xC1, 0xB9, 0x88, 0x49, 0x21, 0x4D, 0xD0, 0xB7, 0xC2, 0x99, 0x8A, 0x09, 0xF2, 0x38, 0x2A, 0x33, 0x8E, 0xA9, 0xC5, 0x1B, 0x75, 0xBB, 0xF8, 0x39, 0x9E, 0x95, 0x64, 0xF6, 0x1E, 0x38, 0x30, 0xFF, 0x66, 0xC6, 0x17, 0x2F, 0x7D, 0xFE, 0x87, 0x91, 0x57, 0xDC, 0x92, 0xAB, 0xCA, 0x2B, 0xAA, 0x2F, 0x53, 0x2E, 0x66, 0x0D, 0xE7, 0x0D, 0xE4, 0xF7, 0xEF, 0x73, 0x7E, 0x77, 0xB3, 0xDD, 0xBA, 0xB2, 0x96, 0x9F, 0x57, 0xF4, 0x4C, 0x45, 0x57, 0xC5, 0xB9, 0x4A, 0x51, 0x5F, 0x88, 0x37, 0x99, 0x29, 0xA0, 0xBF, 0xD9, 0x19, 0xC1, 0xFC, 0xD1, 0xF8, 0x36, 0x26, 0x16, 0xA6, 0x16, 0x87, 0xB4, 0x2B, 0x43, 0x5D, 0x62, 0x18, 0xE3, 0x3B, 0x98, 0x7C, 0x73, 0x80, 0x95, 0x57, 0x06, 0x30, 0xFE, 0x56, 0x40, 0xE4, 0xD9, 0xA6, 0x6C, 0x90, 0x41, 0x2D, 0x8F, 0x05, 0xF6, 0xAA, 0x58, 0xF0, 0x58, 0x3A, 0xFD, 0x4E, 0xBA, 0x8C, 0x3E, 0xD0, 0x06, 0x17, 0x37, 0x19, 0x37, 0xB5, 0x30, 0x07, 0x57, 0x19, 0x36, 0x65, 0x6F, 0x52, 0x95, 0x57, 0xAD, 0xFA, 0x99, 0xA3, 0xA4, 0xE5, 0x98, 0xEA, 0x18, 0x5D, 0x68, 0x80, 0xED, 0x68, 0x9B, 0x8E, 0x7E, 0x58, 0x04, 0xDB, 0xC5, 0x1B, 0x74, 0xF4, 0x0F, 0x0D, 0x60, 0xAC, 0x4C, 0xC0, 0x65, 0x84, 0xA6, 0xBC, 0xF5, 0xA5, 0x30, 0x65, 0xE6, 0x84, 0xC8, 0x55, 0x42, 0x16, 0x67, 0x57, 0xA7, 0x7F, 0x00, 0x41, 0x20, 0x2F, 0x74, 0x97, 0xE3, 0x32, 0x06, 0x60, 0x7D, 0x1C, 0x98, 0x62, 0x7E, 0x1B, 0x47, 0x67, 0x20, 0xC0, 0x3B, 0x79, 0xFC, 0x11, 0x53, 0xC0, 0x5A, 0x50, 0xB4, 0xC5, 0x56, 0x61, 0xBB, 0x61, 0xC3, 0x2B, 0x5A, 0xFF, 0xC3, 0x88, 0x03, 0x9C, 0x77, 0xE5, 0xA9, 0xF9, 0x5A, 0xCA, 0x5B, 0x3E, 0x33, 0x27, 0xF8, 0x21, 0x6C, 0x5F, 0xF0, 0xE4, 0x97, 0x7E, 0x08, 0x6E, 0x34, 0x33, 0xB6, 0x98, 0x45, 0x3F, 0x8A, 0xEE, 0x6C, 0x16, 0x1C, 0x79, 0xA8, 0x1E, 0xD8, 0x2C, 0x6C, 0x28, 0xA4, 0x25, 0x7E, 0xD1, 0x9D, 0x17, 0x37, 0xEC, 0x68, 0xD8, 0xB1, 0x6C, 0xD7, 0x8F, 0x86, 0x7D, 0x29, 0x37, 0x52, 0x52, 0x52, 0xBB, 0x53, 0x37, 0xA4, 0x35, 0xA4, 0x2D, 0x4B, 0x9F, 0xCB, 0x4E, 0xE7, 0x9D, 0x82, 0x22, 0x24, 0xA3, 0xCA, 0xF3, 0xDB, 0xE3, 0x34, 0xE2, 0x51, 0xED, 0xEB, 0x3C, 0x3B, 0xB9, 0x10, 0x7C, 0xDB, 0xE4, 0x69, 0xB7, 0x20, 0xFA, 0x7A, 0x5F, 0x17, 0xC5, 0xFA, 0xD1, 0x98, 0xC4, 0xC1, 0xE2, 0x04, 0x4D, 0x2C, 0xC8, 0x89, 0xA6, 0x38, 0x09, 0xB1, 0x88, 0xBA, 0x52, 0x13, 0xED, 0xEE, 0xD2, 0x07, 0xB1, 0x31, 0x43, 0xEA, 0x4D, 0x4D, 0xE0, 0x7B, 0x22, 0x8F, 0x44, 0x72, 0x85, 0xD4, 0x73, 0x6E, 0x8F, 0x56, 0x32, 0xC8, 0x5A, 0xDC, 0x00, 0xA1, 0x70, 0x93, 0x0F, 0x60, 0x57, 0x07, 0xC0, 0x51, 0x37, 0x3F, 0x4B, 0xD4, 0xF9, 0xFE, 0x21, 0x77, 0xA0, 0xFA, 0x85, 0xFA, 0xF6, 0xFA, 0xCE, 0x92, 0xAA, 0x11, 0xBC, 0x1D, 0x05, 0x3A, 0xCD, 0x6A, 0x27, 0x86, 0xBC, 0x28, 0xEF, 0x22, 0x84, 0x5C, 0x43, 0x11, 0xCA, 0xF3, 0x1A, 0x97, 0x47, 0xCB, 0xA2, 0x2E, 0xA0, 0xF2, 0xB8, 0xA8, 0x8C, 0x41, 0xC9, 0x68, 0xCA, 0x50, 0xBB, 0x15, 0x13, 0xBB, 0x00, 0xFD, 0x43, 0x3D, 0xF8, 0x67, 0x59, 0x9B, 0x03, 0x5E, 0x4F, 0x02, 0xD5, 0x31, 0x6C, 0xD7, 0x30, 0x88, 0x4E, 0xA6, 0x33, 0xA7, 0x41, 0x34, 0x49, 0xBF, 0x12, 0x10, 0xDD, 0x4E, 0x34, 0x4E, 0x24, 0x13, 0xAA, 0xF2, 0xD1, 0xD0, 0xAE, 0x63, 0x3E, 0x59, 0x4C, 0xDB, 0x00, 0x8B, 0x12, 0xF2, 0xDD, 0x43, 0xBB, 0x89, 0x16, 0xDB, 0x6E, 0xC7, 0x6E, 0x92, 0xA9, 0xD9, 0xED, 0x12, 0x74, 0x5E, 0x22, 0xB7, 0x1A, 0xBA, 0x0C, 0x82, 0xDA, 0x89, 0xF8, 0xFD, 0xBD, 0xDC, 0x4E, 0x9D, 0x61, 0xF5, 0x01, 0xD6, 0xE2, 0x2F, 0x83, 0xF4, 0x89, 0xA3, 0xE5, 0x37, 0x9B, 0xC7, 0x5B, 0x6E, 0x78, 0xAE, 0x8D, 0x8E, 0x5D, 0xBA, 0x3C, 0x76, 0xE9, 0xC6, 0x85, 0x9B, 0xA3, 0x93, 0xE7, 0xA7, 0x3C, 0xF7, 0x87, 0xBE, 0x1B, 0x0C, 0x32, 0x9B, 0xFE, 0xC1, 0x51, 0x1E, 0xAD, 0xA6, 0x68, 0x44, 0xCB, 0x3B, 0x07, 0x30, 0xD4, 0xD2, 0x4D, 0xDF, 0xF2, 0x45, 0x9E, 0x4A, 0xA8, 0xD5, 0xBF, 0x26, 0xED, 0x8C, 0x63, 0x12, 0x38, 0x3F, 0xAF, 0xDF, 0x62, 0xE9, 0x5C, 0x5B, 0x90, 0x68, 0xC3, 0x63, 0xFC, 0x52, 0x0E, 0x79, 0x9E, 0xE0, 0xD0, 0xE7, 0x09, 0x28, 0x89, 0xC7, 0x2F, 0x67, 0x19, 0x04, 0x68, 0x0C, 0x1E, 0xED, 0x0A, 0x3D, 0x1E, 0x13, 0x00, 0x21, 0x9F, 0x1E, 0xD7, 0xA0, 0x20, 0x67, 0x37, 0x25, 0x38, 0xC7, 0x09, 0xD3, 0xFB, 0xA2, 0xC2, 0x77, 0xBB, 0x43, 0x3E, 0xFC, 0x9A, 0xA3, 0x40, 0xCE, 0xC1, 0x57, 0x4B, 0xF4, 0x5C, 0xF1, 0x88, 0xF6, 0x80, 0x35, 0x77, 0x05, 0xB6, 0x69, 0xC5, 0xD2, 0xBB, 0x0E, 0x67, 0xC1, 0x7C, 0x14, 0x86, 0x82, 0x70, 0x26, 0x5F, 0x97, 0xCF, 0x21, 0x00, 0x82, 0xF4, 0x6C, 0x99, 0x0B, 0x70, 0x29, 0x1E, 0xAD, 0x62, 0x5F, 0x08, 0xF3, 0x11, 0x6B, 0xB5, 0x76, 0x62, 0x32, 0x19, 0xC0, 0x2A, 0x3D, 0x40, 0xD5, 0x60, 0x6E, 0x1D, 0x96, 0xCE, 0x7E, 0x65, 0xFE, 0x68, 0x58, 0xCA, 0x50, 0x78, 0x8B, 0x4C, 0x8A, 0x8B, 0x1E, 0x8A, 0xCC, 0xEE, 0xC7, 0x81, 0x8C, 0xC2, 0xB1, 0xDB, 0xA2, 0x0F, 0xF8, 0x4A, 0x74, 0x39, 0x9D, 0xA2, 0x2B, 0x7D, 0x92, 0xED, 0x14, 0x6D, 0xF5, 0x49, 0xD6, 0x53, 0xF4, 0xDF, 0x7D, 0xC0, 0xEC, 0xDE, 0x0C, 0x60, 0xF7, 0xD3, 0xA0, 0x19, 0xBD, 0x5E, 0x13, 0x41, 0xD1, 0xEF, 0xF1, 0x27, 0xAD, 0x95, 0xA0, 0x71, 0x5B, 0xE2, 0x65, 0x5D, 0xFC, 0x09, 0x7D, 0x72, 0x78, 0x6D, 0xE2, 0xFF, 0x21, 0x0A, 0x74, 0x28, 0xFD, 0x57, 0xBF, 0x08, 0x43, 0x3A, 0x14, 0x41, 0x15, 0x44, 0x1D, 0x86, 0x38, 0x42, 0xFF, 0x26, 0x16, 0x43, 0x6E, 0xFD, 0x2A, 0xF8, 0xEF, 0x38, 0x52, 0x12, 0xDF, 0xC3, 0xE1, 0x4D, 0x28, 0xA8, 0x45, 0xF7, 0xF7, 0x0C, 0xF3, 0x1A, 0x1E, 0x8A, 0x8C, 0x1C, 0xCC, 0xEB, 0xB9, 0x98, 0x44, 0xFB, 0xA6, 0x44, 0x4C, 0x12, 0x3D, 0x35, 0x05, 0xA0, 0x34, 0x4C, 0x3C, 0x1D, 0x76, 0xFC, 0xC3, 0xE2, 0x28, 0xAC, 0xC8, 0x1F, 0x36, 0x9C, 0xE4, 0xBD, 0x3B, 0xF5, 0x88, 0xFB, 0xCB, 0x88, 0x76, 0x19, 0xCA, 0x96, 0x0F, 0x76, 0xC7, 0xDB, 0x56, 0x6D, 0x13, 0x59, 0x58, 0x09, 0x0A, 0xB3, 0x73, 0x73, 0x61, 0x11, 0x49, 0xDE, 0xBD, 0x63, 0x3F, 0x61, 0x28, 0xDF, 0x9D, 0xC7, 0x56, 0x27, 0xD1, 0xDF, 0x4D, 0x49, 0x97, 0xB0, 0xE5, 0xBD, 0x41, 0x2C, 0x86, 0x12, 0x22, 0xBA, 0xC1, 0x17, 0x2E, 0xBA, 0xBC, 0x86, 0x84, 0x96, 0x32, 0x5C, 0x01, 0xE9, 0x4B, 0xB6, 0xA4, 0x6F, 0xD1, 0x6F, 0x11, 0xE6, 0x31, 0x46, 0x1A, 0x36, 0x1A, 0xA7, 0xA1, 0x34, 0x88, 0xC4, 0x0A, 0x67, 0xC2, 0x9E, 0xDC, 0x82, 0x15, 0xFE, 0x14, 0xA6, 0xD8, 0xB2, 0x7D, 0x8B, 0x37, 0x42, 0xFC, 0x8D, 0xB0, 0x2D, 0x03, 0x45, 0xEF, 0xF1, 0x3F, 0x2B, 0xA3, 0xBC, 0xC5, 0xFE, 0xFB, 0xB3, 0x51, 0xAC, 0xDF, 0x1F, 0xF6, 0x7B, 0xCA, 0x4B, 0xFB, 0xEF, 0x0B, 0xA9, 0xA8, 0x40, 0xF9, 0x4C, 0x38, 0xBA, 0x6D, 0x8D, 0xDB, 0x4A, 0x2D, 0x08, 0x79, 0xFC, 0xEB, 0x37, 0xC2, 0x4B, 0xF4, 0x4B, 0x5D, 0x08, 0xEB, 0x9A, 0xDB, 0x17, 0xF5, 0xAF, 0x85, 0xAF, 0xD8, 0x08, 0x91, 0x71, 0x1F, 0x22, 0x64, 0xC9, 0x83, 0xD0, 0x1E, 0xAA, 0xD5, 0x1B, 0x9B, 0xC0, 0xFA, 0xA6, 0xB5, 0x14, 0xCD, 0xF8, 0x00, 0x42, 0x42, 0x69, 0xB9, 0x1C, 0x7C, 0xBA, 0x12, 0xC0, 0x27, 0x47, 0x80, 0xBD, 0xA0, 0x0A, 0x5C, 0x42, 0x67, 0xFD, 0xC7, 0x12, 0xF6, 0xCC, 0x3A, 0x5F, 0x57, 0x36, 0xCE, 0x47, 0x1B, 0x8D, 0x6A, 0xA4, 0x8A, 0xC8, 0x1E, 0xB7, 0x17, 0xD5, 0x43, 0xF5, 0x5E, 0xE7, 0xEB, 0x42, 0x45, 0x4F, 0x55, 0x89, 0xE6, 0xDF, 0x5D, 0x3C, 0xBF, 0x10, 0x57, 0x12, 0x64, 0xCD, 0xA9, 0xC8, 0x0E, 0xE4, 0xD7, 0xCD, 0x72, 0x3F, 0xD7, 0xD6, 0xEC, 0x87, 0xFB, 0xEA, 0x2E, 0x72, 0xBA, 0x50, 0xDD, 0x74, 0x70, 0x57, 0x40, 0x2D, 0xAE, 0xD3, 0x39, 0xB9, 0xB5, 0x94, 0xB7, 0xC2, 0x37, 0x2D, 0xEC, 0x19, 0xC8, 0x13, 0x38, 0x1D, 0xF5, 0x79, 0xAF, 0x8E, 0x42, 0x48, 0xEF, 0x71, 0xDF, 0x9C, 0xF9, 0xD4, 0x08, 0x80, 0x4F, 0x55, 0x82, 0xCC, 0xE7, 0x3E, 0x0E, 0x9E, 0xB1, 0xBE, 0x39, 0xB8, 0x75, 0x39, 0x54, 0x5B, 0x40, 0xDF, 0xF5, 0x3D, 0x61, 0x3E, 0x95, 0x0A, 0x09, 0xB7, 0x71, 0x71, 0x25, 0xDC, 0xE2, 0x6D, 0x9D, 0x6F, 0xC6, 0xCC, 0xDF, 0x46, 0x14, 0xD0, 0x7B, 0xFD, 0xD1, 0x70, 0xEB, 0x08, 0x58, 0x42, 0xA8, 0xCB, 0x7C, 0xA2, 0x89, 0x78, 0xFC, 0xB4, 0x18, 0xE0, 0xEB, 0x2A, 0x3A, 0x64, 0xBD, 0xB0, 0x5B, 0x0C, 0x68, 0x18, 0x8D, 0x84, 0xF9, 0x1C, 0x39, 0xA3, 0x84, 0xBE, 0x34, 0xE6, 0x07, 0x8E, 0x64, 0x88, 0x62, 0x25, 0xD3, 0xBF, 0xA2, 0x93, 0xFC, 0x7C, 0x2A, 0x5F, 0xE6, 0x13, 0x95, 0xCA, 0xBB, 0x2F, 0x64, 0x0A, 0x76, 0xFF, 0x09, 0x6C, 0x45, 0xB3, 0x6B, 0xCC, 0xEE, 0x77, 0xC0, 0x24, 0x5F, 0x7B, 0xCB, 0xE6, 0xA6, 0x30, 0x71, 0xB8, 0x9C, 0x39, 0xAB, 0x2E, 0xFF, 0x1A, 0xC0, 0x49, 0xE5, 0x10, 0x82, 0x76, 0x1E, 0xBA, 0xCD, 0x99, 0x79, 0xDE, 0x79, 0xF7, 0x38, 0x49, 0x1F, 0x47, 0x23, 0x1D, 0xC9, 0xB8, 0x49, 0x0C, 0x32, 0x7B, 0x72, 0x85, 0xC4, 0x8A, 0xCC, 0xAD, 0x23, 0x10, 0xDF, 0x0D, 0x32, 0xB7, 0xF0, 0x8A, 0x5A, 0x96, 0x43, 0x4B, 0x93, 0xD9, 0xA6, 0xDD, 0xC2, 0x6E, 0x8A, 0x37, 0x54, 0x09, 0x1E, 0x40, 0x3D, 0x50, 0x1A, 0x42, 0xAE, 0x3F, 0x1B, 0x11, 0x9C, 0x7F, 0x8A, 0xB3, 0x81, 0x9C, 0x33, 0xDB, 0xF6, 0x14, 0x19, 0xA3, 0x90, 0xFC, 0xC0, 0xA1, 0x8B, 0x87, 0x84, 0x17, 0x67, 0xFA, 0xCF, 0x50, 0x25, 0x7A, 0xA1, 0x3A, 0xE3, 0x9E, 0xD9, 0x26, 0x7C, 0x67, 0xFA, 0x2F, 0xBF, 0x5A, 0x58, 0xB3, 0xBD, 0xE6, 0xDA, 0x57, 0x41, 0x36, 0xA2, 0x08, 0x39, 0x8B, 0xF9, 0xFD, 0xC0, 0x1B, 0x85, 0xDE, 0x67, 0xC7, 0x29, 0x80, 0x95, 0x55, 0xF2, 0x73, 0x18, 0xB3, 0xBD, 0x45, 0x8D, 0xFF, 0x4A, 0x26, 0x83, 0x18, 0x47, 0xEE, 0x2A, 0x72, 0x07, 0x11, 0x4E, 0x04, 0x0E, 0xD1, 0x68, 0x2B, 0x14, 0xBD, 0x15, 0xA3, 0xFC, 0x0B, 0xC6, 0x9A, 0xEB, 0x87, 0x22, 0xFB, 0x10, 0xB9, 0x4E, 0x7C, 0xBD, 0x37, 0x82, 0x3A, 0x7B, 0x76, 0x71, 0xA7, 0x0D, 0xBE, 0x9B, 0x66, 0x7E, 0x4B, 0x70, 0x6B, 0x2A, 0x84, 0xAF, 0x0B, 0x00, 0x5C, 0x79, 0x0F, 0x0C, 0xDB, 0xCD, 0x4F, 0x1A, 0xF8, 0xBD, 0xD5, 0xDE, 0xB1, 0x7E, 0x21, 0xB8, 0x96, 0x23, 0x3F, 0xF1, 0x09, 0x1C, 0x6B, 0x05, 0x74, 0xBE, 0x5F, 0x82, 0xF9, 0x35, 0xC0, 0xFB, 0x38, 0x3A, 0x09, 0x3F, 0x65, 0x05, 0x50, 0x12, 0x44, 0xA9, 0x91, 0xBB, 0x84, 0xBD, 0xFC, 0x0E, 0xE0, 0x1D, 0x01, 0x5E, 0x54, 0x72, 0x09, 0x5F, 0xD7, 0xC6, 0x73, 0x5C, 0x07, 0x0A, 0xBB, 0xB0, 0xB9, 0xF0, 0x8C, 0x08, 0xF4, 0x70, 0x1F, 0x92, 0x74, 0xAF, 0x77, 0x6D, 0xD0, 0xBF, 0x6B, 0xF0, 0x3A, 0x2B, 0x58, 0xED, 0xC0, 0xC4, 0x26, 0x39, 0xBE, 0x4E, 0xC6, 0x23, 0x65, 0x40, 0xBD, 0xD1, 0x04, 0x7A, 0xEC, 0x42, 0x9F, 0x18, 0xF9, 0xC0, 0xC7, 0xC2, 0xD7, 0x24, 0xBF, 0xD3, 0x29, 0x7C, 0x0F, 0xCB, 0x07, 0x3A, 0x31, 0x34, 0x46, 0x41, 0x9B, 0x7D, 0x72, 0x0C, 0x25, 0x14, 0xDE, 0x5A, 0x5F, 0x37, 0xEC, 0xDA, 0x0C, 0xCC, 0xEE, 0xA7, 0x81, 0x52, 0x9C, 0x5D, 0x15, 0xDA, 0xED, 0xAB, 0xF0, 0x69, 0x17, 0xD0, 0x45, 0xD2, 0x6F, 0x95, 0x41, 0xCA, 0x2A, 0x6F, 0x98, 0xFC, 0x9C, 0x83, 0xC8, 0xAB, 0x8B, 0x33, 0x35, 0x26, 0xD3, 0x99, 0xD3, 0xA0, 0x91, 0xA4, 0xB3, 0x66, 0x96, 0x3D, 0x98, 0xAE, 0xB9, 0x5D, 0x38, 0x31, 0x44, 0xE4, 0x95, 0xB3, 0x4C, 0x25, 0x14, 0x7A, 0xF7, 0x32, 0x34, 0xC0, 0xA2, 0x84, 0x7C, 0x7C, 0x68, 0x9C, 0x98, 0xB4, 0x8D, 0x3B, 0xC6, 0x49, 0xBB, 0xC5, 0xA2, 0x1B, 0x77, 0x85, 0x76, 0x9C, 0xB5, 0xE2, 0x33, 0xD9, 0x1E, 0x0C, 0x41, 0x0E, 0xC0, 0xA7, 0x79, 0x27, 0x4F, 0x2E, 0x39, 0x49, 0xA4, 0x71, 0x28, 0xC8, 0xB9, 0x96, 0xCA, 0x49, 0x00, 0xE4, 0x5C, 0xC9, 0xEE, 0xA4, 0xA0, 0xC7, 0xD0, 0xC2, 0x9A, 0x9E, 0xCA, 0xEB, 0x35, 0xFC, 0x6B, 0x18, 0xD2, 0xDB, 0xAF, 0x58, 0x44, 0x41, 0xE4, 0xAD, 0x34, 0x0C, 0x31, 0x25, 0x86, 0xFE, 0x93, 0x27, 0xCE, 0xFC, 0x32, 0x19, 0x0F, 0xA6, 0x7F, 0xE7, 0x77, 0x7E, 0x6A, 0x1E, 0x08, 0xCE, 0x83, 0xF1, 0xBA, 0x9A, 0x91, 0x89, 0x6A, 0xE7, 0x8A, 0xB6, 0x17, 0xF6, 0x7F, 0xFA, 0x60, 0xFA, 0xC1, 0x8D, 0x12, 0x6E, 0x69, 0x56, 0xAC, 0xAA, 0x12, 0x12, 0xE6, 0x1D, 0x27, 0x75, 0x91, 0x03, 0xDE, 0x5A, 0x8A, 0x49, 0xA5, 0x1F, 0x59, 0xA4, 0x2C, 0x7A, 0x98, 0xD7, 0x5E, 0x7C, 0x06, 0x6E, 0x55, 0x00, 0xE5, 0x05, 0x24, 0xD9, 0x6E, 0xF9, 0x86, 0x48, 0x1C, 0x33, 0xC7, 0x56, 0x74, 0xD0, 0x6F, 0xCD, 0x00, 0x45, 0xF2, 0xD6, 0xC1, 0x17, 0x5C, 0x0F, 0xA6, 0xFF, 0x3C, 0xA6, 0xA4, 0x9E, 0x4B, 0xD6, 0x0C, 0x78, 0xB4, 0x93, 0xCC, 0xBB, 0xE1, 0x6C, 0xB9, 0x07, 0x84, 0x87, 0x63, 0x88, 0x7E, 0x49, 0xA3, 0x41, 0xE3, 0xF7, 0x68, 0x59, 0xA9, 0x1B, 0x94, 0xEE, 0x84, 0x5B, 0x0F, 0x76, 0x98, 0x4F, 0x29, 0xC0, 0x9A, 0xAA, 0x35, 0x35, 0x89, 0x8D, 0x5D, 0x3B, 0xF1, 0x93, 0x77, 0x3B, 0xDA, 0x2B, 0x3F, 0xAB, 0xC7, 0x9B, 0x7A, 0x00, 0x6B, 0xF1, 0x80, 0xE3, 0xD5, 0xD0, 0xC0, 0x89, 0x02, 0xFA, 0xBD, 0x59, 0x90, 0xC5, 0x64, 0x3F, 0x8F, 0x37, 0xED, 0x87, 0x64, 0xAE, 0x71, 0xF2, 0x58, 0xBF, 0x97, 0x78, 0x23, 0x40, 0x7F, 0xB5, 0x1C, 0xB0, 0xE8, 0x1B, 0x72, 0xA6, 0x97, 0x49, 0xE5, 0x8C, 0x23, 0x5A, 0xEE, 0x3C, 0xCF, 0x5A, 0x5D, 0xDD, 0xCD, 0x56, 0x9D, 0x07, 0xF7, 0x7A, 0xBD, 0xF5, 0xCB, 0xDF, 0x1F, 0x27, 0xBD, 0xA5, 0xE8, 0xFB, 0x2C, 0x6A, 0x92, 0x77, 0x72, 0x42, 0xDE, 0xBC, 0x7F, 0x43, 0x1B, 0x21, 0x7D, 0x28, 0xAB, 0x09, 0xC1, 0x4D, 0x07, 0xAB, 0x98, 0xF8, 0x90, 0xB6, 0x84, 0xF4, 0x6E, 0xF8, 0xE4, 0x08, 0xF0, 0x4A, 0xC4, 0x0D, 0x4B, 0xC8, 0x18, 0xCD, 0xFF, 0x76, 0xDA, 0xA4, 0x16, 0xD5, 0xE9, 0xBA, 0xE7, 0x5E, 0xCC, 0xDF, 0x31, 0xB6, 0x23, 0x69, 0xD7, 0xB9, 0x5D, 0xAA, 0xAC, 0xF7, 0xB2, 0x24, 0x2F, 0xCF, 0xA5, 0xE6, 0xA7, 0x8D, 0xA5, 0x25, 0xA5, 0x9F, 0x4B, 0x97, 0xE5, 0x96, 0x9A, 0xFE, 0x0B, 0x5F, 0x99, 0xA0, 0xC9
     },
+    .text_zlen = 2805,
     .text_len = 3380,
     .data = (uint8_t const[]){
-        0x0C, 0x40, 0xCA, 0x3F, 0xE0, 0x08, 0x38, 0x40, 0x2C, 0x09, 0x38, 0x40, 0x84, 0x09, 0x38, 0x40, 0x52, 0x0A, 0x38, 0x40, 0xBE, 0x0A, 0x38, 0x40, 0x6C, 0x0A, 0x38, 0x40, 0xA8, 0x07, 0x38, 0x40, 0x0E, 0x0A, 0x38, 0x40, 0x4E, 0x0A, 0x38, 0x40, 0x98, 0x09, 0x38, 0x40, 0x58, 0x07, 0x38, 0x40, 0xCC, 0x09, 0x38, 0x40, 0x58, 0x07, 0x38, 0x40, 0xBA, 0x08, 0x38, 0x40, 0xFE, 0x08, 0x38, 0x40, 0x2C, 0x09, 0x38, 0x40, 0x84, 0x09, 0x38, 0x40, 0xCC, 0x08, 0x38, 0x40, 0x12, 0x08, 0x38, 0x40, 0x42, 0x08, 0x38, 0x40, 0xC8, 0x08, 0x38, 0x40, 0x16, 0x0D, 0x38, 0x40, 0x2C, 0x09, 0x38, 0x40, 0xD6, 0x0B, 0x38, 0x40, 0xCA, 0x0C, 0x38, 0x40, 0xA4, 0x06, 0x38, 0x40, 0xF4, 0x0C, 0x38, 0x40, 0xA4, 0x06, 0x38, 0x40, 0xA4, 0x06, 0x38, 0x40, 0xA4, 0x06, 0x38, 0x40, 0xA4, 0x06, 0x38, 0x40, 0xA4, 0x06, 0x38, 0x40, 0xA4, 0x06, 0x38, 0x40, 0xA4, 0x06, 0x38, 0x40, 0xA4, 0x06, 0x38, 0x40, 0x72, 0x0B, 0x38, 0x40, 0xA4, 0x06, 0x38, 0x40, 0xF2, 0x0B, 0x38, 0x40, 0xCA, 0x0C, 0x38, 0x40
+        0x28, 0xCF, 0xE3, 0x71, 0x38, 0x65, 0xFF, 0x80, 0xC3, 0xC2, 0x41, 0x87, 0xD3, 0xC2, 0xA1, 0x05, 0x88, 0x83, 0xB8, 0x2C, 0x1C, 0xF6, 0x01, 0x71, 0x0E, 0x10, 0xAF, 0x60, 0xB7, 0x70, 0xE0, 0x03, 0xD2, 0x7E, 0x40, 0x3C, 0x03, 0x28, 0x17, 0x01, 0xE4, 0x9F, 0x81, 0xD2, 0xBB, 0x80, 0x7A, 0xFE, 0x21, 0xE9, 0x3B, 0x03, 0x64, 0x0B, 0x01, 0xB1, 0x13, 0x10, 0x9F, 0x00, 0x62, 0x31, 0x5E, 0x88, 0xDC, 0x35, 0x6E, 0x0B, 0x87, 0x53, 0x3C, 0x16, 0x0E, 0x4B, 0xD8, 0x2C, 0x1C, 0xBE, 0x40, 0x69, 0x7C, 0xB8, 0x88, 0x1B, 0x42, 0x7F, 0x82, 0xEA, 0x03, 0x00, 0x12, 0xCE, 0x2A, 0xCA
     },
+    .data_zlen = 94,
     .data_len = 160,
     .text_start = 0x40380000,
     .data_start = 0x3FCB6BA8,
@@ -1,17 +1,20 @@
 // WARNING: This is a generated file, do not edit it!
 // clang-format off
 // Generated from esp-idf-tools/python_env/idf5.3_py3.12_env/lib/python3.12/site-packages/esptool/targets/stub_flasher/stub_flasher_32c3.json
+// The text and data segments are zlib streams with a 1024 byte window
 
 #include "chips.h"
 
 et2_stub_t const stub_esp32c3 = {
     .text = (uint8_t const[]){
-        0x41, 0x11, 0x22, 0xC4, 0x26, 0xC2, 0x06, 0xC6, 0xB7, 0x37, 0x04, 0x60, 0x11, 0x47, 0x37, 0x44, 0xC8, 0x3F, 0xD8, 0xCB, 0xB7, 0x34, 0x04, 0x60, 0x13, 0x04, 0x04, 0x00, 0xDC, 0x40, 0x91, 0x8B, 0x91, 0xE7, 0xB2, 0x40, 0x22, 0x44, 0x92, 0x44, 0x41, 0x01, 0x82, 0x80, 0x88, 0x40, 0x1C, 0x40, 0x13, 0x75, 0xF5, 0x0F, 0x82, 0x97, 0xDD, 0xB7, 0x01, 0x11, 0xB7, 0x07, 0x00, 0x60, 0x4E, 0xC6, 0x83, 0xA9, 0x87, 0x00, 0x4A, 0xC8, 0x37, 0x49, 0xC8, 0x3F, 0x26, 0xCA, 0x52, 0xC4, 0x06, 0xCE, 0x22, 0xCC, 0xB7, 0x04, 0x00, 0x60, 0x7D, 0x5A, 0x13, 0x09, 0x09, 0x00, 0xC0, 0x4C, 0x13, 0x74, 0xF4, 0x3F, 0x0D, 0xE0, 0xF2, 0x40, 0x62, 0x44, 0x23, 0xA8, 0x34, 0x01, 0x42, 0x49, 0xD2, 0x44, 0xB2, 0x49, 0x22, 0x4A, 0x05, 0x61, 0x82, 0x80, 0x88, 0x40, 0x83, 0x27, 0x09, 0x00, 0x13, 0x75, 0xF5, 0x0F, 0x82, 0x97, 0x7D, 0x14, 0xE3, 0x19, 0x44, 0xFF, 0xC9, 0xBF, 0x13, 0x07, 0x00, 0x0C, 0x94, 0x41, 0xAA, 0x87, 0x63, 0x18, 0xE5, 0x00, 0x85, 0x47, 0x85, 0xC6, 0x23, 0xA0, 0x05, 0x00, 0x79, 0x55, 0x82, 0x80, 0x05, 0x47, 0x63, 0x87, 0xE6, 0x00, 0x09, 0x46, 0x63, 0x8D, 0xC6, 0x00, 0x7D, 0x55, 0x82, 0x80, 0x42, 0x05, 0x13, 0x07, 0xB0, 0x0D, 0x41, 0x85, 0x63, 0x95, 0xE7, 0x02, 0x89, 0x47, 0x9C, 0xC1, 0xF5, 0xB7, 0x93, 0x06, 0xC0, 0x0D, 0x63, 0x16, 0xD5, 0x00, 0x98, 0xC1, 0x13, 0x05, 0x00, 0x0C, 0x82, 0x80, 0x93, 0x06, 0xD0, 0x0D, 0x7D, 0x55, 0x63, 0x95, 0xD7, 0x00, 0x98, 0xC1, 0x13, 0x05, 0xB0, 0x0D, 0x82, 0x80, 0xB7, 0x75, 0xC9, 0x3F, 0x41, 0x11, 0x93, 0x85, 0xC5, 0xBA, 0x06, 0xC6, 0x61, 0x3F, 0x63, 0x45, 0x05, 0x06, 0xB7, 0x77, 0xC9, 0x3F, 0x93, 0x87, 0x47, 0xB2, 0x03, 0xA7, 0x07, 0x08, 0x03, 0xD6, 0x47, 0x08, 0x13, 0x75, 0xF5, 0x0F, 0x93, 0x06, 0x16, 0x00, 0xC2, 0x06, 0xC1, 0x82, 0x23, 0x92, 0xD7, 0x08, 0x32, 0x97, 0x23, 0x00, 0xA7, 0x00, 0x03, 0xD7, 0x47, 0x08, 0x91, 0x67, 0x93, 0x87, 0x07, 0x04, 0x63, 0x1E, 0xF7, 0x02, 0x37, 0xF7, 0xC8, 0x3F, 0x13, 0x07, 0x47, 0xB2, 0xA1, 0x67, 0xBA, 0x97, 0x03, 0xA6, 0x07, 0x08, 0xB7, 0x36, 0xC9, 0x3F, 0xB7, 0x77, 0xC9, 0x3F, 0x93, 0x87, 0x47, 0xB2, 0x93, 0x86, 0x46, 0xB6, 0x63, 0x1F, 0xE6, 0x00, 0x23, 0xA6, 0xC7, 0x08, 0x23, 0xA0, 0xD7, 0x08, 0x23, 0x92, 0x07, 0x08, 0x21, 0xA0, 0xF9, 0x57, 0xE3, 0x06, 0xF5, 0xFC, 0xB2, 0x40, 0x41, 0x01, 0x82, 0x80, 0x23, 0xA6, 0xD7, 0x08, 0x23, 0xA0, 0xE7, 0x08, 0xDD, 0xB7, 0x37, 0x27, 0x00, 0x60, 0x7C, 0x4B, 0x9D, 0x8B, 0xF5, 0xFF, 0x37, 0x37, 0x00, 0x60, 0x7C, 0x4B, 0x9D, 0x8B, 0xF5, 0xFF, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0xDD, 0x37, 0xB7, 0x27, 0x00, 0x60, 0x23, 0xA6, 0x07, 0x02, 0x37, 0x07, 0x00, 0x08, 0x98, 0xC3, 0x98, 0x43, 0x7D, 0xFF, 0xC8, 0x57, 0xB2, 0x40, 0x13, 0x45, 0xF5, 0xFF, 0x05, 0x89, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0xD9, 0x3F, 0x7D, 0xDD, 0x37, 0x07, 0x00, 0x40, 0xB7, 0x27, 0x00, 0x60, 0x98, 0xC3, 0x37, 0x27, 0x00, 0x60, 0x1C, 0x43, 0xFD, 0xFF, 0xB2, 0x40, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x22, 0xC4, 0x37, 0xC4, 0xC8, 0x3F, 0x93, 0x07, 0x84, 0x01, 0x4A, 0xC0, 0x03, 0xA9, 0x07, 0x01, 0x06, 0xC6, 0x26, 0xC2, 0x63, 0x0A, 0x09, 0x04, 0x45, 0x37, 0x39, 0xC5, 0xBD, 0x47, 0x13, 0x04, 0x84, 0x01, 0x81, 0x44, 0x63, 0xD6, 0x27, 0x01, 0x04, 0x44, 0xBD, 0x88, 0x93, 0xB4, 0x14, 0x00, 0x7D, 0x37, 0x85, 0x3F, 0x1C, 0x44, 0x37, 0x06, 0x80, 0x00, 0x13, 0x97, 0xC7, 0x00, 0x99, 0xE0, 0x37, 0x06, 0x00, 0x01, 0xB7, 0xF6, 0xFF, 0x00, 0x75, 0x8F, 0xB7, 0x26, 0x00, 0x60, 0xD8, 0xC2, 0x90, 0xC2, 0x98, 0x42, 0x7D, 0xFF, 0x41, 0x47, 0x91, 0xE0, 0x05, 0x47, 0x33, 0x09, 0xE9, 0x40, 0xBA, 0x97, 0x23, 0x28, 0x24, 0x01, 0x1C, 0xC4, 0xB2, 0x40, 0x22, 0x44, 0x92, 0x44, 0x02, 0x49, 0x41, 0x01, 0x82, 0x80, 0x01, 0x11, 0x06, 0xCE, 0x22, 0xCC, 0x25, 0x37, 0x37, 0x04, 0xCE, 0x3F, 0x6C, 0x00, 0x13, 0x05, 0x44, 0xFF, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x20, 0xF0, 0xAA, 0x87, 0x05, 0x45, 0x95, 0xE7, 0xB2, 0x47, 0x93, 0xF7, 0x07, 0x20, 0x3E, 0xC6, 0x89, 0x37, 0x37, 0x27, 0x00, 0x60, 0x1C, 0x47, 0xB7, 0x06, 0x40, 0x00, 0x13, 0x05, 0x44, 0xFF, 0xD5, 0x8F, 0x1C, 0xC7, 0xB2, 0x45, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xA0, 0xED, 0x33, 0x35, 0xA0, 0x00, 0xF2, 0x40, 0x62, 0x44, 0x05, 0x61, 0x82, 0x80, 0x41, 0x11, 0xB7, 0xC7, 0xC8, 0x3F, 0x06, 0xC6, 0x93, 0x87, 0x87, 0x01, 0x05, 0x47, 0x23, 0x80, 0xE7, 0x00, 0x13, 0xD7, 0xC5, 0x00, 0x98, 0xC7, 0x05, 0x67, 0x7D, 0x17, 0xCC, 0xC3, 0xC8, 0xC7, 0xF9, 0x8D, 0x3A, 0x95, 0xAA, 0x95, 0xB1, 0x81, 0x8C, 0xCB, 0x23, 0xAA, 0x07, 0x00, 0x41, 0x37, 0x19, 0xC1, 0x13, 0x05, 0x50, 0x0C, 0xB2, 0x40, 0x41, 0x01, 0x82, 0x80, 0x01, 0x11, 0x22, 0xCC, 0x37, 0xC4, 0xC8, 0x3F, 0x93, 0x07, 0x84, 0x01, 0x26, 0xCA, 0xC4, 0x47, 0x4E, 0xC6, 0x06, 0xCE, 0x4A, 0xC8, 0xAA, 0x89, 0x13, 0x04, 0x84, 0x01, 0x63, 0xF3, 0x95, 0x00, 0xAE, 0x84, 0xA9, 0xC0, 0x03, 0x29, 0x44, 0x00, 0x26, 0x99, 0x13, 0x59, 0xC9, 0x00, 0x1C, 0x48, 0x63, 0x55, 0xF0, 0x00, 0x1C, 0x44, 0x63, 0x5E, 0xF9, 0x02, 0xB5, 0x3D, 0x7D, 0xDD, 0x48, 0x40, 0x26, 0x86, 0xCE, 0x85, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x20, 0xE1, 0x13, 0x75, 0xF5, 0x0F, 0x01, 0xC5, 0x93, 0x07, 0x40, 0x0C, 0x5C, 0xC8, 0x5C, 0x40, 0xA6, 0x97, 0x5C, 0xC0, 0x5C, 0x44, 0x85, 0x8F, 0x5C, 0xC4, 0xF2, 0x40, 0x62, 0x44, 0xD2, 0x44, 0x42, 0x49, 0xB2, 0x49, 0x05, 0x61, 0x82, 0x80, 0x69, 0x35, 0x6D, 0xBF, 0x41, 0x11, 0x06, 0xC6, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x00, 0xD6, 0x03, 0x45, 0x85, 0x01, 0xB2, 0x40, 0x75, 0x15, 0x13, 0x35, 0x15, 0x00, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0xC5, 0x37, 0x1D, 0xC9, 0x37, 0x47, 0xC8, 0x3F, 0x13, 0x07, 0x07, 0x00, 0x5C, 0x43, 0x8D, 0xC7, 0x10, 0x47, 0x1D, 0xC2, 0xB7, 0x06, 0x0C, 0x60, 0x98, 0x46, 0x0D, 0x8A, 0x71, 0x9B, 0x51, 0x8F, 0x98, 0xC6, 0x05, 0x66, 0xB8, 0x4E, 0x13, 0x06, 0x06, 0xC0, 0xF1, 0x8F, 0x7D, 0x76, 0x13, 0x06, 0xF6, 0x3F, 0x71, 0x8F, 0xD9, 0x8F, 0xBC, 0xCE, 0xB2, 0x40, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0x79, 0x3F, 0x11, 0xC1, 0x0D, 0x45, 0xB2, 0x40, 0x41, 0x01, 0x17, 0x03, 0xC8, 0xFF, 0x67, 0x00, 0x83, 0xCC, 0x41, 0x11, 0x06, 0xC6, 0x26, 0xC2, 0x22, 0xC4, 0xAA, 0x84, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xE0, 0xC9, 0xAD, 0x3F, 0x0D, 0xC9, 0x37, 0x47, 0xC8, 0x3F, 0x93, 0x06, 0x07, 0x00, 0x83, 0xD7, 0xC6, 0x00, 0x13, 0x04, 0x07, 0x00, 0x85, 0x07, 0xC2, 0x07, 0xC1, 0x83, 0x23, 0x96, 0xF6, 0x00, 0x93, 0x06, 0x00, 0x0C, 0x63, 0x86, 0xD4, 0x00, 0x13, 0x07, 0xE0, 0x03, 0x63, 0x75, 0xF7, 0x00, 0x6D, 0x37, 0x23, 0x16, 0x04, 0x00, 0xB2, 0x40, 0x22, 0x44, 0x92, 0x44, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0x13, 0x07, 0x00, 0x0C, 0x63, 0x1A, 0xE5, 0x00, 0x13, 0x05, 0xB0, 0x0D, 0x45, 0x37, 0x13, 0x05, 0xC0, 0x0D, 0xB2, 0x40, 0x41, 0x01, 0x59, 0xBF, 0x13, 0x07, 0xB0, 0x0D, 0xE3, 0x1B, 0xE5, 0xFE, 0x71, 0x37, 0x13, 0x05, 0xD0, 0x0D, 0xF5, 0xB7, 0x41, 0x11, 0x22, 0xC4, 0x26, 0xC2, 0x06, 0xC6, 0x2A, 0x84, 0xB3, 0x04, 0xB5, 0x00, 0x63, 0x17, 0x94, 0x00, 0xB2, 0x40, 0x22, 0x44, 0x92, 0x44, 0x41, 0x01, 0x82, 0x80, 0x03, 0x45, 0x04, 0x00, 0x05, 0x04, 0x4D, 0x3F, 0xED, 0xB7, 0x35, 0x71, 0x26, 0xCB, 0x4E, 0xC7, 0xFD, 0x72, 0x85, 0x69, 0xFD, 0x74, 0x22, 0xCD, 0x4A, 0xC9, 0x52, 0xC5, 0x56, 0xC3, 0x06, 0xCF, 0x93, 0x84, 0x84, 0xFA, 0x16, 0x91, 0x93, 0x87, 0x09, 0x07, 0xA6, 0x97, 0x18, 0x08, 0xB3, 0x84, 0xE7, 0x00, 0x2A, 0x89, 0x26, 0x85, 0x2E, 0x84, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x40, 0x18, 0x93, 0x87, 0x09, 0x07, 0x18, 0x08, 0x05, 0x6A, 0xBA, 0x97, 0xB3, 0x8A, 0x47, 0x41, 0x31, 0xE4, 0x05, 0x67, 0x7D, 0x75, 0x93, 0x05, 0x85, 0xFA, 0x93, 0x07, 0x07, 0x07, 0x13, 0x05, 0x85, 0xF9, 0x14, 0x08, 0xAA, 0x97, 0x33, 0x85, 0xD7, 0x00, 0x93, 0x07, 0x07, 0x07, 0xAE, 0x97, 0xB3, 0x85, 0xD7, 0x00, 0x2A, 0xC6, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x00, 0x15, 0x32, 0x45, 0xC1, 0x45, 0x95, 0x37, 0x01, 0x45, 0x85, 0x62, 0x16, 0x91, 0xFA, 0x40, 0x6A, 0x44, 0xDA, 0x44, 0x4A, 0x49, 0xBA, 0x49, 0x2A, 0x4A, 0x9A, 0x4A, 0x0D, 0x61, 0x82, 0x80, 0xA2, 0x89, 0x63, 0x73, 0x8A, 0x00, 0x85, 0x69, 0x4E, 0x86, 0xD6, 0x85, 0x4A, 0x85, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x00, 0xC3, 0x13, 0x75, 0xF5, 0x0F, 0x01, 0xED, 0x4E, 0x86, 0xD6, 0x85, 0x26, 0x85, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x40, 0x10, 0x4E, 0x99, 0x33, 0x04, 0x34, 0x41, 0x51, 0xB7, 0x13, 0x05, 0x30, 0x06, 0x55, 0xBF, 0x13, 0x05, 0x00, 0x0C, 0x49, 0xBD, 0x31, 0x71, 0xFD, 0x72, 0x05, 0x67, 0x4E, 0xD7, 0x52, 0xD5, 0x56, 0xD3, 0x5E, 0xCF, 0x06, 0xDF, 0x22, 0xDD, 0x26, 0xDB, 0x4A, 0xD9, 0x5A, 0xD1, 0x62, 0xCD, 0x66, 0xCB, 0x6A, 0xC9, 0x6E, 0xC7, 0xFD, 0x77, 0x16, 0x91, 0x13, 0x07, 0x07, 0x07, 0x3E, 0x97, 0x1C, 0x08, 0xBA, 0x97, 0x3E, 0xC6, 0x23, 0xAA, 0x07, 0xF8, 0xAA, 0x89, 0x2E, 0x8A, 0xB2, 0x8A, 0xB6, 0x8B, 0xC5, 0x33, 0x93, 0x07, 0x00, 0x02, 0x19, 0xC1, 0xB7, 0x07, 0x02, 0x00, 0x3E, 0x85, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xE0, 0x08, 0x85, 0x67, 0x63, 0xE5, 0x57, 0x13, 0x05, 0x64, 0x7D, 0x79, 0x13, 0x09, 0x89, 0xFA, 0x93, 0x07, 0x04, 0x07, 0xCA, 0x97, 0x18, 0x08, 0x33, 0x89, 0xE7, 0x00, 0x4A, 0x85, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x60, 0x07, 0x7D, 0x7B, 0x13, 0x0C, 0x3B, 0xF9, 0x93, 0x0C, 0x8B, 0xF9, 0x13, 0x07, 0x04, 0x07, 0x93, 0x07, 0x04, 0x07, 0x14, 0x08, 0x62, 0x97, 0xE6, 0x97, 0x81, 0x44, 0x33, 0x0C, 0xD7, 0x00, 0xB3, 0x8C, 0xD7, 0x00, 0x52, 0x4D, 0x63, 0x7C, 0x4D, 0x09, 0x63, 0xF1, 0xA4, 0x03, 0x41, 0xA8, 0x99, 0x3F, 0xA2, 0x85, 0x08, 0x01, 0x8D, 0x35, 0xB9, 0x37, 0x22, 0x86, 0x0C, 0x01, 0x4A, 0x85, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x40, 0x03, 0xA2, 0x99, 0xA2, 0x94, 0x63, 0xF5, 0x44, 0x03, 0xB3, 0x87, 0xA4, 0x41, 0x63, 0xF1, 0x77, 0x03, 0x33, 0x04, 0x9A, 0x40, 0x63, 0xF3, 0x8A, 0x00, 0x56, 0x84, 0x22, 0x86, 0x0C, 0x01, 0x4E, 0x85, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x40, 0xB2, 0x13, 0x75, 0xF5, 0x0F, 0x55, 0xDD, 0x02, 0xCC, 0x01, 0x44, 0x79, 0x5D, 0x8D, 0x4D, 0xA3, 0x09, 0x01, 0x00, 0x62, 0x85, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x80, 0xA4, 0x7D, 0xF9, 0x03, 0x45, 0x31, 0x01, 0xE6, 0x85, 0x91, 0x3C, 0x63, 0x4F, 0x05, 0x00, 0xE3, 0xE2, 0x8D, 0xFE, 0x85, 0x67, 0x93, 0x87, 0x07, 0x07, 0xA2, 0x97, 0x18, 0x08, 0xBA, 0x97, 0xDA, 0x97, 0x23, 0x8A, 0xA7, 0xF8, 0x05, 0x04, 0xF1, 0xB7, 0xE3, 0x15, 0xA5, 0xFD, 0x91, 0x47, 0xE3, 0x05, 0xF4, 0xF6, 0x05, 0x67, 0x7D, 0x75, 0x93, 0x07, 0x07, 0x07, 0x93, 0x05, 0x85, 0xFA, 0x13, 0x05, 0x85, 0xF9, 0x14, 0x08, 0xAA, 0x97, 0x33, 0x85, 0xD7, 0x00, 0x93, 0x07, 0x07, 0x07, 0xAE, 0x97, 0xB3, 0x85, 0xD7, 0x00, 0x2A, 0xC6, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x60, 0xF9, 0x71, 0x3D, 0x32, 0x45, 0xC1, 0x45, 0x65, 0x33, 0x51, 0x3D, 0x55, 0x39, 0xB7, 0x07, 0x02, 0x00, 0x19, 0xE1, 0x93, 0x07, 0x00, 0x02, 0x3E, 0x85, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x60, 0xF6, 0x85, 0x62, 0x16, 0x91, 0xFA, 0x50, 0x6A, 0x54, 0xDA, 0x54, 0x4A, 0x59, 0xBA, 0x59, 0x2A, 0x5A, 0x9A, 0x5A, 0x0A, 0x5B, 0xFA, 0x4B, 0x6A, 0x4C, 0xDA, 0x4C, 0x4A, 0x4D, 0xBA, 0x4D, 0x29, 0x61, 0x82, 0x80, 0xB7, 0x57, 0x41, 0x49, 0x19, 0x71, 0x93, 0x87, 0xF7, 0x84, 0x01, 0x45, 0x86, 0xDE, 0xA2, 0xDC, 0xA6, 0xDA, 0xCA, 0xD8, 0xCE, 0xD6, 0xD2, 0xD4, 0xD6, 0xD2, 0xDA, 0xD0, 0xDE, 0xCE, 0xE2, 0xCC, 0xE6, 0xCA, 0xEA, 0xC8, 0xEE, 0xC6, 0x3E, 0xCE, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x40, 0x9C, 0xB1, 0x31, 0x0D, 0xCD, 0xB7, 0x04, 0x0C, 0x60, 0x9C, 0x44, 0x37, 0x44, 0xC8, 0x3F, 0x13, 0x04, 0x04, 0x00, 0x1C, 0xC4, 0xBC, 0x4C, 0x7D, 0x77, 0x13, 0x07, 0xF7, 0x3F, 0x5C, 0xC0, 0xF9, 0x8F, 0x93, 0xE7, 0x07, 0x40, 0xBC, 0xCC, 0x13, 0x05, 0x40, 0x06, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x60, 0x92, 0x1C, 0x44, 0xF1, 0x9B, 0x93, 0xE7, 0x17, 0x00, 0x9C, 0xC4, 0x01, 0x39, 0x21, 0xC1, 0xB7, 0x87, 0x00, 0x60, 0x37, 0x47, 0xD8, 0x50, 0x93, 0x86, 0x87, 0x0A, 0x13, 0x07, 0x17, 0xAA, 0x98, 0xC2, 0x13, 0x87, 0x07, 0x09, 0x23, 0x20, 0x07, 0x00, 0x37, 0x37, 0x1D, 0x8F, 0x23, 0xA0, 0x06, 0x00, 0x13, 0x07, 0xA7, 0x12, 0x93, 0x86, 0x07, 0x0B, 0x98, 0xC2, 0x93, 0x87, 0xC7, 0x0A, 0x98, 0x43, 0x37, 0x06, 0x00, 0x80, 0x51, 0x8F, 0x98, 0xC3, 0x23, 0xA0, 0x06, 0x00, 0xB7, 0x47, 0xC8, 0x3F, 0x37, 0x77, 0xC9, 0x3F, 0x93, 0x87, 0x07, 0x00, 0x13, 0x07, 0x47, 0xBB, 0x21, 0xA0, 0x23, 0xA0, 0x07, 0x00, 0x91, 0x07, 0xE3, 0xED, 0xE7, 0xFE, 0x41, 0x3B, 0x91, 0x45, 0x68, 0x08, 0x71, 0x39, 0x61, 0x33, 0xB7, 0xF7, 0xC8, 0x3F, 0x93, 0x87, 0x47, 0xB2, 0x21, 0x67, 0x3E, 0x97, 0x23, 0x20, 0xF7, 0x08, 0xB7, 0x07, 0x38, 0x40, 0x37, 0x49, 0xC8, 0x3F, 0x93, 0x87, 0x87, 0x0E, 0x23, 0x20, 0xF9, 0x00, 0xB7, 0x79, 0xC9, 0x3F, 0x51, 0x36, 0x13, 0x09, 0x09, 0x00, 0x93, 0x89, 0x49, 0xB2, 0x63, 0x09, 0x05, 0x10, 0xB7, 0x27, 0x0C, 0x60, 0x45, 0x47, 0xB8, 0xD7, 0x85, 0x45, 0x45, 0x45, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xE0, 0xDF, 0xB7, 0x05, 0x38, 0x40, 0x01, 0x46, 0x93, 0x85, 0x05, 0x00, 0x45, 0x45, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xE0, 0xE0, 0xB7, 0x37, 0x04, 0x60, 0x11, 0x47, 0x98, 0xCB, 0x37, 0x05, 0x02, 0x00, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x20, 0xE0, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0xA0, 0xF0, 0xB7, 0x47, 0x00, 0x60, 0x9C, 0x5F, 0x09, 0xE5, 0xF1, 0x8B, 0xE1, 0x17, 0x13, 0xB5, 0x17, 0x00, 0x81, 0x45, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x80, 0x93, 0xC1, 0x67, 0xB7, 0xC4, 0xC8, 0x3F, 0xFD, 0x17, 0x13, 0x07, 0x00, 0x10, 0x85, 0x66, 0x41, 0x66, 0xB7, 0x05, 0x00, 0x01, 0x01, 0x45, 0x93, 0x84, 0x84, 0x01, 0xB7, 0x4A, 0xC8, 0x3F, 0x0D, 0x6A, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x00, 0x8E, 0x13, 0x8B, 0x8A, 0x01, 0x26, 0x9A, 0x83, 0xA7, 0xC9, 0x08, 0xF5, 0xDF, 0x83, 0xAB, 0xC9, 0x08, 0x85, 0x47, 0x23, 0xA6, 0x09, 0x08, 0x23, 0x02, 0xF1, 0x02, 0x83, 0xC7, 0x1B, 0x00, 0x09, 0x47, 0x23, 0x13, 0xE1, 0x02, 0xA3, 0x02, 0xF1, 0x02, 0x02, 0xD4, 0x4D, 0x47, 0x63, 0x81, 0xE7, 0x08, 0x51, 0x47, 0x63, 0x8F, 0xE7, 0x06, 0x29, 0x47, 0x63, 0x9F, 0xE7, 0x00, 0x83, 0xC7, 0x3B, 0x00, 0x03, 0xC7, 0x2B, 0x00, 0xA2, 0x07, 0xD9, 0x8F, 0x11, 0x47, 0x63, 0x96, 0xE7, 0x00, 0x83, 0xA7, 0x8B, 0x00, 0x9C, 0x43, 0x3E, 0xD4, 0xA5, 0x39, 0xA1, 0x45, 0x48, 0x10, 0x51, 0x36, 0x83, 0xC7, 0x3B, 0x00, 0x03, 0xC7, 0x2B, 0x00, 0xA2, 0x07, 0xD9, 0x8F, 0x11, 0x67, 0x41, 0x07, 0x63, 0x74, 0xF7, 0x04, 0x13, 0x05, 0xB0, 0x0D, 0xFD, 0x34, 0x13, 0x05, 0xC0, 0x0D, 0xE5, 0x34, 0x13, 0x05, 0xE0, 0x0E, 0xCD, 0x34, 0xA9, 0x31, 0x41, 0xB7, 0xB7, 0x05, 0x38, 0x40, 0x01, 0x46, 0x93, 0x85, 0x85, 0x03, 0x15, 0x45, 0x97, 0x00, 0xC8, 0xFF, 0xE7, 0x80, 0x40, 0xD1, 0x37, 0x07, 0x00, 0x60, 0x5C, 0x47, 0x13, 0x05, 0x00, 0x02, 0x93, 0xE7, 0x17, 0x10, 0x5C, 0xC7, 0x09, 0xB7, 0xC9, 0x47, 0x23, 0x13, 0xF1, 0x02, 0x4D, 0xB7, 0x03, 0xC7, 0x1B, 0x00, 0xD1, 0x46, 0x63, 0xE7, 0xE6, 0x02, 0x85, 0x46, 0x63, 0xE6, 0xE6, 0x00, 0x01, 0x4C, 0x13, 0x04, 0xF0, 0x0F, 0x85, 0xA8, 0x79, 0x17, 0x13, 0x77, 0xF7, 0x0F, 0xC9, 0x46, 0xE3, 0xE8, 0xE6, 0xFE, 0xB7, 0x76, 0xC9, 0x3F, 0x0A, 0x07, 0x93, 0x86, 0x86, 0xBB, 0x36, 0x97, 0x18, 0x43, 0x02, 0x87, 0x93, 0x06, 0x07, 0x03, 0x93, 0xF6, 0xF6, 0x0F, 0x11, 0x46, 0xE3, 0x69, 0xD6, 0xFC, 0x13, 0x07, 0xF7, 0x02, 0x13, 0x77, 0xF7, 0x0F, 0x8D, 0x46, 0x63, 0xE8, 0xE6, 0x0A, 0xB7, 0x76, 0xC9, 0x3F, 0x0A, 0x07, 0x93, 0x86, 0x46, 0xC0, 0x36, 0x97, 0x18, 0x43, 0x02, 0x87, 0x13, 0x07, 0x40, 0x02, 0x63, 0x95, 0xE7, 0x12, 0x02, 0xD4, 0x1D, 0x44, 0x01, 0x45, 0x81, 0x34, 0x01, 0x45, 0x71, 0x34, 0x55, 0x36, 0x4D, 0x36, 0xA1, 0x45, 0x48, 0x10, 0x7D, 0x14, 0x75, 0x34, 0x75, 0xF4, 0x01, 0x4C, 0x01, 0x44, 0x13, 0x75, 0xF4, 0x0F, 0x95, 0x3C, 0x13, 0x75, 0xFC, 0x0F, 0xBD, 0x34, 0x59, 0x36, 0xE3, 0x1E, 0x04, 0xEA, 0x83, 0xC7, 0x1B, 0x00, 0x49, 0x47, 0x63, 0x65, 0xF7, 0x32, 0x09, 0x47, 0xE3, 0x76, 0xF7, 0xEA, 0xF5, 0x17, 0x93, 0xF7, 0xF7, 0x0F, 0x3D, 0x47, 0xE3, 0x60, 0xF7, 0xEA, 0x37, 0x77, 0xC9, 0x3F, 0x8A, 0x07, 0x13, 0x07, 0x47, 0xC1, 0xBA, 0x97, 0x9C, 0x43, 0x82, 0x87, 0x05, 0x44, 0xA1, 0xEB, 0xB7, 0x07, 0x00, 0x40, 0x03, 0xA7, 0x47, 0x01, 0x99, 0x47, 0x70, 0x10, 0x81, 0x45, 0x01, 0x45, 0x63, 0xFD, 0xE7, 0x00, 0x97, 0xD0, 0xCC, 0xFF, 0xE7, 0x80, 0x00, 0xB3, 0x05, 0x44, 0x05, 0xE9, 0xD1, 0x45, 0x68, 0x10, 0x3D, 0x3C, 0x01, 0x44, 0x1D, 0xA0, 0x97, 0xB0, 0xCC, 0xFF, 0xE7, 0x80, 0x60, 0xFD, 0xED, 0xB7, 0x05, 0x44, 0x81, 0xEF, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xE0, 0x70, 0x33, 0x34, 0xA0, 0x00, 0x29, 0xA0, 0x21, 0x47, 0x63, 0x85, 0xE7, 0x00, 0x05, 0x44, 0x01, 0x4C, 0xBD, 0xB7, 0x03, 0xAC, 0x8B, 0x00, 0x03, 0xA4, 0xCB, 0x00, 0xB3, 0x67, 0x8C, 0x00, 0xD2, 0x07, 0xF5, 0xF7, 0xEF, 0xF0, 0xDF, 0x80, 0x7D, 0xF1, 0xC1, 0x6C, 0x22, 0x9C, 0xFD, 0x1C, 0x7D, 0x7D, 0x33, 0x05, 0x8C, 0x40, 0x4D, 0xD8, 0xB3, 0x77, 0x95, 0x01, 0x95, 0xE3, 0xC1, 0x6C, 0x33, 0x05, 0x8C, 0x40, 0x63, 0xE6, 0x8C, 0x02, 0xFD, 0x7C, 0x33, 0x05, 0x8C, 0x40, 0x49, 0xDC, 0x31, 0x81, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xE0, 0x6B, 0x55, 0xF9, 0x66, 0x94, 0xF5, 0xB7, 0x31, 0x81, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xE0, 0x6A, 0x55, 0xF1, 0x6A, 0x94, 0xD1, 0xB7, 0x41, 0x81, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xA0, 0x69, 0x51, 0xF9, 0x33, 0x04, 0x94, 0x41, 0xC1, 0xB7, 0x21, 0x47, 0xE3, 0x8C, 0xE7, 0xEE, 0x01, 0x4C, 0x13, 0x04, 0x00, 0x0C, 0xCD, 0xBD, 0x41, 0x47, 0xCD, 0xBF, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x9C, 0xE7, 0xF6, 0x83, 0xA5, 0xCB, 0x00, 0x03, 0xA5, 0x8B, 0x00, 0x5D, 0x32, 0xB1, 0xBF, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x92, 0xE7, 0xF6, 0x03, 0xA7, 0x0B, 0x01, 0x91, 0x67, 0x63, 0xEA, 0xE7, 0x1E, 0x83, 0xA5, 0x4B, 0x01, 0x03, 0xA5, 0x8B, 0x00, 0xEF, 0xF0, 0x0F, 0xFC, 0x35, 0xBF, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x92, 0xE7, 0xF4, 0x83, 0xA7, 0x0B, 0x01, 0x11, 0x67, 0x63, 0x6A, 0xF7, 0x1C, 0x03, 0xA7, 0xCB, 0x00, 0x83, 0xA5, 0x4B, 0x01, 0x03, 0xA5, 0x8B, 0x00, 0x33, 0x84, 0xE7, 0x02, 0xEF, 0xF0, 0x8F, 0xF9, 0x23, 0xAC, 0x04, 0x00, 0x23, 0x24, 0x8A, 0xB0, 0x31, 0xB7, 0x03, 0xC7, 0x04, 0x00, 0x63, 0x03, 0x07, 0x14, 0x03, 0xA7, 0x8B, 0x00, 0xC1, 0x17, 0x13, 0x04, 0x00, 0x0C, 0x63, 0x13, 0xF7, 0x00, 0xC0, 0x48, 0x01, 0x47, 0x93, 0x06, 0xF0, 0x0E, 0x63, 0x46, 0xF7, 0x02, 0x83, 0xC7, 0x5B, 0x00, 0x03, 0xC7, 0x4B, 0x00, 0x01, 0x4C, 0xA2, 0x07, 0xD9, 0x8F, 0x03, 0xC7, 0x6B, 0x00, 0x42, 0x07, 0x5D, 0x8F, 0x83, 0xC7, 0x7B, 0x00, 0xE2, 0x07, 0xD9, 0x8F, 0xE3, 0x84, 0xF6, 0xE4, 0x13, 0x04, 0x10, 0x0C, 0x81, 0xB5, 0x33, 0x86, 0xEB, 0x00, 0x03, 0x46, 0x86, 0x01, 0x05, 0x07, 0xB1, 0x8E, 0xE1, 0xB7, 0x83, 0xC7, 0x04, 0x00, 0xFD, 0xC7, 0xDC, 0x44, 0x63, 0x9D, 0x07, 0x14, 0xC0, 0x48, 0x23, 0x80, 0x04, 0x00, 0x7D, 0xB5, 0x61, 0x47, 0x63, 0x96, 0xE7, 0x02, 0x83, 0xA7, 0xCB, 0x01, 0x03, 0xA7, 0x8B, 0x01, 0x83, 0xA6, 0x4B, 0x01, 0x03, 0xA6, 0x0B, 0x01, 0x83, 0xA5, 0xCB, 0x00, 0x03, 0xA5, 0x8B, 0x00, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xA0, 0x59, 0x2A, 0x8C, 0x33, 0x34, 0xA0, 0x00, 0xC5, 0xBB, 0x01, 0x4C, 0x05, 0x44, 0xED, 0xB3, 0x11, 0x47, 0x05, 0x44, 0xE3, 0x9A, 0xE7, 0xE6, 0xB7, 0x97, 0x00, 0x60, 0xB4, 0x43, 0x65, 0x77, 0x7D, 0x17, 0x05, 0x66, 0xF9, 0x8E, 0xD1, 0x8E, 0x03, 0xA5, 0x8B, 0x00, 0xB4, 0xC3, 0xB4, 0x47, 0x81, 0x45, 0xF9, 0x8E, 0xD1, 0x8E, 0xB4, 0xC7, 0xF4, 0x43, 0xF9, 0x8E, 0xD1, 0x8E, 0xF4, 0xC3, 0xD4, 0x5F, 0x75, 0x8F, 0x51, 0x8F, 0xD8, 0xDF, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xC0, 0x57, 0x01, 0xBD, 0x13, 0xF7, 0xF7, 0x00, 0xE3, 0x15, 0x07, 0xEA, 0x93, 0xDC, 0x47, 0x00, 0x13, 0x84, 0x8B, 0x00, 0x01, 0x4C, 0x7D, 0x5D, 0xE3, 0x77, 0x9C, 0xD9, 0x48, 0x44, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x40, 0x44, 0x18, 0x44, 0x54, 0x40, 0x10, 0x40, 0xF9, 0x8E, 0x63, 0x07, 0xA7, 0x01, 0x1C, 0x42, 0x13, 0x47, 0xF7, 0xFF, 0x7D, 0x8F, 0xD9, 0x8E, 0x14, 0xC2, 0x05, 0x0C, 0x41, 0x04, 0xD9, 0xBF, 0x11, 0x47, 0xA5, 0xB5, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x97, 0xE7, 0xDE, 0x83, 0xA7, 0x8B, 0x00, 0x03, 0xA7, 0x4B, 0x01, 0x23, 0x2A, 0xF9, 0x00, 0x23, 0x28, 0xE9, 0x00, 0x4D, 0xBB, 0x83, 0x25, 0x09, 0x01, 0xC1, 0x17, 0x91, 0xE5, 0x89, 0xCF, 0x01, 0x4C, 0x13, 0x04, 0x60, 0x0C, 0x25, 0xBB, 0x03, 0x27, 0x49, 0x01, 0x63, 0x66, 0xF7, 0x06, 0x13, 0xF7, 0x37, 0x00, 0xE3, 0x19, 0x07, 0xE2, 0x03, 0x28, 0x49, 0x01, 0x01, 0x46, 0x01, 0x47, 0x33, 0x05, 0xE8, 0x40, 0xB3, 0x86, 0xE5, 0x00, 0x63, 0x69, 0xF7, 0x00, 0xE3, 0x07, 0x06, 0xD0, 0x23, 0x2A, 0xA9, 0x00, 0x23, 0x28, 0xD9, 0x00, 0x09, 0xB3, 0x33, 0x86, 0xEB, 0x00, 0x10, 0x4E, 0x11, 0x07, 0x90, 0xC2, 0x05, 0x46, 0xE9, 0xBF, 0x21, 0x47, 0x05, 0x44, 0xE3, 0x91, 0xE7, 0xD8, 0x03, 0x24, 0x49, 0x01, 0x19, 0xC0, 0x13, 0x04, 0x80, 0x0C, 0x23, 0x2A, 0x09, 0x00, 0x23, 0x28, 0x09, 0x00, 0x33, 0x34, 0x80, 0x00, 0xA5, 0xB3, 0x01, 0x4C, 0x13, 0x04, 0x20, 0x0C, 0xC1, 0xB9, 0x01, 0x4C, 0x13, 0x04, 0x80, 0x0C, 0xE1, 0xB1, 0x01, 0x4C, 0x13, 0x04, 0x90, 0x0C, 0xC1, 0xB1, 0x13, 0x07, 0x20, 0x0D, 0x63, 0x83, 0xE7, 0x0C, 0x13, 0x07, 0x40, 0x0D, 0xE3, 0x9E, 0xE7, 0xB6, 0x03, 0xC4, 0x3B, 0x00, 0x83, 0xC7, 0x2B, 0x00, 0x22, 0x04, 0x5D, 0x8C, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x20, 0x42, 0x03, 0xAC, 0xC4, 0x00, 0x41, 0x14, 0x63, 0x73, 0x84, 0x01, 0x22, 0x8C, 0xE3, 0x0C, 0x0C, 0xB4, 0xC0, 0x40, 0x62, 0x94, 0x31, 0x80, 0x9C, 0x48, 0x63, 0x55, 0xF0, 0x00, 0x9C, 0x44, 0x63, 0x5B, 0xF4, 0x0A, 0xEF, 0xF0, 0xCF, 0xC6, 0x75, 0xDD, 0xC8, 0x40, 0x62, 0x86, 0x93, 0x85, 0x8B, 0x01, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x20, 0x3E, 0x01, 0xC5, 0x93, 0x07, 0x40, 0x0C, 0xDC, 0xC8, 0xDC, 0x40, 0xE2, 0x97, 0xDC, 0xC0, 0xDC, 0x44, 0xB3, 0x87, 0x87, 0x41, 0xDC, 0xC4, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x00, 0x3D, 0x39, 0xB6, 0x09, 0x65, 0x13, 0x05, 0x05, 0x71, 0x03, 0xAC, 0xCB, 0x00, 0x03, 0xA4, 0x8B, 0x00, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xC0, 0x2E, 0xB7, 0x07, 0x00, 0x60, 0xD8, 0x4B, 0xB7, 0x06, 0x00, 0x01, 0xC1, 0x16, 0x93, 0x57, 0x47, 0x01, 0x12, 0x07, 0x75, 0x8F, 0xBD, 0x8B, 0xD9, 0x8F, 0xB3, 0x87, 0x87, 0x03, 0x01, 0x45, 0xB3, 0xD5, 0x87, 0x02, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xA0, 0x2F, 0x13, 0x05, 0x80, 0x3E, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x60, 0x2B, 0xC1, 0xB4, 0x83, 0xA6, 0x4B, 0x01, 0x03, 0xA6, 0x0B, 0x01, 0x83, 0xA5, 0xCB, 0x00, 0x03, 0xA5, 0x8B, 0x00, 0xEF, 0xF0, 0xCF, 0xF7, 0x6D, 0xB4, 0x83, 0xC5, 0x3B, 0x00, 0x83, 0xC7, 0x2B, 0x00, 0x13, 0x85, 0x8B, 0x01, 0xA2, 0x05, 0xDD, 0x8D, 0xC1, 0x15, 0xEF, 0xF0, 0xAF, 0xD0, 0x49, 0xBC, 0xEF, 0xF0, 0x0F, 0xC0, 0x3D, 0xBF, 0x03, 0xC4, 0x3B, 0x00, 0x83, 0xC7, 0x2B, 0x00, 0x13, 0x8C, 0x8B, 0x01, 0x22, 0x04, 0x5D, 0x8C, 0xDC, 0x44, 0x41, 0x14, 0xCD, 0xE3, 0x91, 0x47, 0x85, 0x4B, 0x63, 0xFF, 0x87, 0x08, 0x93, 0x07, 0x90, 0x0C, 0xDC, 0xC8, 0x9D, 0xB4, 0x03, 0xA7, 0x0D, 0x00, 0x22, 0xD0, 0x05, 0x48, 0xB3, 0x87, 0xEC, 0x40, 0x3E, 0xD6, 0x83, 0x27, 0x8A, 0xB0, 0x63, 0x73, 0xF4, 0x00, 0x0D, 0x48, 0x42, 0xC6, 0x3A, 0xC4, 0xEF, 0xF0, 0x8F, 0xBB, 0x22, 0x47, 0x32, 0x48, 0x37, 0xC5, 0xC8, 0x3F, 0xE2, 0x85, 0x7C, 0x10, 0x93, 0x86, 0x8A, 0x01, 0x10, 0x10, 0x13, 0x05, 0x05, 0x03, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x00, 0x2C, 0x37, 0xF7, 0xC8, 0x3F, 0x93, 0x08, 0x87, 0x01, 0x82, 0x57, 0x03, 0xA7, 0x88, 0xB0, 0x83, 0xA5, 0x0D, 0x00, 0x1D, 0x8C, 0x1D, 0x8F, 0x3E, 0x9C, 0xB2, 0x57, 0x23, 0xA4, 0xE8, 0xB0, 0xAA, 0x8B, 0xBE, 0x95, 0x23, 0xA0, 0xBD, 0x00, 0x93, 0x87, 0x8A, 0x01, 0x9D, 0x8D, 0x01, 0xC5, 0xA1, 0x67, 0x63, 0x97, 0xF5, 0x00, 0x5A, 0x85, 0xEF, 0xF0, 0x4F, 0xC6, 0x23, 0xA0, 0x6D, 0x01, 0x09, 0xC4, 0xDC, 0x44, 0x99, 0xC3, 0xE3, 0x4F, 0x70, 0xF7, 0x63, 0xDF, 0x0B, 0x00, 0x93, 0x07, 0x70, 0x0C, 0xBD, 0xB7, 0x85, 0x4B, 0xB7, 0x7D, 0xC9, 0x3F, 0xB7, 0xCC, 0xC8, 0x3F, 0x93, 0x8D, 0x4D, 0xBB, 0x93, 0x8C, 0x8C, 0x01, 0xE9, 0xBF, 0xE3, 0x90, 0x0B, 0x9C, 0xDC, 0x44, 0xE3, 0x8D, 0x07, 0x9A, 0x93, 0x07, 0x80, 0x0C, 0xA9, 0xB7, 0x83, 0xA7, 0x8B, 0x00, 0xE3, 0x96, 0x07, 0x9A, 0xEF, 0xF0, 0x0F, 0xCF, 0x09, 0x65, 0x13, 0x05, 0x05, 0x71, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0xC0, 0x18, 0xEF, 0xF0, 0xCF, 0xC9, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x00, 0x1C, 0x69, 0xB2, 0x03, 0xA4, 0xCB, 0x00, 0xE3, 0x02, 0x04, 0x98, 0xEF, 0xF0, 0x8F, 0xCC, 0x13, 0x05, 0x80, 0x3E, 0x97, 0xF0, 0xC7, 0xFF, 0xE7, 0x80, 0x60, 0x16, 0xEF, 0xF0, 0x6F, 0xC7, 0x02, 0x94, 0xAD, 0xB2, 0xEF, 0xF0, 0xEF, 0xC6, 0xF6, 0x50, 0x66, 0x54, 0xD6, 0x54, 0x46, 0x59, 0xB6, 0x59, 0x26, 0x5A, 0x96, 0x5A, 0x06, 0x5B, 0xF6, 0x4B, 0x66, 0x4C, 0xD6, 0x4C, 0x46, 0x4D, 0xB6, 0x4D, 0x09, 0x61, 0x82, 0x80
+        0x28, 0xCF, 0x7D, 0x52, 0x7B, 0x54, 0x1B, 0xE7, 0x95, 0xFF, 0x46, 0xF3, 0xF8, 0x24, 0x5B, 0x8A, 0x21, 0x83, 0x8D, 0xDD, 0xE2, 0x2C, 0x46, 0x09, 0x4E, 0xC8, 0x9E, 0x6C, 0x6D, 0x61, 0x4F, 0xDD, 0xC4, 0x68, 0x64, 0x46, 0x0C, 0xE2, 0x95, 0x90, 0x63, 0xE2, 0x63, 0x07, 0xB7, 0xB2, 0xA7, 0x81, 0x9A, 0x26, 0x6D, 0x68, 0x42, 0x38, 0x3E, 0x8D, 0xCE, 0x11, 0x08, 0xA1, 0xF0, 0xB2, 0x8C, 0xC7, 0x44, 0xD8, 0x25, 0x5B, 0xE2, 0xDA, 0x10, 0xD3, 0xB4, 0x8B, 0x05, 0xF6, 0xB4, 0x38, 0x2C, 0x12, 0x0F, 0x3D, 0x0C, 0x7E, 0xAE, 0x03, 0xC6, 0x0B, 0x31, 0xB6, 0x6A, 0x14, 0xBB, 0x75, 0x81, 0x2D, 0xA0, 0x92, 0x13, 0xC2, 0xCE, 0x58, 0x52, 0x4F, 0xBA, 0x7F, 0xEC, 0x3F, 0xF3, 0xCD, 0x77, 0xEF, 0xFD, 0xEE, 0xBD, 0xBF, 0x87, 0x2E, 0x36, 0x69, 0x30, 0xB9, 0x9F, 0xF0, 0x08, 0x14, 0x66, 0x8C, 0x65, 0x29, 0xC6, 0xA7, 0xBD, 0x35, 0x2C, 0xA4, 0x62, 0x46, 0x12, 0xC3, 0xC0, 0x04, 0xDD, 0x58, 0xD7, 0x18, 0x74, 0xD2, 0x49, 0xCC, 0x31, 0x46, 0x87, 0x54, 0x9A, 0x3F, 0xA0, 0x13, 0x68, 0xB2, 0x6C, 0x61, 0x4D, 0xA5, 0x63, 0x52, 0x40, 0x62, 0x05, 0x08, 0x8C, 0x79, 0x1E, 0xCB, 0x59, 0x1B, 0xC8, 0xF2, 0x51, 0x06, 0x9F, 0x36, 0xF9, 0xD2, 0xAB, 0x83, 0xC4, 0x95, 0xA4, 0x11, 0x01, 0x03, 0x46, 0xD3, 0x3E, 0x52, 0xA1, 0x00, 0xAE, 0x1C, 0xF2, 0xDD, 0x79, 0xAD, 0x6A, 0xEA, 0x7F, 0xE8, 0x83, 0x8C, 0xFA, 0x93, 0x54, 0x64, 0x97, 0xE1, 0x06, 0xE3, 0x34, 0x24, 0x65, 0xE1, 0x07, 0xA4, 0x5E, 0x96, 0xCD, 0x0A, 0x10, 0xEE, 0x66, 0x8A, 0x0B, 0x6C, 0x60, 0x56, 0xFC, 0x7D, 0x24, 0x04, 0xCA, 0xE3, 0xBA, 0x0E, 0x1B, 0xB7, 0xFE, 0x3E, 0xB0, 0xB2, 0x56, 0x8F, 0xBA, 0x15, 0x07, 0x87, 0x0B, 0x2A, 0xCD, 0x38, 0xCB, 0xD9, 0xA6, 0x81, 0x22, 0x83, 0x6B, 0xF0, 0x00, 0x93, 0x78, 0xDF, 0x85, 0x93, 0xB0, 0x53, 0xA5, 0xB3, 0x72, 0x4D, 0x41, 0x59, 0x0D, 0xDB, 0xE2, 0x5E, 0x10, 0x78, 0xC2, 0xA5, 0xE2, 0xD6, 0x7D, 0x0E, 0x9A, 0xDD, 0x24, 0x0E, 0x94, 0x95, 0x66, 0x9E, 0xB8, 0xA6, 0x32, 0x15, 0x70, 0x4D, 0x63, 0x8F, 0x23, 0x9D, 0xAA, 0x4A, 0xB3, 0x50, 0xE6, 0xD7, 0xEA, 0x62, 0x79, 0xEB, 0x50, 0x0F, 0xE1, 0x39, 0xA0, 0xE5, 0xF4, 0x38, 0x21, 0x94, 0xFB, 0xB5, 0xBC, 0x8D, 0x75, 0xA2, 0xED, 0x50, 0x8E, 0x8E, 0xB2, 0x72, 0x69, 0x17, 0x9E, 0x58, 0x07, 0xFA, 0x09, 0x77, 0xA5, 0xFA, 0xD8, 0x98, 0x7C, 0xAB, 0x43, 0x0D, 0xDA, 0x01, 0x3A, 0xC6, 0xCA, 0x1B, 0x8B, 0x79, 0x1B, 0xC4, 0xB8, 0xA7, 0x42, 0x32, 0x2A, 0xE4, 0xD3, 0x92, 0x90, 0x75, 0x7E, 0x5C, 0xDC, 0xE3, 0x40, 0xDB, 0xA0, 0x5C, 0xD8, 0xEE, 0xD7, 0x46, 0xFB, 0xF0, 0xD5, 0x19, 0x17, 0xB8, 0x7F, 0x99, 0x06, 0xEA, 0x36, 0xAF, 0x5C, 0xDD, 0x3A, 0x26, 0x57, 0x1F, 0x83, 0xF2, 0x4D, 0xAD, 0x4B, 0x7B, 0x02, 0xC4, 0xC2, 0xD7, 0x4E, 0x5A, 0xE2, 0x4F, 0xDD, 0x26, 0x46, 0x5B, 0x83, 0xF2, 0x49, 0x81, 0xDA, 0x0C, 0x8C, 0xEF, 0x67, 0x7F, 0x54, 0xB7, 0xB0, 0x42, 0x51, 0xD1, 0xBF, 0x4A, 0xB3, 0x2E, 0x96, 0xF0, 0x4C, 0x52, 0x82, 0x98, 0x53, 0xB7, 0x41, 0x19, 0x05, 0x81, 0xBC, 0x79, 0xA0, 0x39, 0xDD, 0xB4, 0xE2, 0xDB, 0xE3, 0xA4, 0x49, 0xFD, 0xC2, 0x0A, 0x5E, 0x23, 0x75, 0x91, 0xAA, 0xC6, 0xB5, 0xA6, 0x49, 0x31, 0x4F, 0x4B, 0xB5, 0xCD, 0x03, 0x52, 0xB7, 0x84, 0xF4, 0xE5, 0x95, 0xF0, 0x14, 0x9D, 0xA8, 0x28, 0x35, 0xE8, 0xD3, 0xF2, 0xB0, 0x0A, 0xC9, 0x72, 0xA1, 0x67, 0x21, 0x42, 0x78, 0x92, 0xFB, 0xB9, 0x55, 0x0A, 0x4C, 0x4F, 0xED, 0x18, 0xEA, 0x65, 0x49, 0xAC, 0x0A, 0xA9, 0x60, 0xB8, 0xD1, 0xCD, 0x08, 0xC6, 0xF4, 0x7E, 0xC0, 0x77, 0xC7, 0x01, 0x13, 0x65, 0xD5, 0x26, 0x30, 0x14, 0x61, 0x06, 0xA4, 0xC3, 0x0B, 0x4E, 0x4C, 0x51, 0x04, 0x40, 0x84, 0xC5, 0x15, 0x50, 0x66, 0x17, 0x92, 0x81, 0xF1, 0x56, 0xFF, 0xD1, 0xFE, 0xE6, 0x5D, 0xA6, 0x15, 0x1D, 0xDB, 0x38, 0x85, 0xB3, 0x1A, 0xC5, 0x03, 0xBA, 0xC7, 0xA1, 0x7E, 0xF6, 0x69, 0x24, 0x61, 0x30, 0xEC, 0x0C, 0x99, 0x41, 0x9A, 0x8A, 0xC4, 0x4A, 0xDA, 0x3F, 0x43, 0x51, 0xD8, 0x15, 0xED, 0x9B, 0x80, 0xC4, 0x99, 0x15, 0x07, 0xF0, 0xAD, 0x04, 0xCD, 0x89, 0xB3, 0x1D, 0x36, 0x5C, 0xDF, 0x14, 0x74, 0xB2, 0x7C, 0x08, 0x26, 0xA6, 0x79, 0x6A, 0xA8, 0xC7, 0xDB, 0xB2, 0x02, 0x41, 0x3F, 0xAE, 0xFA, 0xDC, 0x9E, 0xE0, 0x75, 0xEA, 0xC3, 0xB5, 0xAD, 0x8F, 0x34, 0xDB, 0x5A, 0x81, 0xE4, 0x16, 0xC9, 0x21, 0xBA, 0x58, 0xC1, 0xEB, 0xD3, 0x12, 0x1E, 0xDE, 0x66, 0x43, 0x70, 0x56, 0x6D, 0x0E, 0x02, 0x72, 0x6C, 0x08, 0x34, 0x7B, 0xF1, 0x62, 0x53, 0xFC, 0xC8, 0x80, 0xCF, 0xBB, 0xD4, 0xF0, 0x83, 0xA6, 0x8E, 0xA6, 0x73, 0x15, 0xF5, 0xC3, 0xEA, 0x0E, 0x08, 0x74, 0xD4, 0x06, 0x51, 0xE9, 0x57, 0x94, 0x61, 0x0E, 0x90, 0xD8, 0xA4, 0x91, 0x28, 0x07, 0xC9, 0x97, 0x06, 0xD9, 0x3C, 0x0F, 0x71, 0x25, 0xCB, 0xD7, 0x51, 0x23, 0x61, 0xE7, 0xFE, 0xD6, 0x04, 0x7E, 0x5F, 0x75, 0xD6, 0x85, 0x3E, 0xC7, 0x80, 0xE4, 0x13, 0xE4, 0x5E, 0x3F, 0x48, 0xC8, 0xE4, 0x0A, 0x66, 0x41, 0x02, 0xC3, 0xFD, 0x70, 0x49, 0x76, 0x7E, 0xA7, 0x69, 0x32, 0x93, 0x4E, 0xAE, 0xBE, 0x62, 0x8D, 0xEC, 0x7F, 0x57, 0xF2, 0x05, 0x32, 0xC4, 0x43, 0x5A, 0x59, 0xE8, 0x2B, 0xA4, 0xDB, 0x1C, 0x85, 0xAE, 0x42, 0xC6, 0x6A, 0x2F, 0x1C, 0x94, 0xF6, 0xBC, 0xC1, 0xEC, 0x32, 0x38, 0x0D, 0xD2, 0xB6, 0x87, 0xB6, 0xBD, 0xD5, 0x27, 0x29, 0x13, 0x7E, 0x05, 0x46, 0x51, 0xBD, 0x15, 0x71, 0xD2, 0x65, 0x6B, 0xC9, 0x6D, 0x6B, 0x41, 0x54, 0xB5, 0x21, 0x6A, 0xA3, 0x9F, 0x62, 0x25, 0x07, 0x41, 0x50, 0x98, 0xDE, 0xE0, 0x8D, 0x61, 0x37, 0xF6, 0x0B, 0x84, 0xD2, 0xD8, 0x9C, 0xA1, 0xAA, 0x2D, 0xFD, 0x55, 0xBE, 0xBD, 0xD9, 0x83, 0x17, 0xFD, 0x21, 0x8F, 0x24, 0x08, 0xD7, 0x9C, 0xDD, 0xF4, 0x1E, 0x49, 0x2C, 0x6A, 0x4B, 0xED, 0xE3, 0xF6, 0xCF, 0xAE, 0x44, 0x75, 0x25, 0x3C, 0x87, 0xB5, 0xB1, 0x6E, 0x95, 0x5E, 0xBA, 0xC7, 0xA3, 0xBE, 0x95, 0x62, 0x60, 0x19, 0x91, 0xA2, 0xC9, 0xFD, 0x49, 0x83, 0x1D, 0x55, 0xE1, 0xC9, 0x53, 0xFE, 0xDF, 0x69, 0x55, 0x8F, 0xA7, 0xF0, 0x04, 0x04, 0x96, 0x31, 0x0F, 0x20, 0x31, 0x08, 0xAC, 0xB0, 0x1F, 0xBA, 0x2D, 0xEA, 0x0F, 0x17, 0x01, 0x4F, 0x00, 0x25, 0x57, 0x7D, 0x13, 0x90, 0x70, 0x0A, 0xE5, 0xCA, 0x42, 0xE0, 0x2D, 0x4A, 0xBD, 0x0E, 0x03, 0x61, 0x25, 0xA3, 0x53, 0x48, 0x28, 0xD6, 0x7C, 0xE7, 0xBE, 0xA8, 0x4F, 0xA7, 0x4A, 0x4F, 0x91, 0xB8, 0x4B, 0x25, 0x4D, 0xDC, 0xDB, 0x47, 0xC2, 0x4E, 0x55, 0xE0, 0xBB, 0xF7, 0xBF, 0x29, 0x15, 0x63, 0xD7, 0x54, 0x0B, 0x82, 0xE4, 0xB4, 0xE4, 0x7E, 0xC2, 0x93, 0x52, 0xD5, 0x85, 0x9D, 0x07, 0x5C, 0xFC, 0xF1, 0x6F, 0xF5, 0x41, 0xF5, 0x18, 0xC0, 0xB1, 0x5C, 0xED, 0x23, 0x61, 0x5B, 0x69, 0xF2, 0x70, 0x9E, 0x77, 0xF9, 0x17, 0xD6, 0x43, 0xCB, 0xEF, 0x26, 0x5D, 0xCE, 0xF2, 0xBF, 0x3A, 0xF4, 0xDA, 0x00, 0x71, 0x95, 0xAF, 0xAA, 0xFA, 0x6A, 0x5D, 0x23, 0x6F, 0x53, 0xC0, 0x36, 0xC7, 0x7A, 0x79, 0x57, 0x55, 0x10, 0xA4, 0xD4, 0x24, 0x5B, 0x5F, 0x88, 0xA0, 0xA0, 0xD7, 0x4B, 0x99, 0xF5, 0x72, 0xBC, 0xA4, 0xC7, 0xD1, 0x55, 0xCB, 0xEA, 0xB6, 0xFC, 0x49, 0x54, 0xBD, 0x8C, 0xC7, 0xAD, 0x5F, 0xF1, 0x10, 0x42, 0x12, 0xB7, 0x2E, 0xC5, 0xC9, 0x3B, 0x1C, 0x1A, 0xEB, 0x18, 0x90, 0xEE, 0xBF, 0x77, 0x74, 0x89, 0x7F, 0x29, 0x51, 0xEE, 0xD7, 0x6E, 0xD5, 0xBB, 0xF5, 0x4D, 0x14, 0xA2, 0xB7, 0x1E, 0x5C, 0xD7, 0xF8, 0x15, 0x5D, 0xC2, 0xDC, 0x66, 0xB2, 0x0C, 0x3D, 0x86, 0x94, 0xAC, 0x93, 0x59, 0x2A, 0x51, 0xA9, 0x53, 0x35, 0xDC, 0x3B, 0xB5, 0xC0, 0x7A, 0x28, 0xAF, 0x7A, 0xD4, 0x9A, 0x15, 0x51, 0x19, 0x0C, 0x3C, 0x56, 0xF9, 0x91, 0x14, 0x4B, 0x8E, 0xC4, 0xE8, 0x98, 0xBC, 0x13, 0x1A, 0x2C, 0x55, 0x97, 0x2F, 0x90, 0xF8, 0xF7, 0x88, 0x82, 0x3E, 0x12, 0x07, 0x4A, 0x43, 0xEF, 0x96, 0xD2, 0xE5, 0x5F, 0xE0, 0xC5, 0x79, 0x63, 0xAF, 0x7E, 0xFE, 0xDA, 0x7F, 0xFD, 0xF0, 0x2A, 0x71, 0x27, 0x69, 0x32, 0xF9, 0xBF, 0xB3, 0xC6, 0xF7, 0x5D, 0x3F, 0x78, 0xB9, 0x68, 0xB8, 0xC4, 0xFF, 0x33, 0xEF, 0x72, 0xF9, 0xBA, 0x46, 0x51, 0x5F, 0x98, 0xE6, 0x48, 0x90, 0xF7, 0x38, 0xD2, 0x3C, 0xA2, 0x37, 0xFF, 0xDE, 0x51, 0xF3, 0x42, 0xAD, 0xB3, 0xF6, 0x42, 0xDD, 0x90, 0x86, 0x87, 0x40, 0xB6, 0xC1, 0x2D, 0x40, 0x19, 0x48, 0x8B, 0x4C, 0x99, 0x92, 0x5B, 0x8B, 0xB9, 0xFB, 0x7B, 0x48, 0xFC, 0xC7, 0xA6, 0xC3, 0xA4, 0xA2, 0x46, 0xC4, 0x87, 0xC1, 0x4B, 0x22, 0x23, 0x9A, 0x9A, 0x20, 0x88, 0x6E, 0x67, 0x84, 0xA6, 0x5F, 0x92, 0xCA, 0x17, 0x97, 0x78, 0x65, 0xDD, 0x12, 0x29, 0xE6, 0xA5, 0x9A, 0x38, 0xF9, 0x41, 0xC7, 0xB4, 0xA3, 0x82, 0xD1, 0x28, 0xC7, 0x40, 0x57, 0xFD, 0x18, 0x78, 0x35, 0x97, 0x7B, 0x3F, 0x57, 0xC1, 0xCD, 0x9D, 0x46, 0x75, 0x9F, 0x9C, 0xD0, 0x9E, 0xB2, 0xCA, 0x91, 0x86, 0x6D, 0x7F, 0xA4, 0x92, 0xAA, 0x95, 0x48, 0xB4, 0x0B, 0x8D, 0x9E, 0x3A, 0x71, 0xEA, 0x38, 0xB7, 0xC0, 0xA0, 0x5D, 0xB6, 0xD3, 0x3A, 0x6E, 0xAE, 0x1C, 0xD5, 0x60, 0x27, 0x69, 0xEE, 0x6F, 0xB5, 0xE0, 0xB5, 0x2A, 0xA9, 0x2E, 0x2F, 0x5A, 0xE7, 0x94, 0xB8, 0x28, 0x98, 0x94, 0x8D, 0x20, 0xCC, 0xE1, 0xFD, 0x0D, 0xB9, 0xBF, 0x51, 0x20, 0xE0, 0x60, 0x24, 0x67, 0x3E, 0x6D, 0x5A, 0x42, 0xF5, 0x5B, 0x90, 0x69, 0x6B, 0xE3, 0x4B, 0xDC, 0xCB, 0x38, 0x08, 0xDC, 0x6B, 0xF8, 0xC6, 0x5A, 0xCC, 0xDB, 0x20, 0x3C, 0x25, 0xEE, 0xDC, 0xE3, 0xB8, 0xED, 0x50, 0xD7, 0xB6, 0xFF, 0x1D, 0xC7, 0xE6, 0x84, 0xC0, 0xDA, 0x33, 0xCB, 0x8D, 0x6C, 0x00, 0x9F, 0x5F, 0x7C, 0xAC, 0x9C, 0xC8, 0x88, 0xA4, 0xDE, 0xFF, 0xAF, 0x9C, 0x71, 0xA9, 0x74, 0xA7, 0xA4, 0xDD, 0x1B, 0x9A, 0xFC, 0x9D, 0x05, 0x3B, 0x24, 0x96, 0x36, 0xDC, 0x95, 0x18, 0x8B, 0x72, 0x65, 0x5C, 0x7C, 0xAC, 0xE8, 0x2B, 0x25, 0xBB, 0x6F, 0xEF, 0xCE, 0xDA, 0xDB, 0xB3, 0x37, 0x65, 0xDF, 0xC9, 0x7D, 0xAB, 0x5E, 0xFF, 0x2A, 0xBB, 0x24, 0xE7, 0x76, 0x4E, 0x56, 0x6E, 0x4F, 0xEE, 0x73, 0xA2, 0xBA, 0xC2, 0x1E, 0x9D, 0x61, 0x43, 0x29, 0x6F, 0x0B, 0x55, 0x21, 0xFA, 0xEA, 0x2F, 0x4E, 0x4D, 0xB4, 0xDD, 0xBE, 0x74, 0xEB, 0xCA, 0xE8, 0x8D, 0x9B, 0xA3, 0x37, 0x6E, 0x5F, 0xFB, 0xE2, 0xCA, 0xBD, 0x91, 0xE9, 0x4B, 0x0F, 0x7D, 0x7F, 0xF5, 0xA4, 0x5D, 0x89, 0x60, 0x6D, 0x39, 0xB7, 0x45, 0x75, 0x59, 0xC0, 0x94, 0xC6, 0x16, 0x86, 0x62, 0x7C, 0x5A, 0x12, 0xC3, 0x40, 0xC2, 0xE0, 0x67, 0x39, 0xA6, 0x72, 0x12, 0x86, 0xB4, 0x85, 0xAE, 0x25, 0x3B, 0x1F, 0x84, 0xF4, 0x67, 0x23, 0x24, 0x4E, 0x13, 0x91, 0x1D, 0x8E, 0x25, 0x30, 0x73, 0xBF, 0xE2, 0x83, 0xF1, 0xA0, 0x65, 0x10, 0xD9, 0xB1, 0xC9, 0x2D, 0xD8, 0x80, 0x91, 0x62, 0x6F, 0xBD, 0xC2, 0x57, 0xDB, 0x56, 0x91, 0x30, 0xBE, 0xA3, 0xB9, 0x9F, 0xB4, 0x41, 0x85, 0x3A, 0x11, 0x02, 0x8A, 0xDA, 0x68, 0x57, 0xB7, 0x12, 0x80, 0x84, 0xED, 0x4F, 0xF2, 0xD5, 0x70, 0x75, 0x73, 0x3F, 0x6F, 0xF3, 0xAE, 0x6A, 0x4E, 0xA7, 0x08, 0x60, 0xCE, 0xB7, 0x37, 0x0F, 0x48, 0x39, 0x81, 0xF5, 0x69, 0xA9, 0x72, 0xBF, 0x56, 0x64, 0x50, 0xAC, 0x63, 0x2F, 0x6E, 0x6A, 0x55, 0xB7, 0x42, 0xD0, 0x08, 0x03, 0x8F, 0x82, 0xDF, 0xE8, 0x5E, 0x6C, 0xD4, 0xFF, 0x44, 0x5E, 0xBA, 0xE3, 0x80, 0x46, 0x08, 0xF9, 0xC4, 0x0A, 0xD6, 0xB9, 0xA9, 0x38, 0xCD, 0xA1, 0x4E, 0x0C, 0xC9, 0x05, 0xF8, 0x7D, 0x9A, 0x32, 0x48, 0x31, 0xDB, 0x13, 0xEA, 0xC4, 0x25, 0x20, 0x1C, 0xF6, 0x6B, 0xF3, 0xB7, 0x93, 0x0A, 0x05, 0xE0, 0x6B, 0x0C, 0x4E, 0x4E, 0x81, 0xC7, 0x08, 0x9B, 0x95, 0x46, 0x3D, 0xFB, 0x87, 0x31, 0xAB, 0x5E, 0xAF, 0x8F, 0xF8, 0xEC, 0x8E, 0x80, 0x7F, 0x9F, 0x46, 0x32, 0x78, 0x2B, 0x0E, 0xFE, 0x11, 0x9B, 0x12, 0x28, 0xCC, 0x18, 0xCB, 0x36, 0x0F, 0x53, 0xB8, 0x0C, 0x84, 0x63, 0x89, 0x53, 0xE1, 0xB3, 0x75, 0x56, 0x60, 0x81, 0xB1, 0xE5, 0x47, 0x8A, 0xFB, 0x73, 0x75, 0x77, 0xE3, 0xC9, 0xF3, 0xF1, 0xA0, 0x22, 0xF2, 0xCA, 0xCC, 0xBB, 0x8B, 0x85, 0x41, 0x9F, 0x76, 0x39, 0x9E, 0x84, 0x20, 0xC6, 0x5A, 0xA4, 0x2B, 0x12, 0x70, 0x80, 0x20, 0x7A, 0xBE, 0xAA, 0x0A, 0x11, 0xB2, 0x7C, 0x5A, 0x55, 0x49, 0xB8, 0x0E, 0x1C, 0x21, 0xEB, 0x6A, 0x91, 0xE4, 0x93, 0x96, 0x76, 0xBF, 0x7C, 0xE1, 0x8E, 0xE5, 0xB7, 0x7E, 0xB9, 0x95, 0x55, 0xB7, 0x29, 0xE4, 0x6A, 0xD9, 0x9C, 0xCC, 0xE2, 0xFD, 0x2E, 0x50, 0xB0, 0x6A, 0xF2, 0xAE, 0xEC, 0x37, 0xE2, 0x4D, 0x76, 0x33, 0x97, 0xE5, 0x2A, 0x82, 0xF2, 0x7C, 0x96, 0xB3, 0x07, 0x89, 0xE7, 0x58, 0xEE, 0xD7, 0x41, 0x60, 0xF1, 0xBE, 0x08, 0x50, 0xEF, 0xF3, 0xE0, 0x14, 0x1C, 0xB7, 0xC7, 0xB2, 0xDC, 0x87, 0x62, 0xA4, 0xBD, 0x0E, 0xB4, 0xA4, 0xA7, 0xDD, 0x3C, 0xB3, 0xE3, 0x63, 0x7D, 0x66, 0x4C, 0xFE, 0xF6, 0x7F, 0xAA, 0x28, 0xD6, 0x41, 0xEE, 0xDD, 0x10, 0x46, 0xE2, 0x9D, 0xAA, 0xE5, 0x54, 0x12, 0x77, 0xA9, 0xEE, 0x8B, 0xDF, 0xA9, 0x27, 0x2E, 0xA7, 0x9E, 0xDD, 0xA2, 0x13, 0xA2, 0xC8, 0xAD, 0xE8, 0xDA, 0x08, 0x06, 0xFA, 0x3A, 0x05, 0x81, 0xB1, 0x90, 0x25, 0x71, 0x20, 0x13, 0xB5, 0x8C, 0x29, 0xF4, 0x2A, 0x04, 0xBF, 0xB8, 0xCF, 0x9C, 0x2C, 0x57, 0x40, 0xC5, 0xDD, 0xAE, 0x67, 0x70, 0xC1, 0x69, 0x99, 0x35, 0x83, 0x9B, 0x9E, 0x06, 0x48, 0x0E, 0x89, 0xCD, 0xAE, 0xB1, 0x7E, 0x72, 0x38, 0x9E, 0x2C, 0x0F, 0xAD, 0xF1, 0x67, 0x04, 0xBE, 0x9C, 0xFE, 0x46, 0x78, 0xCF, 0xAF, 0x5D, 0x05, 0xF9, 0xEA, 0xEA, 0x8B, 0xDB, 0x1D, 0xEB, 0xD3, 0x65, 0x36, 0x9E, 0x80, 0x28, 0xBF, 0xB8, 0xB8, 0x26, 0x36, 0x23, 0x70, 0x68, 0xF4, 0x6B, 0xD1, 0x3B, 0x32, 0xA9, 0xB6, 0x21, 0x83, 0xFB, 0x72, 0x7A, 0x55, 0xB4, 0x36, 0xC3, 0x15, 0xAE, 0x25, 0x21, 0x2D, 0xE3, 0x9A, 0x82, 0x4F, 0xCA, 0x6E, 0x6E, 0x64, 0x10, 0x7D, 0x45, 0x2A, 0xA2, 0x2F, 0x4D, 0x2D, 0xD8, 0x9E, 0xBB, 0x5D, 0x42, 0x65, 0x8A, 0x2B, 0x4B, 0x2D, 0x9B, 0x47, 0x72, 0x10, 0x86, 0x2C, 0x9B, 0x5F, 0xD3, 0xF4, 0x12, 0x59, 0xF6, 0xF5, 0x9A, 0xDE, 0xD4, 0xBD, 0xDB, 0x03, 0x4F, 0x61, 0x0F, 0x25, 0xCE, 0x0C, 0x2C, 0xF7, 0x46, 0x68, 0xAB, 0x82, 0x0D, 0xBC, 0x17, 0x7A, 0xB8, 0x10, 0xCF, 0x87, 0x42, 0x6B, 0x76, 0xB2, 0x01, 0x63, 0xE8, 0xA1, 0xE4, 0xA1, 0x5A, 0x28, 0x3A, 0xC8, 0xDD, 0xE3, 0x68, 0x49, 0xAF, 0xB4, 0xE1, 0xCC, 0xC7, 0x7F, 0x16, 0x20, 0xA0, 0xD1, 0x76, 0x16, 0x39, 0xC1, 0xBE, 0x1D, 0x53, 0xA1, 0x47, 0xF4, 0xDC, 0x72, 0x10, 0x38, 0xAE, 0x8D, 0x48, 0xCA, 0x74, 0xE1, 0x0C, 0xFE, 0xE0, 0xBA, 0xFE, 0x27, 0x31, 0x3B, 0x5F, 0x42, 0x98, 0x8D, 0xAD, 0x8E, 0x4E, 0x29, 0x6A, 0x5C, 0x7E, 0x24, 0xE0, 0x4C, 0xC5, 0x8C, 0x63, 0xD6, 0x2B, 0x79, 0xE3, 0x6D, 0x4D, 0x6A, 0x2B, 0x78, 0xAE, 0x75, 0x13, 0xCB, 0x59, 0x83, 0x00, 0x67, 0x90, 0x9C, 0x5E, 0x01, 0xFD, 0xB4, 0x0E, 0xA0, 0xA7, 0x87, 0x41, 0x57, 0x71, 0x3D, 0xB8, 0x01, 0x17, 0x42, 0x33, 0xB3, 0x77, 0xCC, 0xA6, 0x39, 0xF7, 0x9B, 0x49, 0x2D, 0xCB, 0x09, 0x26, 0x93, 0x06, 0xAF, 0xA7, 0x73, 0x6F, 0x75, 0x95, 0x37, 0x21, 0x4D, 0x01, 0xF7, 0x9B, 0xD2, 0x8D, 0x9B, 0xAE, 0x97, 0x2D, 0xBF, 0x2F, 0xFD, 0x19, 0x26, 0xB6, 0x54, 0x44, 0xFA, 0xFE, 0xB4, 0x60, 0xA9, 0xE8, 0xF8, 0x82, 0xF0, 0x8F, 0x7B, 0x49, 0xC1, 0x5C, 0xC9, 0xF1, 0xEB, 0x82, 0x2E, 0x72, 0x6F, 0x3D, 0x94, 0xBF, 0xA4, 0xC1, 0x8E, 0xEB, 0xDC, 0xC2, 0x26, 0x36, 0x50, 0x1F, 0xFC, 0xAB, 0xC4, 0x3E, 0x50, 0x5E, 0xEE, 0xD5, 0xB1, 0x97, 0xFB, 0x74, 0x2C, 0xCE, 0x04, 0x5A, 0x82, 0x8B, 0x96, 0x33, 0xC3, 0x00, 0x3D, 0x53, 0x07, 0xF6, 0x6F, 0x3D, 0x17, 0x8E, 0x1D, 0x0B, 0x2E, 0xA2, 0xED, 0xAB, 0x91, 0xC6, 0x62, 0xEE, 0x61, 0xF0, 0x29, 0xCB, 0x99, 0x6C, 0x44, 0xCA, 0xCE, 0xCC, 0xAE, 0xF9, 0x7A, 0x5B, 0x34, 0x3F, 0x6F, 0x11, 0xF3, 0xB1, 0xC5, 0x5C, 0x49, 0x28, 0x01, 0x6D, 0x1F, 0x06, 0xD1, 0x1A, 0x4D, 0x55, 0x50, 0x36, 0x33, 0x6B, 0x5F, 0x52, 0x7F, 0x8A, 0x01, 0xF5, 0xD3, 0xB5, 0x9D, 0x5B, 0x44, 0xF5, 0x31, 0xC0, 0xA1, 0x30, 0x0E, 0x15, 0xDD, 0xE6, 0x8E, 0x97, 0x66, 0x73, 0x64, 0x08, 0xB8, 0x32, 0x11, 0x96, 0x27, 0x66, 0x9F, 0xE0, 0x32, 0x42, 0xA2, 0x77, 0x5F, 0x17, 0x7D, 0x97, 0x2D, 0xFA, 0x42, 0x72, 0x1E, 0xEA, 0xFD, 0x29, 0xD8, 0x05, 0xF7, 0xDB, 0x2D, 0xDE, 0x5F, 0x82, 0x7B, 0xE2, 0x3D, 0x50, 0xB5, 0xF8, 0x27, 0x12, 0x8B, 0x51, 0x56, 0x9C, 0xD7, 0x54, 0xFF, 0x19, 0xA0, 0x19, 0xD5, 0x08, 0x0E, 0xCF, 0x1D, 0xB9, 0x2B, 0x58, 0xC4, 0xBE, 0xCB, 0xDE, 0x09, 0x86, 0xFB, 0x08, 0xC6, 0xB9, 0x32, 0xD5, 0x66, 0x0C, 0x98, 0xCE, 0x1F, 0x90, 0x7C, 0x2D, 0xB3, 0xB4, 0x0F, 0x23, 0xE2, 0x34, 0xC4, 0xD2, 0x26, 0xEE, 0xD4, 0xB6, 0x1A, 0x89, 0xA2, 0x8B, 0xF0, 0xB1, 0x37, 0xA5, 0x5E, 0x52, 0x62, 0xE8, 0x22, 0x92, 0x83, 0x33, 0x8F, 0xBA, 0x62, 0x25, 0x3C, 0x27, 0x83, 0xD3, 0x82, 0x03, 0x18, 0xBB, 0xD3, 0xDF, 0x28, 0x37, 0xC5, 0xE3, 0x45, 0x4B, 0x47, 0xAE, 0x1F, 0x91, 0x5E, 0x74, 0x0F, 0x74, 0xB3, 0x15, 0x7A, 0xE9, 0xD6, 0xED, 0x9D, 0x4F, 0x97, 0xCE, 0xF9, 0x81, 0x9B, 0x3F, 0x2A, 0xB3, 0xE7, 0xDB, 0x6F, 0xDD, 0x09, 0x77, 0x73, 0xED, 0x41, 0x7A, 0xC9, 0x50, 0x08, 0x04, 0xD6, 0xC2, 0x87, 0xFC, 0x04, 0x0B, 0xC8, 0xAA, 0x3A, 0x11, 0x87, 0x69, 0x7F, 0xA0, 0xBC, 0x65, 0x3C, 0x93, 0x09, 0xD7, 0xD0, 0xCC, 0x7A, 0x66, 0x37, 0x1D, 0x43, 0x2F, 0x1D, 0xE1, 0x60, 0x3B, 0x92, 0xB0, 0x8B, 0x64, 0x43, 0x2B, 0x26, 0xFB, 0xF8, 0x91, 0xB8, 0x7E, 0x5C, 0xA9, 0xC3, 0xC6, 0xFB, 0x62, 0xD9, 0x33, 0xE7, 0x1F, 0xB3, 0xEA, 0x08, 0x7E, 0x61, 0x11, 0x59, 0x42, 0xDB, 0xB3, 0x11, 0x75, 0xCA, 0x12, 0x50, 0x3F, 0xFB, 0x00, 0xE4, 0x5E, 0xB4, 0x3C, 0xA3, 0x40, 0xDC, 0xF1, 0x8D, 0xF7, 0x6B, 0xAE, 0x4A, 0xCA, 0x19, 0x95, 0xCF, 0x5C, 0x44, 0x37, 0x1B, 0x10, 0xAE, 0x28, 0x44, 0x90, 0x21, 0x0A, 0x04, 0x36, 0xC0, 0x7B, 0xE8, 0xB3, 0x06, 0x04, 0xC9, 0x40, 0x58, 0x0D, 0xFE, 0x25, 0xDD, 0x55, 0x7D, 0x1F, 0x70, 0x87, 0xC4, 0x7D, 0x20, 0x71, 0x4D, 0x9D, 0x72, 0x56, 0xEC, 0x31, 0x0E, 0x14, 0x5D, 0x12, 0x73, 0x31, 0x79, 0xB1, 0xF0, 0x68, 0x3F, 0x9E, 0xF1, 0xA0, 0x6F, 0x93, 0x34, 0xAB, 0x31, 0x78, 0x0B, 0x7D, 0xDA, 0x80, 0x6C, 0x70, 0x91, 0x98, 0x59, 0xA9, 0x4E, 0x51, 0x88, 0x95, 0x0A, 0xA0, 0x49, 0x35, 0x83, 0x33, 0x5D, 0xD2, 0x9C, 0x44, 0xA5, 0xFB, 0x8F, 0xD2, 0x69, 0x56, 0xDE, 0x3D, 0x27, 0x9D, 0x47, 0x95, 0xEE, 0x73, 0x24, 0x4C, 0x54, 0x71, 0x96, 0xA0, 0x92, 0x84, 0xB4, 0x2A, 0xF0, 0xEF, 0xC1, 0x0B, 0xE8, 0xE0, 0x8B, 0xC0, 0xE2, 0x7D, 0x1E, 0x24, 0x61, 0xFB, 0xEB, 0xC3, 0x48, 0x13, 0x77, 0xA1, 0x9F, 0x0E, 0x02, 0x5D, 0x1C, 0xF7, 0x4E, 0x15, 0x92, 0x54, 0x1F, 0x50, 0x2A, 0xBB, 0x5D, 0xF4, 0xC1, 0xE3, 0x5B, 0xCC, 0x2D, 0x99, 0x5C, 0xC1, 0x2C, 0x68, 0x61, 0xB8, 0xD7, 0xE7, 0x57, 0xCD, 0xCC, 0x5E, 0xF5, 0x94, 0x4D, 0xFA, 0xE8, 0x83, 0xD5, 0xBC, 0xB5, 0x0E, 0x89, 0xBC, 0x4B, 0x43, 0x86, 0x78, 0x48, 0x2B, 0x27, 0x7C, 0x13, 0xF4, 0x3D, 0xC7, 0x84, 0x6B, 0x82, 0xE9, 0xB2, 0xD9, 0x74, 0x13, 0x83, 0xE1, 0x2C, 0xD8, 0xB9, 0xE3, 0x82, 0xE2, 0x0D, 0x12, 0xC7, 0x4B, 0xD1, 0x4F, 0x45, 0x25, 0x4F, 0x47, 0x95, 0x74, 0xBD, 0x20, 0x40, 0x60, 0xBC, 0x95, 0x2D, 0x10, 0x00, 0x71, 0xAF, 0xE3, 0xF7, 0xB0, 0xC8, 0x93, 0xB0, 0xCC, 0xDE, 0x5B, 0x37, 0x6E, 0x17, 0x5F, 0xA3, 0x88, 0xBE, 0xEB, 0x73, 0x9B, 0x2C, 0xA2, 0xF9, 0xBF, 0x91, 0xB8, 0x39, 0x2D, 0xFC, 0x6F, 0x7C, 0xDE, 0xDD, 0xFD, 0x7F, 0x9D, 0x21, 0xEE, 0x14, 0x7A, 0xAB, 0xDB, 0x32, 0x14, 0xC6, 0x43, 0x8A, 0x7B, 0x9D, 0xC2, 0x27, 0x1B, 0xDC, 0x6B, 0x67, 0x66, 0xFF, 0xE3, 0x9A, 0xE1, 0x33, 0xD1, 0xF7, 0xAE, 0x9D, 0x7D, 0x51, 0xB4, 0x64, 0x7D, 0x1D, 0x22, 0x21, 0x9E, 0x60, 0x74, 0x71, 0x97, 0x03, 0x8D, 0xAC, 0x35, 0x9B, 0x5B, 0xB1, 0xC9, 0x79, 0x78, 0x54, 0xDC, 0xFE, 0xA3, 0x6E, 0xB4, 0x5D, 0x05, 0x92, 0xAE, 0xE1, 0x99, 0x5D, 0xB6, 0xBF, 0xD0, 0x69, 0xA3, 0x96, 0xCD, 0xB5, 0x9D, 0xDC, 0x3B, 0xF3, 0x40, 0x95, 0xB9, 0xCB, 0xF3, 0x83, 0xC1, 0x99, 0x59, 0xFB, 0xC5, 0x24, 0x76, 0x6B, 0x26, 0x35, 0xE4, 0xD3, 0xDE, 0xB3, 0xBE, 0x1F, 0xC3, 0x57, 0xD7, 0x22, 0x31, 0x31, 0x22, 0x2E, 0x34, 0x82, 0xF3, 0x5F, 0xA9, 0x90, 0x4F, 0xCB, 0xCB, 0x6D, 0x48, 0xE5, 0x1E, 0xB4, 0xFD, 0x83, 0x4E, 0xCB, 0x19, 0x15, 0xD8, 0x58, 0xBF, 0xD1, 0x9E, 0xD6, 0xE2, 0xDC, 0xA3, 0x3E, 0xFD, 0x65, 0x67, 0x47, 0xDD, 0x7F, 0x36, 0xA9, 0x5B, 0x7B, 0x01, 0x6F, 0xAB, 0x45, 0x3E, 0x6A, 0x40, 0x86, 0x3E, 0x2E, 0xE6, 0x1C, 0x0B, 0x60, 0x9F, 0x75, 0x66, 0xF6, 0x65, 0x8F, 0xBA, 0xF5, 0x2D, 0x44, 0x31, 0x38, 0xC1, 0x9C, 0x18, 0x08, 0xBC, 0xFC, 0x76, 0x88, 0xBB, 0xB3, 0x1A, 0xF0, 0xF0, 0x6D, 0x65, 0xAF, 0x60, 0xCD, 0x16, 0x4C, 0x7E, 0xAD, 0x30, 0x22, 0xF6, 0x6D, 0xC8, 0xBD, 0xC8, 0xD7, 0xD7, 0x23, 0x0F, 0xFA, 0x02, 0x47, 0x57, 0xB7, 0x4C, 0x30, 0x81, 0x06, 0x78, 0x92, 0x87, 0x66, 0xE5, 0x59, 0x41, 0xF2, 0x5C, 0xE0, 0x43, 0x78, 0x52, 0xC4, 0x79, 0x35, 0xCC, 0x73, 0x84, 0xDF, 0xF5, 0x22, 0x2F, 0xFE, 0xC8, 0x6E, 0x09, 0x87, 0x9C, 0xE8, 0xE9, 0x61, 0x10, 0x90, 0x61, 0xCD, 0x22, 0x8E, 0x91, 0x6F, 0xF1, 0xB9, 0x6E, 0x66, 0xF6, 0xE7, 0x5E, 0xD9, 0xF1, 0xDF, 0x39, 0x67, 0x66, 0x67, 0x3C, 0x8B, 0xAF, 0x14, 0xED, 0x1E, 0xDD, 0x9D, 0xB1, 0xF7, 0xC2, 0xDE, 0xE4, 0x7D, 0x1F, 0xEE, 0x23, 0x5E, 0x5F, 0xCC, 0x2E, 0xCA, 0x19, 0xCD, 0xC9, 0xC8, 0xBD, 0x90, 0xAB, 0x38, 0x50, 0x69, 0xFE, 0x5F, 0x93, 0x74, 0x57, 0xE4
     },
+    .text_zlen = 3200,
     .text_len = 3868,
     .data = (uint8_t const[]){
-        0x18, 0x40, 0xC8, 0x3F, 0xC0, 0x0A, 0x38, 0x40, 0x10, 0x0B, 0x38, 0x40, 0x68, 0x0B, 0x38, 0x40, 0x36, 0x0C, 0x38, 0x40, 0xA2, 0x0C, 0x38, 0x40, 0x50, 0x0C, 0x38, 0x40, 0x72, 0x09, 0x38, 0x40, 0xF2, 0x0B, 0x38, 0x40, 0x32, 0x0C, 0x38, 0x40, 0x7C, 0x0B, 0x38, 0x40, 0x22, 0x09, 0x38, 0x40, 0xB0, 0x0B, 0x38, 0x40, 0x22, 0x09, 0x38, 0x40, 0x9A, 0x0A, 0x38, 0x40, 0xE0, 0x0A, 0x38, 0x40, 0x10, 0x0B, 0x38, 0x40, 0x68, 0x0B, 0x38, 0x40, 0xAC, 0x0A, 0x38, 0x40, 0xD6, 0x09, 0x38, 0x40, 0x20, 0x0A, 0x38, 0x40, 0xA8, 0x0A, 0x38, 0x40, 0xFA, 0x0E, 0x38, 0x40, 0x10, 0x0B, 0x38, 0x40, 0xBA, 0x0D, 0x38, 0x40, 0xB2, 0x0E, 0x38, 0x40, 0x62, 0x08, 0x38, 0x40, 0xDA, 0x0E, 0x38, 0x40, 0x62, 0x08, 0x38, 0x40, 0x62, 0x08, 0x38, 0x40, 0x62, 0x08, 0x38, 0x40, 0x62, 0x08, 0x38, 0x40, 0x62, 0x08, 0x38, 0x40, 0x62, 0x08, 0x38, 0x40, 0x62, 0x08, 0x38, 0x40, 0x62, 0x08, 0x38, 0x40, 0x56, 0x0D, 0x38, 0x40, 0x62, 0x08, 0x38, 0x40, 0xD8, 0x0D, 0x38, 0x40, 0xB2, 0x0E, 0x38, 0x40
+        0x28, 0xCF, 0x93, 0x70, 0x38, 0x61, 0x7F, 0x80, 0xCB, 0xC2, 0x41, 0x80, 0xDB, 0xC2, 0x21, 0x03, 0x88, 0xCD, 0x78, 0x2C, 0x1C, 0x16, 0x01, 0x71, 0x00, 0x10, 0x17, 0x71, 0x5A, 0x38, 0x7C, 0x02, 0x8A, 0x19, 0x01, 0xD9, 0x35, 0x40, 0x5A, 0x09, 0xC8, 0xDF, 0x00, 0xA5, 0x67, 0x01, 0xF5, 0x3C, 0x40, 0xD2, 0xB7, 0x06, 0xC8, 0xBE, 0x06, 0x14, 0x57, 0x00, 0xD2, 0x2B, 0x80, 0xF8, 0x17, 0x1F, 0x44, 0x6E, 0x17, 0xAF, 0x85, 0xC3, 0x26, 0x20, 0x3B, 0x89, 0xC3, 0xC2, 0xE1, 0x16, 0x94, 0xC6, 0x87, 0xC3, 0x78, 0x21, 0xF4, 0x0D, 0xA8, 0x3E, 0x00, 0x8D, 0xCC, 0x27, 0xE5
     },
+    .data_zlen = 93,
     .data_len = 160,
     .text_start = 0x40380000,
     .data_start = 0x3FC96BB4,
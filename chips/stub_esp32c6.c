@@ -1,17 +1,20 @@
 // WARNING: This is a generated file, do not edit it!
 // clang-format off
 // Generated from c6.json
+// The text and data segments are zlib streams with a 1024 byte window
 
 #include "chips.h"
 
 et2_stub_t const stub_esp32c6 = {
     .text = (uint8_t const[]){
-        0x41, 0x11, 0x22, 0xC4, 0x26, 0xC2, 0x06, 0xC6, 0xB7, 0xF7, 0x00, 0x60, 0x11, 0x47, 0x37, 0x04, 0x84, 0x40, 0xD8, 0xCB, 0xB7, 0xF4, 0x00, 0x60, 0x13, 0x04, 0x04, 0x00, 0xDC, 0x40, 0x91, 0x8B, 0x91, 0xE7, 0xB2, 0x40, 0x22, 0x44, 0x92, 0x44, 0x41, 0x01, 0x82, 0x80, 0x88, 0x40, 0x1C, 0x40, 0x13, 0x75, 0xF5, 0x0F, 0x82, 0x97, 0xDD, 0xB7, 0x01, 0x11, 0xB7, 0x07, 0x00, 0x60, 0x4E, 0xC6, 0x83, 0xA9, 0x87, 0x00, 0x4A, 0xC8, 0x37, 0x09, 0x84, 0x40, 0x26, 0xCA, 0x52, 0xC4, 0x06, 0xCE, 0x22, 0xCC, 0xB7, 0x04, 0x00, 0x60, 0x7D, 0x5A, 0x13, 0x09, 0x09, 0x00, 0xC0, 0x4C, 0x13, 0x74, 0xF4, 0x0F, 0x0D, 0xE0, 0xF2, 0x40, 0x62, 0x44, 0x23, 0xA8, 0x34, 0x01, 0x42, 0x49, 0xD2, 0x44, 0xB2, 0x49, 0x22, 0x4A, 0x05, 0x61, 0x82, 0x80, 0x88, 0x40, 0x83, 0x27, 0x09, 0x00, 0x13, 0x75, 0xF5, 0x0F, 0x82, 0x97, 0x7D, 0x14, 0xE3, 0x19, 0x44, 0xFF, 0xC9, 0xBF, 0x13, 0x07, 0x00, 0x0C, 0x94, 0x41, 0xAA, 0x87, 0x63, 0x18, 0xE5, 0x00, 0x85, 0x47, 0x85, 0xC6, 0x23, 0xA0, 0x05, 0x00, 0x79, 0x55, 0x82, 0x80, 0x05, 0x47, 0x63, 0x87, 0xE6, 0x00, 0x09, 0x46, 0x63, 0x8D, 0xC6, 0x00, 0x7D, 0x55, 0x82, 0x80, 0x42, 0x05, 0x13, 0x07, 0xB0, 0x0D, 0x41, 0x85, 0x63, 0x95, 0xE7, 0x02, 0x89, 0x47, 0x9C, 0xC1, 0xF5, 0xB7, 0x93, 0x06, 0xC0, 0x0D, 0x63, 0x16, 0xD5, 0x00, 0x98, 0xC1, 0x13, 0x05, 0x00, 0x0C, 0x82, 0x80, 0x93, 0x06, 0xD0, 0x0D, 0x7D, 0x55, 0x63, 0x95, 0xD7, 0x00, 0x98, 0xC1, 0x13, 0x05, 0xB0, 0x0D, 0x82, 0x80, 0xB7, 0x35, 0x85, 0x40, 0x41, 0x11, 0x93, 0x85, 0x85, 0xBA, 0x06, 0xC6, 0x61, 0x3F, 0x63, 0x45, 0x05, 0x06, 0xB7, 0x37, 0x85, 0x40, 0x93, 0x87, 0x07, 0xB2, 0x03, 0xA7, 0x07, 0x08, 0x03, 0xD6, 0x47, 0x08, 0x13, 0x75, 0xF5, 0x0F, 0x93, 0x06, 0x16, 0x00, 0xC2, 0x06, 0xC1, 0x82, 0x23, 0x92, 0xD7, 0x08, 0x32, 0x97, 0x23, 0x00, 0xA7, 0x00, 0x03, 0xD7, 0x47, 0x08, 0x91, 0x67, 0x93, 0x87, 0x07, 0x04, 0x63, 0x1E, 0xF7, 0x02, 0x37, 0xB7, 0x84, 0x40, 0x13, 0x07, 0x07, 0xB2, 0xA1, 0x67, 0xBA, 0x97, 0x03, 0xA6, 0x07, 0x08, 0xB7, 0xF6, 0x84, 0x40, 0xB7, 0x37, 0x85, 0x40, 0x93, 0x87, 0x07, 0xB2, 0x93, 0x86, 0x06, 0xB6, 0x63, 0x1F, 0xE6, 0x00, 0x23, 0xA6, 0xC7, 0x08, 0x23, 0xA0, 0xD7, 0x08, 0x23, 0x92, 0x07, 0x08, 0x21, 0xA0, 0xF9, 0x57, 0xE3, 0x06, 0xF5, 0xFC, 0xB2, 0x40, 0x41, 0x01, 0x82, 0x80, 0x23, 0xA6, 0xD7, 0x08, 0x23, 0xA0, 0xE7, 0x08, 0xDD, 0xB7, 0x37, 0x37, 0x00, 0x60, 0x7C, 0x4B, 0x9D, 0x8B, 0xF5, 0xFF, 0x37, 0x27, 0x00, 0x60, 0x7C, 0x4B, 0x9D, 0x8B, 0xF5, 0xFF, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0xDD, 0x37, 0xB7, 0x37, 0x00, 0x60, 0x23, 0xA6, 0x07, 0x02, 0x37, 0x07, 0x00, 0x08, 0x98, 0xC3, 0x98, 0x43, 0x7D, 0xFF, 0xC8, 0x57, 0xB2, 0x40, 0x13, 0x45, 0xF5, 0xFF, 0x05, 0x89, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0xD9, 0x3F, 0x7D, 0xDD, 0x37, 0x07, 0x00, 0x40, 0xB7, 0x37, 0x00, 0x60, 0x98, 0xC3, 0x37, 0x37, 0x00, 0x60, 0x1C, 0x43, 0xFD, 0xFF, 0xB2, 0x40, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x22, 0xC4, 0x37, 0x84, 0x84, 0x40, 0x93, 0x07, 0x44, 0x01, 0x4A, 0xC0, 0x03, 0xA9, 0x07, 0x01, 0x06, 0xC6, 0x26, 0xC2, 0x63, 0x0A, 0x09, 0x04, 0x45, 0x37, 0x39, 0xC5, 0xBD, 0x47, 0x13, 0x04, 0x44, 0x01, 0x81, 0x44, 0x63, 0xD6, 0x27, 0x01, 0x04, 0x44, 0xBD, 0x88, 0x93, 0xB4, 0x14, 0x00, 0x7D, 0x37, 0x85, 0x3F, 0x1C, 0x44, 0x37, 0x06, 0x80, 0x00, 0x13, 0x97, 0xC7, 0x00, 0x99, 0xE0, 0x37, 0x06, 0x00, 0x01, 0xB7, 0xF6, 0xFF, 0x00, 0x75, 0x8F, 0xB7, 0x36, 0x00, 0x60, 0xD8, 0xC2, 0x90, 0xC2, 0x98, 0x42, 0x7D, 0xFF, 0x41, 0x47, 0x91, 0xE0, 0x05, 0x47, 0x33, 0x09, 0xE9, 0x40, 0xBA, 0x97, 0x23, 0x28, 0x24, 0x01, 0x1C, 0xC4, 0xB2, 0x40, 0x22, 0x44, 0x92, 0x44, 0x02, 0x49, 0x41, 0x01, 0x82, 0x80, 0x01, 0x11, 0x06, 0xCE, 0x22, 0xCC, 0x25, 0x37, 0x37, 0x04, 0xCE, 0x3F, 0x6C, 0x00, 0x13, 0x05, 0x44, 0xFF, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0xA0, 0xF2, 0xAA, 0x87, 0x05, 0x45, 0x95, 0xE7, 0xB2, 0x47, 0x93, 0xF7, 0x07, 0x20, 0x3E, 0xC6, 0x89, 0x37, 0x37, 0x37, 0x00, 0x60, 0x1C, 0x47, 0xB7, 0x06, 0x40, 0x00, 0x13, 0x05, 0x44, 0xFF, 0xD5, 0x8F, 0x1C, 0xC7, 0xB2, 0x45, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x20, 0xF0, 0x33, 0x35, 0xA0, 0x00, 0xF2, 0x40, 0x62, 0x44, 0x05, 0x61, 0x82, 0x80, 0x41, 0x11, 0xB7, 0x87, 0x84, 0x40, 0x06, 0xC6, 0x93, 0x87, 0x47, 0x01, 0x05, 0x47, 0x23, 0x80, 0xE7, 0x00, 0x13, 0xD7, 0xC5, 0x00, 0x98, 0xC7, 0x05, 0x67, 0x7D, 0x17, 0xCC, 0xC3, 0xC8, 0xC7, 0xF9, 0x8D, 0x3A, 0x95, 0xAA, 0x95, 0xB1, 0x81, 0x8C, 0xCB, 0x23, 0xAA, 0x07, 0x00, 0x41, 0x37, 0x19, 0xC1, 0x13, 0x05, 0x50, 0x0C, 0xB2, 0x40, 0x41, 0x01, 0x82, 0x80, 0x01, 0x11, 0x22, 0xCC, 0x37, 0x84, 0x84, 0x40, 0x93, 0x07, 0x44, 0x01, 0x26, 0xCA, 0xC4, 0x47, 0x4E, 0xC6, 0x06, 0xCE, 0x4A, 0xC8, 0xAA, 0x89, 0x13, 0x04, 0x44, 0x01, 0x63, 0xF3, 0x95, 0x00, 0xAE, 0x84, 0xA9, 0xC0, 0x03, 0x29, 0x44, 0x00, 0x26, 0x99, 0x13, 0x59, 0xC9, 0x00, 0x1C, 0x48, 0x63, 0x55, 0xF0, 0x00, 0x1C, 0x44, 0x63, 0x5E, 0xF9, 0x02, 0xB5, 0x3D, 0x7D, 0xDD, 0x48, 0x40, 0x26, 0x86, 0xCE, 0x85, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x20, 0xE3, 0x13, 0x75, 0xF5, 0x0F, 0x01, 0xC5, 0x93, 0x07, 0x40, 0x0C, 0x5C, 0xC8, 0x5C, 0x40, 0xA6, 0x97, 0x5C, 0xC0, 0x5C, 0x44, 0x85, 0x8F, 0x5C, 0xC4, 0xF2, 0x40, 0x62, 0x44, 0xD2, 0x44, 0x42, 0x49, 0xB2, 0x49, 0x05, 0x61, 0x82, 0x80, 0x69, 0x35, 0x6D, 0xBF, 0x41, 0x11, 0x06, 0xC6, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x40, 0xD6, 0x03, 0x45, 0x85, 0x01, 0xB2, 0x40, 0x75, 0x15, 0x13, 0x35, 0x15, 0x00, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0xC5, 0x37, 0x0D, 0xC5, 0xB7, 0x07, 0x84, 0x40, 0x93, 0x87, 0x07, 0x00, 0xD4, 0x43, 0x99, 0xCE, 0x37, 0x67, 0x09, 0x60, 0x13, 0x07, 0x07, 0x11, 0x1C, 0x43, 0x37, 0x06, 0xFD, 0xFF, 0x7D, 0x16, 0xF1, 0x8F, 0x37, 0x06, 0x03, 0x00, 0xF1, 0x8E, 0xD5, 0x8F, 0x1C, 0xC3, 0xB2, 0x40, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0x6D, 0x37, 0x11, 0xC1, 0x0D, 0x45, 0xB2, 0x40, 0x41, 0x01, 0x17, 0x03, 0x80, 0xFF, 0x67, 0x00, 0x83, 0xCC, 0x41, 0x11, 0x06, 0xC6, 0x26, 0xC2, 0x22, 0xC4, 0xAA, 0x84, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0xE0, 0xC9, 0x59, 0x37, 0x0D, 0xC9, 0x37, 0x07, 0x84, 0x40, 0x93, 0x06, 0x07, 0x00, 0x83, 0xD7, 0x86, 0x00, 0x13, 0x04, 0x07, 0x00, 0x85, 0x07, 0xC2, 0x07, 0xC1, 0x83, 0x23, 0x94, 0xF6, 0x00, 0x93, 0x06, 0x00, 0x0C, 0x63, 0x86, 0xD4, 0x00, 0x13, 0x07, 0xE0, 0x03, 0x63, 0x75, 0xF7, 0x00, 0x6D, 0x37, 0x23, 0x14, 0x04, 0x00, 0xB2, 0x40, 0x22, 0x44, 0x92, 0x44, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0x13, 0x07, 0x00, 0x0C, 0x63, 0x1A, 0xE5, 0x00, 0x13, 0x05, 0xB0, 0x0D, 0x45, 0x37, 0x13, 0x05, 0xC0, 0x0D, 0xB2, 0x40, 0x41, 0x01, 0x59, 0xBF, 0x13, 0x07, 0xB0, 0x0D, 0xE3, 0x1B, 0xE5, 0xFE, 0x71, 0x37, 0x13, 0x05, 0xD0, 0x0D, 0xF5, 0xB7, 0x41, 0x11, 0x22, 0xC4, 0x26, 0xC2, 0x06, 0xC6, 0x2A, 0x84, 0xB3, 0x04, 0xB5, 0x00, 0x63, 0x17, 0x94, 0x00, 0xB2, 0x40, 0x22, 0x44, 0x92, 0x44, 0x41, 0x01, 0x82, 0x80, 0x03, 0x45, 0x04, 0x00, 0x05, 0x04, 0x4D, 0x3F, 0xED, 0xB7, 0x35, 0x71, 0x26, 0xCB, 0x4E, 0xC7, 0xFD, 0x72, 0x85, 0x69, 0xFD, 0x74, 0x22, 0xCD, 0x4A, 0xC9, 0x52, 0xC5, 0x56, 0xC3, 0x06, 0xCF, 0x93, 0x84, 0x84, 0xFA, 0x16, 0x91, 0x93, 0x87, 0x09, 0x07, 0xA6, 0x97, 0x18, 0x08, 0xB3, 0x84, 0xE7, 0x00, 0x2A, 0x89, 0x26, 0x85, 0x2E, 0x84, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x80, 0x2C, 0x93, 0x87, 0x09, 0x07, 0x18, 0x08, 0x05, 0x6A, 0xBA, 0x97, 0xB3, 0x8A, 0x47, 0x41, 0x31, 0xE4, 0x05, 0x67, 0x7D, 0x75, 0x93, 0x05, 0x85, 0xFA, 0x93, 0x07, 0x07, 0x07, 0x13, 0x05, 0x85, 0xF9, 0x14, 0x08, 0xAA, 0x97, 0x33, 0x85, 0xD7, 0x00, 0x93, 0x07, 0x07, 0x07, 0xAE, 0x97, 0xB3, 0x85, 0xD7, 0x00, 0x2A, 0xC6, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x40, 0x29, 0x32, 0x45, 0xC1, 0x45, 0x95, 0x37, 0x01, 0x45, 0x85, 0x62, 0x16, 0x91, 0xFA, 0x40, 0x6A, 0x44, 0xDA, 0x44, 0x4A, 0x49, 0xBA, 0x49, 0x2A, 0x4A, 0x9A, 0x4A, 0x0D, 0x61, 0x82, 0x80, 0xA2, 0x89, 0x63, 0x73, 0x8A, 0x00, 0x85, 0x69, 0x4E, 0x86, 0xD6, 0x85, 0x4A, 0x85, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0xC0, 0xC5, 0x13, 0x75, 0xF5, 0x0F, 0x01, 0xED, 0x4E, 0x86, 0xD6, 0x85, 0x26, 0x85, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x80, 0x24, 0x4E, 0x99, 0x33, 0x04, 0x34, 0x41, 0x51, 0xB7, 0x13, 0x05, 0x30, 0x06, 0x55, 0xBF, 0x13, 0x05, 0x00, 0x0C, 0x49, 0xBD, 0x31, 0x71, 0xFD, 0x72, 0x05, 0x67, 0x4E, 0xD7, 0x52, 0xD5, 0x56, 0xD3, 0x5E, 0xCF, 0x06, 0xDF, 0x22, 0xDD, 0x26, 0xDB, 0x4A, 0xD9, 0x5A, 0xD1, 0x62, 0xCD, 0x66, 0xCB, 0x6A, 0xC9, 0x6E, 0xC7, 0xFD, 0x77, 0x16, 0x91, 0x13, 0x07, 0x07, 0x07, 0x3E, 0x97, 0x1C, 0x08, 0xBA, 0x97, 0x3E, 0xC6, 0x23, 0xAA, 0x07, 0xF8, 0xAA, 0x89, 0x2E, 0x8A, 0xB2, 0x8A, 0xB6, 0x8B, 0xF5, 0x33, 0x93, 0x07, 0x00, 0x02, 0x19, 0xC1, 0xB7, 0x07, 0x02, 0x00, 0x3E, 0x85, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x20, 0x1D, 0x85, 0x67, 0x63, 0xE5, 0x57, 0x13, 0x05, 0x64, 0x7D, 0x79, 0x13, 0x09, 0x89, 0xFA, 0x93, 0x07, 0x04, 0x07, 0xCA, 0x97, 0x18, 0x08, 0x33, 0x89, 0xE7, 0x00, 0x4A, 0x85, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0xA0, 0x1B, 0x7D, 0x7B, 0x13, 0x0C, 0x3B, 0xF9, 0x93, 0x0C, 0x8B, 0xF9, 0x13, 0x07, 0x04, 0x07, 0x93, 0x07, 0x04, 0x07, 0x14, 0x08, 0x62, 0x97, 0xE6, 0x97, 0x81, 0x44, 0x33, 0x0C, 0xD7, 0x00, 0xB3, 0x8C, 0xD7, 0x00, 0x52, 0x4D, 0x63, 0x7C, 0x4D, 0x09, 0x63, 0xF1, 0xA4, 0x03, 0x41, 0xA8, 0x99, 0x3F, 0xA2, 0x85, 0x08, 0x01, 0x8D, 0x35, 0xB9, 0x37, 0x22, 0x86, 0x0C, 0x01, 0x4A, 0x85, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x80, 0x17, 0xA2, 0x99, 0xA2, 0x94, 0x63, 0xF5, 0x44, 0x03, 0xB3, 0x87, 0xA4, 0x41, 0x63, 0xF1, 0x77, 0x03, 0x33, 0x04, 0x9A, 0x40, 0x63, 0xF3, 0x8A, 0x00, 0x56, 0x84, 0x22, 0x86, 0x0C, 0x01, 0x4E, 0x85, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x00, 0xB5, 0x13, 0x75, 0xF5, 0x0F, 0x55, 0xDD, 0x02, 0xCC, 0x01, 0x44, 0x79, 0x5D, 0x8D, 0x4D, 0xA3, 0x09, 0x01, 0x00, 0x62, 0x85, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x40, 0xA4, 0x7D, 0xF9, 0x03, 0x45, 0x31, 0x01, 0xE6, 0x85, 0x85, 0x34, 0x63, 0x4F, 0x05, 0x00, 0xE3, 0xE2, 0x8D, 0xFE, 0x85, 0x67, 0x93, 0x87, 0x07, 0x07, 0xA2, 0x97, 0x18, 0x08, 0xBA, 0x97, 0xDA, 0x97, 0x23, 0x8A, 0xA7, 0xF8, 0x05, 0x04, 0xF1, 0xB7, 0xE3, 0x15, 0xA5, 0xFD, 0x91, 0x47, 0xE3, 0x05, 0xF4, 0xF6, 0x05, 0x67, 0x7D, 0x75, 0x93, 0x07, 0x07, 0x07, 0x93, 0x05, 0x85, 0xFA, 0x13, 0x05, 0x85, 0xF9, 0x14, 0x08, 0xAA, 0x97, 0x33, 0x85, 0xD7, 0x00, 0x93, 0x07, 0x07, 0x07, 0xAE, 0x97, 0xB3, 0x85, 0xD7, 0x00, 0x2A, 0xC6, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0xA0, 0x0D, 0x71, 0x3D, 0x32, 0x45, 0xC1, 0x45, 0x65, 0x33, 0x51, 0x3D, 0xC1, 0x31, 0xB7, 0x07, 0x02, 0x00, 0x19, 0xE1, 0x93, 0x07, 0x00, 0x02, 0x3E, 0x85, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0xA0, 0x0A, 0x85, 0x62, 0x16, 0x91, 0xFA, 0x50, 0x6A, 0x54, 0xDA, 0x54, 0x4A, 0x59, 0xBA, 0x59, 0x2A, 0x5A, 0x9A, 0x5A, 0x0A, 0x5B, 0xFA, 0x4B, 0x6A, 0x4C, 0xDA, 0x4C, 0x4A, 0x4D, 0xBA, 0x4D, 0x29, 0x61, 0x82, 0x80, 0xB7, 0x57, 0x41, 0x49, 0x19, 0x71, 0x93, 0x87, 0xF7, 0x84, 0x01, 0x45, 0x86, 0xDE, 0xA2, 0xDC, 0xA6, 0xDA, 0xCA, 0xD8, 0xCE, 0xD6, 0xD2, 0xD4, 0xD6, 0xD2, 0xDA, 0xD0, 0xDE, 0xCE, 0xE2, 0xCC, 0xE6, 0xCA, 0xEA, 0xC8, 0xEE, 0xC6, 0x3E, 0xCE, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x80, 0x9D, 0xA1, 0x39, 0x0D, 0xC1, 0x37, 0x67, 0x09, 0x60, 0x13, 0x07, 0x07, 0x11, 0x1C, 0x43, 0xB7, 0x06, 0x84, 0x40, 0x23, 0xA2, 0xF6, 0x00, 0xB7, 0x06, 0xFD, 0xFF, 0xFD, 0x16, 0xF5, 0x8F, 0xC1, 0x66, 0xD5, 0x8F, 0x1C, 0xC3, 0x15, 0x39, 0x05, 0xCD, 0xB7, 0x27, 0x0B, 0x60, 0x37, 0x47, 0xD8, 0x50, 0x93, 0x86, 0x87, 0xC1, 0x13, 0x07, 0x17, 0xAA, 0x98, 0xC2, 0x13, 0x86, 0x07, 0xC0, 0x23, 0x20, 0x06, 0x00, 0x23, 0xA0, 0x06, 0x00, 0x93, 0x86, 0x07, 0xC2, 0x98, 0xC2, 0x93, 0x87, 0xC7, 0xC1, 0x98, 0x43, 0x37, 0x06, 0x04, 0x00, 0x51, 0x8F, 0x98, 0xC3, 0x23, 0xA0, 0x06, 0x00, 0xB7, 0x07, 0x84, 0x40, 0x37, 0x37, 0x85, 0x40, 0x93, 0x87, 0x07, 0x00, 0x13, 0x07, 0x07, 0xBB, 0x21, 0xA0, 0x23, 0xA0, 0x07, 0x00, 0x91, 0x07, 0xE3, 0xED, 0xE7, 0xFE, 0x45, 0x3B, 0x91, 0x45, 0x68, 0x08, 0x75, 0x39, 0x65, 0x33, 0xB7, 0xB7, 0x84, 0x40, 0x93, 0x87, 0x07, 0xB2, 0x21, 0x67, 0x3E, 0x97, 0x23, 0x20, 0xF7, 0x08, 0xB7, 0x07, 0x80, 0x40, 0x37, 0x09, 0x84, 0x40, 0x93, 0x87, 0x87, 0x0E, 0x23, 0x20, 0xF9, 0x00, 0xB7, 0x39, 0x85, 0x40, 0x45, 0x3E, 0x13, 0x09, 0x09, 0x00, 0x93, 0x89, 0x09, 0xB2, 0x63, 0x05, 0x05, 0x10, 0xB7, 0x07, 0x01, 0x60, 0x45, 0x47, 0x23, 0xA0, 0xE7, 0x0C, 0x85, 0x45, 0x45, 0x45, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x00, 0xF6, 0xB7, 0x05, 0x80, 0x40, 0x01, 0x46, 0x93, 0x85, 0x05, 0x00, 0x45, 0x45, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x00, 0xF7, 0xB7, 0xF7, 0x00, 0x60, 0x11, 0x47, 0x98, 0xCB, 0x37, 0x05, 0x02, 0x00, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x40, 0xF6, 0xB7, 0x17, 0x09, 0x60, 0x88, 0x5F, 0x81, 0x45, 0xB7, 0x84, 0x84, 0x40, 0x71, 0x89, 0x61, 0x15, 0x13, 0x35, 0x15, 0x00, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x00, 0x9E, 0xC1, 0x67, 0xFD, 0x17, 0x13, 0x07, 0x00, 0x10, 0x85, 0x66, 0x41, 0x66, 0xB7, 0x05, 0x00, 0x01, 0x01, 0x45, 0x93, 0x84, 0x44, 0x01, 0xB7, 0x0A, 0x84, 0x40, 0x0D, 0x6A, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x00, 0x94, 0x13, 0x8B, 0x4A, 0x01, 0x26, 0x9A, 0x83, 0xA7, 0xC9, 0x08, 0xF5, 0xDF, 0x83, 0xAB, 0xC9, 0x08, 0x85, 0x47, 0x23, 0xA6, 0x09, 0x08, 0x23, 0x02, 0xF1, 0x02, 0x83, 0xC7, 0x1B, 0x00, 0x09, 0x47, 0x23, 0x13, 0xE1, 0x02, 0xA3, 0x02, 0xF1, 0x02, 0x02, 0xD4, 0x4D, 0x47, 0x63, 0x81, 0xE7, 0x08, 0x51, 0x47, 0x63, 0x8F, 0xE7, 0x06, 0x29, 0x47, 0x63, 0x9F, 0xE7, 0x00, 0x83, 0xC7, 0x3B, 0x00, 0x03, 0xC7, 0x2B, 0x00, 0xA2, 0x07, 0xD9, 0x8F, 0x11, 0x47, 0x63, 0x96, 0xE7, 0x00, 0x83, 0xA7, 0x8B, 0x00, 0x9C, 0x43, 0x3E, 0xD4, 0x45, 0x31, 0xA1, 0x45, 0x48, 0x10, 0x75, 0x36, 0x83, 0xC7, 0x3B, 0x00, 0x03, 0xC7, 0x2B, 0x00, 0xA2, 0x07, 0xD9, 0x8F, 0x11, 0x67, 0x41, 0x07, 0x63, 0x74, 0xF7, 0x04, 0x13, 0x05, 0xB0, 0x0D, 0x19, 0x3E, 0x13, 0x05, 0xC0, 0x0D, 0x01, 0x3E, 0x13, 0x05, 0xE0, 0x0E, 0x29, 0x36, 0x8D, 0x39, 0x41, 0xB7, 0xB7, 0x05, 0x80, 0x40, 0x01, 0x46, 0x93, 0x85, 0x85, 0x03, 0x15, 0x45, 0x97, 0x00, 0x80, 0xFF, 0xE7, 0x80, 0x00, 0xE8, 0x37, 0x07, 0x00, 0x60, 0x5C, 0x47, 0x13, 0x05, 0x00, 0x02, 0x93, 0xE7, 0x17, 0x10, 0x5C, 0xC7, 0x31, 0xB7, 0xC9, 0x47, 0x23, 0x13, 0xF1, 0x02, 0x4D, 0xB7, 0x03, 0xC7, 0x1B, 0x00, 0xD1, 0x46, 0x63, 0xE7, 0xE6, 0x02, 0x85, 0x46, 0x63, 0xE6, 0xE6, 0x00, 0x01, 0x4C, 0x13, 0x04, 0xF0, 0x0F, 0x85, 0xA8, 0x79, 0x17, 0x13, 0x77, 0xF7, 0x0F, 0xC9, 0x46, 0xE3, 0xE8, 0xE6, 0xFE, 0xB7, 0x36, 0x85, 0x40, 0x0A, 0x07, 0x93, 0x86, 0x46, 0xBB, 0x36, 0x97, 0x18, 0x43, 0x02, 0x87, 0x93, 0x06, 0x07, 0x03, 0x93, 0xF6, 0xF6, 0x0F, 0x11, 0x46, 0xE3, 0x69, 0xD6, 0xFC, 0x13, 0x07, 0xF7, 0x02, 0x13, 0x77, 0xF7, 0x0F, 0x8D, 0x46, 0x63, 0xEB, 0xE6, 0x08, 0xB7, 0x36, 0x85, 0x40, 0x0A, 0x07, 0x93, 0x86, 0x06, 0xC0, 0x36, 0x97, 0x18, 0x43, 0x02, 0x87, 0x13, 0x07, 0x40, 0x02, 0x63, 0x98, 0xE7, 0x10, 0x02, 0xD4, 0x1D, 0x44, 0x01, 0x45, 0xA5, 0x34, 0x01, 0x45, 0x55, 0x3C, 0xF1, 0x36, 0xE9, 0x36, 0xA1, 0x45, 0x48, 0x10, 0x7D, 0x14, 0xD1, 0x3C, 0x75, 0xF4, 0x01, 0x4C, 0x01, 0x44, 0x13, 0x75, 0xF4, 0x0F, 0x71, 0x3C, 0x13, 0x75, 0xFC, 0x0F, 0x59, 0x3C, 0x7D, 0x36, 0xE3, 0x1E, 0x04, 0xEA, 0x83, 0xC7, 0x1B, 0x00, 0x49, 0x47, 0x63, 0x68, 0xF7, 0x30, 0x09, 0x47, 0xE3, 0x76, 0xF7, 0xEA, 0xF5, 0x17, 0x93, 0xF7, 0xF7, 0x0F, 0x3D, 0x47, 0xE3, 0x60, 0xF7, 0xEA, 0x37, 0x37, 0x85, 0x40, 0x8A, 0x07, 0x13, 0x07, 0x07, 0xC1, 0xBA, 0x97, 0x9C, 0x43, 0x82, 0x87, 0x05, 0x44, 0x9D, 0xEB, 0x70, 0x10, 0x81, 0x45, 0x01, 0x45, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0x00, 0x71, 0x1D, 0xE1, 0xD1, 0x45, 0x68, 0x10, 0x9D, 0x3C, 0x01, 0x44, 0x31, 0xA8, 0x05, 0x44, 0x81, 0xEF, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0x00, 0x76, 0x33, 0x34, 0xA0, 0x00, 0x29, 0xA0, 0x21, 0x47, 0x63, 0x85, 0xE7, 0x00, 0x05, 0x44, 0x01, 0x4C, 0x61, 0xB7, 0x03, 0xAC, 0x8B, 0x00, 0x03, 0xA4, 0xCB, 0x00, 0xB3, 0x67, 0x8C, 0x00, 0xD2, 0x07, 0xF5, 0xF7, 0xEF, 0xF0, 0xBF, 0x85, 0x7D, 0xF1, 0xC1, 0x6C, 0x22, 0x9C, 0xFD, 0x1C, 0x7D, 0x7D, 0x33, 0x05, 0x8C, 0x40, 0x55, 0xDC, 0xB3, 0x77, 0x95, 0x01, 0x95, 0xE3, 0xC1, 0x6C, 0x33, 0x05, 0x8C, 0x40, 0x63, 0xE6, 0x8C, 0x02, 0xFD, 0x7C, 0x33, 0x05, 0x8C, 0x40, 0x55, 0xD0, 0x31, 0x81, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0x80, 0x72, 0x55, 0xF9, 0x66, 0x94, 0xF5, 0xB7, 0x31, 0x81, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0x80, 0x71, 0x55, 0xF1, 0x6A, 0x94, 0xD1, 0xB7, 0x41, 0x81, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0xC0, 0x70, 0x51, 0xF9, 0x33, 0x04, 0x94, 0x41, 0xC1, 0xB7, 0x21, 0x47, 0xE3, 0x89, 0xE7, 0xF0, 0x01, 0x4C, 0x13, 0x04, 0x00, 0x0C, 0x31, 0xB7, 0x41, 0x47, 0xCD, 0xBF, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x9C, 0xE7, 0xF6, 0x83, 0xA5, 0xCB, 0x00, 0x03, 0xA5, 0x8B, 0x00, 0xE5, 0x32, 0xB1, 0xBF, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x92, 0xE7, 0xF6, 0x03, 0xA7, 0x0B, 0x01, 0x91, 0x67, 0x63, 0xEA, 0xE7, 0x1E, 0x83, 0xA5, 0x4B, 0x01, 0x03, 0xA5, 0x8B, 0x00, 0xEF, 0xF0, 0xFF, 0x80, 0x35, 0xBF, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x92, 0xE7, 0xF4, 0x83, 0xA7, 0x0B, 0x01, 0x11, 0x67, 0x63, 0x6A, 0xF7, 0x1C, 0x03, 0xA7, 0xCB, 0x00, 0x83, 0xA5, 0x4B, 0x01, 0x03, 0xA5, 0x8B, 0x00, 0x33, 0x84, 0xE7, 0x02, 0xEF, 0xF0, 0x6F, 0xFE, 0x23, 0xAC, 0x04, 0x00, 0x23, 0x24, 0x8A, 0xB0, 0x31, 0xB7, 0x03, 0xC7, 0x04, 0x00, 0x63, 0x03, 0x07, 0x14, 0x03, 0xA7, 0x8B, 0x00, 0xC1, 0x17, 0x13, 0x04, 0x00, 0x0C, 0x63, 0x13, 0xF7, 0x00, 0xC0, 0x48, 0x01, 0x47, 0x93, 0x06, 0xF0, 0x0E, 0x63, 0x46, 0xF7, 0x02, 0x83, 0xC7, 0x5B, 0x00, 0x03, 0xC7, 0x4B, 0x00, 0x01, 0x4C, 0xA2, 0x07, 0xD9, 0x8F, 0x03, 0xC7, 0x6B, 0x00, 0x42, 0x07, 0x5D, 0x8F, 0x83, 0xC7, 0x7B, 0x00, 0xE2, 0x07, 0xD9, 0x8F, 0xE3, 0x81, 0xF6, 0xE6, 0x13, 0x04, 0x10, 0x0C, 0xA9, 0xBD, 0x33, 0x86, 0xEB, 0x00, 0x03, 0x46, 0x86, 0x01, 0x05, 0x07, 0xB1, 0x8E, 0xE1, 0xB7, 0x83, 0xC7, 0x04, 0x00, 0xFD, 0xC7, 0xDC, 0x44, 0x63, 0x9D, 0x07, 0x14, 0xC0, 0x48, 0x23, 0x80, 0x04, 0x00, 0x7D, 0xB5, 0x61, 0x47, 0x63, 0x96, 0xE7, 0x02, 0x83, 0xA7, 0xCB, 0x01, 0x03, 0xA7, 0x8B, 0x01, 0x83, 0xA6, 0x4B, 0x01, 0x03, 0xA6, 0x0B, 0x01, 0x83, 0xA5, 0xCB, 0x00, 0x03, 0xA5, 0x8B, 0x00, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0x40, 0x61, 0x2A, 0x8C, 0x33, 0x34, 0xA0, 0x00, 0x29, 0xB5, 0x01, 0x4C, 0x05, 0x44, 0x11, 0xB5, 0x11, 0x47, 0x05, 0x44, 0xE3, 0x9A, 0xE7, 0xE6, 0xB7, 0x97, 0x00, 0x60, 0xB4, 0x5F, 0x65, 0x77, 0x7D, 0x17, 0x05, 0x66, 0xF9, 0x8E, 0xD1, 0x8E, 0x03, 0xA5, 0x8B, 0x00, 0xB4, 0xDF, 0xB4, 0x57, 0x81, 0x45, 0xF9, 0x8E, 0xD1, 0x8E, 0xB4, 0xD7, 0xF4, 0x5F, 0xF9, 0x8E, 0xD1, 0x8E, 0xF4, 0xDF, 0xF4, 0x53, 0x75, 0x8F, 0x51, 0x8F, 0xF8, 0xD3, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0x20, 0x64, 0x29, 0xBD, 0x13, 0xF7, 0xF7, 0x00, 0xE3, 0x15, 0x07, 0xEA, 0x93, 0xDC, 0x47, 0x00, 0x13, 0x84, 0x8B, 0x00, 0x01, 0x4C, 0x7D, 0x5D, 0xE3, 0x74, 0x9C, 0xDB, 0x48, 0x44, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0x20, 0x48, 0x18, 0x44, 0x54, 0x40, 0x10, 0x40, 0xF9, 0x8E, 0x63, 0x07, 0xA7, 0x01, 0x1C, 0x42, 0x13, 0x47, 0xF7, 0xFF, 0x7D, 0x8F, 0xD9, 0x8E, 0x14, 0xC2, 0x05, 0x0C, 0x41, 0x04, 0xD9, 0xBF, 0x11, 0x47, 0xA5, 0xB5, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x97, 0xE7, 0xDE, 0x83, 0xA7, 0x8B, 0x00, 0x03, 0xA7, 0x4B, 0x01, 0x23, 0x28, 0xF9, 0x00, 0x23, 0x26, 0xE9, 0x00, 0x75, 0xBB, 0x83, 0x25, 0xC9, 0x00, 0xC1, 0x17, 0x91, 0xE5, 0x89, 0xCF, 0x01, 0x4C, 0x13, 0x04, 0x60, 0x0C, 0x89, 0xBB, 0x03, 0x27, 0x09, 0x01, 0x63, 0x66, 0xF7, 0x06, 0x13, 0xF7, 0x37, 0x00, 0xE3, 0x19, 0x07, 0xE2, 0x03, 0x28, 0x09, 0x01, 0x01, 0x46, 0x01, 0x47, 0x33, 0x05, 0xE8, 0x40, 0xB3, 0x86, 0xE5, 0x00, 0x63, 0x69, 0xF7, 0x00, 0xE3, 0x04, 0x06, 0xD2, 0x23, 0x28, 0xA9, 0x00, 0x23, 0x26, 0xD9, 0x00, 0x31, 0xBB, 0x33, 0x86, 0xEB, 0x00, 0x10, 0x4E, 0x11, 0x07, 0x90, 0xC2, 0x05, 0x46, 0xE9, 0xBF, 0x21, 0x47, 0x05, 0x44, 0xE3, 0x91, 0xE7, 0xD8, 0x03, 0x24, 0x09, 0x01, 0x19, 0xC0, 0x13, 0x04, 0x80, 0x0C, 0x23, 0x28, 0x09, 0x00, 0x23, 0x26, 0x09, 0x00, 0x33, 0x34, 0x80, 0x00, 0xA5, 0xB3, 0x01, 0x4C, 0x13, 0x04, 0x20, 0x0C, 0xED, 0xB1, 0x01, 0x4C, 0x13, 0x04, 0x80, 0x0C, 0xCD, 0xB1, 0x01, 0x4C, 0x13, 0x04, 0x90, 0x0C, 0xE9, 0xB9, 0x13, 0x07, 0x20, 0x0D, 0x63, 0x83, 0xE7, 0x0C, 0x13, 0x07, 0x40, 0x0D, 0xE3, 0x9B, 0xE7, 0xB8, 0x03, 0xC4, 0x3B, 0x00, 0x83, 0xC7, 0x2B, 0x00, 0x22, 0x04, 0x5D, 0x8C, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0x40, 0x47, 0x03, 0xAC, 0xC4, 0x00, 0x41, 0x14, 0x63, 0x73, 0x84, 0x01, 0x22, 0x8C, 0xE3, 0x09, 0x0C, 0xB6, 0xC0, 0x40, 0x62, 0x94, 0x31, 0x80, 0x9C, 0x48, 0x63, 0x55, 0xF0, 0x00, 0x9C, 0x44, 0x63, 0x5B, 0xF4, 0x0A, 0xEF, 0xF0, 0xAF, 0xCB, 0x75, 0xDD, 0xC8, 0x40, 0x62, 0x86, 0x93, 0x85, 0x8B, 0x01, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0x40, 0x43, 0x01, 0xC5, 0x93, 0x07, 0x40, 0x0C, 0xDC, 0xC8, 0xDC, 0x40, 0xE2, 0x97, 0xDC, 0xC0, 0xDC, 0x44, 0xB3, 0x87, 0x87, 0x41, 0xDC, 0xC4, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0x20, 0x42, 0x25, 0xB6, 0x09, 0x65, 0x13, 0x05, 0x05, 0x71, 0x03, 0xAC, 0xCB, 0x00, 0x03, 0xA4, 0x8B, 0x00, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0xA0, 0x32, 0xB7, 0x07, 0x00, 0x60, 0xD8, 0x4B, 0xB7, 0x06, 0x00, 0x01, 0xC1, 0x16, 0x93, 0x57, 0x47, 0x01, 0x12, 0x07, 0x75, 0x8F, 0xBD, 0x8B, 0xD9, 0x8F, 0xB3, 0x87, 0x87, 0x03, 0x01, 0x45, 0xB3, 0xD5, 0x87, 0x02, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0xC0, 0x33, 0x13, 0x05, 0x80, 0x3E, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0x40, 0x2F, 0xE9, 0xBC, 0x83, 0xA6, 0x4B, 0x01, 0x03, 0xA6, 0x0B, 0x01, 0x83, 0xA5, 0xCB, 0x00, 0x03, 0xA5, 0x8B, 0x00, 0xEF, 0xF0, 0xEF, 0xFB, 0xD1, 0xB4, 0x83, 0xC5, 0x3B, 0x00, 0x83, 0xC7, 0x2B, 0x00, 0x13, 0x85, 0x8B, 0x01, 0xA2, 0x05, 0xDD, 0x8D, 0xC1, 0x15, 0xEF, 0xF0, 0x8F, 0xD5, 0x75, 0xB4, 0xEF, 0xF0, 0xEF, 0xC4, 0x3D, 0xBF, 0x03, 0xC4, 0x3B, 0x00, 0x83, 0xC7, 0x2B, 0x00, 0x13, 0x8C, 0x8B, 0x01, 0x22, 0x04, 0x5D, 0x8C, 0xDC, 0x44, 0x41, 0x14, 0xCD, 0xE3, 0x91, 0x47, 0x85, 0x4B, 0x63, 0xFF, 0x87, 0x08, 0x93, 0x07, 0x90, 0x0C, 0xDC, 0xC8, 0x41, 0xB4, 0x03, 0xA7, 0x0D, 0x00, 0x22, 0xD0, 0x05, 0x48, 0xB3, 0x87, 0xEC, 0x40, 0x3E, 0xD6, 0x83, 0x27, 0x8A, 0xB0, 0x63, 0x73, 0xF4, 0x00, 0x0D, 0x48, 0x42, 0xC6, 0x3A, 0xC4, 0xEF, 0xF0, 0x6F, 0xC0, 0x22, 0x47, 0x32, 0x48, 0x37, 0x85, 0x84, 0x40, 0xE2, 0x85, 0x7C, 0x10, 0x93, 0x86, 0x4A, 0x01, 0x10, 0x10, 0x13, 0x05, 0xC5, 0x02, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0x20, 0x31, 0x37, 0xB7, 0x84, 0x40, 0x93, 0x08, 0x47, 0x01, 0x82, 0x57, 0x03, 0xA7, 0x88, 0xB0, 0x83, 0xA5, 0x0D, 0x00, 0x1D, 0x8C, 0x1D, 0x8F, 0x3E, 0x9C, 0xB2, 0x57, 0x23, 0xA4, 0xE8, 0xB0, 0xAA, 0x8B, 0xBE, 0x95, 0x23, 0xA0, 0xBD, 0x00, 0x93, 0x87, 0x4A, 0x01, 0x9D, 0x8D, 0x01, 0xC5, 0xA1, 0x67, 0x63, 0x97, 0xF5, 0x00, 0x5A, 0x85, 0xEF, 0xF0, 0x2F, 0xCB, 0x23, 0xA0, 0x6D, 0x01, 0x09, 0xC4, 0xDC, 0x44, 0x99, 0xC3, 0xE3, 0x4F, 0x70, 0xF7, 0x63, 0xDF, 0x0B, 0x00, 0x93, 0x07, 0x70, 0x0C, 0xBD, 0xB7, 0x85, 0x4B, 0xB7, 0x3D, 0x85, 0x40, 0xB7, 0x8C, 0x84, 0x40, 0x93, 0x8D, 0x0D, 0xBB, 0x93, 0x8C, 0x4C, 0x01, 0xE9, 0xBF, 0xE3, 0x9D, 0x0B, 0x9C, 0xDC, 0x44, 0xE3, 0x8A, 0x07, 0x9C, 0x93, 0x07, 0x80, 0x0C, 0xA9, 0xB7, 0x83, 0xA7, 0x8B, 0x00, 0xE3, 0x93, 0x07, 0x9C, 0xEF, 0xF0, 0x2F, 0xD3, 0x09, 0x65, 0x13, 0x05, 0x05, 0x71, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0xA0, 0x1C, 0xEF, 0xF0, 0xAF, 0xCE, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0xE0, 0x20, 0x55, 0xB2, 0x03, 0xA4, 0xCB, 0x00, 0xE3, 0x0F, 0x04, 0x98, 0xEF, 0xF0, 0xAF, 0xD0, 0x13, 0x05, 0x80, 0x3E, 0x97, 0xF0, 0x7F, 0xFF, 0xE7, 0x80, 0x40, 0x1A, 0xEF, 0xF0, 0x4F, 0xCC, 0x02, 0x94, 0x51, 0xB2, 0xEF, 0xF0, 0xCF, 0xCB, 0xF6, 0x50, 0x66, 0x54, 0xD6, 0x54, 0x46, 0x59, 0xB6, 0x59, 0x26, 0x5A, 0x96, 0x5A, 0x06, 0x5B, 0xF6, 0x4B, 0x66, 0x4C, 0xD6, 0x4C, 0x46, 0x4D, 0xB6, 0x4D, 0x09, 0x61, 0x82, 0x80, 0x00, 0x00
+        0x28, 0xCF, 0x7D, 0x52, 0x7D, 0x58, 0x13, 0xF7, 0x1D, 0xFF, 0xFD, 0x72, 0xB9, 0xFB, 0x25, 0x9A, 0x14, 0xB2, 0x03, 0xD1, 0x15, 0x3B, 0xE4, 0x5A, 0x7C, 0xD9, 0x9E, 0xB6, 0x18, 0xF5, 0x1E, 0x57, 0xC5, 0x8B, 0x5C, 0x38, 0x5E, 0x6D, 0xED, 0xA4, 0x3E, 0x5A, 0xDB, 0x46, 0x6F, 0x85, 0xEA, 0xDA, 0xAD, 0xB4, 0x65, 0x3E, 0x7D, 0xD6, 0x3C, 0x0B, 0x24, 0x47, 0xCA, 0x9B, 0x29, 0x3D, 0x58, 0xD0, 0xE1, 0x96, 0x32, 0x85, 0xCA, 0xFA, 0x6C, 0x14, 0xD4, 0xDB, 0x70, 0x8E, 0x04, 0x79, 0x11, 0x51, 0xAA, 0x56, 0x41, 0x1D, 0x54, 0x6B, 0x26, 0xA9, 0x76, 0x1D, 0x61, 0x03, 0x52, 0xBA, 0x22, 0xBB, 0x23, 0x49, 0x9F, 0x6D, 0x7F, 0xEC, 0x9F, 0xBB, 0xFB, 0x7E, 0xBF, 0x9F, 0xFB, 0xBE, 0x7C, 0x3E, 0x1F, 0x93, 0x21, 0xB9, 0x3B, 0xA5, 0x8B, 0xE8, 0x95, 0x42, 0xC0, 0x62, 0xE0, 0x68, 0xB5, 0x83, 0xB9, 0x36, 0x20, 0x4D, 0x02, 0x0B, 0xA9, 0x56, 0x83, 0x11, 0xA6, 0xA6, 0xB2, 0x26, 0xD0, 0xC6, 0x24, 0xB3, 0xEF, 0xB2, 0x26, 0x58, 0x6A, 0x7B, 0x9B, 0x49, 0x64, 0xC8, 0xE2, 0xA9, 0x98, 0x52, 0xF7, 0xA8, 0x04, 0x0D, 0x12, 0x02, 0x96, 0x2D, 0xBD, 0xF6, 0x63, 0x4E, 0x90, 0x7D, 0x96, 0xD6, 0x3A, 0x98, 0x94, 0x73, 0x4F, 0x77, 0x13, 0x83, 0xC9, 0xE7, 0x25, 0x35, 0xB0, 0x58, 0x77, 0x92, 0x5A, 0x2D, 0xF0, 0xE6, 0x92, 0x6F, 0x4C, 0xC6, 0xE8, 0x6F, 0xFD, 0x83, 0xD9, 0xC3, 0x52, 0xEF, 0xAF, 0x81, 0x9B, 0xB3, 0x2E, 0xB3, 0x6D, 0x59, 0xC9, 0xD9, 0xF8, 0x6E, 0xA5, 0x97, 0x7D, 0xB9, 0x16, 0x84, 0xBB, 0x59, 0xE3, 0xFC, 0x4B, 0xD8, 0xB9, 0xFE, 0x4E, 0x12, 0x01, 0x5D, 0xAD, 0xA9, 0xC5, 0xC9, 0x2F, 0xBE, 0x03, 0x04, 0x4E, 0xE8, 0xA5, 0x3C, 0x38, 0x78, 0x33, 0xBF, 0xD4, 0x86, 0x73, 0xBC, 0x73, 0x0C, 0x68, 0x33, 0xF8, 0xEA, 0x5E, 0x60, 0x95, 0xE3, 0xCD, 0x38, 0x89, 0x5A, 0xF5, 0x26, 0x81, 0xAF, 0x0B, 0xA8, 0xCA, 0xB9, 0x06, 0xDF, 0x94, 0x24, 0x12, 0x5E, 0x3D, 0xBF, 0xE8, 0x2A, 0xA8, 0xF7, 0x91, 0x38, 0xD0, 0x95, 0xDA, 0x44, 0xE2, 0xA2, 0xDE, 0x9A, 0xCF, 0xD7, 0x0D, 0xCF, 0x67, 0x5A, 0xF5, 0xA5, 0x36, 0x69, 0xAD, 0xC0, 0x98, 0x0C, 0xA2, 0x20, 0x74, 0x10, 0xBD, 0xBB, 0x37, 0xF1, 0x66, 0x9C, 0x90, 0x68, 0x81, 0x11, 0x9D, 0xA8, 0x0D, 0x6B, 0x46, 0x1A, 0x6C, 0x88, 0xD3, 0x28, 0xBB, 0x88, 0xC4, 0x22, 0xD0, 0x45, 0xF8, 0x4A, 0xA9, 0x77, 0x87, 0x35, 0xAB, 0xDD, 0x14, 0x68, 0x06, 0xD8, 0x30, 0xA7, 0xA9, 0x29, 0x94, 0x71, 0x6A, 0xFE, 0xA1, 0x90, 0x8A, 0x96, 0x1C, 0x0C, 0x89, 0x50, 0xDB, 0x7B, 0x85, 0x1D, 0x6E, 0xAC, 0x09, 0x69, 0xA4, 0x69, 0x07, 0x13, 0xED, 0x23, 0x96, 0x11, 0x27, 0xF9, 0xEF, 0x8C, 0x01, 0xAA, 0xA9, 0x4F, 0x43, 0x79, 0x86, 0x35, 0xD4, 0xBB, 0x48, 0xB3, 0xCC, 0x33, 0xB3, 0xDD, 0x4F, 0x4C, 0x7D, 0xDD, 0xC6, 0x28, 0xFC, 0x51, 0x4D, 0x72, 0xD6, 0x13, 0xD0, 0x8C, 0x4A, 0x34, 0x0D, 0x2C, 0x6F, 0xE5, 0x1C, 0xAE, 0x9C, 0x9A, 0xA3, 0x97, 0x47, 0xBF, 0x4A, 0x6D, 0x26, 0x03, 0xD1, 0x3B, 0x4A, 0x4B, 0x72, 0x8D, 0x6A, 0x42, 0x2A, 0x1A, 0x01, 0x4D, 0xFD, 0x99, 0xFA, 0x74, 0xEB, 0xDC, 0xD9, 0xED, 0x6D, 0x0C, 0x69, 0x9E, 0x9A, 0xC3, 0xCB, 0x95, 0x2E, 0x0A, 0xEA, 0xFA, 0x26, 0xEB, 0xA8, 0x5C, 0x67, 0x14, 0x6C, 0xFD, 0x19, 0xA5, 0x5B, 0x62, 0xFA, 0xEC, 0x5C, 0x78, 0x8A, 0x49, 0x56, 0x94, 0x76, 0x38, 0x18, 0x11, 0xB1, 0x30, 0xDB, 0x8B, 0x1D, 0x43, 0x90, 0xE8, 0x4D, 0xE9, 0xE2, 0x17, 0x68, 0xD5, 0x66, 0x7A, 0x7D, 0xCF, 0x69, 0x8E, 0x54, 0xB3, 0xB0, 0x84, 0xE5, 0x87, 0x96, 0x43, 0x35, 0x7B, 0xFA, 0x6D, 0xF1, 0x78, 0x1C, 0xB0, 0xD2, 0xC2, 0xA6, 0x44, 0x96, 0x26, 0x6C, 0x80, 0x74, 0xF7, 0x81, 0x83, 0xB7, 0x68, 0x02, 0x40, 0x69, 0x7A, 0x0E, 0x14, 0xBB, 0xA4, 0x75, 0xC0, 0x72, 0xAD, 0xEB, 0x9D, 0xAE, 0xFA, 0xCD, 0xD6, 0x39, 0x13, 0x57, 0x73, 0x0B, 0xE7, 0x8C, 0xDA, 0xBB, 0x4C, 0x87, 0x9B, 0x5A, 0xF1, 0x30, 0x4C, 0xEC, 0x0E, 0x3B, 0x43, 0x95, 0xA5, 0x4C, 0x85, 0x06, 0x45, 0xFB, 0x47, 0x68, 0x5A, 0x3D, 0xB8, 0xE9, 0x65, 0x40, 0xE2, 0xEC, 0x9C, 0x1B, 0xD8, 0xE6, 0x02, 0x36, 0xCF, 0x3F, 0x5A, 0x9C, 0xB8, 0xB9, 0x2E, 0xD0, 0xC6, 0x89, 0x21, 0x94, 0x94, 0xD6, 0x5B, 0x4E, 0xCF, 0x6F, 0xCB, 0x49, 0x04, 0x33, 0x8F, 0xBA, 0xEA, 0x4A, 0xEC, 0x6B, 0x33, 0x87, 0xB1, 0x49, 0x41, 0xE3, 0x5A, 0x0F, 0x50, 0xDC, 0xA2, 0x38, 0xC4, 0x64, 0x90, 0x9C, 0x0E, 0x86, 0xE8, 0x15, 0x9D, 0x1C, 0xC4, 0x39, 0xCA, 0x16, 0x00, 0xE4, 0x70, 0x0F, 0xA8, 0xEF, 0xC3, 0x0B, 0xAD, 0x09, 0xE7, 0xCF, 0x9C, 0xED, 0x9B, 0xA9, 0xFE, 0x7E, 0x5D, 0x4B, 0xDD, 0x87, 0x25, 0x55, 0x03, 0x54, 0x0B, 0x02, 0x26, 0x7A, 0x89, 0xAC, 0xF4, 0x53, 0xBA, 0x30, 0x07, 0xD0, 0x90, 0x7C, 0x3E, 0xCA, 0x41, 0xCA, 0xB9, 0x6E, 0x6E, 0x4B, 0x2F, 0x31, 0x98, 0x7D, 0xB6, 0xA5, 0x5C, 0xB9, 0x9D, 0xFF, 0x67, 0x1D, 0xF8, 0x9D, 0xE3, 0x98, 0x17, 0x5B, 0xC9, 0x82, 0x94, 0x83, 0xE4, 0x8E, 0x7E, 0x90, 0x98, 0xC9, 0xE7, 0x07, 0x41, 0x22, 0xCB, 0x3F, 0x3F, 0xA3, 0x3A, 0xB1, 0xD1, 0x3A, 0x9A, 0xC9, 0xA4, 0x94, 0x0D, 0x0A, 0x91, 0x9D, 0xFC, 0x8A, 0x2F, 0x60, 0x8F, 0x88, 0x18, 0xDD, 0xAE, 0xB3, 0xBB, 0x98, 0x26, 0xF7, 0x2E, 0xEF, 0x2E, 0x56, 0x70, 0xED, 0xEA, 0x56, 0xF6, 0xBC, 0xCC, 0x6E, 0xCE, 0x6A, 0xCB, 0x52, 0xB6, 0xDD, 0xBB, 0xF6, 0x95, 0x4E, 0x45, 0x99, 0xF0, 0x5F, 0xCC, 0x10, 0x66, 0x16, 0x60, 0x1B, 0x53, 0x1C, 0x4F, 0xAE, 0x8D, 0x07, 0x51, 0xD5, 0x7A, 0x68, 0x7D, 0x8F, 0x84, 0x1C, 0x8A, 0x5B, 0xC0, 0x95, 0xF4, 0x83, 0x83, 0x74, 0xA1, 0xD6, 0x22, 0xBB, 0xC9, 0x90, 0x98, 0x4E, 0x13, 0xB3, 0x73, 0xD6, 0x45, 0x13, 0x2E, 0x9A, 0xC0, 0xC0, 0xC4, 0x01, 0x99, 0x93, 0x33, 0x51, 0x2D, 0x89, 0xDE, 0x57, 0x68, 0x83, 0x4F, 0x6F, 0x56, 0xE2, 0x04, 0xCC, 0x36, 0x57, 0x08, 0xEC, 0xE7, 0x95, 0x6C, 0x4A, 0x57, 0x72, 0x77, 0x8B, 0x23, 0x3C, 0xED, 0x56, 0xFF, 0x0E, 0x5A, 0xDF, 0x4F, 0x2B, 0x9D, 0x09, 0x04, 0xEC, 0xC3, 0x65, 0x80, 0x54, 0x23, 0x20, 0xA0, 0x2E, 0xE4, 0xB3, 0x53, 0xB5, 0xD3, 0x40, 0x24, 0x80, 0x8E, 0x2F, 0xBB, 0x02, 0x48, 0x74, 0x0B, 0xE3, 0x8B, 0x43, 0xE0, 0x15, 0x9A, 0x8A, 0x53, 0x83, 0xB0, 0x7A, 0xD1, 0x29, 0x24, 0x92, 0x31, 0xDF, 0xBE, 0x23, 0x6B, 0xD2, 0xAA, 0x37, 0xD3, 0x24, 0xEE, 0xD5, 0x2B, 0x13, 0x77, 0x74, 0x92, 0xA8, 0x55, 0xEF, 0x7F, 0xF0, 0xCE, 0xFD, 0x22, 0x39, 0x77, 0x51, 0x3F, 0x25, 0x29, 0xEE, 0x4A, 0xE9, 0x22, 0x7A, 0x57, 0x39, 0xDA, 0xD5, 0x27, 0x00, 0x9F, 0x50, 0xFB, 0x1F, 0x7D, 0x30, 0xB3, 0x1A, 0xE0, 0xEA, 0xBC, 0x4D, 0x5F, 0x48, 0x6B, 0x8B, 0x52, 0x06, 0xB6, 0xF4, 0xCD, 0xBE, 0x26, 0xEC, 0x9D, 0x7D, 0x23, 0xF9, 0x42, 0x76, 0xFF, 0xD3, 0x3D, 0xCF, 0x9C, 0x21, 0x3E, 0x12, 0x1D, 0x8E, 0xAF, 0x16, 0xD5, 0x88, 0x4E, 0x2D, 0x6A, 0x72, 0x2F, 0xD6, 0xB4, 0x3B, 0x02, 0x60, 0x55, 0x79, 0x8A, 0xF0, 0x68, 0xE4, 0x0A, 0xDB, 0xF7, 0x94, 0xCA, 0x62, 0x0D, 0xBE, 0xAF, 0xC3, 0xDD, 0x5E, 0xC1, 0x99, 0x52, 0xFF, 0x2A, 0x2B, 0x5D, 0x2C, 0xE2, 0xC2, 0x57, 0x22, 0x42, 0x88, 0xC4, 0x85, 0x99, 0x38, 0x4D, 0x8B, 0xDB, 0x28, 0x0C, 0x03, 0x25, 0xFE, 0x9D, 0xBB, 0x5D, 0xFE, 0x5A, 0x15, 0xE5, 0x7B, 0xE5, 0x6A, 0xB3, 0xCF, 0x5C, 0x47, 0x43, 0xB3, 0xB0, 0x67, 0x51, 0xCD, 0x57, 0xCC, 0x3E, 0xF6, 0x06, 0x9B, 0x9D, 0xD5, 0x91, 0xB5, 0x2A, 0xFB, 0x50, 0xB6, 0x5E, 0x56, 0xA7, 0xB1, 0x9C, 0x7F, 0xBD, 0x02, 0x08, 0x7B, 0xB7, 0x94, 0x0D, 0x09, 0xD9, 0x11, 0x65, 0xBD, 0x3D, 0xF3, 0xCA, 0x7E, 0xA1, 0xE4, 0x52, 0x22, 0x39, 0xDB, 0xC3, 0x5B, 0x0E, 0x1A, 0xD5, 0x6B, 0x4C, 0x5B, 0x25, 0x12, 0x7F, 0x9C, 0xC8, 0xEF, 0x24, 0x71, 0xA0, 0xCB, 0x3A, 0x9D, 0x5A, 0x34, 0xFB, 0x1A, 0x5E, 0xB8, 0x65, 0xF8, 0xE9, 0xAB, 0xCF, 0x7C, 0xFC, 0xFC, 0x47, 0xC4, 0xCD, 0xE4, 0xD1, 0x94, 0xBF, 0x64, 0x5F, 0xDF, 0x79, 0x69, 0xCF, 0x85, 0x82, 0x81, 0x7D, 0xFD, 0x3F, 0xEE, 0x9B, 0xDD, 0xBF, 0xA8, 0x46, 0xD6, 0x11, 0xA5, 0xB9, 0x13, 0x35, 0x1D, 0xEE, 0xB4, 0x5E, 0xD9, 0x8F, 0x5F, 0xB6, 0x94, 0x3F, 0x5A, 0xD1, 0x56, 0x71, 0xB2, 0x72, 0xCA, 0x28, 0x22, 0xA0, 0x5A, 0xE2, 0x93, 0x90, 0x0A, 0xA4, 0x45, 0x3D, 0xB5, 0x54, 0x28, 0xE4, 0xEF, 0x6C, 0x27, 0xF1, 0x1F, 0x5A, 0xDF, 0x24, 0xB5, 0xE5, 0xF2, 0x7D, 0x6A, 0x74, 0x4E, 0x66, 0xC4, 0x58, 0x1E, 0x00, 0xD1, 0xED, 0x3C, 0x0F, 0x5A, 0x7F, 0x46, 0xEA, 0x9E, 0x98, 0x11, 0x75, 0x95, 0x33, 0xA4, 0x5C, 0x57, 0x30, 0x71, 0x9A, 0x3D, 0xEE, 0x31, 0x77, 0x09, 0x6B, 0xD4, 0x0D, 0x83, 0xF6, 0xAA, 0x61, 0xF0, 0x74, 0x1E, 0xFF, 0x56, 0x9E, 0x96, 0x9F, 0x38, 0x82, 0x99, 0xDE, 0x3F, 0xB8, 0xA9, 0x51, 0xD0, 0xC0, 0xEA, 0xB5, 0x7F, 0xA4, 0x93, 0xCB, 0x74, 0x30, 0xDA, 0xC5, 0x96, 0xD0, 0x78, 0xB0, 0xB1, 0x96, 0x9F, 0x62, 0xB1, 0x76, 0xE7, 0x11, 0x13, 0x3F, 0xB1, 0x1F, 0x33, 0xAA, 0x0F, 0x31, 0xFC, 0x3F, 0x2B, 0xC0, 0x33, 0x0E, 0x05, 0xB7, 0x25, 0x82, 0x03, 0x27, 0x14, 0x2E, 0xF2, 0x47, 0x55, 0xE7, 0x21, 0xFB, 0xE6, 0x73, 0xD5, 0x79, 0xBF, 0xD1, 0x42, 0xB0, 0x27, 0x52, 0x63, 0x8E, 0x58, 0x67, 0x30, 0x73, 0x2A, 0x1C, 0x13, 0x84, 0x35, 0xFC, 0x93, 0x38, 0xF0, 0xDF, 0xAE, 0xBE, 0x2F, 0x14, 0xCA, 0x1E, 0x46, 0x8D, 0xF2, 0xCE, 0x1D, 0xEE, 0x1B, 0x6E, 0xAA, 0xA2, 0xF9, 0x4B, 0x5C, 0x3D, 0x21, 0xF9, 0xE3, 0x8F, 0xCE, 0xD6, 0x70, 0x7E, 0x7C, 0x72, 0x7A, 0x5E, 0x39, 0x99, 0x11, 0x45, 0xBD, 0xFF, 0xAF, 0x9C, 0x47, 0x5F, 0xB4, 0x51, 0xD1, 0xEE, 0x45, 0xE3, 0xD6, 0x8D, 0xBE, 0x54, 0x85, 0xA5, 0x25, 0x9F, 0x2A, 0x8C, 0x45, 0xB9, 0xF2, 0x2C, 0x98, 0x57, 0xF4, 0xA9, 0x7D, 0xDB, 0x6E, 0x6C, 0xCB, 0xDE, 0xD1, 0xB1, 0x63, 0xD5, 0xCE, 0x43, 0x3B, 0x17, 0x3C, 0xFB, 0x55, 0xCE, 0xBE, 0xDC, 0x1B, 0xB9, 0xD9, 0x79, 0x1D, 0x79, 0x2B, 0x65, 0x75, 0xA5, 0xED, 0xA6, 0xAC, 0x25, 0x45, 0xA2, 0x33, 0xE4, 0x80, 0xE6, 0xB2, 0x4F, 0x1A, 0x47, 0x9A, 0x6E, 0x9C, 0xBB, 0x36, 0x38, 0x74, 0xF9, 0xCA, 0xD0, 0xE5, 0x1B, 0x17, 0x3F, 0x19, 0xBC, 0x7D, 0x7E, 0xEC, 0xDC, 0xBD, 0xB3, 0x7F, 0xEF, 0x4D, 0x1B, 0x8C, 0x70, 0x72, 0xF8, 0xBD, 0xF5, 0x7A, 0x1F, 0x5D, 0xA8, 0xB5, 0xC8, 0x9A, 0x19, 0x12, 0xD3, 0x25, 0xC2, 0xC1, 0x50, 0x8D, 0xD3, 0x40, 0x22, 0x66, 0xE7, 0x66, 0x17, 0x4D, 0xB9, 0x7C, 0x05, 0x57, 0x5D, 0x89, 0x67, 0xE2, 0xD7, 0xE3, 0x17, 0xA4, 0xE5, 0x0B, 0x2D, 0x34, 0x77, 0xED, 0x29, 0xB1, 0xCC, 0xE9, 0x23, 0x51, 0x42, 0x4B, 0x7D, 0x17, 0x59, 0x86, 0xBC, 0x54, 0x12, 0x01, 0x28, 0x0F, 0x01, 0xC4, 0x32, 0xD4, 0x55, 0xDF, 0x25, 0x3A, 0xFB, 0x7C, 0xF5, 0xE9, 0x34, 0xA1, 0x06, 0x5B, 0x5D, 0xF5, 0x67, 0x94, 0xBC, 0x84, 0x1C, 0x0C, 0x4D, 0x0B, 0x8C, 0xCC, 0x10, 0x90, 0x27, 0x9C, 0x5A, 0xE6, 0xA1, 0x3C, 0x08, 0xD4, 0x20, 0xFF, 0x17, 0x81, 0xFB, 0xE6, 0x27, 0x6A, 0xCC, 0x2F, 0x69, 0x8A, 0xD7, 0xBF, 0x68, 0x94, 0x24, 0x87, 0x82, 0x68, 0x5B, 0x56, 0x98, 0xE6, 0xA6, 0x92, 0x42, 0x1A, 0x09, 0xD9, 0x18, 0x5A, 0xAB, 0xE4, 0x9C, 0x0F, 0x50, 0x49, 0x33, 0x40, 0x5A, 0x2F, 0x30, 0xE6, 0x34, 0x52, 0xAB, 0x05, 0x62, 0xB9, 0xB6, 0x8D, 0xC7, 0xF1, 0x58, 0x09, 0x41, 0x8B, 0x99, 0xA3, 0x3C, 0x01, 0x9D, 0x60, 0x36, 0x9B, 0x23, 0xBA, 0x4D, 0x4B, 0xB8, 0x8D, 0x81, 0x19, 0xA2, 0x80, 0x83, 0x6F, 0x72, 0x21, 0x29, 0x04, 0x2C, 0x06, 0xAE, 0x7E, 0x80, 0xC6, 0x55, 0x20, 0xA2, 0xE1, 0xB4, 0x94, 0xA0, 0xB5, 0xBC, 0xFD, 0x42, 0x89, 0x59, 0x72, 0x38, 0x98, 0xA2, 0xF2, 0xDD, 0xF1, 0xE4, 0xDA, 0xF8, 0x48, 0x0D, 0xFC, 0xCA, 0x57, 0x38, 0x9B, 0x40, 0x22, 0x10, 0x2B, 0x14, 0x98, 0x0A, 0x24, 0x1C, 0x40, 0x68, 0x16, 0x1D, 0x2C, 0x94, 0x16, 0x38, 0x18, 0xFD, 0xBE, 0x08, 0xA6, 0x96, 0xAC, 0xCC, 0x86, 0x29, 0x87, 0xEC, 0xCD, 0xFD, 0x9A, 0xA9, 0x9B, 0xF6, 0xDF, 0xF6, 0x6B, 0x04, 0x8E, 0x6A, 0xD2, 0x6A, 0x28, 0xD5, 0x84, 0xCA, 0xDE, 0xF7, 0x20, 0xD0, 0x72, 0x14, 0xF9, 0xA9, 0xEA, 0x37, 0x72, 0xA4, 0xBA, 0x92, 0xC7, 0xF1, 0x25, 0x01, 0xCD, 0x56, 0x8E, 0x77, 0x05, 0x88, 0x95, 0x1C, 0xFF, 0xEB, 0x00, 0xB0, 0xF7, 0x3D, 0x01, 0xB0, 0xBE, 0xEF, 0x82, 0x46, 0x74, 0xDD, 0x65, 0xE0, 0xF8, 0x5F, 0xC8, 0x99, 0xE6, 0x4A, 0xD0, 0x90, 0x9E, 0x76, 0xC5, 0x9C, 0xFA, 0x9E, 0x39, 0x33, 0xB6, 0x78, 0xDD, 0x7F, 0x21, 0x0A, 0x4D, 0x88, 0x7F, 0x23, 0xA4, 0x26, 0xF1, 0x56, 0xFD, 0x92, 0x34, 0x12, 0xF7, 0xEA, 0xA1, 0xFC, 0xBC, 0xF5, 0xC0, 0xCA, 0x75, 0xD5, 0xEB, 0x4D, 0x52, 0xF4, 0x5E, 0x01, 0x8B, 0x8F, 0xDE, 0xFB, 0x19, 0x8D, 0x80, 0x65, 0x17, 0x47, 0xE2, 0x40, 0x25, 0x06, 0x12, 0x62, 0x77, 0xF5, 0xA5, 0x4A, 0xFD, 0xF2, 0x3E, 0x13, 0xAA, 0x3C, 0x09, 0x93, 0x77, 0xBB, 0x94, 0xC1, 0x07, 0xC6, 0x54, 0x42, 0x06, 0x3F, 0x36, 0x06, 0x60, 0x2E, 0xA9, 0x0E, 0xC6, 0x08, 0xEF, 0xBF, 0x99, 0x40, 0xEE, 0x0F, 0xC5, 0xF4, 0x67, 0xF8, 0x3F, 0x1B, 0xBB, 0x2F, 0xAD, 0x13, 0x98, 0x05, 0x48, 0x2C, 0xCB, 0x38, 0xB5, 0xCE, 0xBD, 0x38, 0x5D, 0xE5, 0x14, 0x09, 0x84, 0x89, 0xD3, 0xD3, 0x31, 0x86, 0x0C, 0xFF, 0xDE, 0xA1, 0xAF, 0x49, 0x14, 0x52, 0x29, 0xD8, 0xEA, 0x0C, 0xFE, 0xF3, 0x31, 0x4D, 0x14, 0x4B, 0x78, 0xC3, 0x58, 0x12, 0x31, 0x2A, 0xBE, 0x3E, 0x10, 0xAB, 0xBA, 0xB2, 0x94, 0x85, 0xE6, 0xA3, 0x6B, 0xA0, 0x39, 0x7F, 0xC3, 0xC4, 0xBA, 0xBB, 0xEB, 0x94, 0xAB, 0xAC, 0x71, 0x97, 0x36, 0x14, 0x4F, 0xC2, 0x5C, 0xC8, 0x92, 0xC5, 0x93, 0x31, 0x45, 0x1B, 0xC8, 0xE2, 0xAF, 0x63, 0x76, 0x6C, 0xB0, 0xAE, 0xF3, 0x3F, 0xA4, 0xBE, 0xA7, 0x70, 0x96, 0xC5, 0xF1, 0x2F, 0x85, 0x1E, 0xD7, 0x72, 0xFE, 0x9F, 0x86, 0xEE, 0x4D, 0x25, 0x88, 0xA1, 0x50, 0xCC, 0x46, 0xCE, 0x6F, 0x09, 0xDD, 0x53, 0xBC, 0x53, 0x81, 0x64, 0xE7, 0xF8, 0x3A, 0xDC, 0x0D, 0xE9, 0xA5, 0x4E, 0x9C, 0x3D, 0xFC, 0xF9, 0xAB, 0xB1, 0x25, 0x66, 0x68, 0x76, 0x07, 0x7F, 0xAE, 0xDC, 0x5B, 0xB4, 0xF4, 0xD3, 0x4B, 0xE6, 0x97, 0x62, 0x0F, 0x6F, 0x80, 0x6C, 0xEA, 0xFB, 0x38, 0x5B, 0x32, 0x1E, 0xC9, 0xFF, 0xD4, 0xB8, 0xC6, 0x03, 0x56, 0x7A, 0x96, 0x71, 0xBC, 0x10, 0x00, 0x38, 0x0B, 0x73, 0x77, 0x4B, 0xD8, 0x07, 0x95, 0x00, 0x3B, 0x32, 0x00, 0xDA, 0x0B, 0xAB, 0xC0, 0x65, 0x34, 0x15, 0x1A, 0x0F, 0x76, 0x0A, 0xD6, 0x09, 0xDF, 0xCB, 0xC9, 0x0D, 0xB3, 0x89, 0x56, 0xAB, 0x11, 0xAF, 0x62, 0xF2, 0x47, 0xDA, 0xF7, 0xD7, 0xC1, 0x3A, 0xBF, 0xEF, 0x65, 0x25, 0xE2, 0xC7, 0xAA, 0x54, 0xB3, 0x6F, 0xCD, 0xE7, 0x2F, 0xA6, 0x96, 0x84, 0xFB, 0xDA, 0x5E, 0xCB, 0x9F, 0x29, 0xA8, 0x9D, 0x92, 0xBE, 0x89, 0x8B, 0xF2, 0x27, 0xF6, 0xD5, 0x5E, 0x92, 0x4C, 0x91, 0xD8, 0xFB, 0xEA, 0xD6, 0x19, 0xA3, 0xBA, 0xD6, 0xE4, 0x93, 0x96, 0x71, 0xFE, 0xF2, 0x40, 0x50, 0xE1, 0x18, 0xE8, 0x52, 0x25, 0x13, 0x77, 0xA1, 0xD3, 0xC4, 0xE1, 0xAC, 0xBF, 0x21, 0x30, 0x6D, 0x3F, 0x3A, 0x00, 0xB0, 0xA3, 0x95, 0xE0, 0xCE, 0xEA, 0x0F, 0xC3, 0xB9, 0x77, 0x03, 0xD3, 0x58, 0xF3, 0x42, 0x58, 0x53, 0xC8, 0xDF, 0x0B, 0x3C, 0x64, 0x3F, 0x9A, 0x03, 0x95, 0xEA, 0x78, 0x70, 0xCE, 0xB6, 0x36, 0x5A, 0x9F, 0xB4, 0xCB, 0x75, 0x43, 0x21, 0xBF, 0x2F, 0x94, 0x88, 0x35, 0x0F, 0x80, 0x28, 0xC6, 0xE8, 0x08, 0xA8, 0xC6, 0x83, 0x3F, 0xB9, 0x4F, 0x7D, 0xA0, 0x06, 0xD4, 0xC3, 0x15, 0xAD, 0xA9, 0xB2, 0xC6, 0x6A, 0xC0, 0x63, 0x28, 0x0E, 0x93, 0x3D, 0xE5, 0x4B, 0x50, 0x66, 0xF3, 0x64, 0x08, 0x78, 0x33, 0x21, 0x27, 0x12, 0xC1, 0x07, 0xF8, 0x8C, 0x90, 0xEC, 0xD0, 0x67, 0x65, 0x77, 0xE5, 0xC8, 0xEA, 0x2B, 0xFE, 0xC2, 0xFA, 0x7E, 0x04, 0x36, 0xA3, 0xE7, 0x5C, 0xF6, 0xBE, 0x9F, 0x81, 0xDB, 0x72, 0xEC, 0x2F, 0x99, 0x1E, 0x23, 0xD5, 0xB1, 0xBA, 0x63, 0xA7, 0x8D, 0x65, 0x9F, 0x03, 0x2C, 0xA3, 0x0C, 0xE2, 0xE8, 0xC3, 0x03, 0x9F, 0x4A, 0x76, 0xB9, 0xEF, 0x6C, 0xDF, 0x08, 0xCB, 0x1F, 0x46, 0x71, 0xDE, 0x4C, 0xCA, 0xA6, 0x06, 0xD6, 0x13, 0xBB, 0x15, 0xF7, 0xAA, 0xEC, 0xCD, 0x03, 0x50, 0x9E, 0x06, 0xED, 0x4D, 0xF2, 0x4E, 0x4D, 0x0B, 0x61, 0xF4, 0xBA, 0x30, 0x1F, 0xCC, 0xEE, 0x55, 0x55, 0xF3, 0x4A, 0x9C, 0x80, 0xB9, 0x38, 0x6B, 0x38, 0x61, 0x50, 0xEE, 0x39, 0x14, 0x18, 0x93, 0xDC, 0xC0, 0x72, 0xFC, 0x85, 0x17, 0xF7, 0x5B, 0x13, 0xF0, 0x82, 0x99, 0x03, 0x97, 0x0E, 0x28, 0x7F, 0x1C, 0xBF, 0x79, 0x7C, 0x7B, 0x89, 0x59, 0x89, 0x8E, 0x0F, 0x4F, 0xBE, 0xA0, 0xBC, 0x27, 0x6F, 0x4E, 0xFE, 0xA0, 0xD8, 0xB5, 0xD5, 0xF5, 0xE5, 0xC7, 0xE1, 0x6E, 0x49, 0x3F, 0x5C, 0x79, 0x9A, 0x0C, 0x85, 0x80, 0x3F, 0x1E, 0xDD, 0x13, 0x47, 0x38, 0x40, 0x3A, 0x2A, 0xE5, 0x3B, 0xAC, 0xCF, 0xF9, 0xDF, 0x68, 0xF8, 0x4B, 0x26, 0x1B, 0xC1, 0x64, 0x2E, 0x66, 0xB7, 0x31, 0xB1, 0xCC, 0xCC, 0x01, 0x1E, 0x35, 0xC3, 0xC4, 0xCD, 0x24, 0x17, 0x9A, 0xB3, 0xBA, 0xAE, 0x1F, 0x88, 0xEB, 0xC2, 0x75, 0x26, 0xF5, 0xF5, 0x4E, 0x03, 0x77, 0xF4, 0xC4, 0x3C, 0xAB, 0xEE, 0xC0, 0x27, 0x76, 0x99, 0x25, 0xAC, 0x39, 0x07, 0x52, 0x2B, 0x66, 0x00, 0x95, 0x72, 0x17, 0x14, 0x9F, 0xB2, 0x3F, 0xD2, 0x2F, 0xF3, 0x56, 0x73, 0xA7, 0xFC, 0x23, 0x45, 0x39, 0x8B, 0xAE, 0xFC, 0x14, 0xB6, 0x5C, 0x0B, 0xF9, 0x82, 0x10, 0x41, 0x86, 0x68, 0xE0, 0x5F, 0x82, 0x6E, 0x63, 0x2B, 0xB4, 0x10, 0x66, 0x40, 0xCE, 0x88, 0x7F, 0xC6, 0xB4, 0x97, 0xDD, 0x01, 0xFC, 0x5E, 0x79, 0x1F, 0x35, 0x71, 0x99, 0x5A, 0x71, 0x4C, 0xEE, 0x71, 0x1D, 0xA4, 0x9E, 0x52, 0x98, 0x8B, 0xDD, 0x62, 0x40, 0xEF, 0x74, 0xE1, 0x19, 0x77, 0x3B, 0x97, 0x29, 0xB3, 0x6A, 0x02, 0xD7, 0xB0, 0x87, 0xB5, 0x70, 0x89, 0x97, 0x54, 0xDB, 0x74, 0xD4, 0x0A, 0xAD, 0x8C, 0xD4, 0x02, 0xE3, 0x1A, 0x1B, 0x38, 0xDA, 0xAE, 0xCC, 0x49, 0xD2, 0x7D, 0xF1, 0xA1, 0xF2, 0xB6, 0xE9, 0x2E, 0xCC, 0xBF, 0xDF, 0xD1, 0xDD, 0xFD, 0x23, 0x89, 0x92, 0xF4, 0xBC, 0x3D, 0xA0, 0x23, 0x11, 0xA3, 0xF7, 0xFF, 0x32, 0xF0, 0x07, 0xAC, 0xFB, 0x09, 0x60, 0xEF, 0xFB, 0x2E, 0x48, 0x56, 0x3F, 0x57, 0x15, 0xE1, 0x96, 0xC3, 0x3E, 0xE8, 0x06, 0xA6, 0x38, 0xFE, 0x75, 0x07, 0x4C, 0xAE, 0xF2, 0x6B, 0x75, 0x27, 0xBD, 0xCC, 0x9E, 0xDA, 0x54, 0x5B, 0x43, 0x26, 0x9F, 0x1F, 0x04, 0x0D, 0x2C, 0xFF, 0xEC, 0xE4, 0x82, 0xF1, 0xE0, 0xEF, 0x07, 0x8A, 0x47, 0xCF, 0x32, 0x7B, 0xCA, 0x44, 0xA1, 0x12, 0x46, 0xFE, 0x4B, 0x87, 0x3D, 0x22, 0x62, 0x74, 0x23, 0x67, 0x47, 0x98, 0xDB, 0xEE, 0x11, 0xEF, 0x08, 0xDB, 0xEE, 0x74, 0x9A, 0x46, 0xBA, 0x23, 0xFC, 0x6D, 0x7E, 0xE4, 0xA4, 0xF6, 0x45, 0x12, 0xC7, 0x8B, 0xB0, 0x0F, 0x64, 0x25, 0x8F, 0x44, 0x95, 0xF4, 0xAC, 0x96, 0x10, 0xB0, 0x5C, 0xCB, 0x91, 0x08, 0x00, 0x7D, 0x8B, 0xC4, 0xED, 0x1C, 0xFC, 0x16, 0x2A, 0x76, 0x9D, 0xAE, 0xBC, 0xEE, 0x92, 0xFF, 0xC6, 0xA0, 0xB9, 0xFD, 0xAA, 0x53, 0x15, 0x46, 0x7A, 0x8D, 0x24, 0x6E, 0x4B, 0x8B, 0xCC, 0x7A, 0xEC, 0xEE, 0x9F, 0xFE, 0xD7, 0x19, 0xE3, 0xC1, 0xF1, 0x7F, 0x5D, 0x3A, 0x6E, 0xEF, 0x09, 0xDF, 0x43, 0xCA, 0x7B, 0x35, 0xE2, 0xA3, 0xD5, 0xBE, 0xF8, 0xF1, 0xA0, 0xEB, 0x6A, 0xF1, 0x71, 0xB9, 0xDA, 0xBD, 0xB1, 0x33, 0x7A, 0x2D, 0x59, 0x55, 0x09, 0x95, 0x8B, 0x47, 0x58, 0x53, 0xDC, 0x05, 0x7F, 0x0D, 0x27, 0xE4, 0xF0, 0x73, 0x4E, 0x8D, 0x88, 0xDE, 0x91, 0xB7, 0x37, 0x1D, 0xC7, 0x9A, 0xF5, 0x20, 0xF9, 0x22, 0x9E, 0xD9, 0xEE, 0xFC, 0x1B, 0x93, 0x36, 0x64, 0x5F, 0x5E, 0xD1, 0xCA, 0xBF, 0x3E, 0x09, 0xF4, 0x99, 0x9B, 0x7B, 0xBF, 0xDF, 0x3D, 0x1E, 0xFC, 0x89, 0x37, 0x99, 0x5B, 0x9D, 0x49, 0x0B, 0x0E, 0xE6, 0xB6, 0xF0, 0x56, 0xAC, 0x58, 0x96, 0x0D, 0x63, 0x63, 0x49, 0xBC, 0x27, 0xB2, 0x65, 0x52, 0x2A, 0x2D, 0x39, 0x18, 0x51, 0xC3, 0xC1, 0xD2, 0xED, 0x58, 0xF3, 0xDB, 0xAD, 0xF6, 0xA3, 0x7A, 0xB0, 0xB4, 0x6A, 0xA9, 0x2B, 0xAD, 0xA1, 0x6D, 0x3B, 0x75, 0xE4, 0xB3, 0xD6, 0x96, 0xCA, 0x3F, 0xD7, 0x51, 0x9E, 0xD3, 0x40, 0x74, 0x66, 0xC3, 0xC3, 0xD5, 0xB0, 0xE7, 0xBD, 0x42, 0xDE, 0x3D, 0x05, 0x76, 0x0A, 0xE3, 0xC1, 0xC7, 0x06, 0x28, 0xCF, 0x2B, 0x50, 0xDB, 0x3D, 0xC2, 0x1E, 0x3C, 0xE3, 0x7F, 0xF2, 0xD5, 0x10, 0x7F, 0x73, 0x21, 0x10, 0xD1, 0xAB, 0xBA, 0xD3, 0x92, 0x90, 0x23, 0x6D, 0x14, 0x18, 0xA9, 0x4A, 0xEE, 0x5B, 0xAD, 0x3F, 0x25, 0x56, 0xE5, 0xC2, 0xBB, 0x9D, 0xFE, 0xC3, 0x0B, 0x1B, 0x46, 0x58, 0x7F, 0x05, 0x6A, 0x10, 0x91, 0x4D, 0x77, 0x4C, 0x52, 0x3C, 0xE7, 0x17, 0x51, 0x83, 0xDC, 0xE7, 0xE3, 0x30, 0xCF, 0x11, 0x7E, 0x13, 0x65, 0xAD, 0x06, 0xC3, 0xDF, 0xB7, 0x92, 0xF2, 0xDB, 0xB0, 0x23, 0x03, 0xC0, 0x1F, 0xA3, 0xAE, 0x97, 0xB3, 0x17, 0xFF, 0x83, 0xCF, 0x6F, 0x8F, 0x07, 0x9F, 0x3C, 0xAF, 0xAA, 0xDD, 0xDA, 0x36, 0x1E, 0xFC, 0x68, 0x60, 0xFA, 0xA9, 0x82, 0x6D, 0x43, 0xDB, 0x32, 0x76, 0x9C, 0xDC, 0x91, 0xB2, 0xF3, 0x17, 0x3B, 0x89, 0x67, 0xA7, 0x73, 0x0A, 0x72, 0x87, 0x72, 0x33, 0xF2, 0x4E, 0xE6, 0x69, 0x77, 0x97, 0xDA, 0x00, 0xF8, 0x37, 0xFF, 0x92, 0x16, 0xC1
     },
+    .text_zlen = 3121,
     .text_len = 3792,
     .data = (uint8_t const[]){
-        0x14, 0x00, 0x84, 0x40, 0x72, 0x0A, 0x80, 0x40, 0xC2, 0x0A, 0x80, 0x40, 0x1A, 0x0B, 0x80, 0x40, 0xE8, 0x0B, 0x80, 0x40, 0x54, 0x0C, 0x80, 0x40, 0x02, 0x0C, 0x80, 0x40, 0x3E, 0x09, 0x80, 0x40, 0xA4, 0x0B, 0x80, 0x40, 0xE4, 0x0B, 0x80, 0x40, 0x2E, 0x0B, 0x80, 0x40, 0xEE, 0x08, 0x80, 0x40, 0x62, 0x0B, 0x80, 0x40, 0xEE, 0x08, 0x80, 0x40, 0x4C, 0x0A, 0x80, 0x40, 0x92, 0x0A, 0x80, 0x40, 0xC2, 0x0A, 0x80, 0x40, 0x1A, 0x0B, 0x80, 0x40, 0x5E, 0x0A, 0x80, 0x40, 0xA2, 0x09, 0x80, 0x40, 0xD2, 0x09, 0x80, 0x40, 0x5A, 0x0A, 0x80, 0x40, 0xAC, 0x0E, 0x80, 0x40, 0xC2, 0x0A, 0x80, 0x40, 0x6C, 0x0D, 0x80, 0x40, 0x64, 0x0E, 0x80, 0x40, 0x2E, 0x08, 0x80, 0x40, 0x8C, 0x0E, 0x80, 0x40, 0x2E, 0x08, 0x80, 0x40, 0x2E, 0x08, 0x80, 0x40, 0x2E, 0x08, 0x80, 0x40, 0x2E, 0x08, 0x80, 0x40, 0x2E, 0x08, 0x80, 0x40, 0x2E, 0x08, 0x80, 0x40, 0x2E, 0x08, 0x80, 0x40, 0x2E, 0x08, 0x80, 0x40, 0x08, 0x0D, 0x80, 0x40, 0x2E, 0x08, 0x80, 0x40, 0x8A, 0x0D, 0x80, 0x40, 0x64, 0x0E, 0x80, 0x40
+        0x28, 0xCF, 0x13, 0x61, 0x68, 0x71, 0x28, 0xE2, 0x6A, 0x70, 0x38, 0x04, 0xC4, 0x52, 0xDC, 0x0D, 0x0E, 0x2F, 0x80, 0x38, 0x84, 0xA7, 0xC1, 0x81, 0x09, 0x88, 0xED, 0x38, 0x1B, 0x1C, 0x96, 0x00, 0xF9, 0x4F, 0x80, 0x58, 0x0F, 0x88, 0xDF, 0x71, 0x34, 0x38, 0x24, 0x41, 0x69, 0x1F, 0xA0, 0xFA, 0x49, 0x48, 0xFA, 0xE2, 0x80, 0xF4, 0x22, 0xA0, 0xFA, 0x4B, 0x40, 0x1C, 0x05, 0x64, 0xAF, 0xE1, 0x83, 0xC8, 0xE5, 0xF0, 0x36, 0x38, 0xA4, 0x00, 0xD9, 0x7A, 0x40, 0x3D, 0x3D, 0x50, 0x1A, 0x1F, 0xE6, 0xE0, 0x85, 0xD0, 0x5D, 0x50, 0x7D, 0x00, 0x9F, 0x16, 0x2F, 0xD8
     },
+    .data_zlen = 92,
     .data_len = 160,
     .text_start = 0x40800000,
     .data_start = 0x40852BB0,
@@ -1,17 +1,20 @@
 // WARNING: This is a generated file, do not edit it!
 // clang-format off
 // Generated from esp-idf-tools/python_env/idf5.3_py3.12_env/lib/python3.12/site-packages/esptool/targets/stub_flasher/stub_flasher_32p4.json
+// The text and data segments are zlib streams with a 1024 byte window
 
 #include "chips.h"
 
 et2_stub_t const stub_esp32p4 = {
     .text = (uint8_t const[]){
-        0x41, 0x11, 0x22, 0xC4, 0x26, 0xC2, 0x06, 0xC6, 0xB7, 0x27, 0x0D, 0x50, 0x11, 0x47, 0x37, 0x04, 0xF5, 0x4F, 0xD8, 0xCB, 0xB7, 0x24, 0x0D, 0x50, 0x13, 0x04, 0x04, 0x00, 0xDC, 0x40, 0x91, 0x8B, 0x91, 0xE7, 0xB2, 0x40, 0x22, 0x44, 0x92, 0x44, 0x41, 0x01, 0x82, 0x80, 0x88, 0x40, 0x1C, 0x40, 0x13, 0x75, 0xF5, 0x0F, 0x82, 0x97, 0xDD, 0xB7, 0x01, 0x11, 0xB7, 0xA7, 0x0C, 0x50, 0x4E, 0xC6, 0x83, 0xA9, 0x87, 0x00, 0x4A, 0xC8, 0x37, 0x09, 0xF5, 0x4F, 0x26, 0xCA, 0x52, 0xC4, 0x06, 0xCE, 0x22, 0xCC, 0xB7, 0xA4, 0x0C, 0x50, 0x7D, 0x5A, 0x13, 0x09, 0x09, 0x00, 0xC0, 0x4C, 0x13, 0x74, 0xF4, 0x3F, 0x0D, 0xE0, 0xF2, 0x40, 0x62, 0x44, 0x23, 0xA8, 0x34, 0x01, 0x42, 0x49, 0xD2, 0x44, 0xB2, 0x49, 0x22, 0x4A, 0x05, 0x61, 0x82, 0x80, 0x88, 0x40, 0x83, 0x27, 0x09, 0x00, 0x13, 0x75, 0xF5, 0x0F, 0x82, 0x97, 0x7D, 0x14, 0xE3, 0x19, 0x44, 0xFF, 0xC9, 0xBF, 0x13, 0x07, 0x00, 0x0C, 0x94, 0x41, 0xAA, 0x87, 0x63, 0x18, 0xE5, 0x00, 0x85, 0x47, 0x85, 0xC6, 0x23, 0xA0, 0x05, 0x00, 0x79, 0x55, 0x82, 0x80, 0x05, 0x47, 0x63, 0x87, 0xE6, 0x00, 0x09, 0x46, 0x63, 0x8D, 0xC6, 0x00, 0x7D, 0x55, 0x82, 0x80, 0x42, 0x05, 0x13, 0x07, 0xB0, 0x0D, 0x41, 0x85, 0x63, 0x95, 0xE7, 0x02, 0x89, 0x47, 0x9C, 0xC1, 0xF5, 0xB7, 0x93, 0x06, 0xC0, 0x0D, 0x63, 0x16, 0xD5, 0x00, 0x98, 0xC1, 0x13, 0x05, 0x00, 0x0C, 0x82, 0x80, 0x93, 0x06, 0xD0, 0x0D, 0x7D, 0x55, 0x63, 0x95, 0xD7, 0x00, 0x98, 0xC1, 0x13, 0x05, 0xB0, 0x0D, 0x82, 0x80, 0xB7, 0x35, 0xF6, 0x4F, 0x41, 0x11, 0x93, 0x85, 0x45, 0xBA, 0x06, 0xC6, 0x61, 0x3F, 0x63, 0x45, 0x05, 0x06, 0xB7, 0x37, 0xF6, 0x4F, 0x93, 0x87, 0xC7, 0xB1, 0x03, 0xA7, 0x07, 0x08, 0x03, 0xD6, 0x47, 0x08, 0x13, 0x75, 0xF5, 0x0F, 0x93, 0x06, 0x16, 0x00, 0xC2, 0x06, 0xC1, 0x82, 0x23, 0x92, 0xD7, 0x08, 0x32, 0x97, 0x23, 0x00, 0xA7, 0x00, 0x03, 0xD7, 0x47, 0x08, 0x91, 0x67, 0x93, 0x87, 0x07, 0x04, 0x63, 0x1E, 0xF7, 0x02, 0x37, 0xB7, 0xF5, 0x4F, 0x13, 0x07, 0xC7, 0xB1, 0xA1, 0x67, 0xBA, 0x97, 0x03, 0xA6, 0x07, 0x08, 0xB7, 0xF6, 0xF5, 0x4F, 0xB7, 0x37, 0xF6, 0x4F, 0x93, 0x87, 0xC7, 0xB1, 0x93, 0x86, 0xC6, 0xB5, 0x63, 0x1F, 0xE6, 0x00, 0x23, 0xA6, 0xC7, 0x08, 0x23, 0xA0, 0xD7, 0x08, 0x23, 0x92, 0x07, 0x08, 0x21, 0xA0, 0xF9, 0x57, 0xE3, 0x06, 0xF5, 0xFC, 0xB2, 0x40, 0x41, 0x01, 0x82, 0x80, 0x23, 0xA6, 0xD7, 0x08, 0x23, 0xA0, 0xE7, 0x08, 0xDD, 0xB7, 0x37, 0xD7, 0x08, 0x50, 0x7C, 0x4B, 0x9D, 0x8B, 0xF5, 0xFF, 0x37, 0xC7, 0x08, 0x50, 0x7C, 0x4B, 0x9D, 0x8B, 0xF5, 0xFF, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0xDD, 0x37, 0xB7, 0xD7, 0x08, 0x50, 0x23, 0xA6, 0x07, 0x02, 0x37, 0x07, 0x00, 0x08, 0x98, 0xC3, 0x98, 0x43, 0x7D, 0xFF, 0xC8, 0x57, 0xB2, 0x40, 0x13, 0x45, 0xF5, 0xFF, 0x05, 0x89, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0xD9, 0x3F, 0x7D, 0xDD, 0x37, 0x07, 0x00, 0x40, 0xB7, 0xD7, 0x08, 0x50, 0x98, 0xC3, 0x37, 0xD7, 0x08, 0x50, 0x1C, 0x43, 0xFD, 0xFF, 0xB2, 0x40, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x22, 0xC4, 0x37, 0x84, 0xF5, 0x4F, 0x93, 0x07, 0x04, 0x01, 0x4A, 0xC0, 0x03, 0xA9, 0x07, 0x01, 0x06, 0xC6, 0x26, 0xC2, 0x63, 0x0A, 0x09, 0x04, 0x45, 0x37, 0x39, 0xC5, 0xBD, 0x47, 0x13, 0x04, 0x04, 0x01, 0x81, 0x44, 0x63, 0xD6, 0x27, 0x01, 0x04, 0x44, 0xBD, 0x88, 0x93, 0xB4, 0x14, 0x00, 0x7D, 0x37, 0x85, 0x3F, 0x1C, 0x44, 0x37, 0x06, 0x80, 0x00, 0x13, 0x97, 0xC7, 0x00, 0x99, 0xE0, 0x37, 0x06, 0x00, 0x01, 0xB7, 0xF6, 0xFF, 0x00, 0x75, 0x8F, 0xB7, 0xD6, 0x08, 0x50, 0xD8, 0xC2, 0x90, 0xC2, 0x98, 0x42, 0x7D, 0xFF, 0x41, 0x47, 0x91, 0xE0, 0x05, 0x47, 0x33, 0x09, 0xE9, 0x40, 0xBA, 0x97, 0x23, 0x28, 0x24, 0x01, 0x1C, 0xC4, 0xB2, 0x40, 0x22, 0x44, 0x92, 0x44, 0x02, 0x49, 0x41, 0x01, 0x82, 0x80, 0x01, 0x11, 0x06, 0xCE, 0x22, 0xCC, 0x25, 0x37, 0x37, 0x04, 0xF4, 0x4F, 0x6C, 0x00, 0x13, 0x05, 0xC4, 0xFE, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0x20, 0xF3, 0xAA, 0x87, 0x05, 0x45, 0x95, 0xE7, 0xB2, 0x47, 0x93, 0xF7, 0x07, 0x20, 0x3E, 0xC6, 0x89, 0x37, 0x37, 0xD7, 0x08, 0x50, 0x1C, 0x47, 0xB7, 0x06, 0x40, 0x00, 0x13, 0x05, 0xC4, 0xFE, 0xD5, 0x8F, 0x1C, 0xC7, 0xB2, 0x45, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0xA0, 0xF0, 0x33, 0x35, 0xA0, 0x00, 0xF2, 0x40, 0x62, 0x44, 0x05, 0x61, 0x82, 0x80, 0x41, 0x11, 0xB7, 0x87, 0xF5, 0x4F, 0x06, 0xC6, 0x93, 0x87, 0x07, 0x01, 0x05, 0x47, 0x23, 0x80, 0xE7, 0x00, 0x13, 0xD7, 0xC5, 0x00, 0x98, 0xC7, 0x05, 0x67, 0x7D, 0x17, 0xCC, 0xC3, 0xC8, 0xC7, 0xF9, 0x8D, 0x3A, 0x95, 0xAA, 0x95, 0xB1, 0x81, 0x8C, 0xCB, 0x23, 0xAA, 0x07, 0x00, 0x41, 0x37, 0x19, 0xC1, 0x13, 0x05, 0x50, 0x0C, 0xB2, 0x40, 0x41, 0x01, 0x82, 0x80, 0x01, 0x11, 0x22, 0xCC, 0x37, 0x84, 0xF5, 0x4F, 0x93, 0x07, 0x04, 0x01, 0x26, 0xCA, 0xC4, 0x47, 0x4E, 0xC6, 0x06, 0xCE, 0x4A, 0xC8, 0xAA, 0x89, 0x13, 0x04, 0x04, 0x01, 0x63, 0xF3, 0x95, 0x00, 0xAE, 0x84, 0xA9, 0xC0, 0x03, 0x29, 0x44, 0x00, 0x26, 0x99, 0x13, 0x59, 0xC9, 0x00, 0x1C, 0x48, 0x63, 0x55, 0xF0, 0x00, 0x1C, 0x44, 0x63, 0x5E, 0xF9, 0x02, 0xB5, 0x3D, 0x7D, 0xDD, 0x48, 0x40, 0x26, 0x86, 0xCE, 0x85, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0xA0, 0xE3, 0x13, 0x75, 0xF5, 0x0F, 0x01, 0xC5, 0x93, 0x07, 0x40, 0x0C, 0x5C, 0xC8, 0x5C, 0x40, 0xA6, 0x97, 0x5C, 0xC0, 0x5C, 0x44, 0x85, 0x8F, 0x5C, 0xC4, 0xF2, 0x40, 0x62, 0x44, 0xD2, 0x44, 0x42, 0x49, 0xB2, 0x49, 0x05, 0x61, 0x82, 0x80, 0x69, 0x35, 0x6D, 0xBF, 0x41, 0x11, 0x06, 0xC6, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0x40, 0xD6, 0x03, 0x45, 0x85, 0x01, 0xB2, 0x40, 0x69, 0x15, 0x13, 0x35, 0x15, 0x00, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0xC5, 0x37, 0x11, 0xC1, 0x19, 0x45, 0xB2, 0x40, 0x41, 0x01, 0x17, 0x03, 0xCF, 0xFF, 0x67, 0x00, 0xE3, 0xCF, 0x41, 0x11, 0x06, 0xC6, 0x26, 0xC2, 0x22, 0xC4, 0xAA, 0x84, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0x00, 0xCD, 0x75, 0x3F, 0x0D, 0xC9, 0x37, 0x07, 0xF5, 0x4F, 0x93, 0x06, 0x07, 0x00, 0x83, 0xD7, 0x46, 0x00, 0x13, 0x04, 0x07, 0x00, 0x85, 0x07, 0xC2, 0x07, 0xC1, 0x83, 0x23, 0x92, 0xF6, 0x00, 0x93, 0x06, 0x00, 0x0C, 0x63, 0x86, 0xD4, 0x00, 0x13, 0x07, 0xE0, 0x03, 0x63, 0x75, 0xF7, 0x00, 0x6D, 0x37, 0x23, 0x12, 0x04, 0x00, 0xB2, 0x40, 0x22, 0x44, 0x92, 0x44, 0x41, 0x01, 0x82, 0x80, 0x41, 0x11, 0x06, 0xC6, 0x13, 0x07, 0x00, 0x0C, 0x63, 0x1A, 0xE5, 0x00, 0x13, 0x05, 0xB0, 0x0D, 0x45, 0x37, 0x13, 0x05, 0xC0, 0x0D, 0xB2, 0x40, 0x41, 0x01, 0x59, 0xBF, 0x13, 0x07, 0xB0, 0x0D, 0xE3, 0x1B, 0xE5, 0xFE, 0x71, 0x37, 0x13, 0x05, 0xD0, 0x0D, 0xF5, 0xB7, 0x41, 0x11, 0x22, 0xC4, 0x26, 0xC2, 0x06, 0xC6, 0x2A, 0x84, 0xB3, 0x04, 0xB5, 0x00, 0x63, 0x17, 0x94, 0x00, 0xB2, 0x40, 0x22, 0x44, 0x92, 0x44, 0x41, 0x01, 0x82, 0x80, 0x03, 0x45, 0x04, 0x00, 0x05, 0x04, 0x4D, 0x3F, 0xED, 0xB7, 0x35, 0x71, 0x26, 0xCB, 0x4E, 0xC7, 0xFD, 0x72, 0x85, 0x69, 0xFD, 0x74, 0x22, 0xCD, 0x4A, 0xC9, 0x52, 0xC5, 0x56, 0xC3, 0x06, 0xCF, 0x93, 0x84, 0x84, 0xFA, 0x16, 0x91, 0x93, 0x87, 0x09, 0x07, 0xA6, 0x97, 0x18, 0x08, 0xB3, 0x84, 0xE7, 0x00, 0x2A, 0x89, 0x26, 0x85, 0x2E, 0x84, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0xE0, 0x19, 0x93, 0x87, 0x09, 0x07, 0x18, 0x08, 0x05, 0x6A, 0xBA, 0x97, 0xB3, 0x8A, 0x47, 0x41, 0x31, 0xE4, 0x05, 0x67, 0x7D, 0x75, 0x93, 0x05, 0x85, 0xFA, 0x93, 0x07, 0x07, 0x07, 0x13, 0x05, 0x85, 0xF9, 0x14, 0x08, 0xAA, 0x97, 0x33, 0x85, 0xD7, 0x00, 0x93, 0x07, 0x07, 0x07, 0xAE, 0x97, 0xB3, 0x85, 0xD7, 0x00, 0x2A, 0xC6, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0xA0, 0x16, 0x32, 0x45, 0xC1, 0x45, 0x95, 0x37, 0x01, 0x45, 0x85, 0x62, 0x16, 0x91, 0xFA, 0x40, 0x6A, 0x44, 0xDA, 0x44, 0x4A, 0x49, 0xBA, 0x49, 0x2A, 0x4A, 0x9A, 0x4A, 0x0D, 0x61, 0x82, 0x80, 0xA2, 0x89, 0x63, 0x73, 0x8A, 0x00, 0x85, 0x69, 0x4E, 0x86, 0xD6, 0x85, 0x4A, 0x85, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0xA0, 0xC9, 0x13, 0x75, 0xF5, 0x0F, 0x01, 0xED, 0x4E, 0x86, 0xD6, 0x85, 0x26, 0x85, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0xE0, 0x11, 0x4E, 0x99, 0x33, 0x04, 0x34, 0x41, 0x51, 0xB7, 0x13, 0x05, 0x30, 0x06, 0x55, 0xBF, 0x13, 0x05, 0x00, 0x0C, 0x49, 0xBD, 0x31, 0x71, 0xFD, 0x72, 0x05, 0x67, 0x4E, 0xD7, 0x52, 0xD5, 0x56, 0xD3, 0x5E, 0xCF, 0x06, 0xDF, 0x22, 0xDD, 0x26, 0xDB, 0x4A, 0xD9, 0x5A, 0xD1, 0x62, 0xCD, 0x66, 0xCB, 0x6A, 0xC9, 0x6E, 0xC7, 0xFD, 0x77, 0x16, 0x91, 0x13, 0x07, 0x07, 0x07, 0x3E, 0x97, 0x1C, 0x08, 0xBA, 0x97, 0x3E, 0xC6, 0x23, 0xAA, 0x07, 0xF8, 0xAA, 0x89, 0x2E, 0x8A, 0xB2, 0x8A, 0xB6, 0x8B, 0x0D, 0x35, 0x93, 0x07, 0x00, 0x02, 0x19, 0xC1, 0xB7, 0x07, 0x02, 0x00, 0x3E, 0x85, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0x80, 0x0A, 0x85, 0x67, 0x63, 0xE5, 0x57, 0x13, 0x05, 0x64, 0x7D, 0x79, 0x13, 0x09, 0x89, 0xFA, 0x93, 0x07, 0x04, 0x07, 0xCA, 0x97, 0x18, 0x08, 0x33, 0x89, 0xE7, 0x00, 0x4A, 0x85, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0x00, 0x09, 0x7D, 0x7B, 0x13, 0x0C, 0x3B, 0xF9, 0x93, 0x0C, 0x8B, 0xF9, 0x13, 0x07, 0x04, 0x07, 0x93, 0x07, 0x04, 0x07, 0x14, 0x08, 0x62, 0x97, 0xE6, 0x97, 0x81, 0x44, 0x33, 0x0C, 0xD7, 0x00, 0xB3, 0x8C, 0xD7, 0x00, 0x52, 0x4D, 0x63, 0x7C, 0x4D, 0x09, 0x63, 0xF1, 0xA4, 0x03, 0x41, 0xA8, 0x99, 0x3F, 0xA2, 0x85, 0x08, 0x01, 0x8D, 0x35, 0xB9, 0x37, 0x22, 0x86, 0x0C, 0x01, 0x4A, 0x85, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0xE0, 0x04, 0xA2, 0x99, 0xA2, 0x94, 0x63, 0xF5, 0x44, 0x03, 0xB3, 0x87, 0xA4, 0x41, 0x63, 0xF1, 0x77, 0x03, 0x33, 0x04, 0x9A, 0x40, 0x63, 0xF3, 0x8A, 0x00, 0x56, 0x84, 0x22, 0x86, 0x0C, 0x01, 0x4E, 0x85, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0xE0, 0xB8, 0x13, 0x75, 0xF5, 0x0F, 0x55, 0xDD, 0x02, 0xCC, 0x01, 0x44, 0x79, 0x5D, 0x8D, 0x4D, 0xA3, 0x09, 0x01, 0x00, 0x62, 0x85, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0xA0, 0xA7, 0x7D, 0xF9, 0x03, 0x45, 0x31, 0x01, 0xE6, 0x85, 0x59, 0x3C, 0x63, 0x4F, 0x05, 0x00, 0xE3, 0xE2, 0x8D, 0xFE, 0x85, 0x67, 0x93, 0x87, 0x07, 0x07, 0xA2, 0x97, 0x18, 0x08, 0xBA, 0x97, 0xDA, 0x97, 0x23, 0x8A, 0xA7, 0xF8, 0x05, 0x04, 0xF1, 0xB7, 0xE3, 0x15, 0xA5, 0xFD, 0x91, 0x47, 0xE3, 0x05, 0xF4, 0xF6, 0x05, 0x67, 0x7D, 0x75, 0x93, 0x07, 0x07, 0x07, 0x93, 0x05, 0x85, 0xFA, 0x13, 0x05, 0x85, 0xF9, 0x14, 0x08, 0xAA, 0x97, 0x33, 0x85, 0xD7, 0x00, 0x93, 0x07, 0x07, 0x07, 0xAE, 0x97, 0xB3, 0x85, 0xD7, 0x00, 0x2A, 0xC6, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0x00, 0xFB, 0x71, 0x3D, 0x32, 0x45, 0xC1, 0x45, 0x65, 0x33, 0x51, 0x3D, 0xDD, 0x39, 0xB7, 0x07, 0x02, 0x00, 0x19, 0xE1, 0x93, 0x07, 0x00, 0x02, 0x3E, 0x85, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0x00, 0xF8, 0x85, 0x62, 0x16, 0x91, 0xFA, 0x50, 0x6A, 0x54, 0xDA, 0x54, 0x4A, 0x59, 0xBA, 0x59, 0x2A, 0x5A, 0x9A, 0x5A, 0x0A, 0x5B, 0xFA, 0x4B, 0x6A, 0x4C, 0xDA, 0x4C, 0x4A, 0x4D, 0xBA, 0x4D, 0x29, 0x61, 0x82, 0x80, 0xB7, 0x57, 0x41, 0x49, 0x19, 0x71, 0x93, 0x87, 0xF7, 0x84, 0x01, 0x45, 0x86, 0xDE, 0xA2, 0xDC, 0xA6, 0xDA, 0xCA, 0xD8, 0xCE, 0xD6, 0xD2, 0xD4, 0xD6, 0xD2, 0xDA, 0xD0, 0xDE, 0xCE, 0xE2, 0xCC, 0xE6, 0xCA, 0xEA, 0xC8, 0xEE, 0xC6, 0x3E, 0xCE, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0xE0, 0xA0, 0x79, 0x31, 0x05, 0xC5, 0x37, 0x47, 0xD8, 0x50, 0xB7, 0x67, 0x11, 0x50, 0x13, 0x07, 0x17, 0xAA, 0x98, 0xCF, 0x23, 0xA0, 0x07, 0x00, 0x23, 0xAC, 0x07, 0x00, 0x98, 0xD3, 0xD8, 0x4F, 0xB7, 0x06, 0x04, 0x00, 0x55, 0x8F, 0xD8, 0xCF, 0x23, 0xA0, 0x07, 0x02, 0xB7, 0x07, 0xF5, 0x4F, 0x37, 0x37, 0xF6, 0x4F, 0x93, 0x87, 0x07, 0x00, 0x13, 0x07, 0xC7, 0xBA, 0x21, 0xA0, 0x23, 0xA0, 0x07, 0x00, 0x91, 0x07, 0xE3, 0xED, 0xE7, 0xFE, 0xD5, 0x33, 0x91, 0x45, 0x68, 0x08, 0xC5, 0x39, 0xF1, 0x3B, 0xB7, 0xB7, 0xF5, 0x4F, 0x93, 0x87, 0xC7, 0xB1, 0x21, 0x67, 0x3E, 0x97, 0x23, 0x20, 0xF7, 0x08, 0xB7, 0x07, 0xF1, 0x4F, 0x37, 0x09, 0xF5, 0x4F, 0x93, 0x87, 0x87, 0x0E, 0x23, 0x20, 0xF9, 0x00, 0xB7, 0x39, 0xF6, 0x4F, 0x29, 0x39, 0x93, 0x89, 0xC9, 0xB1, 0x13, 0x09, 0x09, 0x00, 0x63, 0x05, 0x05, 0x10, 0xB7, 0x67, 0x0D, 0x50, 0x13, 0x07, 0x10, 0x02, 0xB8, 0xCF, 0x85, 0x45, 0x45, 0x45, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0xA0, 0xE6, 0xB7, 0x05, 0xF1, 0x4F, 0x01, 0x46, 0x93, 0x85, 0x05, 0x00, 0x45, 0x45, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0xA0, 0xE7, 0xB7, 0x27, 0x0D, 0x50, 0x11, 0x47, 0x98, 0xCB, 0x37, 0x05, 0x02, 0x00, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0xE0, 0xE6, 0xB7, 0x07, 0x0E, 0x50, 0x88, 0x5F, 0x81, 0x45, 0xB7, 0x84, 0xF5, 0x4F, 0x71, 0x89, 0x61, 0x15, 0x13, 0x35, 0x15, 0x00, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0x60, 0xA5, 0xC1, 0x67, 0xFD, 0x17, 0x13, 0x07, 0x00, 0x10, 0x85, 0x66, 0x41, 0x66, 0xB7, 0x05, 0x00, 0x01, 0x01, 0x45, 0x93, 0x84, 0x04, 0x01, 0xB7, 0x0A, 0xF5, 0x4F, 0x0D, 0x6A, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0x20, 0x9B, 0x13, 0x8B, 0x0A, 0x01, 0x26, 0x9A, 0x83, 0xA7, 0xC9, 0x08, 0xF5, 0xDF, 0x83, 0xAB, 0xC9, 0x08, 0x85, 0x47, 0x23, 0xA6, 0x09, 0x08, 0x23, 0x02, 0xF1, 0x02, 0x83, 0xC7, 0x1B, 0x00, 0x09, 0x47, 0x23, 0x13, 0xE1, 0x02, 0xA3, 0x02, 0xF1, 0x02, 0x02, 0xD4, 0x4D, 0x47, 0x63, 0x81, 0xE7, 0x08, 0x51, 0x47, 0x63, 0x8F, 0xE7, 0x06, 0x29, 0x47, 0x63, 0x9F, 0xE7, 0x00, 0x83, 0xC7, 0x3B, 0x00, 0x03, 0xC7, 0x2B, 0x00, 0xA2, 0x07, 0xD9, 0x8F, 0x11, 0x47, 0x63, 0x96, 0xE7, 0x00, 0x83, 0xA7, 0x8B, 0x00, 0x9C, 0x43, 0x3E, 0xD4, 0xD1, 0x39, 0xA1, 0x45, 0x48, 0x10, 0xC5, 0x36, 0x83, 0xC7, 0x3B, 0x00, 0x03, 0xC7, 0x2B, 0x00, 0xA2, 0x07, 0xD9, 0x8F, 0x11, 0x67, 0x41, 0x07, 0x63, 0x74, 0xF7, 0x04, 0x13, 0x05, 0xB0, 0x0D, 0xA9, 0x36, 0x13, 0x05, 0xC0, 0x0D, 0x91, 0x36, 0x13, 0x05, 0xE0, 0x0E, 0x3D, 0x3E, 0x5D, 0x31, 0x41, 0xB7, 0xB7, 0x05, 0xF1, 0x4F, 0x01, 0x46, 0x93, 0x85, 0x85, 0x03, 0x15, 0x45, 0x97, 0x00, 0xCF, 0xFF, 0xE7, 0x80, 0xA0, 0xD8, 0x37, 0xA7, 0x0C, 0x50, 0x5C, 0x47, 0x13, 0x05, 0x00, 0x02, 0x93, 0xE7, 0x17, 0x10, 0x5C, 0xC7, 0x31, 0xB7, 0xC9, 0x47, 0x23, 0x13, 0xF1, 0x02, 0x4D, 0xB7, 0x03, 0xC7, 0x1B, 0x00, 0xD1, 0x46, 0x63, 0xE7, 0xE6, 0x02, 0x85, 0x46, 0x63, 0xE6, 0xE6, 0x00, 0x01, 0x4C, 0x13, 0x04, 0xF0, 0x0F, 0x85, 0xA8, 0x79, 0x17, 0x13, 0x77, 0xF7, 0x0F, 0xC9, 0x46, 0xE3, 0xE8, 0xE6, 0xFE, 0xB7, 0x36, 0xF6, 0x4F, 0x0A, 0x07, 0x93, 0x86, 0x06, 0xBB, 0x36, 0x97, 0x18, 0x43, 0x02, 0x87, 0x93, 0x06, 0x07, 0x03, 0x93, 0xF6, 0xF6, 0x0F, 0x11, 0x46, 0xE3, 0x69, 0xD6, 0xFC, 0x13, 0x07, 0xF7, 0x02, 0x13, 0x77, 0xF7, 0x0F, 0x8D, 0x46, 0x63, 0xEB, 0xE6, 0x08, 0xB7, 0x36, 0xF6, 0x4F, 0x0A, 0x07, 0x93, 0x86, 0xC6, 0xBF, 0x36, 0x97, 0x18, 0x43, 0x02, 0x87, 0x13, 0x07, 0x40, 0x02, 0x63, 0x97, 0xE7, 0x10, 0x02, 0xD4, 0x1D, 0x44, 0x01, 0x45, 0x71, 0x3C, 0x01, 0x45, 0xE5, 0x34, 0x01, 0x31, 0xFD, 0x3E, 0xA1, 0x45, 0x48, 0x10, 0x7D, 0x14, 0x21, 0x36, 0x75, 0xF4, 0x01, 0x4C, 0x01, 0x44, 0x13, 0x75, 0xF4, 0x0F, 0xC1, 0x3C, 0x13, 0x75, 0xFC, 0x0F, 0xE9, 0x34, 0xCD, 0x36, 0xE3, 0x1E, 0x04, 0xEA, 0x83, 0xC7, 0x1B, 0x00, 0x49, 0x47, 0x63, 0x6B, 0xF7, 0x30, 0x09, 0x47, 0xE3, 0x76, 0xF7, 0xEA, 0xF5, 0x17, 0x93, 0xF7, 0xF7, 0x0F, 0x3D, 0x47, 0xE3, 0x60, 0xF7, 0xEA, 0x37, 0x37, 0xF6, 0x4F, 0x8A, 0x07, 0x13, 0x07, 0xC7, 0xC0, 0xBA, 0x97, 0x9C, 0x43, 0x82, 0x87, 0x05, 0x44, 0x9D, 0xEB, 0x70, 0x10, 0x81, 0x45, 0x01, 0x45, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0xA0, 0x77, 0x1D, 0xE1, 0xD1, 0x45, 0x68, 0x10, 0x6D, 0x34, 0x01, 0x44, 0x31, 0xA8, 0x05, 0x44, 0x81, 0xEF, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0x20, 0x7D, 0x33, 0x34, 0xA0, 0x00, 0x29, 0xA0, 0x21, 0x47, 0x63, 0x85, 0xE7, 0x00, 0x05, 0x44, 0x01, 0x4C, 0x61, 0xB7, 0x03, 0xAC, 0x8B, 0x00, 0x03, 0xA4, 0xCB, 0x00, 0xB3, 0x67, 0x8C, 0x00, 0xD2, 0x07, 0xF5, 0xF7, 0xD1, 0x30, 0x65, 0xF5, 0xC1, 0x6C, 0x22, 0x9C, 0xFD, 0x1C, 0x7D, 0x7D, 0x33, 0x05, 0x8C, 0x40, 0x5D, 0xDC, 0xB3, 0x77, 0x95, 0x01, 0x95, 0xE3, 0xC1, 0x6C, 0x33, 0x05, 0x8C, 0x40, 0x63, 0xE6, 0x8C, 0x02, 0xFD, 0x7C, 0x33, 0x05, 0x8C, 0x40, 0x5D, 0xD0, 0x31, 0x81, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0xC0, 0x79, 0x5D, 0xF9, 0x66, 0x94, 0xF5, 0xB7, 0x31, 0x81, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0xC0, 0x78, 0x5D, 0xF1, 0x6A, 0x94, 0xD1, 0xB7, 0x41, 0x81, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0x00, 0x78, 0x59, 0xF9, 0x33, 0x04, 0x94, 0x41, 0xC1, 0xB7, 0x21, 0x47, 0xE3, 0x8A, 0xE7, 0xF0, 0x01, 0x4C, 0x13, 0x04, 0x00, 0x0C, 0x39, 0xB7, 0x41, 0x47, 0xCD, 0xBF, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x9D, 0xE7, 0xF6, 0x83, 0xA5, 0xCB, 0x00, 0x03, 0xA5, 0x8B, 0x00, 0x39, 0x3C, 0xB9, 0xBF, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x93, 0xE7, 0xF6, 0x03, 0xA7, 0x0B, 0x01, 0x91, 0x67, 0x63, 0xEE, 0xE7, 0x1E, 0x83, 0xA5, 0x4B, 0x01, 0x03, 0xA5, 0x8B, 0x00, 0xEF, 0xF0, 0xBF, 0x87, 0x3D, 0xBF, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x93, 0xE7, 0xF4, 0x83, 0xA7, 0x0B, 0x01, 0x11, 0x67, 0x63, 0x6E, 0xF7, 0x1C, 0x03, 0xA7, 0xCB, 0x00, 0x83, 0xA5, 0x4B, 0x01, 0x03, 0xA5, 0x8B, 0x00, 0x33, 0x84, 0xE7, 0x02, 0xEF, 0xF0, 0x3F, 0x85, 0x23, 0xAC, 0x04, 0x00, 0x23, 0x24, 0x8A, 0xB0, 0x39, 0xB7, 0x03, 0xC7, 0x04, 0x00, 0x63, 0x07, 0x07, 0x14, 0x03, 0xA7, 0x8B, 0x00, 0xC1, 0x17, 0x13, 0x04, 0x00, 0x0C, 0x63, 0x13, 0xF7, 0x00, 0xC0, 0x48, 0x01, 0x47, 0x93, 0x06, 0xF0, 0x0E, 0x63, 0x46, 0xF7, 0x02, 0x83, 0xC7, 0x5B, 0x00, 0x03, 0xC7, 0x4B, 0x00, 0x01, 0x4C, 0xA2, 0x07, 0xD9, 0x8F, 0x03, 0xC7, 0x6B, 0x00, 0x42, 0x07, 0x5D, 0x8F, 0x83, 0xC7, 0x7B, 0x00, 0xE2, 0x07, 0xD9, 0x8F, 0xE3, 0x82, 0xF6, 0xE6, 0x13, 0x04, 0x10, 0x0C, 0xB1, 0xBD, 0x33, 0x86, 0xEB, 0x00, 0x03, 0x46, 0x86, 0x01, 0x05, 0x07, 0xB1, 0x8E, 0xE1, 0xB7, 0x83, 0xC7, 0x04, 0x00, 0xFD, 0xCB, 0xDC, 0x44, 0x63, 0x91, 0x07, 0x16, 0xC0, 0x48, 0x23, 0x80, 0x04, 0x00, 0x45, 0xBD, 0x61, 0x47, 0x63, 0x96, 0xE7, 0x02, 0x83, 0xA7, 0xCB, 0x01, 0x03, 0xA7, 0x8B, 0x01, 0x83, 0xA6, 0x4B, 0x01, 0x03, 0xA6, 0x0B, 0x01, 0x83, 0xA5, 0xCB, 0x00, 0x03, 0xA5, 0x8B, 0x00, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0x80, 0x68, 0x2A, 0x8C, 0x33, 0x34, 0xA0, 0x00, 0x31, 0xB5, 0x01, 0x4C, 0x05, 0x44, 0x19, 0xB5, 0x11, 0x47, 0x05, 0x44, 0xE3, 0x9B, 0xE7, 0xE6, 0xB7, 0x17, 0x0E, 0x50, 0xF4, 0x5F, 0x65, 0x77, 0x7D, 0x17, 0x05, 0x66, 0xF9, 0x8E, 0xD1, 0x8E, 0x03, 0xA5, 0x8B, 0x00, 0x93, 0x85, 0x07, 0x08, 0xF4, 0xDF, 0x94, 0x41, 0xF9, 0x8E, 0xD1, 0x8E, 0x94, 0xC1, 0x93, 0x85, 0x47, 0x08, 0x94, 0x41, 0xF9, 0x8E, 0xD1, 0x8E, 0x94, 0xC1, 0xB4, 0x5F, 0x81, 0x45, 0x75, 0x8F, 0x51, 0x8F, 0xB8, 0xDF, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0x20, 0x6B, 0x11, 0xBD, 0x13, 0xF7, 0xF7, 0x00, 0xE3, 0x11, 0x07, 0xEA, 0x93, 0xDC, 0x47, 0x00, 0x13, 0x84, 0x8B, 0x00, 0x01, 0x4C, 0x7D, 0x5D, 0xE3, 0x71, 0x9C, 0xDB, 0x48, 0x44, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0x20, 0x4E, 0x18, 0x44, 0x54, 0x40, 0x10, 0x40, 0xF9, 0x8E, 0x63, 0x07, 0xA7, 0x01, 0x1C, 0x42, 0x13, 0x47, 0xF7, 0xFF, 0x7D, 0x8F, 0xD9, 0x8E, 0x14, 0xC2, 0x05, 0x0C, 0x41, 0x04, 0xD9, 0xBF, 0x11, 0x47, 0x85, 0xB5, 0x41, 0x47, 0x05, 0x44, 0xE3, 0x94, 0xE7, 0xDE, 0x83, 0xA7, 0x8B, 0x00, 0x03, 0xA7, 0x4B, 0x01, 0x23, 0x26, 0xF9, 0x00, 0x23, 0x24, 0xE9, 0x00, 0x5D, 0xBB, 0x83, 0x25, 0x89, 0x00, 0xC1, 0x17, 0x91, 0xE5, 0x89, 0xCF, 0x01, 0x4C, 0x13, 0x04, 0x60, 0x0C, 0xB1, 0xB3, 0x03, 0x27, 0xC9, 0x00, 0x63, 0x66, 0xF7, 0x06, 0x13, 0xF7, 0x37, 0x00, 0xE3, 0x15, 0x07, 0xE2, 0x03, 0x28, 0xC9, 0x00, 0x01, 0x46, 0x01, 0x47, 0x33, 0x05, 0xE8, 0x40, 0xB3, 0x86, 0xE5, 0x00, 0x63, 0x69, 0xF7, 0x00, 0xE3, 0x01, 0x06, 0xD2, 0x23, 0x26, 0xA9, 0x00, 0x23, 0x24, 0xD9, 0x00, 0x19, 0xBB, 0x33, 0x86, 0xEB, 0x00, 0x10, 0x4E, 0x11, 0x07, 0x90, 0xC2, 0x05, 0x46, 0xE9, 0xBF, 0x21, 0x47, 0x05, 0x44, 0xE3, 0x9E, 0xE7, 0xD6, 0x03, 0x24, 0xC9, 0x00, 0x19, 0xC0, 0x13, 0x04, 0x80, 0x0C, 0x23, 0x26, 0x09, 0x00, 0x23, 0x24, 0x09, 0x00, 0x33, 0x34, 0x80, 0x00, 0x8D, 0xB3, 0x01, 0x4C, 0x13, 0x04, 0x20, 0x0C, 0xD5, 0xB1, 0x01, 0x4C, 0x13, 0x04, 0x80, 0x0C, 0xF1, 0xB9, 0x01, 0x4C, 0x13, 0x04, 0x90, 0x0C, 0xD1, 0xB9, 0x13, 0x07, 0x20, 0x0D, 0x63, 0x83, 0xE7, 0x0C, 0x13, 0x07, 0x40, 0x0D, 0xE3, 0x98, 0xE7, 0xB8, 0x03, 0xC4, 0x3B, 0x00, 0x83, 0xC7, 0x2B, 0x00, 0x22, 0x04, 0x5D, 0x8C, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0x00, 0x4E, 0x03, 0xAC, 0xC4, 0x00, 0x41, 0x14, 0x63, 0x73, 0x84, 0x01, 0x22, 0x8C, 0xE3, 0x06, 0x0C, 0xB6, 0xC0, 0x40, 0x62, 0x94, 0x31, 0x80, 0x9C, 0x48, 0x63, 0x55, 0xF0, 0x00, 0x9C, 0x44, 0x63, 0x5B, 0xF4, 0x0A, 0xEF, 0xF0, 0xEF, 0xD1, 0x75, 0xDD, 0xC8, 0x40, 0x62, 0x86, 0x93, 0x85, 0x8B, 0x01, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0x00, 0x4A, 0x01, 0xC5, 0x93, 0x07, 0x40, 0x0C, 0xDC, 0xC8, 0xDC, 0x40, 0xE2, 0x97, 0xDC, 0xC0, 0xDC, 0x44, 0xB3, 0x87, 0x87, 0x41, 0xDC, 0xC4, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0xE0, 0x48, 0x0D, 0xB6, 0x09, 0x65, 0x13, 0x05, 0x05, 0x71, 0x03, 0xAC, 0xCB, 0x00, 0x03, 0xA4, 0x8B, 0x00, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0xA0, 0x38, 0xB7, 0xA7, 0x0C, 0x50, 0xD8, 0x4B, 0xB7, 0x06, 0x00, 0x01, 0xC1, 0x16, 0x93, 0x57, 0x47, 0x01, 0x12, 0x07, 0x75, 0x8F, 0xBD, 0x8B, 0xD9, 0x8F, 0xB3, 0x87, 0x87, 0x03, 0x01, 0x45, 0xB3, 0xD5, 0x87, 0x02, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0x00, 0x3A, 0x13, 0x05, 0x80, 0x3E, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0x40, 0x35, 0xD1, 0xBC, 0x83, 0xA6, 0x4B, 0x01, 0x03, 0xA6, 0x0B, 0x01, 0x83, 0xA5, 0xCB, 0x00, 0x03, 0xA5, 0x8B, 0x00, 0xEF, 0xF0, 0xCF, 0xFE, 0x7D, 0xBC, 0x83, 0xC5, 0x3B, 0x00, 0x83, 0xC7, 0x2B, 0x00, 0x13, 0x85, 0x8B, 0x01, 0xA2, 0x05, 0xDD, 0x8D, 0xC1, 0x15, 0xEF, 0xF0, 0xCF, 0xDB, 0x5D, 0xB4, 0xEF, 0xF0, 0x2F, 0xCB, 0x3D, 0xBF, 0x03, 0xC4, 0x3B, 0x00, 0x83, 0xC7, 0x2B, 0x00, 0x13, 0x8C, 0x8B, 0x01, 0x22, 0x04, 0x5D, 0x8C, 0xDC, 0x44, 0x41, 0x14, 0xCD, 0xE3, 0x91, 0x47, 0x85, 0x4B, 0x63, 0xFF, 0x87, 0x08, 0x93, 0x07, 0x90, 0x0C, 0xDC, 0xC8, 0xAD, 0xBC, 0x03, 0xA7, 0x0D, 0x00, 0x22, 0xD0, 0x05, 0x48, 0xB3, 0x87, 0xEC, 0x40, 0x3E, 0xD6, 0x83, 0x27, 0x8A, 0xB0, 0x63, 0x73, 0xF4, 0x00, 0x0D, 0x48, 0x42, 0xC6, 0x3A, 0xC4, 0xEF, 0xF0, 0xAF, 0xC6, 0x22, 0x47, 0x32, 0x48, 0x37, 0x85, 0xF5, 0x4F, 0xE2, 0x85, 0x7C, 0x10, 0x93, 0x86, 0x0A, 0x01, 0x10, 0x10, 0x13, 0x05, 0x85, 0x02, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0x60, 0x37, 0x37, 0xB7, 0xF5, 0x4F, 0x93, 0x08, 0x07, 0x01, 0x82, 0x57, 0x03, 0xA7, 0x88, 0xB0, 0x83, 0xA5, 0x0D, 0x00, 0x1D, 0x8C, 0x1D, 0x8F, 0x3E, 0x9C, 0xB2, 0x57, 0x23, 0xA4, 0xE8, 0xB0, 0xAA, 0x8B, 0xBE, 0x95, 0x23, 0xA0, 0xBD, 0x00, 0x93, 0x87, 0x0A, 0x01, 0x9D, 0x8D, 0x01, 0xC5, 0xA1, 0x67, 0x63, 0x97, 0xF5, 0x00, 0x5A, 0x85, 0xEF, 0xF0, 0x6F, 0xD1, 0x23, 0xA0, 0x6D, 0x01, 0x09, 0xC4, 0xDC, 0x44, 0x99, 0xC3, 0xE3, 0x4F, 0x70, 0xF7, 0x63, 0xDF, 0x0B, 0x00, 0x93, 0x07, 0x70, 0x0C, 0xBD, 0xB7, 0x85, 0x4B, 0xB7, 0x3D, 0xF6, 0x4F, 0xB7, 0x8C, 0xF5, 0x4F, 0x93, 0x8D, 0xCD, 0xBA, 0x93, 0x8C, 0x0C, 0x01, 0xE9, 0xBF, 0xE3, 0x9A, 0x0B, 0x9C, 0xDC, 0x44, 0xE3, 0x87, 0x07, 0x9C, 0x93, 0x07, 0x80, 0x0C, 0xA9, 0xB7, 0x83, 0xA7, 0x8B, 0x00, 0xE3, 0x90, 0x07, 0x9C, 0xEF, 0xF0, 0x0F, 0xD6, 0x09, 0x65, 0x13, 0x05, 0x05, 0x71, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0xA0, 0x22, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0xA0, 0x27, 0x4D, 0xB2, 0x03, 0xA4, 0xCB, 0x00, 0xE3, 0x0E, 0x04, 0x98, 0xEF, 0xF0, 0xCF, 0xD3, 0x13, 0x05, 0x80, 0x3E, 0x97, 0xF0, 0xCE, 0xFF, 0xE7, 0x80, 0x80, 0x20, 0x02, 0x94, 0x59, 0xB2, 0xF6, 0x50, 0x66, 0x54, 0xD6, 0x54, 0x46, 0x59, 0xB6, 0x59, 0x26, 0x5A, 0x96, 0x5A, 0x06, 0x5B, 0xF6, 0x4B, 0x66, 0x4C, 0xD6, 0x4C, 0x46, 0x4D, 0xB6, 0x4D, 0x09, 0x61, 0x82, 0x80, 0x00, 0x00
+        0x28, 0xCF, 0x7D, 0x52, 0x6B, 0x54, 0x13, 0x67, 0x1A, 0xFE, 0x26, 0x93, 0xC9, 0x97, 0x60, 0xA2, 0xA4, 0xC3, 0x45, 0xB6, 0xB4, 0x8B, 0xC4, 0xC6, 0x6A, 0xCF, 0xE9, 0x96, 0x22, 0xCE, 0x52, 0x05, 0x13, 0x9D, 0x30, 0xDC, 0x83, 0x1E, 0xAD, 0x07, 0x95, 0x56, 0x9D, 0x15, 0xAA, 0xAD, 0xDD, 0xD2, 0x96, 0xB5, 0x9E, 0x35, 0xE7, 0x04, 0xC2, 0x10, 0xB9, 0x89, 0x38, 0xD0, 0xA0, 0xC5, 0x5D, 0x4A, 0x15, 0x94, 0x75, 0xBB, 0x5C, 0xAA, 0xA3, 0xB4, 0x2C, 0x17, 0x21, 0x01, 0x51, 0x11, 0xAB, 0xA0, 0x16, 0x2A, 0x9A, 0x95, 0x54, 0xBB, 0x2D, 0xB0, 0x25, 0x49, 0x71, 0x8B, 0xEC, 0x8C, 0x49, 0xBA, 0x97, 0x1F, 0xFB, 0x67, 0xE6, 0xFB, 0xDE, 0xF7, 0xF9, 0xDE, 0xF7, 0x79, 0x9F, 0xE7, 0xD5, 0x2A, 0xC3, 0xBB, 0xD5, 0x5D, 0x12, 0x2B, 0xB7, 0x44, 0x91, 0xA6, 0xA4, 0x08, 0xB1, 0x53, 0x7F, 0xB3, 0x9F, 0x5B, 0xAC, 0x48, 0xC3, 0xC5, 0x62, 0x30, 0xA2, 0x29, 0x2F, 0x2E, 0x77, 0x34, 0x6B, 0xC2, 0xC9, 0xC3, 0xA4, 0x16, 0xC9, 0x33, 0x1E, 0xD0, 0x84, 0x6A, 0xF0, 0x1C, 0xE7, 0x82, 0x3C, 0xCB, 0x28, 0x87, 0x28, 0xB9, 0x7A, 0x79, 0x5A, 0xAA, 0xD5, 0x74, 0xCA, 0x0C, 0x12, 0x7B, 0x09, 0x99, 0x53, 0xAF, 0xBE, 0xB8, 0xBE, 0x5B, 0x72, 0x25, 0xFC, 0x12, 0x77, 0x5C, 0x9E, 0x66, 0xD8, 0x8C, 0xCB, 0x64, 0xA0, 0x23, 0x19, 0x7F, 0x7F, 0x7A, 0xB5, 0x62, 0xEC, 0x1F, 0x9A, 0x1D, 0xA4, 0xEA, 0xE4, 0x72, 0x64, 0x4D, 0xC2, 0x35, 0xB2, 0x39, 0x21, 0x3C, 0x11, 0xDB, 0x2E, 0xD4, 0x32, 0x2D, 0x91, 0x01, 0x4F, 0x35, 0x43, 0x80, 0x3D, 0x84, 0x9C, 0xEB, 0x6B, 0xC7, 0x21, 0x90, 0x57, 0x68, 0x1B, 0xCC, 0xF4, 0xC2, 0xFB, 0x80, 0xA1, 0x18, 0xAB, 0xAA, 0x06, 0x03, 0xFB, 0x36, 0xE6, 0x19, 0x31, 0x8A, 0x36, 0x8F, 0x03, 0x59, 0x1C, 0x5D, 0x6A, 0x05, 0x06, 0xFE, 0xBE, 0x06, 0xC3, 0x61, 0xA3, 0x42, 0xCB, 0xD0, 0x95, 0x0E, 0x51, 0x21, 0x55, 0xDD, 0xE9, 0xE4, 0x58, 0x49, 0x87, 0x82, 0x0E, 0xBA, 0x01, 0xAA, 0x3A, 0x71, 0x0C, 0xC8, 0xF3, 0x8C, 0xAC, 0xE4, 0xAA, 0xC2, 0xB0, 0x91, 0xAE, 0x1C, 0x7E, 0x12, 0x69, 0x54, 0xE4, 0x19, 0xB9, 0x28, 0x97, 0x5E, 0xAB, 0x64, 0x19, 0x5D, 0xAB, 0xC4, 0xBA, 0x7D, 0x35, 0xAD, 0xC3, 0x24, 0x1C, 0xE1, 0xD2, 0xB3, 0x66, 0x5B, 0x13, 0x5A, 0x0F, 0xA5, 0xE8, 0x10, 0x25, 0x15, 0xB8, 0xB0, 0x92, 0x20, 0xD0, 0x25, 0xE9, 0xCC, 0x53, 0x1D, 0x1E, 0x96, 0xBE, 0x6C, 0x51, 0x81, 0x7A, 0x80, 0x0E, 0x53, 0xD2, 0xF2, 0x2C, 0xD6, 0x0C, 0xC5, 0xF4, 0xB3, 0x6E, 0x11, 0xC1, 0x39, 0xF5, 0x38, 0xB4, 0x35, 0x7D, 0x9C, 0xD5, 0x6A, 0x41, 0xEB, 0xA0, 0x94, 0x73, 0x39, 0xF5, 0xBE, 0x3A, 0x6C, 0x81, 0xF5, 0x0C, 0xFD, 0xCB, 0x71, 0xA0, 0xAA, 0xB3, 0x49, 0x55, 0x35, 0xC3, 0x52, 0xD5, 0x61, 0x28, 0x5D, 0x54, 0x33, 0xB3, 0xC9, 0x2E, 0x71, 0xFE, 0xD4, 0xAC, 0x11, 0xF4, 0x53, 0xD5, 0xF1, 0xD1, 0x1A, 0x87, 0x74, 0x94, 0x23, 0x86, 0xA5, 0x69, 0xFB, 0x93, 0x8E, 0x15, 0x3B, 0xE7, 0x08, 0x9B, 0xEF, 0x94, 0x67, 0xD4, 0x2A, 0x25, 0xD6, 0x51, 0x82, 0xE3, 0x73, 0xAA, 0x3A, 0x28, 0x22, 0x20, 0x90, 0x56, 0x5D, 0xA8, 0x5A, 0x6B, 0x98, 0xEB, 0xDD, 0xD4, 0xAC, 0xC1, 0x75, 0xCE, 0x39, 0xAC, 0x50, 0xA8, 0x22, 0xA0, 0x6E, 0xAD, 0x36, 0x8C, 0xF2, 0x79, 0x8D, 0x80, 0xAD, 0xBA, 0x20, 0x54, 0x0B, 0x5D, 0x3B, 0x3B, 0xE7, 0xE9, 0xA2, 0xE5, 0x1D, 0x25, 0xF2, 0x9D, 0x7A, 0x16, 0x8A, 0x91, 0xC4, 0x0E, 0xF4, 0x14, 0x44, 0x24, 0x56, 0x75, 0x17, 0xED, 0x27, 0x13, 0xEB, 0x88, 0xE8, 0x9E, 0x36, 0x8A, 0x77, 0x16, 0xC9, 0x25, 0xE9, 0xA1, 0x25, 0x88, 0x98, 0x6C, 0x3B, 0xC0, 0x7E, 0x16, 0x00, 0x0C, 0x04, 0xB3, 0x3A, 0x94, 0x24, 0x24, 0x46, 0x80, 0x5B, 0x6C, 0xE0, 0xC8, 0x18, 0x21, 0x01, 0x08, 0xE7, 0x9A, 0x03, 0x39, 0x65, 0xDC, 0x90, 0x34, 0xED, 0x66, 0xD7, 0xA1, 0xAE, 0xAA, 0x35, 0x86, 0x39, 0x2D, 0x55, 0x3E, 0x86, 0x51, 0x91, 0xB2, 0x07, 0x9A, 0x56, 0x8B, 0xEA, 0xF9, 0xC5, 0x48, 0x68, 0xB7, 0x67, 0x33, 0x44, 0x09, 0x42, 0x57, 0x44, 0x29, 0x78, 0xFF, 0x1C, 0x41, 0x88, 0xA7, 0xF5, 0x6F, 0x01, 0x1C, 0xEB, 0x7E, 0x6C, 0x01, 0x03, 0x73, 0x0E, 0x63, 0xD8, 0x0F, 0x0D, 0x66, 0x4C, 0x57, 0xE9, 0x68, 0xA6, 0x58, 0x37, 0x0C, 0x8B, 0xB5, 0x16, 0x12, 0x4F, 0xD8, 0x52, 0x9C, 0x44, 0xF3, 0x04, 0x75, 0xA3, 0x2C, 0xD4, 0xD6, 0xAC, 0xF3, 0x60, 0x6B, 0x26, 0x23, 0xA3, 0x6A, 0x80, 0xB0, 0x2D, 0xC2, 0x86, 0x68, 0x95, 0x9C, 0xD9, 0xA9, 0x97, 0x58, 0x79, 0xED, 0x11, 0x8C, 0x52, 0x19, 0x1D, 0x00, 0x1F, 0xEE, 0x01, 0x55, 0x36, 0x2C, 0xCB, 0x10, 0x7C, 0xE9, 0x42, 0xAF, 0x6D, 0xA6, 0xF4, 0x95, 0xCA, 0x86, 0xCA, 0xA6, 0xDC, 0x92, 0x7E, 0x55, 0x03, 0x04, 0x5A, 0x22, 0x84, 0x77, 0x3A, 0x4D, 0xEE, 0xD1, 0x00, 0x51, 0x86, 0x5F, 0xF2, 0x69, 0xA0, 0xBE, 0xD8, 0x4D, 0xA5, 0x5A, 0x25, 0x57, 0x12, 0x7B, 0x1B, 0x0A, 0x85, 0xD9, 0xE9, 0x1F, 0x2A, 0xC1, 0xA7, 0xF9, 0xA7, 0x3A, 0xD0, 0xA5, 0x24, 0x50, 0x1F, 0xC1, 0xD3, 0xFB, 0x40, 0x68, 0x3C, 0xBD, 0x71, 0x12, 0x84, 0x92, 0xF4, 0x6B, 0x33, 0xA2, 0x33, 0x31, 0x86, 0xD1, 0x78, 0x8D, 0xBA, 0xE0, 0x0A, 0xE3, 0xE5, 0x64, 0x17, 0xF6, 0x02, 0xE9, 0x61, 0xA1, 0x46, 0xBE, 0xB5, 0x77, 0xAB, 0xA6, 0xCE, 0xB2, 0xB5, 0x63, 0x2B, 0xC9, 0x94, 0x6D, 0xED, 0x16, 0x78, 0x5E, 0x23, 0xD7, 0x24, 0x34, 0x27, 0x08, 0x6C, 0x77, 0x45, 0xED, 0x69, 0x17, 0x9C, 0xF1, 0xBC, 0xD2, 0x0C, 0xA1, 0x3A, 0x06, 0x69, 0xD6, 0xEC, 0x0A, 0xC4, 0xA3, 0x02, 0x81, 0xCF, 0xB5, 0x1E, 0x42, 0xD9, 0x19, 0xA2, 0x13, 0x18, 0x06, 0xA3, 0x03, 0x73, 0x59, 0xC0, 0x3E, 0x20, 0x44, 0xD5, 0x5D, 0xE1, 0xDD, 0x0D, 0xF9, 0x9E, 0x77, 0xE0, 0x72, 0xCE, 0x6A, 0x45, 0x1F, 0x01, 0x79, 0xE6, 0x12, 0x08, 0x4C, 0xC3, 0x71, 0x00, 0x17, 0x43, 0xC0, 0xC0, 0x2E, 0xD8, 0x69, 0x52, 0x1D, 0x76, 0x01, 0x56, 0x02, 0xE4, 0x74, 0xC1, 0x75, 0x80, 0xC3, 0x31, 0x94, 0xCE, 0x71, 0x83, 0x3D, 0x84, 0xEA, 0x29, 0x31, 0xF0, 0xF8, 0xE0, 0xEB, 0x82, 0x43, 0x1E, 0xF3, 0x8B, 0xFB, 0x40, 0xD8, 0x7B, 0x1D, 0x81, 0x63, 0x1D, 0x0A, 0xA1, 0x63, 0x7A, 0x3B, 0x0E, 0x1B, 0x15, 0xF6, 0xA7, 0xEF, 0x3F, 0xCE, 0xE6, 0x63, 0x57, 0x15, 0x4E, 0x4E, 0xD8, 0x13, 0x75, 0x97, 0xC4, 0xBA, 0x2C, 0xBF, 0x45, 0x7C, 0x06, 0xD0, 0xC1, 0x15, 0xFF, 0x51, 0x07, 0xD5, 0x89, 0x01, 0x26, 0x4E, 0x59, 0xFD, 0x1D, 0x17, 0x95, 0xAD, 0xEE, 0x4F, 0xB5, 0xCD, 0xBE, 0xCB, 0xEC, 0x9A, 0x7D, 0x3F, 0xFC, 0x72, 0x62, 0xDF, 0xFA, 0x9E, 0x57, 0x2F, 0x48, 0x06, 0xD8, 0xFC, 0xFC, 0x47, 0x41, 0xE5, 0xAC, 0x59, 0x06, 0xEB, 0x2C, 0x0B, 0xA5, 0x2D, 0xF9, 0x0E, 0xB0, 0xAC, 0x50, 0xCD, 0xBC, 0xE8, 0x9D, 0x62, 0x2C, 0x44, 0xC8, 0x2C, 0x94, 0x62, 0xBB, 0x5B, 0x2D, 0x2D, 0x45, 0x94, 0x36, 0xE2, 0x6F, 0xBC, 0x67, 0x39, 0x2C, 0xC6, 0x3C, 0x62, 0x21, 0x84, 0x38, 0xC6, 0xCC, 0x04, 0x48, 0x1B, 0x2C, 0x91, 0xCC, 0x30, 0x10, 0xEE, 0x9F, 0x5A, 0x5A, 0xF8, 0xD3, 0x32, 0xAF, 0x72, 0x35, 0x41, 0x2F, 0xEB, 0x3A, 0x75, 0x95, 0x04, 0xA2, 0x63, 0x76, 0x04, 0x95, 0x3F, 0xD2, 0xEC, 0x26, 0x6F, 0x93, 0x89, 0x09, 0xAD, 0x09, 0xCB, 0x12, 0x8F, 0x26, 0x2A, 0x78, 0x9D, 0x6B, 0x0B, 0xE9, 0xF7, 0x8A, 0x00, 0xB3, 0x2B, 0xB5, 0x60, 0x88, 0x49, 0xF4, 0x79, 0xD4, 0xF7, 0xC4, 0xA3, 0xEF, 0x84, 0x98, 0xDA, 0x1B, 0x1B, 0x53, 0xA6, 0x1E, 0x89, 0x14, 0x2F, 0xD7, 0xAE, 0xE3, 0x70, 0xEC, 0x25, 0xC9, 0xC6, 0x76, 0x1C, 0x03, 0xF2, 0x84, 0xB6, 0x88, 0xEC, 0xD9, 0x77, 0xB1, 0xAC, 0xD4, 0xE1, 0xF5, 0x37, 0x5E, 0xFD, 0xF2, 0xB5, 0x01, 0xC9, 0x9D, 0xF0, 0x51, 0xF5, 0x57, 0x89, 0xB7, 0x36, 0x0F, 0xEE, 0xB8, 0x9C, 0xD9, 0xBF, 0xBB, 0xEF, 0x6D, 0xDB, 0xEC, 0xDE, 0xA0, 0x72, 0x9C, 0xE7, 0x14, 0x6B, 0x09, 0x95, 0xB6, 0x5A, 0x62, 0xAD, 0xFC, 0x66, 0xFD, 0xD8, 0x50, 0xF8, 0x62, 0x51, 0x73, 0xD1, 0xD9, 0x62, 0x45, 0x14, 0x0B, 0x81, 0x28, 0xA4, 0x93, 0x83, 0x22, 0x10, 0xEB, 0xED, 0x62, 0xF4, 0x63, 0xB2, 0xE8, 0xFB, 0x9B, 0x70, 0xEC, 0x37, 0x86, 0x7D, 0xB8, 0xAC, 0x90, 0x9F, 0x4F, 0x0C, 0x2F, 0xF2, 0x8A, 0x44, 0x16, 0x3A, 0x80, 0x8F, 0x1D, 0x90, 0x19, 0x7E, 0x8F, 0xCB, 0x57, 0xCE, 0xB0, 0xF2, 0xE2, 0x19, 0x9C, 0xCF, 0x0B, 0x98, 0x00, 0xE9, 0x0E, 0xCB, 0xB8, 0x25, 0x97, 0x8C, 0x94, 0x0F, 0x83, 0x96, 0x92, 0x61, 0xB0, 0x3E, 0x85, 0xDE, 0x9F, 0x22, 0xA3, 0xA7, 0x8E, 0xA3, 0xDA, 0x93, 0x47, 0x56, 0xD7, 0x32, 0x52, 0xA4, 0x34, 0xEA, 0x3C, 0x11, 0x5E, 0x20, 0x47, 0x7C, 0x55, 0xC6, 0xC4, 0xB5, 0x47, 0x6A, 0x2B, 0x68, 0x27, 0x89, 0xB6, 0x98, 0x8F, 0x6B, 0xE9, 0xA9, 0xBD, 0x68, 0xA4, 0xF8, 0xA8, 0x86, 0xFE, 0xA1, 0x08, 0xBC, 0x9A, 0x2F, 0xE0, 0x52, 0x7D, 0xB8, 0x73, 0x82, 0x16, 0x1B, 0x47, 0x45, 0x97, 0x10, 0x72, 0x5F, 0x46, 0x69, 0xCA, 0x27, 0x32, 0x04, 0xEC, 0xF0, 0xE9, 0x54, 0x6F, 0x98, 0x41, 0x75, 0x11, 0xC8, 0x38, 0x93, 0xBE, 0x8A, 0xD6, 0x63, 0xC0, 0x7E, 0xAF, 0xF4, 0x31, 0x93, 0xC5, 0x9A, 0x21, 0xAC, 0xE5, 0x39, 0xB7, 0x5A, 0x6E, 0x5B, 0x54, 0x45, 0xF5, 0x3F, 0x62, 0xE2, 0x29, 0xCE, 0x1E, 0x78, 0x62, 0xB6, 0x9C, 0xB2, 0x63, 0xD3, 0xAE, 0x27, 0xCE, 0xF1, 0x8A, 0x08, 0xEE, 0xFD, 0x7F, 0xE7, 0xC0, 0x3F, 0xB3, 0x63, 0x04, 0xEF, 0x76, 0x46, 0xAE, 0x8B, 0x19, 0x8D, 0x16, 0x54, 0x0A, 0xB9, 0x2B, 0x28, 0xE6, 0xD3, 0x0A, 0xFC, 0xF8, 0xC4, 0xD1, 0xB4, 0xDD, 0x1B, 0x6E, 0x6F, 0x48, 0x4C, 0x6F, 0x4D, 0x5F, 0xB6, 0xF9, 0xE8, 0x66, 0xBF, 0x2D, 0x8F, 0x92, 0x76, 0x27, 0xDF, 0x4E, 0x4E, 0x4C, 0x69, 0x4D, 0x59, 0xCA, 0xBB, 0xCB, 0x6D, 0xD2, 0x26, 0x84, 0x64, 0xB3, 0x66, 0x77, 0x3E, 0xA2, 0x2B, 0xF8, 0xBA, 0x76, 0xA4, 0xEE, 0xF6, 0xC5, 0x9B, 0x57, 0x86, 0xAE, 0x5D, 0x1F, 0xBA, 0x76, 0xFB, 0xEA, 0xD7, 0x57, 0xEE, 0x5D, 0x1A, 0xBF, 0xF8, 0xB0, 0xF7, 0x7B, 0x6B, 0xEC, 0x15, 0xEF, 0xAC, 0x35, 0xFB, 0x22, 0xB0, 0x1E, 0x82, 0xBA, 0x99, 0xC6, 0x65, 0x29, 0xD3, 0x70, 0x18, 0xDC, 0x50, 0x35, 0xA0, 0xAA, 0x81, 0x40, 0x75, 0x1A, 0x82, 0xAA, 0x2F, 0x6F, 0xEA, 0x39, 0x89, 0x18, 0x6C, 0x2C, 0xBB, 0x29, 0xC4, 0x44, 0x1C, 0x74, 0xEA, 0x09, 0xC2, 0xA5, 0xE7, 0xA7, 0x05, 0x38, 0xB4, 0xB5, 0x2E, 0xAA, 0x11, 0x90, 0xE5, 0xD0, 0xFE, 0x9D, 0xE3, 0xF1, 0x8D, 0xC8, 0x72, 0xDD, 0x1B, 0xD2, 0x9E, 0xE8, 0xA9, 0x95, 0x1C, 0xE7, 0xE4, 0x11, 0xB6, 0xA6, 0x45, 0x59, 0xB1, 0x16, 0x55, 0x98, 0x5B, 0xCA, 0xC1, 0x29, 0x3D, 0x21, 0x13, 0x62, 0xE6, 0xF9, 0xAA, 0xB0, 0x19, 0xC0, 0x45, 0xBB, 0xF4, 0x4B, 0xA3, 0xD9, 0xC2, 0xBE, 0x26, 0x5C, 0x26, 0x03, 0x34, 0x86, 0xF9, 0x73, 0x59, 0x0A, 0xBE, 0xB3, 0xBF, 0xE8, 0xDC, 0x00, 0xA3, 0xD3, 0xE9, 0xBC, 0x3A, 0x8F, 0x73, 0xD8, 0x94, 0x1E, 0x89, 0x63, 0x19, 0x0C, 0xFC, 0x1C, 0x73, 0x70, 0x4B, 0x14, 0x69, 0x4A, 0xAA, 0xAA, 0x9F, 0xC0, 0x44, 0xC0, 0xCB, 0x7F, 0x9C, 0x83, 0xF3, 0xD3, 0x0E, 0xBC, 0x9E, 0xAB, 0xE3, 0xF2, 0x9D, 0xFA, 0xEC, 0xC2, 0xED, 0x81, 0x78, 0x54, 0xA0, 0x37, 0xB7, 0xED, 0x44, 0x67, 0xD6, 0x6C, 0x30, 0x0E, 0x81, 0x3F, 0x93, 0xA9, 0xCD, 0xE4, 0x30, 0x80, 0x20, 0x3A, 0x36, 0x5F, 0x8C, 0x70, 0x7E, 0x4E, 0xBD, 0x62, 0xB7, 0x07, 0x13, 0xF6, 0x11, 0x5E, 0xEC, 0x87, 0xA8, 0x8F, 0x9A, 0xEA, 0xFB, 0xA4, 0xCE, 0x3B, 0xA6, 0x3F, 0xF5, 0x49, 0x19, 0x4A, 0x55, 0x27, 0x93, 0xAA, 0x44, 0x53, 0x22, 0x93, 0xED, 0x69, 0x20, 0xA3, 0x54, 0xF8, 0x5D, 0xD1, 0x27, 0xFC, 0x4D, 0x74, 0x3D, 0x85, 0xA2, 0x73, 0x1D, 0xD2, 0x75, 0x14, 0x5D, 0xE6, 0x90, 0x2C, 0xA5, 0xE8, 0x3F, 0x3A, 0x80, 0xC9, 0xB6, 0x12, 0xA0, 0xB6, 0x17, 0x40, 0x2D, 0xBC, 0x55, 0xA6, 0xA4, 0xE8, 0x0F, 0xF9, 0x48, 0x7D, 0x31, 0xA8, 0x5E, 0x1B, 0x7B, 0x7D, 0x30, 0xFA, 0x63, 0x5D, 0xBC, 0x7F, 0xCF, 0x8A, 0xFF, 0x42, 0x64, 0x69, 0x21, 0xFD, 0xBE, 0x5B, 0x8C, 0x63, 0x8D, 0x8A, 0x53, 0x2B, 0x70, 0xAC, 0x43, 0x51, 0xCE, 0x7F, 0xC7, 0xE6, 0xC7, 0xC4, 0x66, 0x44, 0x68, 0x39, 0xDF, 0xBC, 0x0C, 0x1A, 0xE8, 0x9B, 0xF7, 0x26, 0x51, 0x2F, 0x4F, 0xDB, 0x4A, 0xE1, 0x18, 0x10, 0xB1, 0x8E, 0x60, 0xFF, 0xAD, 0xB6, 0x08, 0xAE, 0x8F, 0xE7, 0x33, 0x25, 0x4A, 0xE1, 0x50, 0x9E, 0xDB, 0x60, 0x1C, 0xED, 0x18, 0x17, 0x31, 0x71, 0xF4, 0xF8, 0x38, 0x40, 0x92, 0x71, 0xF1, 0xE4, 0x02, 0xE6, 0xE4, 0xBE, 0x60, 0x7C, 0xAF, 0x7B, 0x41, 0x5F, 0x9C, 0xFD, 0x9B, 0xF1, 0xC7, 0xDC, 0x0A, 0x97, 0xDE, 0x0F, 0xB2, 0x05, 0x92, 0xCF, 0x57, 0x58, 0x16, 0xAE, 0x15, 0x99, 0x59, 0x09, 0x44, 0x59, 0x97, 0x6B, 0x81, 0x32, 0xCE, 0xBE, 0x6B, 0xE8, 0x27, 0x1C, 0xBA, 0x45, 0x02, 0xB6, 0x34, 0x8E, 0xFE, 0x76, 0x5C, 0xEA, 0xC3, 0x5A, 0xDB, 0x3D, 0x58, 0x1C, 0x6A, 0x44, 0xB4, 0xC5, 0xE1, 0x2F, 0xBA, 0xFE, 0x0C, 0x89, 0xE8, 0xB2, 0x57, 0x21, 0xBA, 0xFB, 0xCB, 0x91, 0x88, 0xD9, 0x58, 0x61, 0x2A, 0x43, 0xC0, 0xA2, 0x15, 0x39, 0xD3, 0x48, 0x32, 0x42, 0xE2, 0x39, 0xD3, 0x0B, 0x3A, 0x57, 0xE1, 0x39, 0x3F, 0x2D, 0x78, 0xB0, 0xFC, 0xF2, 0x0A, 0xFB, 0xB3, 0xE2, 0x87, 0x82, 0x66, 0x09, 0x14, 0xFD, 0xA6, 0xFB, 0x25, 0x19, 0x65, 0xFF, 0x9D, 0xFB, 0xA1, 0x33, 0x98, 0x75, 0xBB, 0x17, 0xC4, 0x50, 0xF6, 0x6D, 0xEE, 0x87, 0xC2, 0xEE, 0x14, 0x41, 0x7E, 0x73, 0x3A, 0x5A, 0x2D, 0xD5, 0x6B, 0xF3, 0xCC, 0x18, 0x79, 0xEC, 0xDB, 0x77, 0xFC, 0x73, 0x75, 0x88, 0xCE, 0x32, 0x79, 0x45, 0x98, 0x77, 0xEF, 0x33, 0x77, 0x07, 0x75, 0x6F, 0xF8, 0xEF, 0x59, 0x8E, 0x90, 0x11, 0x27, 0x31, 0x32, 0x77, 0xC2, 0x13, 0x0F, 0x33, 0x44, 0x2E, 0xAF, 0x01, 0x4B, 0x6B, 0x16, 0x51, 0x34, 0xE3, 0x00, 0x18, 0x89, 0x24, 0x6F, 0xE7, 0xD0, 0xD3, 0xC5, 0x00, 0x3D, 0xDE, 0x0F, 0x5A, 0xB2, 0x4A, 0xC0, 0x35, 0xE8, 0x74, 0x0F, 0xBE, 0xB4, 0xD3, 0xD9, 0xF9, 0x56, 0x78, 0xF5, 0x6C, 0xA8, 0xC1, 0x10, 0x89, 0x95, 0x68, 0x32, 0x46, 0x5A, 0xF6, 0x56, 0x22, 0x95, 0xF6, 0xCE, 0xB7, 0x84, 0x1B, 0x3D, 0x5E, 0x22, 0x9A, 0xDD, 0xFF, 0x24, 0x7E, 0x35, 0x22, 0xD7, 0x53, 0xB5, 0x63, 0x5F, 0xC6, 0x4C, 0x66, 0x85, 0x93, 0xFB, 0xF9, 0xFE, 0x41, 0xC6, 0xD4, 0xEE, 0x8A, 0x41, 0x4E, 0xEB, 0xBD, 0x83, 0x0F, 0xD2, 0x67, 0x22, 0xC5, 0x15, 0xDA, 0x4E, 0x6E, 0x11, 0x65, 0x2F, 0x72, 0x4C, 0x0A, 0x0A, 0x03, 0x79, 0x34, 0xA7, 0xA5, 0x2E, 0xB7, 0x6B, 0x29, 0x8C, 0xB4, 0x1F, 0x73, 0xB8, 0x4C, 0x27, 0xFA, 0x01, 0x7A, 0xA2, 0x18, 0x44, 0xAF, 0x3A, 0xEF, 0x89, 0xB1, 0x0E, 0x17, 0x5A, 0x3F, 0x0F, 0x29, 0xCF, 0xA2, 0xBF, 0x77, 0x3C, 0x6B, 0x3A, 0x91, 0x84, 0x08, 0xD9, 0x89, 0xC9, 0x76, 0x73, 0x8C, 0x2F, 0x3F, 0x6D, 0xE2, 0xF3, 0xCA, 0x2C, 0xFA, 0x6D, 0x77, 0x28, 0x5A, 0xDF, 0x0F, 0x7C, 0x98, 0xC8, 0x7C, 0x87, 0x68, 0x62, 0x72, 0x35, 0xA3, 0x3A, 0x2D, 0x06, 0xAA, 0xC5, 0x45, 0x8D, 0xD1, 0xBC, 0xC3, 0x62, 0x40, 0x43, 0x18, 0x80, 0xF2, 0x1B, 0xD5, 0x19, 0x2C, 0xF4, 0xA6, 0x71, 0x37, 0xE8, 0x88, 0x47, 0x28, 0x56, 0x32, 0x39, 0x9F, 0x8E, 0x73, 0xF3, 0xFB, 0xB9, 0x85, 0xDF, 0xAD, 0x24, 0xDE, 0x7B, 0x61, 0xBB, 0x50, 0xDB, 0x9B, 0x60, 0x0D, 0xCC, 0x28, 0x33, 0xD9, 0x7E, 0x0F, 0xEE, 0xF1, 0x77, 0x7B, 0x9E, 0x6B, 0x1C, 0x17, 0xFB, 0xCB, 0x9B, 0xDA, 0x22, 0x0B, 0xBE, 0x05, 0x68, 0x5C, 0x01, 0x82, 0xC1, 0xA6, 0x83, 0x77, 0x39, 0x13, 0x5F, 0x77, 0xB6, 0x7F, 0x84, 0xA4, 0xCB, 0x61, 0x50, 0x47, 0xBC, 0xCA, 0x28, 0x06, 0xBA, 0xB6, 0xED, 0xC2, 0xEE, 0x8A, 0x4C, 0xF5, 0xFD, 0x08, 0xDF, 0x0D, 0x31, 0xD5, 0xF1, 0x9C, 0xEA, 0xE6, 0x21, 0xBE, 0xE9, 0x3C, 0x7A, 0x18, 0xDF, 0x58, 0x56, 0x22, 0xF8, 0x10, 0x71, 0x06, 0x49, 0xC6, 0xC8, 0x90, 0x33, 0x4A, 0x61, 0x9E, 0x8F, 0x1C, 0xE3, 0x5C, 0xF0, 0xFC, 0xB4, 0xE9, 0xD7, 0x77, 0xEE, 0x35, 0x04, 0x63, 0x99, 0x33, 0x07, 0x07, 0x0F, 0x0A, 0x2F, 0x58, 0x06, 0x4A, 0xA7, 0xEF, 0x54, 0x68, 0x85, 0x7B, 0x45, 0x27, 0xCB, 0x50, 0x52, 0xDF, 0xF9, 0xB3, 0xD7, 0x73, 0x75, 0x39, 0x65, 0xEB, 0xCA, 0xCE, 0xDD, 0xF1, 0x7A, 0xFB, 0xA6, 0xB2, 0x0D, 0x77, 0xBB, 0x81, 0x5D, 0x09, 0x1F, 0xB2, 0x23, 0x14, 0xC0, 0xF3, 0x8B, 0xF9, 0x79, 0x0C, 0x19, 0xF6, 0xEC, 0xEA, 0xAF, 0xE2, 0x49, 0x2F, 0x26, 0x75, 0x21, 0xB9, 0x41, 0xE3, 0xAF, 0x99, 0x39, 0x48, 0xC3, 0x7A, 0x24, 0x74, 0x0D, 0x4E, 0xB9, 0xE7, 0x0C, 0x65, 0xB7, 0x0E, 0x06, 0x74, 0x61, 0x72, 0xAD, 0xF8, 0x56, 0xBB, 0x92, 0x62, 0xCE, 0x3C, 0x51, 0xB7, 0xC2, 0xF1, 0xB5, 0x89, 0x57, 0x0B, 0xAD, 0x4F, 0x42, 0x54, 0xEA, 0x19, 0x5E, 0xC7, 0x07, 0x20, 0xE3, 0x73, 0xD3, 0x73, 0x85, 0xBC, 0x7E, 0xE5, 0xF7, 0x0B, 0x07, 0x04, 0x07, 0xB7, 0xC9, 0x9B, 0x5A, 0xD0, 0x25, 0x7D, 0x80, 0xCE, 0x74, 0x4B, 0x70, 0x37, 0x01, 0xEC, 0x81, 0xF0, 0x1E, 0xFA, 0x7C, 0x1F, 0x40, 0xE2, 0x10, 0x2A, 0x12, 0xFB, 0x46, 0xD3, 0x52, 0x70, 0x1F, 0xD0, 0xBB, 0x78, 0x3E, 0x88, 0xE4, 0x9A, 0x4A, 0x7D, 0x8A, 0xAF, 0x71, 0x0B, 0x84, 0x7C, 0x2E, 0x28, 0xE8, 0x9F, 0xAA, 0x84, 0x87, 0xBA, 0xB0, 0xB8, 0x07, 0xED, 0x8B, 0x84, 0x5E, 0x7F, 0x70, 0x0C, 0xA1, 0x8B, 0xFB, 0x40, 0x48, 0x07, 0x2E, 0x36, 0xCA, 0x55, 0x6A, 0x19, 0x8F, 0x94, 0x81, 0xC8, 0xE5, 0x46, 0x50, 0xDA, 0x22, 0xF4, 0x09, 0x93, 0xDF, 0x68, 0x12, 0xFE, 0x46, 0xF9, 0xD4, 0x79, 0xE1, 0x7F, 0x48, 0x3E, 0x78, 0x1E, 0x87, 0x61, 0x0A, 0xDA, 0xE4, 0x90, 0xE3, 0x50, 0xA3, 0xB0, 0x57, 0x39, 0xCE, 0xA1, 0xDD, 0x2B, 0x81, 0xC9, 0xF6, 0x02, 0x08, 0x17, 0x67, 0x94, 0x78, 0x77, 0x2E, 0x15, 0x3D, 0xDD, 0x0D, 0xB4, 0x01, 0xF4, 0x7B, 0xF9, 0x48, 0x78, 0x89, 0x5D, 0x22, 0x3F, 0xDB, 0xA1, 0xD9, 0x51, 0x11, 0x61, 0xAC, 0x8E, 0xA7, 0x37, 0x4E, 0x82, 0x6A, 0x92, 0xDE, 0x32, 0xED, 0x37, 0x31, 0x39, 0x31, 0x98, 0x33, 0xDA, 0xAB, 0xD9, 0x51, 0xC0, 0x32, 0xC5, 0x88, 0xF7, 0x5D, 0x22, 0xD2, 0xC3, 0x42, 0x8D, 0x7C, 0xA4, 0x77, 0x44, 0x73, 0xCF, 0x32, 0xD2, 0x31, 0x42, 0xB6, 0x98, 0xCD, 0xDA, 0x91, 0x6E, 0x4F, 0x76, 0x2C, 0x5E, 0x71, 0x56, 0xB6, 0x13, 0xC7, 0xB0, 0x6C, 0xF4, 0x34, 0xEF, 0xE8, 0x71, 0x9F, 0xA3, 0x35, 0xBF, 0xE6, 0xEA, 0xE5, 0x69, 0x37, 0x93, 0x38, 0x09, 0x40, 0x3A, 0x83, 0xD8, 0x4D, 0x14, 0xF2, 0x14, 0xCC, 0x29, 0x6B, 0x2B, 0xBE, 0x55, 0xC6, 0xBF, 0x46, 0x11, 0x5D, 0xCB, 0x0D, 0xB3, 0xC8, 0x5B, 0xFF, 0x15, 0x1C, 0x33, 0xC6, 0x7A, 0xCE, 0x9A, 0xA8, 0xC1, 0x2F, 0xFE, 0x77, 0x43, 0x26, 0x26, 0x07, 0x1E, 0x1B, 0xBE, 0x30, 0xF5, 0x78, 0xE6, 0xC1, 0x79, 0x5E, 0xB5, 0xD8, 0x68, 0x69, 0x67, 0x20, 0x1F, 0xFF, 0x2A, 0xE3, 0xB3, 0x89, 0xC9, 0x5F, 0xF5, 0xC7, 0xB4, 0xFB, 0xA6, 0xC5, 0x4B, 0x8A, 0x11, 0x61, 0xE2, 0x11, 0x52, 0x1B, 0x70, 0xD9, 0x5E, 0x4E, 0x31, 0x49, 0xF4, 0x9C, 0x59, 0xCA, 0xC2, 0x43, 0x3C, 0xFB, 0x3F, 0x7F, 0x81, 0xD6, 0x2B, 0x40, 0xF8, 0x55, 0x2C, 0xBE, 0xC5, 0xFC, 0x77, 0x4D, 0xEC, 0x90, 0x69, 0x49, 0x51, 0x23, 0xFD, 0xDE, 0x34, 0x50, 0xC4, 0xAF, 0xB1, 0xBE, 0xD2, 0x3D, 0x31, 0xF9, 0x17, 0x6B, 0x38, 0xF5, 0x72, 0x3C, 0xC1, 0x38, 0xF5, 0xF7, 0x98, 0xFD, 0xFE, 0x6C, 0x81, 0x1F, 0xE2, 0xEF, 0x8F, 0x63, 0x8C, 0x97, 0xE5, 0x36, 0x82, 0xE0, 0x9C, 0x7A, 0x56, 0x0A, 0x91, 0xBC, 0x4D, 0x68, 0xFD, 0x81, 0x46, 0xD3, 0x09, 0x05, 0x78, 0xA6, 0xE4, 0x99, 0xB2, 0xD8, 0xEA, 0xE6, 0x4D, 0xAA, 0xE3, 0xDF, 0x34, 0x36, 0x14, 0xFF, 0xB5, 0x52, 0x55, 0xD3, 0x06, 0x58, 0xB3, 0x1F, 0x72, 0xAC, 0x14, 0xE9, 0xF9, 0x38, 0x8B, 0xB6, 0x38, 0xC1, 0x66, 0x66, 0x62, 0xF2, 0xB7, 0x83, 0xAA, 0x9A, 0x3D, 0x88, 0xAC, 0x7B, 0x84, 0x3C, 0x72, 0xC1, 0xAE, 0x7F, 0xC7, 0x4D, 0xDF, 0x99, 0x07, 0x58, 0xF8, 0x8E, 0xBC, 0x8D, 0x63, 0x92, 0xB8, 0x18, 0x97, 0x9E, 0x2B, 0xE1, 0xEB, 0x96, 0x5E, 0x6E, 0x65, 0x4B, 0xE4, 0xC8, 0x83, 0x76, 0xFB, 0xD1, 0x79, 0xD5, 0x23, 0xA4, 0xDD, 0x0C, 0xAB, 0x59, 0x68, 0x94, 0x9F, 0xE2, 0x84, 0x9D, 0xB3, 0x1F, 0x82, 0xD5, 0x13, 0x93, 0x0B, 0x86, 0x3C, 0x3A, 0x7B, 0xF5, 0x0D, 0xF7, 0xFE, 0x97, 0xA4, 0x34, 0xA3, 0xC7, 0xFB, 0x81, 0x7D, 0xBE, 0xB8, 0x8A, 0x57, 0xE4, 0xCB, 0x7F, 0x6B, 0x69, 0x0C, 0x13, 0x55, 0xA4, 0x37, 0xBB, 0xD2, 0x32, 0x37, 0x0C, 0x6D, 0x88, 0x4B, 0x3F, 0x9B, 0xAE, 0xDE, 0xFC, 0xE1, 0x66, 0xC9, 0x16, 0x57, 0x52, 0x66, 0xF2, 0x50, 0x72, 0x5C, 0xCA, 0xD9, 0x14, 0xD9, 0xF6, 0x3C, 0x23, 0x00, 0xFF, 0x02, 0x04, 0xDC, 0x0F, 0x9A
     },
+    .text_zlen = 3036,
     .text_len = 3680,
     .data = (uint8_t const[]){
-        0x10, 0x00, 0xF5, 0x4F, 0x06, 0x0A, 0xF1, 0x4F, 0x56, 0x0A, 0xF1, 0x4F, 0xAE, 0x0A, 0xF1, 0x4F, 0x84, 0x0B, 0xF1, 0x4F, 0xF0, 0x0B, 0xF1, 0x4F, 0x9E, 0x0B, 0xF1, 0x4F, 0xD4, 0x08, 0xF1, 0x4F, 0x40, 0x0B, 0xF1, 0x4F, 0x80, 0x0B, 0xF1, 0x4F, 0xC2, 0x0A, 0xF1, 0x4F, 0x84, 0x08, 0xF1, 0x4F, 0xF6, 0x0A, 0xF1, 0x4F, 0x84, 0x08, 0xF1, 0x4F, 0xE0, 0x09, 0xF1, 0x4F, 0x26, 0x0A, 0xF1, 0x4F, 0x56, 0x0A, 0xF1, 0x4F, 0xAE, 0x0A, 0xF1, 0x4F, 0xF2, 0x09, 0xF1, 0x4F, 0x38, 0x09, 0xF1, 0x4F, 0x68, 0x09, 0xF1, 0x4F, 0xEE, 0x09, 0xF1, 0x4F, 0x40, 0x0E, 0xF1, 0x4F, 0x56, 0x0A, 0xF1, 0x4F, 0x08, 0x0D, 0xF1, 0x4F, 0x00, 0x0E, 0xF1, 0x4F, 0xC4, 0x07, 0xF1, 0x4F, 0x24, 0x0E, 0xF1, 0x4F, 0xC4, 0x07, 0xF1, 0x4F, 0xC4, 0x07, 0xF1, 0x4F, 0xC4, 0x07, 0xF1, 0x4F, 0xC4, 0x07, 0xF1, 0x4F, 0xC4, 0x07, 0xF1, 0x4F, 0xC4, 0x07, 0xF1, 0x4F, 0xC4, 0x07, 0xF1, 0x4F, 0xC4, 0x07, 0xF1, 0x4F, 0xA4, 0x0C, 0xF1, 0x4F, 0xC4, 0x07, 0xF1, 0x4F, 0x26, 0x0D, 0xF1, 0x4F, 0x00, 0x0E, 0xF1, 0x4F
+        0x28, 0xCF, 0x13, 0x60, 0xF8, 0xEA, 0xCF, 0xC6, 0xF5, 0xD1, 0x3F, 0x0C, 0x88, 0xD7, 0x01, 0x71, 0x0B, 0xF7, 0x47, 0xFF, 0x0F, 0x40, 0x3C, 0x0F, 0x88, 0xAF, 0x70, 0x7C, 0xF4, 0x77, 0x00, 0xD2, 0x0D, 0x40, 0x7C, 0x08, 0x24, 0x07, 0xE4, 0x7F, 0x83, 0xD2, 0x0F, 0x38, 0x3F, 0xFA, 0xAB, 0x21, 0xE9, 0xFB, 0x04, 0xE4, 0x5B, 0x00, 0x71, 0x06, 0x10, 0xBF, 0x03, 0x62, 0x07, 0x3E, 0x88, 0x1C, 0x07, 0xEF, 0x47, 0x7F, 0x06, 0x20, 0xFB, 0x08, 0xFB, 0x47, 0x7F, 0x15, 0x28, 0x8D, 0x0F, 0x2F, 0xE1, 0x81, 0xD0, 0x6A, 0x50, 0x7D, 0x00, 0xB1, 0xE4, 0x48, 0xBD
     },
+    .data_zlen = 91,
     .data_len = 160,
     .text_start = 0x4FF10000,
     .data_start = 0x4FF62BAC,
@@ -1,17 +1,20 @@
 // WARNING: This is a generated file, do not edit it!
 // clang-format off
 // Generated from esp-idf-tools/python_env/idf5.3_py3.12_env/lib/python3.12/site-packages/esptool/targets/stub_flasher/stub_flasher_32s2.json
+// The text and data segments are zlib streams with a 1024 byte window
 
 #include "chips.h"
 
 et2_stub_t const stub_esp32s2 = {
     .text = (uint8_t const[]){
-        0x08, 0x00, 0x00, 0x60, 0x1C, 0x00, 0x00, 0x60, 0x48, 0x00, 0xFD, 0x3F, 0x10, 0x00, 0x00, 0x60, 0x36, 0x41, 0x00, 0x21, 0xFB, 0xFF, 0xC0, 0x20, 0x00, 0x38, 0x02, 0x41, 0xFA, 0xFF, 0xC0, 0x20, 0x00, 0x28, 0x04, 0x20, 0x20, 0x94, 0x9C, 0xE2, 0x41, 0xF8, 0xFF, 0x46, 0x04, 0x00, 0x0C, 0x38, 0x30, 0x88, 0x01, 0xC0, 0x20, 0x00, 0xA8, 0x08, 0x88, 0x04, 0xA0, 0xA0, 0x74, 0xE0, 0x08, 0x00, 0x0B, 0x22, 0x66, 0x02, 0xE8, 0x86, 0xF4, 0xFF, 0x21, 0xF1, 0xFF, 0xC0, 0x20, 0x00, 0x39, 0x02, 0x1D, 0xF0, 0x00, 0x00, 0xEC, 0x2B, 0xFE, 0x3F, 0x64, 0xAB, 0xFD, 0x3F, 0x84, 0x80, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xA4, 0xEB, 0xFD, 0x3F, 0xF0, 0x2B, 0xFE, 0x3F, 0x36, 0x41, 0x00, 0xB1, 0xF9, 0xFF, 0x20, 0xA0, 0x74, 0x10, 0x11, 0x20, 0x25, 0x08, 0x01, 0x96, 0x1A, 0x06, 0x81, 0xF6, 0xFF, 0x92, 0xA1, 0x01, 0x90, 0x99, 0x11, 0x9A, 0x98, 0xC0, 0x20, 0x00, 0xB8, 0x09, 0x91, 0xF3, 0xFF, 0xA0, 0xA0, 0x74, 0x9A, 0x88, 0xC0, 0x20, 0x00, 0x92, 0x18, 0x00, 0x90, 0x90, 0xF4, 0x1B, 0xC9, 0xC0, 0xC0, 0xF4, 0xC0, 0x20, 0x00, 0xC2, 0x58, 0x00, 0x9A, 0x9B, 0xC0, 0x20, 0x00, 0xA2, 0x49, 0x00, 0xC0, 0x20, 0x00, 0x92, 0x18, 0x00, 0x81, 0xEA, 0xFF, 0x90, 0x90, 0xF4, 0x80, 0x80, 0xF4, 0x87, 0x99, 0x47, 0x81, 0xE5, 0xFF, 0x92, 0xA1, 0x01, 0x90, 0x99, 0x11, 0x9A, 0x98, 0xC0, 0x20, 0x00, 0xC8, 0x09, 0xA1, 0xE5, 0xFF, 0xB1, 0xE3, 0xFF, 0x87, 0x9C, 0x17, 0xC6, 0x01, 0x00, 0x7C, 0xE8, 0x87, 0x1A, 0xDE, 0xC6, 0x08, 0x00, 0xC0, 0x20, 0x00, 0x89, 0x0A, 0xC0, 0x20, 0x00, 0xB9, 0x09, 0x46, 0x02, 0x00, 0xC0, 0x20, 0x00, 0xB9, 0x0A, 0xC0, 0x20, 0x00, 0x89, 0x09, 0x91, 0xD7, 0xFF, 0x9A, 0x88, 0x0C, 0x09, 0xC0, 0x20, 0x00, 0x92, 0x58, 0x00, 0x1D, 0xF0, 0x00, 0x00, 0x54, 0x20, 0x40, 0x3F, 0x54, 0x30, 0x40, 0x3F, 0x36, 0x41, 0x00, 0x91, 0xFD, 0xFF, 0xC0, 0x20, 0x00, 0x88, 0x09, 0x80, 0x80, 0x24, 0x56, 0x48, 0xFF, 0x91, 0xFA, 0xFF, 0xC0, 0x20, 0x00, 0x88, 0x09, 0x80, 0x80, 0x24, 0x56, 0x48, 0xFF, 0x1D, 0xF0, 0x00, 0x00, 0x00, 0x2C, 0x20, 0x40, 0x3F, 0x00, 0x20, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x08, 0x36, 0x41, 0x00, 0x10, 0x11, 0x20, 0xA5, 0xFC, 0xFF, 0x21, 0xFA, 0xFF, 0x0C, 0x08, 0xC0, 0x20, 0x00, 0x82, 0x62, 0x00, 0x91, 0xFA, 0xFF, 0x81, 0xF8, 0xFF, 0xC0, 0x20, 0x00, 0x92, 0x68, 0x00, 0xC0, 0x20, 0x00, 0x98, 0x08, 0x56, 0x79, 0xFF, 0xC0, 0x20, 0x00, 0x88, 0x02, 0x7C, 0xF2, 0x80, 0x22, 0x30, 0x20, 0x20, 0x04, 0x1D, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x36, 0x41, 0x00, 0x10, 0x11, 0x20, 0xE5, 0xFB, 0xFF, 0x16, 0x6A, 0xFF, 0x81, 0xEC, 0xFF, 0x91, 0xFB, 0xFF, 0xC0, 0x20, 0x00, 0x92, 0x68, 0x00, 0xC0, 0x20, 0x00, 0x98, 0x08, 0x56, 0x79, 0xFF, 0x1D, 0xF0, 0x00, 0x00, 0x58, 0x80, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x20, 0x40, 0x3F, 0x36, 0x41, 0x00, 0x21, 0xFC, 0xFF, 0x38, 0x42, 0x16, 0x83, 0x06, 0x10, 0x11, 0x20, 0x65, 0xF8, 0xFF, 0x16, 0xFA, 0x05, 0x0C, 0xF8, 0x0C, 0x04, 0x37, 0xA8, 0x0D, 0x98, 0x22, 0x80, 0x99, 0x10, 0x82, 0xA0, 0x01, 0x90, 0x48, 0x83, 0x40, 0x40, 0x74, 0x10, 0x11, 0x20, 0x25, 0xFA, 0xFF, 0x10, 0x11, 0x20, 0x25, 0xF3, 0xFF, 0x88, 0x22, 0x0C, 0x1B, 0x40, 0x98, 0x11, 0x90, 0xAB, 0x01, 0xCC, 0x14, 0x80, 0xAB, 0x01, 0xB1, 0xED, 0xFF, 0xB0, 0x99, 0x10, 0xB1, 0xEC, 0xFF, 0xC0, 0x20, 0x00, 0x92, 0x6B, 0x00, 0x91, 0xCE, 0xFF, 0xC0, 0x20, 0x00, 0xA2, 0x69, 0x00, 0xC0, 0x20, 0x00, 0xA8, 0x09, 0x56, 0x7A, 0xFF, 0x1C, 0x09, 0x0C, 0x1A, 0x40, 0x9A, 0x83, 0x90, 0x33, 0xC0, 0x9A, 0x88, 0x39, 0x42, 0x89, 0x22, 0x1D, 0xF0, 0x00, 0x00, 0x70, 0xE2, 0xFA, 0x3F, 0x08, 0x20, 0x40, 0x3F, 0x84, 0x62, 0x01, 0x40, 0xA4, 0x62, 0x01, 0x40, 0x36, 0x61, 0x00, 0x10, 0x11, 0x20, 0x65, 0xED, 0xFF, 0x31, 0xF9, 0xFF, 0xBD, 0x01, 0xAD, 0x03, 0x81, 0xFA, 0xFF, 0xE0, 0x08, 0x00, 0x4D, 0x0A, 0x0C, 0x12, 0xEC, 0xEA, 0x88, 0x01, 0x92, 0xA2, 0x00, 0x90, 0x88, 0x10, 0x89, 0x01, 0x10, 0x11, 0x20, 0xE5, 0xF1, 0xFF, 0x91, 0xF2, 0xFF, 0xA0, 0xA2, 0x01, 0xC0, 0x20, 0x00, 0x88, 0x09, 0xA0, 0x88, 0x20, 0xC0, 0x20, 0x00, 0x89, 0x09, 0xB8, 0x01, 0xAD, 0x03, 0x81, 0xEE, 0xFF, 0xE0, 0x08, 0x00, 0xA0, 0x24, 0x83, 0x1D, 0xF0, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x36, 0x41, 0x00, 0x81, 0xC5, 0xFF, 0x0C, 0x19, 0x92, 0x48, 0x00, 0x30, 0x9C, 0x41, 0x99, 0x28, 0x91, 0xFB, 0xFF, 0x39, 0x18, 0x29, 0x38, 0x30, 0x30, 0xB4, 0x9A, 0x22, 0x2A, 0x33, 0x30, 0x3C, 0x41, 0x0C, 0x02, 0x29, 0x58, 0x39, 0x48, 0x10, 0x11, 0x20, 0x25, 0xF8, 0xFF, 0x2D, 0x0A, 0x8C, 0x1A, 0x22, 0xA0, 0xC5, 0x1D, 0xF0, 0x00, 0x00, 0xCC, 0x71, 0x01, 0x40, 0x36, 0x41, 0x00, 0x41, 0xB6, 0xFF, 0x58, 0x34, 0x50, 0x33, 0x63, 0x16, 0x63, 0x04, 0x58, 0x14, 0x5A, 0x53, 0x50, 0x5C, 0x41, 0x46, 0x01, 0x00, 0x10, 0x11, 0x20, 0xE5, 0xEC, 0xFF, 0x88, 0x44, 0xA6, 0x18, 0x04, 0x88, 0x24, 0x87, 0xA5, 0xEF, 0x10, 0x11, 0x20, 0x25, 0xE5, 0xFF, 0x16, 0x6A, 0xFF, 0xA8, 0x14, 0xCD, 0x03, 0xBD, 0x02, 0x81, 0xF1, 0xFF, 0xE0, 0x08, 0x00, 0xA0, 0xA0, 0x74, 0x8C, 0x4A, 0x52, 0xA0, 0xC4, 0x52, 0x64, 0x05, 0x58, 0x14, 0x3A, 0x55, 0x59, 0x14, 0x58, 0x34, 0x30, 0x55, 0xC0, 0x59, 0x34, 0x1D, 0xF0, 0x00, 0xF8, 0xFC, 0xFF, 0x3F, 0x44, 0x00, 0xFD, 0x3F, 0x4C, 0x00, 0xFD, 0x3F, 0x00, 0x32, 0x01, 0x40, 0xEC, 0x31, 0x01, 0x40, 0x30, 0x33, 0x01, 0x40, 0x36, 0x61, 0x00, 0x7C, 0xC8, 0xAD, 0x02, 0x87, 0x93, 0x2D, 0x31, 0xF7, 0xFF, 0xC6, 0x05, 0x00, 0xA8, 0x03, 0x0C, 0x1C, 0x10, 0xB1, 0x20, 0x81, 0xF7, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0x2B, 0xFF, 0xA2, 0x01, 0x00, 0x88, 0x08, 0xE0, 0x08, 0x00, 0xA8, 0x03, 0x81, 0xF3, 0xFF, 0xE0, 0x08, 0x00, 0xE6, 0x1A, 0xDC, 0xC6, 0x0A, 0x00, 0x00, 0x00, 0x66, 0x03, 0x26, 0x0C, 0x03, 0xCD, 0x01, 0x0C, 0x2B, 0x32, 0x61, 0x00, 0x81, 0xEE, 0xFF, 0xE0, 0x08, 0x00, 0x98, 0x01, 0x81, 0xE8, 0xFF, 0x37, 0x99, 0x0D, 0xA8, 0x08, 0x66, 0x1A, 0x08, 0x31, 0xE6, 0xFF, 0xC0, 0x20, 0x00, 0xA2, 0x43, 0x00, 0x99, 0x08, 0x1D, 0xF0, 0x40, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0x8C, 0x31, 0x01, 0x40, 0x36, 0x41, 0x00, 0x21, 0xFC, 0xFF, 0x81, 0xDC, 0xFF, 0xC8, 0x02, 0xA8, 0x08, 0xB1, 0xFA, 0xFF, 0x81, 0xFB, 0xFF, 0xE0, 0x08, 0x00, 0x0C, 0x08, 0x89, 0x02, 0x1D, 0xF0, 0x60, 0x2F, 0x01, 0x40, 0x36, 0x41, 0x00, 0x81, 0xFE, 0xFF, 0xE0, 0x08, 0x00, 0x82, 0x0A, 0x18, 0x0C, 0x09, 0x82, 0xC8, 0xFE, 0x0C, 0x12, 0x80, 0x29, 0x93, 0x1D, 0xF0, 0xF8, 0x2B, 0xFE, 0x3F, 0xF4, 0x2B, 0xFE, 0x3F, 0x18, 0x00, 0x4C, 0x3F, 0x8C, 0x00, 0x4C, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x36, 0x41, 0x00, 0x10, 0x11, 0x20, 0xE5, 0xFC, 0xFF, 0x16, 0x5A, 0x04, 0xA1, 0xF8, 0xFF, 0x88, 0x0A, 0xBC, 0xD8, 0x81, 0xF7, 0xFF, 0x98, 0x08, 0xBC, 0x69, 0xB1, 0xF6, 0xFF, 0x7C, 0xCC, 0xC0, 0x20, 0x00, 0x88, 0x0B, 0x90, 0x90, 0x14, 0xC0, 0x88, 0x10, 0x90, 0x88, 0x20, 0xC0, 0x20, 0x00, 0x89, 0x0B, 0x88, 0x0A, 0xB1, 0xF1, 0xFF, 0x0C, 0x3A, 0x60, 0xAA, 0x11, 0xC0, 0x20, 0x00, 0x98, 0x0B, 0xA0, 0x88, 0x10, 0xA1, 0xEE, 0xFF, 0xA0, 0x99, 0x10, 0x90, 0x88, 0x20, 0xC0, 0x20, 0x00, 0x89, 0x0B, 0x1D, 0xF0, 0x28, 0x2B, 0x01, 0x40, 0x36, 0x41, 0x00, 0x10, 0x11, 0x20, 0x65, 0xF7, 0xFF, 0xBC, 0x1A, 0x91, 0xD1, 0xFF, 0x88, 0x09, 0x1B, 0xA8, 0xA9, 0x09, 0x91, 0xD0, 0xFF, 0x0C, 0x0A, 0x8A, 0x99, 0x22, 0x49, 0x00, 0x82, 0xC8, 0xC1, 0x0C, 0x19, 0x80, 0xA9, 0x83, 0xA0, 0x80, 0x74, 0xCC, 0x8A, 0xA2, 0xAF, 0x40, 0xAA, 0x22, 0x20, 0x98, 0x93, 0x8C, 0xF9, 0x10, 0x11, 0x20, 0x25, 0xF2, 0xFF, 0xC6, 0x01, 0x00, 0xAD, 0x02, 0x81, 0xEF, 0xFF, 0xE0, 0x08, 0x00, 0x1D, 0xF0, 0x36, 0x41, 0x00, 0xA2, 0xA0, 0xC0, 0x10, 0x11, 0x20, 0xE5, 0xFA, 0xFF, 0x1D, 0xF0, 0x00, 0x00, 0x36, 0x41, 0x00, 0x82, 0xA0, 0xC0, 0xAD, 0x02, 0x87, 0x92, 0x11, 0xA2, 0xA0, 0xDB, 0x10, 0x11, 0x20, 0x65, 0xF9, 0xFF, 0xA2, 0xA0, 0xDC, 0x46, 0x04, 0x00, 0x00, 0x00, 0x00, 0x82, 0xA0, 0xDB, 0x87, 0x92, 0x08, 0x10, 0x11, 0x20, 0x25, 0xF8, 0xFF, 0xA2, 0xA0, 0xDD, 0x10, 0x11, 0x20, 0xA5, 0xF7, 0xFF, 0x1D, 0xF0, 0x36, 0x41, 0x00, 0x3A, 0x32, 0xC6, 0x02, 0x00, 0xA2, 0x02, 0x00, 0x22, 0xC2, 0x01, 0x10, 0x11, 0x20, 0xA5, 0xFB, 0xFF, 0x37, 0x92, 0xF0, 0x1D, 0xF0, 0x00, 0x00, 0x00, 0x6C, 0x52, 0x00, 0x40, 0x8C, 0x72, 0x01, 0x40, 0x8C, 0x52, 0x00, 0x40, 0x0C, 0x53, 0x00, 0x40, 0x36, 0x21, 0x21, 0xA2, 0xD1, 0x10, 0x81, 0xFA, 0xFF, 0xE0, 0x08, 0x00, 0x46, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x14, 0x40, 0x44, 0x11, 0x40, 0x43, 0x63, 0xCD, 0x04, 0xBD, 0x01, 0xAD, 0x02, 0x81, 0xF5, 0xFF, 0xE0, 0x08, 0x00, 0xA0, 0xA0, 0x74, 0xFC, 0x5A, 0xCD, 0x04, 0x10, 0xB1, 0x20, 0xA2, 0xD1, 0x10, 0x81, 0xF1, 0xFF, 0xE0, 0x08, 0x00, 0x4A, 0x22, 0x40, 0x33, 0xC0, 0x56, 0x03, 0xFD, 0x22, 0xA2, 0x0B, 0x10, 0x22, 0xB0, 0x20, 0xA2, 0x20, 0xB2, 0xD1, 0x10, 0x81, 0xEC, 0xFF, 0xE0, 0x08, 0x00, 0xAD, 0x02, 0x1C, 0x0B, 0x10, 0x11, 0x20, 0xA5, 0xF7, 0xFF, 0x2D, 0x03, 0x86, 0x00, 0x00, 0x22, 0xA0, 0x63, 0x1D, 0xF0, 0x00, 0x00, 0x40, 0x2B, 0x01, 0x40, 0x36, 0x41, 0x00, 0x10, 0x11, 0x20, 0x25, 0xE5, 0xFF, 0x8C, 0xBA, 0x81, 0x88, 0xFF, 0x88, 0x08, 0x8C, 0x48, 0x10, 0x11, 0x20, 0x25, 0xE2, 0xFF, 0x0C, 0x0A, 0x81, 0xF8, 0xFF, 0xE0, 0x08, 0x00, 0x1D, 0xF0, 0x00, 0x00, 0x84, 0x32, 0x01, 0x40, 0xB4, 0xF1, 0x00, 0x40, 0x90, 0x32, 0x01, 0x40, 0xC0, 0xF1, 0x00, 0x40, 0x36, 0x41, 0x00, 0x10, 0x11, 0x20, 0xE5, 0xE1, 0xFF, 0xAC, 0x9A, 0x31, 0x5C, 0xFF, 0x8C, 0xE2, 0xA8, 0x03, 0x81, 0xF7, 0xFF, 0xE0, 0x08, 0x00, 0xA2, 0xA2, 0x00, 0xC6, 0x06, 0x00, 0x00, 0x00, 0xA2, 0xA2, 0x00, 0x81, 0xF4, 0xFF, 0xE0, 0x08, 0x00, 0xA8, 0x03, 0x81, 0xF3, 0xFF, 0xE0, 0x08, 0x00, 0x46, 0x05, 0x00, 0x00, 0x00, 0x2C, 0x0A, 0x8C, 0x82, 0x81, 0xF0, 0xFF, 0xE0, 0x08, 0x00, 0x86, 0x01, 0x00, 0x00, 0x81, 0xEC, 0xFF, 0xE0, 0x08, 0x00, 0x1D, 0xF0, 0xF0, 0x2B, 0x01, 0x40, 0x36, 0x41, 0x21, 0x62, 0xA1, 0x07, 0xC0, 0x66, 0x11, 0x1A, 0x66, 0x59, 0x06, 0x0C, 0x05, 0x62, 0xD1, 0x10, 0xAD, 0x05, 0x52, 0x66, 0x1A, 0x10, 0x11, 0x20, 0x65, 0xF9, 0xFF, 0x0C, 0x18, 0x40, 0x88, 0x11, 0x47, 0xB8, 0x02, 0x46, 0x44, 0x00, 0xAD, 0x06, 0x81, 0xB5, 0xFF, 0xE0, 0x08, 0x00, 0x86, 0x33, 0x00, 0x00, 0x92, 0xA4, 0x1D, 0x50, 0x73, 0xC0, 0xE0, 0x99, 0x11, 0x1A, 0x99, 0x40, 0x77, 0x63, 0x89, 0x09, 0xCD, 0x07, 0xBD, 0x01, 0x20, 0xA2, 0x20, 0x81, 0xAE, 0xFF, 0xE0, 0x08, 0x00, 0x92, 0xA4, 0x1D, 0xE0, 0x99, 0x11, 0x1A, 0x99, 0xA0, 0xA0, 0x74, 0x88, 0x09, 0x8C, 0x8A, 0x0C, 0x08, 0x82, 0x66, 0x16, 0x7D, 0x08, 0x86, 0x15, 0x00, 0x92, 0xA4, 0x1D, 0xE0, 0x99, 0x11, 0x1A, 0x99, 0x89, 0x09, 0x10, 0x11, 0x20, 0xA5, 0xE2, 0xFF, 0xBD, 0x07, 0xAD, 0x01, 0x10, 0x11, 0x20, 0x25, 0xE6, 0xFF, 0x10, 0x11, 0x20, 0xA5, 0xE1, 0xFF, 0xCD, 0x07, 0x10, 0xB1, 0x20, 0x60, 0xA6, 0x20, 0x81, 0x9D, 0xFF, 0xE0, 0x08, 0x00, 0x92, 0xA4, 0x1D, 0xE0, 0x99, 0x11, 0x1A, 0x99, 0x88, 0x09, 0x70, 0x22, 0x80, 0x70, 0x55, 0x80, 0x37, 0xB5, 0xB4, 0x92, 0xA1, 0x07, 0xC0, 0x99, 0x11, 0x1A, 0x99, 0x98, 0x09, 0x80, 0x75, 0xC0, 0x97, 0xB7, 0x02, 0x46, 0xDD, 0xFF, 0x86, 0xE7, 0xFF, 0x0C, 0x08, 0x82, 0x46, 0x6C, 0xA2, 0xA4, 0x1B, 0x10, 0xAA, 0xA0, 0x81, 0xCC, 0xFF, 0xE0, 0x08, 0x00, 0x56, 0x0A, 0xFF, 0xB2, 0xA2, 0x0B, 0xA2, 0x06, 0x6C, 0x10, 0xBB, 0xB0, 0x10, 0x11, 0x20, 0x25, 0xA2, 0x00, 0xF7, 0xEA, 0x12, 0xF6, 0x47, 0x0F, 0xB2, 0xA2, 0x0D, 0x10, 0xBB, 0xB0, 0x7A, 0xBB, 0xA2, 0x4B, 0x00, 0x1B, 0x77, 0x86, 0xF1, 0xFF, 0x7C, 0xEB, 0xB7, 0x9A, 0xC1, 0x66, 0x47, 0x08, 0x82, 0x26, 0x1A, 0x37, 0xB8, 0x02, 0x87, 0xB5, 0x9C, 0x22, 0xA2, 0x0B, 0x10, 0x22, 0xB0, 0x60, 0xB6, 0x20, 0xAD, 0x02, 0x81, 0x7D, 0xFF, 0xE0, 0x08, 0x00, 0x10, 0x11, 0x20, 0x25, 0xD8, 0xFF, 0xAD, 0x02, 0x1C, 0x0B, 0x10, 0x11, 0x20, 0xA5, 0xDB, 0xFF, 0x10, 0x11, 0x20, 0x25, 0xD7, 0xFF, 0x0C, 0x1A, 0x10, 0x11, 0x20, 0xA5, 0xE7, 0xFF, 0x1D, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x4F, 0x48, 0x41, 0x49, 0xFC, 0x2B, 0xFE, 0x3F, 0x6C, 0x80, 0x02, 0x40, 0x48, 0x3C, 0x01, 0x40, 0x3C, 0x83, 0x02, 0x40, 0x08, 0x00, 0x08, 0x60, 0x10, 0x80, 0x02, 0x40, 0x0C, 0x00, 0x00, 0x60, 0x38, 0x40, 0x40, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x28, 0x81, 0x40, 0x3F, 0x8C, 0x80, 0x00, 0x00, 0x10, 0x40, 0x00, 0x00, 0x00, 0x2C, 0xFE, 0x3F, 0x10, 0x2C, 0xFE, 0x3F, 0x7C, 0x90, 0x40, 0x3F, 0xFF, 0x8F, 0xFF, 0xFF, 0x80, 0x90, 0x40, 0x3F, 0x84, 0x90, 0x40, 0x3F, 0x78, 0x90, 0x40, 0x3F, 0x50, 0x00, 0xFD, 0x3F, 0x54, 0x00, 0xFD, 0x3F, 0x5C, 0x2C, 0xFE, 0x3F, 0x14, 0x00, 0x00, 0x60, 0xF0, 0xFF, 0xFF, 0x00, 0xFC, 0x2B, 0xFE, 0x3F, 0x58, 0x00, 0xFD, 0x3F, 0x70, 0x80, 0xFD, 0x3F, 0x5C, 0xF2, 0x00, 0x40, 0x88, 0xD8, 0x00, 0x40, 0xD0, 0xF1, 0x00, 0x40, 0xA4, 0xF1, 0x00, 0x40, 0xD4, 0x32, 0x01, 0x40, 0x58, 0x32, 0x01, 0x40, 0xA0, 0xE4, 0x00, 0x40, 0x04, 0x70, 0x01, 0x40, 0x00, 0x75, 0x01, 0x40, 0x80, 0x49, 0x01, 0x40, 0xE8, 0x35, 0x01, 0x40, 0xEC, 0x3B, 0x01, 0x40, 0x80, 0x00, 0x01, 0x40, 0x98, 0x20, 0x01, 0x40, 0xEC, 0x70, 0x01, 0x40, 0x6C, 0x71, 0x01, 0x40, 0x0C, 0x71, 0x01, 0x40, 0x84, 0x29, 0x01, 0x40, 0x78, 0x76, 0x01, 0x40, 0xE0, 0x77, 0x01, 0x40, 0x94, 0x76, 0x01, 0x40, 0x00, 0x30, 0x00, 0x40, 0x68, 0x00, 0x01, 0x40, 0x36, 0xC1, 0x00, 0x21, 0xCC, 0xFF, 0x0C, 0x0A, 0x29, 0xA1, 0x81, 0xE6, 0xFF, 0xE0, 0x08, 0x00, 0x10, 0x11, 0x20, 0x65, 0xBB, 0xFF, 0x16, 0xEA, 0x04, 0x31, 0xF3, 0xFE, 0x41, 0xF2, 0xFE, 0xC0, 0x20, 0x00, 0x28, 0x03, 0x51, 0xF2, 0xFE, 0x29, 0x04, 0xC0, 0x20, 0x00, 0x28, 0x05, 0x61, 0xEC, 0xFE, 0xA2, 0xA0, 0x64, 0x29, 0x06, 0x61, 0xEE, 0xFE, 0x60, 0x22, 0x10, 0x62, 0xA4, 0x00, 0x60, 0x22, 0x20, 0xC0, 0x20, 0x00, 0x29, 0x05, 0x81, 0xD8, 0xFF, 0xE0, 0x08, 0x00, 0x48, 0x04, 0x7C, 0xC2, 0x40, 0x22, 0x10, 0x0C, 0x24, 0x40, 0x22, 0x20, 0xC0, 0x20, 0x00, 0x29, 0x03, 0x86, 0x01, 0x00, 0x49, 0x02, 0x4B, 0x22, 0xC6, 0x01, 0x00, 0x21, 0xB2, 0xFF, 0x31, 0xB3, 0xFF, 0x0C, 0x04, 0x37, 0x32, 0xED, 0x10, 0x11, 0x20, 0xE5, 0xC1, 0xFF, 0x0C, 0x4B, 0xA2, 0xC1, 0x28, 0x10, 0x11, 0x20, 0x65, 0xC5, 0xFF, 0x22, 0xA1, 0x01, 0x10, 0x11, 0x20, 0xA5, 0xC0, 0xFF, 0x41, 0xF1, 0xFD, 0x90, 0x22, 0x11, 0x2A, 0x24, 0xC0, 0x20, 0x00, 0x49, 0x02, 0x31, 0xA8, 0xFF, 0x21, 0xD9, 0xFD, 0x32, 0x62, 0x00, 0x10, 0x11, 0x20, 0x25, 0xB2, 0xFF, 0x16, 0x3A, 0x06, 0x21, 0x9D, 0xFE, 0xC1, 0x9D, 0xFE, 0xA8, 0x02, 0x0C, 0x2B, 0x81, 0x9F, 0xFE, 0xE0, 0x08, 0x00, 0x0C, 0x9C, 0x3C, 0x0B, 0x0C, 0x0A, 0x81, 0xBA, 0xFF, 0xE0, 0x08, 0x00, 0xB1, 0x9E, 0xFF, 0x0C, 0x0C, 0x0C, 0x9A, 0x81, 0xB8, 0xFF, 0xE0, 0x08, 0x00, 0xA2, 0xA2, 0x00, 0x81, 0x32, 0xFF, 0xE0, 0x08, 0x00, 0xB1, 0x99, 0xFF, 0xA8, 0x02, 0x52, 0xA0, 0x01, 0x81, 0xB3, 0xFF, 0xE0, 0x08, 0x00, 0xA8, 0x02, 0x81, 0x29, 0xFF, 0xE0, 0x08, 0x00, 0xA8, 0x02, 0x81, 0xB0, 0xFF, 0xE0, 0x08, 0x00, 0x31, 0x93, 0xFF, 0xC0, 0x20, 0x00, 0x28, 0x03, 0x50, 0x22, 0x20, 0xC0, 0x20, 0x00, 0x29, 0x03, 0x06, 0x0A, 0x00, 0x00, 0xB1, 0x8F, 0xFF, 0xCD, 0x0A, 0x0C, 0x5A, 0x81, 0xA6, 0xFF, 0xE0, 0x08, 0x00, 0x31, 0x8C, 0xFF, 0x52, 0xA1, 0x01, 0xC0, 0x20, 0x00, 0x28, 0x03, 0x2C, 0x0A, 0x50, 0x22, 0x20, 0xC0, 0x20, 0x00, 0x29, 0x03, 0x81, 0x1B, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0xA1, 0xFF, 0xE0, 0x08, 0x00, 0x21, 0x85, 0xFF, 0xC0, 0x20, 0x00, 0x28, 0x02, 0xCC, 0xBA, 0x1C, 0xC3, 0x30, 0x22, 0x10, 0x22, 0xC2, 0xF8, 0x0C, 0x13, 0x20, 0xA3, 0x83, 0x0C, 0x0B, 0x81, 0x9A, 0xFF, 0xE0, 0x08, 0x00, 0xF1, 0x7E, 0xFF, 0x0C, 0x1D, 0x0C, 0x1C, 0xB2, 0xA0, 0x01, 0xE2, 0xA1, 0x00, 0x40, 0xDD, 0x11, 0x00, 0xCC, 0x11, 0x80, 0xBB, 0x01, 0xA2, 0xA0, 0x00, 0x81, 0x93, 0xFF, 0xE0, 0x08, 0x00, 0x21, 0x79, 0xFF, 0x51, 0x09, 0xFE, 0x2A, 0x44, 0x62, 0xD5, 0x2B, 0xC6, 0x16, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x20, 0x00, 0x32, 0x07, 0x00, 0x30, 0x30, 0x74, 0x16, 0xF3, 0x04, 0xA2, 0xA2, 0x00, 0xC0, 0x20, 0x00, 0x22, 0x47, 0x00, 0x81, 0xFD, 0xFE, 0xE0, 0x08, 0x00, 0xA2, 0xA2, 0x71, 0xC0, 0xAA, 0x11, 0x81, 0x7E, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0x85, 0xFF, 0xE0, 0x08, 0x00, 0x71, 0x68, 0xFF, 0x7C, 0xE8, 0xC0, 0x20, 0x00, 0x38, 0x07, 0xA2, 0xAF, 0xFF, 0x80, 0x33, 0x10, 0x10, 0xAA, 0x01, 0xC0, 0x20, 0x00, 0x39, 0x07, 0x81, 0x7E, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0x7E, 0xFF, 0xE0, 0x08, 0x00, 0xAD, 0x02, 0x81, 0x7D, 0xFF, 0xE0, 0x08, 0x00, 0x71, 0x50, 0xFE, 0xC0, 0x20, 0x00, 0x28, 0x04, 0x16, 0xB2, 0xF9, 0x0C, 0x07, 0xC0, 0x20, 0x00, 0x38, 0x04, 0x0C, 0x12, 0xC0, 0x20, 0x00, 0x79, 0x04, 0x22, 0x41, 0x1C, 0x22, 0x03, 0x01, 0x0C, 0x28, 0x79, 0x81, 0x22, 0x41, 0x1D, 0x82, 0x51, 0x0F, 0x1C, 0x37, 0x77, 0x12, 0x23, 0x1C, 0x47, 0x77, 0x12, 0x24, 0x66, 0x92, 0x26, 0x22, 0x03, 0x03, 0x72, 0x03, 0x02, 0x80, 0x22, 0x11, 0x70, 0x22, 0x20, 0x66, 0x42, 0x17, 0x28, 0x23, 0xC0, 0x20, 0x00, 0x28, 0x02, 0x29, 0x81, 0xC6, 0x02, 0x00, 0x00, 0x1C, 0x22, 0x86, 0x00, 0x00, 0x00, 0x0C, 0xC2, 0x22, 0x51, 0x0F, 0x10, 0x11, 0x20, 0xE5, 0xA4, 0xFF, 0xB2, 0xA0, 0x08, 0xA2, 0xC1, 0x1C, 0x10, 0x11, 0x20, 0x65, 0xA8, 0xFF, 0x72, 0x03, 0x03, 0x22, 0x03, 0x02, 0x80, 0x77, 0x11, 0x20, 0x77, 0x20, 0x21, 0x40, 0xFF, 0x20, 0x20, 0xF4, 0x77, 0xB2, 0x1A, 0xA2, 0xA0, 0xC0, 0x10, 0x11, 0x20, 0x25, 0xA3, 0xFF, 0xA2, 0xA0, 0xEE, 0x10, 0x11, 0x20, 0xA5, 0xA2, 0xFF, 0x10, 0x11, 0x20, 0x65, 0xA1, 0xFF, 0x06, 0xD8, 0xFF, 0x22, 0x03, 0x01, 0x1C, 0x48, 0x27, 0x38, 0x37, 0xF6, 0x22, 0x1B, 0x06, 0xF7, 0x00, 0x22, 0xC2, 0x2F, 0x20, 0x20, 0x74, 0xB6, 0x42, 0x02, 0x46, 0x26, 0x00, 0x81, 0x32, 0xFF, 0x80, 0x22, 0xA0, 0x28, 0x02, 0xA0, 0x02, 0x00, 0x00, 0x00, 0x22, 0xC2, 0xFE, 0x20, 0x20, 0x74, 0x1C, 0x28, 0x27, 0xB8, 0x02, 0x46, 0xED, 0x00, 0x81, 0x2C, 0xFF, 0x80, 0x22, 0xA0, 0x28, 0x02, 0xA0, 0x02, 0x00, 0x82, 0xC2, 0x30, 0x80, 0x80, 0x74, 0xB6, 0x58, 0xC4, 0x86, 0xE7, 0x00, 0x2C, 0x49, 0x0C, 0x08, 0x22, 0xA0, 0xC0, 0x97, 0x17, 0x02, 0x86, 0xE5, 0x00, 0x89, 0x81, 0x0C, 0x72, 0x7D, 0x08, 0xAD, 0x07, 0x10, 0x11, 0x20, 0xA5, 0x9B, 0xFF, 0xAD, 0x07, 0x10, 0x11, 0x20, 0x25, 0x9B, 0xFF, 0x10, 0x11, 0x20, 0xE5, 0x99, 0xFF, 0x10, 0x11, 0x20, 0x65, 0x99, 0xFF, 0x0C, 0x8B, 0xA2, 0xC1, 0x1C, 0x0B, 0x22, 0x10, 0x11, 0x20, 0xE5, 0x9C, 0xFF, 0x56, 0x32, 0xFD, 0x86, 0x2F, 0x00, 0x0C, 0x12, 0x56, 0x17, 0x35, 0xC2, 0xC1, 0x10, 0xBD, 0x07, 0xAD, 0x07, 0x81, 0x2E, 0xFF, 0xE0, 0x08, 0x00, 0x56, 0x1A, 0x34, 0xB2, 0xA0, 0x0C, 0xA2, 0xC1, 0x10, 0x10, 0x11, 0x20, 0x65, 0x9A, 0xFF, 0x06, 0xAE, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x56, 0xB7, 0x32, 0x81, 0x27, 0xFF, 0xE0, 0x08, 0x00, 0x06, 0x2B, 0x00, 0x26, 0x87, 0x06, 0x0C, 0x12, 0x86, 0xC6, 0x00, 0x00, 0x00, 0x78, 0x23, 0x28, 0x33, 0x20, 0x87, 0x20, 0x80, 0x80, 0xB4, 0x56, 0xB8, 0xFE, 0x10, 0x11, 0x20, 0x65, 0x6D, 0xFF, 0x2A, 0x77, 0x9C, 0x1A, 0x86, 0xF7, 0xFF, 0x00, 0xA0, 0xAC, 0x41, 0x81, 0x1C, 0xFF, 0xE0, 0x08, 0x00, 0x56, 0x1A, 0xFD, 0x22, 0xD2, 0xF0, 0x20, 0xA7, 0xC0, 0xCC, 0x22, 0x06, 0x9B, 0x00, 0x00, 0xA0, 0x80, 0xF4, 0x56, 0x18, 0xFE, 0x86, 0x04, 0x00, 0xA0, 0xA0, 0xF5, 0x89, 0xC1, 0x81, 0x14, 0xFF, 0xE0, 0x08, 0x00, 0x88, 0xC1, 0x56, 0xCA, 0xFA, 0x80, 0x22, 0xC0, 0x0C, 0x18, 0x00, 0x88, 0x11, 0x20, 0xA7, 0xC0, 0x27, 0x38, 0xE1, 0x86, 0x03, 0x00, 0xA0, 0xAC, 0x41, 0x81, 0x0B, 0xFF, 0xE0, 0x08, 0x00, 0x56, 0xFA, 0xF8, 0x22, 0xD2, 0xF0, 0x20, 0xA7, 0xC0, 0x56, 0xA2, 0xFE, 0x46, 0x8A, 0x00, 0x00, 0x0C, 0x08, 0x22, 0xA0, 0xC0, 0x26, 0x87, 0x02, 0x86, 0xA8, 0x00, 0x0C, 0x08, 0x2D, 0x08, 0xC6, 0xA6, 0x00, 0x26, 0xB7, 0xF5, 0x86, 0x7C, 0x00, 0x0C, 0x12, 0x26, 0xB7, 0x02, 0x86, 0xA0, 0x00, 0xB8, 0x33, 0xA8, 0x23, 0x72, 0xA0, 0x00, 0x10, 0x11, 0x20, 0x25, 0x91, 0xFF, 0xA0, 0x27, 0x83, 0xC6, 0x9B, 0x00, 0x0C, 0x19, 0x66, 0xB7, 0x5D, 0x78, 0x43, 0x20, 0xA9, 0x11, 0x0C, 0x08, 0x22, 0xA0, 0xC2, 0x77, 0xBA, 0x02, 0x46, 0x99, 0x00, 0xB8, 0x53, 0xA8, 0x23, 0x92, 0x61, 0x0E, 0x10, 0x11, 0x20, 0x25, 0x67, 0xFF, 0x98, 0xE1, 0x0C, 0x02, 0xA0, 0x92, 0x83, 0x86, 0x0D, 0x00, 0x0C, 0x19, 0x66, 0xB7, 0x31, 0x78, 0x43, 0x20, 0xA9, 0x11, 0x0C, 0x08, 0x22, 0xA0, 0xC2, 0x77, 0xBA, 0x02, 0x46, 0x8E, 0x00, 0x28, 0x33, 0xB8, 0x53, 0xA8, 0x23, 0x20, 0x77, 0x82, 0x99, 0xE1, 0x10, 0x11, 0x20, 0x25, 0x64, 0xFF, 0x21, 0x56, 0xFD, 0x0C, 0x08, 0x98, 0xE1, 0x89, 0x62, 0x22, 0xD2, 0x2B, 0x79, 0x22, 0xA0, 0x98, 0x83, 0x2D, 0x09, 0xC6, 0x81, 0x00, 0x91, 0x50, 0xFD, 0x0C, 0x08, 0xA2, 0x09, 0x00, 0x22, 0xA0, 0xC6, 0x87, 0x9A, 0x02, 0x46, 0x80, 0x00, 0x88, 0x23, 0x72, 0xC7, 0xF0, 0x22, 0xA0, 0xC0, 0x77, 0x98, 0x01, 0x28, 0x59, 0x0C, 0x08, 0x92, 0xA0, 0xEF, 0x46, 0x02, 0x00, 0x8A, 0xA3, 0xA2, 0x0A, 0x18, 0x1B, 0x88, 0xA0, 0x99, 0x30, 0x77, 0x28, 0xF2, 0x72, 0x03, 0x05, 0x82, 0x03, 0x04, 0x80, 0x77, 0x11, 0x80, 0x77, 0x20, 0x82, 0x03, 0x06, 0x00, 0x88, 0x11, 0x70, 0x88, 0x20, 0x72, 0x03, 0x07, 0x80, 0x77, 0x01, 0x80, 0x77, 0x20, 0x70, 0x99, 0xC0, 0x72, 0xA0, 0xC1, 0x0C, 0x08, 0x90, 0x27, 0x93, 0xC6, 0x6C, 0x00, 0x71, 0x38, 0xFD, 0x22, 0xA0, 0xC6, 0x92, 0x07, 0x00, 0x8D, 0x09, 0x16, 0x59, 0x1A, 0x98, 0x37, 0x0C, 0x08, 0x22, 0xA0, 0xC8, 0x87, 0x19, 0x02, 0x06, 0x66, 0x00, 0x28, 0x57, 0x92, 0x47, 0x00, 0x46, 0x61, 0x00, 0x1C, 0x89, 0x0C, 0x08, 0x0C, 0x12, 0x97, 0x17, 0x02, 0x06, 0x61, 0x00, 0xF8, 0x73, 0xE8, 0x63, 0xD8, 0x53, 0xC8, 0x43, 0xB8, 0x33, 0xA8, 0x23, 0x0C, 0x07, 0x81, 0xB1, 0xFE, 0xE0, 0x08, 0x00, 0x8D, 0x0A, 0xA0, 0x27, 0x83, 0x06, 0x5A, 0x00, 0x0C, 0x12, 0x26, 0x47, 0x02, 0x46, 0x55, 0x00, 0x91, 0x97, 0xFE, 0x81, 0x97, 0xFE, 0xC0, 0x20, 0x00, 0x78, 0x09, 0x40, 0x22, 0x11, 0x80, 0x77, 0x10, 0x20, 0x77, 0x20, 0xA8, 0x23, 0xC0, 0x20, 0x00, 0x79, 0x09, 0x91, 0x92, 0xFE, 0x0C, 0x0B, 0xC0, 0x20, 0x00, 0x78, 0x09, 0x80, 0x77, 0x10, 0x20, 0x77, 0x20, 0xC0, 0x20, 0x00, 0x79, 0x09, 0x91, 0x8E, 0xFE, 0xC0, 0x20, 0x00, 0x78, 0x09, 0x80, 0x77, 0x10, 0x20, 0x77, 0x20, 0xC0, 0x20, 0x00, 0x79, 0x09, 0x91, 0x8A, 0xFE, 0xC0, 0x20, 0x00, 0x78, 0x09, 0x80, 0x77, 0x10, 0x20, 0x27, 0x20, 0xC0, 0x20, 0x00, 0x29, 0x09, 0x81, 0x95, 0xFE, 0xE0, 0x08, 0x00, 0x06, 0x1F, 0x00, 0x70, 0xA0, 0x34, 0x0C, 0x08, 0x22, 0xA0, 0xC0, 0x87, 0x1A, 0x02, 0xC6, 0x3C, 0x00, 0x70, 0xB4, 0x41, 0x8B, 0x93, 0x7D, 0x0A, 0x7C, 0xFC, 0x06, 0x0E, 0x00, 0x00, 0xA8, 0x39, 0x99, 0xE1, 0xB9, 0xC1, 0xC9, 0xD1, 0x81, 0x84, 0xFE, 0xE0, 0x08, 0x00, 0x98, 0xE1, 0xB8, 0xC1, 0x28, 0x29, 0x88, 0x19, 0xA8, 0x09, 0xC8, 0xD1, 0x80, 0x82, 0x10, 0x26, 0x02, 0x0D, 0xC0, 0x20, 0x00, 0xD8, 0x0A, 0x20, 0x2C, 0x30, 0xD0, 0x22, 0x10, 0x20, 0x88, 0x20, 0xC0, 0x20, 0x00, 0x89, 0x0A, 0x1B, 0x77, 0x92, 0xC9, 0x10, 0xB7, 0x37, 0xC4, 0x46, 0x81, 0xFF, 0x66, 0x47, 0x02, 0xC6, 0x7F, 0xFF, 0x0C, 0x08, 0x22, 0xA0, 0xC0, 0x86, 0x26, 0x00, 0x0C, 0x12, 0x26, 0xB7, 0x02, 0xC6, 0x21, 0x00, 0x21, 0x68, 0xFE, 0x88, 0x53, 0x78, 0x23, 0x89, 0x02, 0x21, 0x67, 0xFE, 0x79, 0x02, 0x0C, 0x02, 0x06, 0x1D, 0x00, 0xB1, 0x63, 0xFE, 0x0C, 0x08, 0xD8, 0x0B, 0x0C, 0x1A, 0x72, 0xC7, 0xF0, 0x9D, 0x08, 0x2D, 0x08, 0xD0, 0x2A, 0x83, 0x70, 0x9A, 0x93, 0x20, 0x99, 0x10, 0x22, 0xA0, 0xC6, 0x87, 0x99, 0x60, 0xC1, 0x5D, 0xFE, 0x8D, 0x09, 0xE8, 0x0C, 0x22, 0xA0, 0xC9, 0x77, 0x3E, 0x53, 0x70, 0xF0, 0x14, 0x22, 0xA0, 0xC0, 0x56, 0xAF, 0x04, 0x2D, 0x09, 0x86, 0x02, 0x00, 0x00, 0x2A, 0x93, 0x98, 0x69, 0x4B, 0x22, 0x99, 0x08, 0x9D, 0x0A, 0x20, 0xFE, 0xC0, 0x2A, 0x8D, 0x77, 0x32, 0xED, 0x16, 0xC9, 0xD8, 0xF9, 0x0C, 0x89, 0x0B, 0x46, 0x61, 0xFF, 0x00, 0x0C, 0x12, 0x66, 0x87, 0x17, 0x21, 0x4D, 0xFE, 0x88, 0x02, 0x8C, 0x18, 0x82, 0xA0, 0xC8, 0x0C, 0x07, 0x79, 0x02, 0x21, 0x49, 0xFE, 0x79, 0x02, 0x0C, 0x12, 0x80, 0x27, 0x83, 0x0C, 0x08, 0x46, 0x01, 0x00, 0x00, 0x0C, 0x08, 0x22, 0xA0, 0xFF, 0x20, 0xA0, 0x74, 0x82, 0x61, 0x0C, 0x10, 0x11, 0x20, 0x65, 0x62, 0xFF, 0x88, 0xC1, 0x80, 0xA0, 0x74, 0x10, 0x11, 0x20, 0xA5, 0x61, 0xFF, 0x10, 0x11, 0x20, 0x65, 0x60, 0xFF, 0x56, 0x02, 0xB5, 0x22, 0x03, 0x01, 0x1C, 0x27, 0x27, 0x37, 0x1E, 0xF6, 0x32, 0x02, 0x86, 0xD0, 0xFE, 0x22, 0xC2, 0xFD, 0x20, 0x20, 0x74, 0x0C, 0xF7, 0x27, 0xB7, 0x02, 0x06, 0xCD, 0xFE, 0x71, 0x36, 0xFE, 0x70, 0x22, 0xA0, 0x28, 0x02, 0xA0, 0x02, 0x00, 0x72, 0xA0, 0xD2, 0x77, 0x12, 0x5F, 0x72, 0xA0, 0xD4, 0x77, 0x92, 0x02, 0x06, 0x21, 0x00, 0xC6, 0xC5, 0xFE, 0x00, 0x00, 0x78, 0x33, 0x38, 0x23, 0x10, 0x11, 0x20, 0x25, 0x4F, 0xFF, 0x8D, 0x0A, 0x56, 0x6A, 0xB0, 0xA2, 0xA2, 0x71, 0xC0, 0xAA, 0x11, 0x89, 0xC1, 0x81, 0x30, 0xFE, 0xE0, 0x08, 0x00, 0x21, 0x28, 0xFE, 0x91, 0x29, 0xFE, 0xC0, 0x20, 0x00, 0x28, 0x02, 0x88, 0xC1, 0x20, 0xB4, 0x35, 0xC0, 0x22, 0x11, 0x90, 0x22, 0x10, 0x20, 0xBB, 0x20, 0x70, 0xBB, 0x82, 0xAD, 0x08, 0x30, 0xBB, 0xC2, 0x81, 0x36, 0xFE, 0xE0, 0x08, 0x00, 0xA2, 0xA3, 0xE8, 0x81, 0x24, 0xFE, 0xE0, 0x08, 0x00, 0x46, 0xB1, 0xFE, 0x00, 0x00, 0xD8, 0x53, 0xC8, 0x43, 0xB8, 0x33, 0xA8, 0x23, 0x10, 0x11, 0x20, 0x65, 0x6C, 0xFF, 0x86, 0xAC, 0xFE, 0xB2, 0x03, 0x03, 0x22, 0x03, 0x02, 0x80, 0xBB, 0x11, 0x20, 0xBB, 0x20, 0xB2, 0xCB, 0xF0, 0xA2, 0xC3, 0x18, 0x10, 0x11, 0x20, 0xE5, 0x37, 0xFF, 0xC6, 0xA5, 0xFE, 0x00, 0x00, 0x22, 0x03, 0x03, 0x72, 0x03, 0x02, 0x80, 0x22, 0x11, 0x70, 0x22, 0x20, 0x81, 0x24, 0xFE, 0xE0, 0x08, 0x00, 0x71, 0x90, 0xFC, 0x22, 0xC2, 0xF0, 0x88, 0x37, 0x80, 0x22, 0x63, 0x16, 0x52, 0xA7, 0x88, 0x17, 0x8A, 0x82, 0x80, 0x8C, 0x41, 0x86, 0x02, 0x00, 0x89, 0xC1, 0x10, 0x11, 0x20, 0x25, 0x23, 0xFF, 0x82, 0x21, 0x0C, 0x92, 0x27, 0x04, 0xA6, 0x19, 0x04, 0x98, 0x27, 0x97, 0xA8, 0xE9, 0x10, 0x11, 0x20, 0x25, 0x1B, 0xFF, 0x16, 0x6A, 0xFF, 0xA8, 0x17, 0xCD, 0x02, 0xB2, 0xC3, 0x18, 0x81, 0x14, 0xFE, 0xE0, 0x08, 0x00, 0x8C, 0x3A, 0x32, 0xA0, 0xC4, 0x39, 0x57, 0x38, 0x17, 0x2A, 0x33, 0x39, 0x17, 0x38, 0x37, 0x20, 0x23, 0xC0, 0x29, 0x37, 0x81, 0x0E, 0xFE, 0xE0, 0x08, 0x00, 0x86, 0x88, 0xFE, 0x00, 0x00, 0x22, 0x03, 0x03, 0x82, 0x03, 0x02, 0x72, 0xC3, 0x18, 0x80, 0x22, 0x11, 0x38, 0x35, 0x80, 0x22, 0x20, 0x22, 0xC2, 0xF0, 0x56, 0xC3, 0x09, 0xF6, 0x52, 0x02, 0x86, 0x25, 0x00, 0x22, 0xA0, 0xC9, 0x46, 0x2A, 0x00, 0x31, 0xEC, 0xFD, 0x81, 0x6E, 0xFC, 0xE8, 0x03, 0x29, 0x91, 0xE0, 0x88, 0xC0, 0x89, 0x41, 0x88, 0x26, 0xAD, 0x09, 0x87, 0xB2, 0x01, 0x0C, 0x3A, 0x99, 0xE1, 0xA9, 0xD1, 0xE9, 0xC1, 0x10, 0x11, 0x20, 0x65, 0x1A, 0xFF, 0xA8, 0xD1, 0x81, 0xE3, 0xFD, 0xE8, 0xC1, 0xA9, 0x01, 0xA1, 0xE2, 0xFD, 0xDD, 0x08, 0xBD, 0x07, 0xC2, 0xC1, 0x24, 0xF2, 0xC1, 0x10, 0x89, 0xC1, 0x81, 0xF5, 0xFD, 0xE0, 0x08, 0x00, 0xB8, 0x26, 0xCD, 0x0A, 0xA8, 0x91, 0x98, 0xE1, 0xA0, 0xBB, 0xC0, 0xB9, 0x26, 0xA0, 0x22, 0xC0, 0xB8, 0x03, 0xAA, 0x77, 0xA8, 0x41, 0x88, 0xC1, 0xAA, 0xBB, 0x0C, 0x0A, 0xB9, 0x03, 0xC0, 0xA9, 0x83, 0x80, 0xBB, 0xC0, 0xA0, 0xD0, 0x74, 0xCC, 0x9A, 0xE2, 0xDB, 0x80, 0xAD, 0x0D, 0xE0, 0xA9, 0x83, 0x16, 0xEA, 0x01, 0xAD, 0x08, 0x89, 0xC1, 0x99, 0xE1, 0xC9, 0xD1, 0x10, 0x11, 0x20, 0xE5, 0x25, 0xFF, 0x88, 0xC1, 0x98, 0xE1, 0xC8, 0xD1, 0x89, 0x03, 0x46, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x1C, 0x9D, 0x0C, 0x8C, 0xB2, 0x38, 0x35, 0x8C, 0x73, 0xC0, 0x3F, 0x31, 0xC0, 0x33, 0xC0, 0x96, 0xB3, 0xF5, 0xD6, 0x8C, 0x00, 0x22, 0xA0, 0xC7, 0x29, 0x55, 0x86, 0x53, 0xFE, 0x00, 0x56, 0xAC, 0x94, 0x28, 0x35, 0x16, 0x52, 0x94, 0x22, 0xA0, 0xC8, 0xC6, 0xFA, 0xFF, 0x28, 0x23, 0x56, 0xA2, 0x93, 0x10, 0x11, 0x20, 0x25, 0x4C, 0xFF, 0xA2, 0xA2, 0x71, 0xC0, 0xAA, 0x11, 0x81, 0xBC, 0xFD, 0xE0, 0x08, 0x00, 0x10, 0x11, 0x20, 0x25, 0x33, 0xFF, 0x81, 0xCE, 0xFD, 0xE0, 0x08, 0x00, 0x46, 0x46, 0xFE, 0x00, 0x28, 0x33, 0x16, 0x32, 0x91, 0x10, 0x11, 0x20, 0xA5, 0x49, 0xFF, 0xA2, 0xA3, 0xE8, 0x81, 0xB3, 0xFD, 0xE0, 0x08, 0x00, 0x10, 0x11, 0x20, 0xE5, 0x30, 0xFF, 0xE0, 0x02, 0x00, 0x06, 0x3E, 0xFE, 0x00, 0x10, 0x11, 0x20, 0x25, 0x30, 0xFF, 0x1D, 0xF0, 0x00, 0x00, 0x36, 0x41, 0x00, 0x9D, 0x02, 0x82, 0xA0, 0xC0, 0x28, 0x03, 0x87, 0x99, 0x0F, 0xCC, 0x32, 0x0C, 0x12, 0x86, 0x07, 0x00, 0x0C, 0x02, 0x29, 0x03, 0x7C, 0xE2, 0x86, 0x0F, 0x00, 0x26, 0x12, 0x07, 0x26, 0x22, 0x18, 0x86, 0x03, 0x00, 0x00, 0x00, 0x82, 0xA0, 0xDB, 0x80, 0x29, 0x23, 0x87, 0x99, 0x2A, 0x0C, 0x22, 0x29, 0x03, 0x7C, 0xF2, 0x46, 0x08, 0x00, 0x00, 0x00, 0x22, 0xA0, 0xDC, 0x27, 0x99, 0x0A, 0x0C, 0x12, 0x29, 0x03, 0x2D, 0x08, 0x06, 0x04, 0x00, 0x00, 0x00, 0x82, 0xA0, 0xDD, 0x7C, 0xF2, 0x87, 0x99, 0x06, 0x0C, 0x12, 0x29, 0x03, 0x22, 0xA0, 0xDB, 0x1D, 0xF0, 0x00, 0x00
+        0x28, 0xCF, 0x65, 0x52, 0x7F, 0x50, 0x1B, 0xD7, 0x9D, 0x7F, 0xBB, 0x12, 0x62, 0x25, 0x9E, 0x63, 0x89, 0xA3, 0x80, 0xF9, 0x71, 0xB7, 0x5A, 0x6C, 0x90, 0xC0, 0x6E, 0x04, 0xD8, 0x06, 0xFB, 0x3C, 0x65, 0x49, 0x3C, 0x02, 0x9A, 0x74, 0xEA, 0xE0, 0x58, 0xC5, 0x9E, 0x74, 0x0E, 0x70, 0x4C, 0x93, 0x9C, 0xEF, 0x06, 0x08, 0x3D, 0xD9, 0x1D, 0xD2, 0xDB, 0x15, 0xAE, 0xB4, 0x72, 0xE5, 0x16, 0x44, 0xAE, 0x96, 0xB0, 0x7D, 0xB7, 0x6C, 0x6C, 0x57, 0x76, 0x42, 0x63, 0x88, 0x13, 0xE3, 0x10, 0xCF, 0x48, 0x38, 0x51, 0x71, 0x0B, 0x1D, 0x93, 0xE9, 0x5D, 0xB9, 0x71, 0x7C, 0x63, 0xE8, 0x39, 0xA1, 0x2E, 0x4E, 0x30, 0xFE, 0x85, 0x31, 0xDA, 0x77, 0xEF, 0xAD, 0x48, 0x2E, 0x77, 0xFD, 0xE3, 0xED, 0xDB, 0xF7, 0xFD, 0xF1, 0xF9, 0xFE, 0xF8, 0x7C, 0x18, 0x00, 0x1A, 0xF3, 0xF0, 0xA9, 0x05, 0x89, 0x2A, 0x33, 0xBE, 0x37, 0x57, 0x03, 0xEB, 0x63, 0x14, 0x65, 0x41, 0x25, 0x5D, 0xBD, 0x44, 0x6E, 0x9B, 0x9E, 0x65, 0x5F, 0x3F, 0x3E, 0x53, 0xBD, 0x88, 0x9C, 0x7A, 0x00, 0x2B, 0x1D, 0x12, 0x85, 0x8D, 0x11, 0x46, 0xD2, 0xCB, 0x72, 0xC7, 0x0D, 0x06, 0xA4, 0x71, 0x2D, 0xF4, 0xAC, 0xF7, 0x1E, 0xB2, 0xDE, 0x21, 0xC1, 0x5B, 0xE8, 0xFC, 0x79, 0x00, 0xE6, 0x4A, 0xD4, 0xAA, 0x17, 0xDF, 0x4C, 0x54, 0x1D, 0x12, 0x00, 0xE0, 0x79, 0x00, 0x4E, 0xFE, 0x39, 0x51, 0x35, 0x8F, 0x6D, 0x18, 0x7B, 0xF0, 0x11, 0x62, 0xE5, 0x0E, 0xB3, 0x85, 0x5D, 0xC7, 0x50, 0xBF, 0xC8, 0x31, 0x88, 0x0F, 0x50, 0xB0, 0x9F, 0xEA, 0x0E, 0x5B, 0xFA, 0x42, 0x38, 0x7B, 0xD8, 0xD8, 0x73, 0x17, 0x61, 0xD8, 0x3E, 0x09, 0x3F, 0x82, 0xD9, 0xA0, 0xBB, 0xFB, 0x5E, 0xEE, 0x95, 0x68, 0xF4, 0x1E, 0x7E, 0x8D, 0x36, 0x80, 0xBE, 0x63, 0xF8, 0x56, 0xEA, 0x40, 0xD2, 0x27, 0xDE, 0x42, 0xD8, 0x2D, 0x08, 0xF7, 0x7C, 0xE1, 0x1A, 0xF1, 0xE6, 0xD7, 0x51, 0xC6, 0x8C, 0xFD, 0x37, 0xD1, 0xE0, 0x1F, 0x91, 0xEF, 0x78, 0x56, 0x9C, 0x02, 0x9D, 0xB3, 0xBE, 0x9C, 0xFF, 0x8A, 0x33, 0x24, 0xCB, 0x6F, 0xC2, 0x9F, 0x8B, 0x46, 0x27, 0x4D, 0x1E, 0x17, 0xC9, 0xC3, 0x6F, 0xEC, 0xF9, 0x03, 0xEA, 0x93, 0xA0, 0x91, 0x60, 0x36, 0x00, 0xD2, 0xFB, 0xF3, 0x2C, 0x5F, 0xF5, 0xBC, 0x83, 0x27, 0xBD, 0xF6, 0x24, 0xC8, 0x48, 0x92, 0x51, 0x10, 0xD6, 0xBA, 0x6A, 0x51, 0xCF, 0xD2, 0xD7, 0x5F, 0x24, 0x14, 0xAC, 0xC7, 0xB1, 0x80, 0x1C, 0x00, 0x18, 0x1C, 0x8F, 0xA7, 0x3A, 0xB5, 0x8C, 0xAC, 0x4B, 0x08, 0x32, 0x38, 0xD2, 0xD3, 0x0C, 0x70, 0x8A, 0xB8, 0x48, 0xB2, 0x82, 0x2F, 0x91, 0x92, 0x21, 0xC6, 0x75, 0x50, 0xC3, 0xA0, 0x3B, 0x17, 0x04, 0xCE, 0xC1, 0xB2, 0x7A, 0x0D, 0x05, 0xF0, 0xC9, 0xDC, 0x9B, 0x8F, 0x51, 0xE6, 0x2B, 0x48, 0x9C, 0x43, 0x3D, 0x8F, 0xFF, 0x5F, 0x0E, 0x09, 0x6B, 0x10, 0x12, 0x55, 0x08, 0x21, 0xA0, 0x67, 0xB5, 0xDE, 0xAC, 0xCB, 0xA8, 0xF2, 0xA9, 0xCC, 0x2E, 0x03, 0xCE, 0xDB, 0xB7, 0x88, 0x32, 0x97, 0x52, 0xE0, 0x22, 0xD4, 0x57, 0x44, 0x56, 0x85, 0x38, 0x21, 0x6C, 0xF6, 0xC8, 0x54, 0x77, 0x6D, 0x17, 0xCF, 0x6B, 0x7B, 0x5E, 0x42, 0xE4, 0x7B, 0x17, 0x49, 0x1C, 0xCC, 0xE5, 0x43, 0x96, 0xEE, 0x37, 0xA9, 0xF1, 0x0C, 0xE1, 0x4D, 0x6A, 0xF0, 0x36, 0x3A, 0x17, 0x36, 0x0F, 0xCE, 0x69, 0xA5, 0xFE, 0x1E, 0xF4, 0xFC, 0x8E, 0xFC, 0x28, 0x2F, 0x93, 0x9A, 0x11, 0xA3, 0xEB, 0x47, 0x28, 0xCF, 0x08, 0x73, 0xF8, 0xBE, 0xAE, 0xEE, 0xF2, 0x68, 0x9F, 0xB4, 0xE5, 0x29, 0x3F, 0x47, 0x7A, 0x68, 0x9D, 0x59, 0xAA, 0x62, 0x70, 0xFD, 0x43, 0xCD, 0x14, 0x7F, 0x12, 0x9F, 0xCD, 0x4D, 0xA4, 0xEF, 0x7D, 0xB7, 0x51, 0xE9, 0x23, 0x74, 0x89, 0x1A, 0xD0, 0x89, 0x4B, 0x08, 0x2B, 0xE2, 0x3B, 0x26, 0x98, 0x3E, 0x77, 0x4B, 0xA2, 0x82, 0x0A, 0xE8, 0x96, 0xCC, 0x7E, 0x8A, 0x8C, 0x76, 0x07, 0xF5, 0x2C, 0x20, 0x59, 0xA1, 0xB4, 0x0D, 0xCA, 0x12, 0xAB, 0xED, 0x7E, 0x98, 0xA4, 0x7C, 0x4E, 0x52, 0xE4, 0xB5, 0x5D, 0x04, 0x1F, 0xAD, 0x06, 0x00, 0xCF, 0x26, 0x7E, 0x84, 0xE0, 0x9A, 0x60, 0x2D, 0x70, 0x1C, 0xAF, 0x0E, 0xDB, 0xF0, 0x32, 0xB6, 0x64, 0xDB, 0x2B, 0x1D, 0x8E, 0xF3, 0x7D, 0x5C, 0x71, 0xB9, 0x63, 0x5B, 0x35, 0xA4, 0xED, 0x0D, 0x5B, 0x6A, 0xC9, 0x4C, 0x8B, 0x68, 0x83, 0x29, 0x90, 0xC3, 0xC9, 0x1F, 0x91, 0xDC, 0xF1, 0x36, 0x8A, 0xEC, 0xB1, 0xFA, 0x3D, 0xD4, 0xB0, 0x71, 0x47, 0xF9, 0xDE, 0xCC, 0xBD, 0xFA, 0x86, 0x8C, 0x3D, 0x3B, 0x77, 0xBC, 0x50, 0xED, 0xA4, 0xB4, 0xE5, 0xCE, 0x21, 0x69, 0xFB, 0xE9, 0x6C, 0xBD, 0xB4, 0xD6, 0x77, 0xEA, 0x0B, 0x92, 0x7C, 0x93, 0x2C, 0x3B, 0x92, 0x31, 0xA1, 0xBB, 0x44, 0x8B, 0x77, 0xB4, 0x1E, 0xE4, 0x8E, 0xC0, 0xB7, 0xEB, 0xE5, 0x0F, 0xEB, 0x5F, 0x4C, 0x69, 0xC8, 0xD8, 0xBA, 0x6B, 0x77, 0x46, 0xC3, 0x46, 0xC7, 0xAE, 0xE8, 0xEE, 0x8D, 0x18, 0x7C, 0x71, 0x19, 0x55, 0x6D, 0x07, 0x89, 0xAA, 0x67, 0xF1, 0x01, 0x65, 0x14, 0x3F, 0x57, 0x4A, 0xF1, 0x8E, 0x72, 0x6D, 0xFE, 0xCE, 0xB1, 0x01, 0xDA, 0xD7, 0xBB, 0xA1, 0xF4, 0x21, 0x8A, 0xA7, 0x80, 0x88, 0x0E, 0xE6, 0x99, 0x07, 0x59, 0xF1, 0x21, 0xC1, 0x13, 0x4B, 0x90, 0x42, 0x01, 0x89, 0xC1, 0xBF, 0x11, 0x9D, 0x78, 0x97, 0x98, 0x3E, 0xCD, 0xF9, 0x24, 0x6E, 0xC2, 0x84, 0xB7, 0xE8, 0x0A, 0xA1, 0x6E, 0x82, 0x82, 0x25, 0x65, 0x4D, 0x20, 0xB9, 0x80, 0x10, 0x25, 0xCE, 0xA2, 0x8A, 0xF0, 0xAA, 0x08, 0xD3, 0x92, 0xC3, 0x94, 0x7E, 0xAA, 0x71, 0xF1, 0x34, 0x08, 0x33, 0xF9, 0xF3, 0x3C, 0xA9, 0x89, 0x4F, 0xA0, 0x54, 0x9B, 0x0F, 0xF3, 0x2E, 0x7E, 0x82, 0xC6, 0xE8, 0x08, 0x33, 0x88, 0xC5, 0xF5, 0x98, 0xE4, 0x42, 0xC6, 0x4F, 0xE7, 0xCF, 0x37, 0x3E, 0xA9, 0xF9, 0x45, 0x95, 0x98, 0x3C, 0xA6, 0x6C, 0x68, 0xF4, 0x8C, 0xA9, 0x30, 0x5D, 0xB0, 0xF7, 0xE6, 0xCF, 0x2F, 0x96, 0xA8, 0x55, 0xF7, 0xF0, 0xC9, 0x06, 0xCF, 0x56, 0x05, 0xF0, 0x41, 0x77, 0x11, 0x5A, 0xD1, 0xDC, 0x32, 0xCA, 0xDC, 0xA3, 0xEF, 0x5F, 0x44, 0x92, 0xE9, 0x83, 0x29, 0xDC, 0x77, 0x88, 0xF9, 0xE0, 0xE5, 0xC1, 0x07, 0xA8, 0x73, 0x9C, 0x10, 0x95, 0xD6, 0xDD, 0x9D, 0x11, 0x95, 0xCC, 0xDD, 0x49, 0xBA, 0xD2, 0x24, 0xD3, 0xE0, 0x1D, 0x04, 0xB7, 0x36, 0x9E, 0xB5, 0x10, 0x5D, 0xA6, 0xC9, 0x92, 0xB9, 0xFF, 0x73, 0x24, 0x87, 0xBF, 0xF2, 0xE7, 0xCF, 0xDB, 0x4A, 0xA8, 0x15, 0x2D, 0xEF, 0x7B, 0x88, 0x3E, 0xC8, 0xE9, 0x99, 0x44, 0x92, 0x31, 0x37, 0x72, 0xC6, 0xD8, 0x73, 0x15, 0x41, 0xD3, 0xE1, 0x30, 0x57, 0x07, 0x3C, 0x63, 0x31, 0xB8, 0x46, 0x38, 0xD3, 0x25, 0x0B, 0x1D, 0xE3, 0x87, 0x95, 0xB7, 0xF9, 0xB3, 0x1C, 0x1B, 0xEA, 0x0D, 0x3C, 0x22, 0x84, 0x2C, 0xA0, 0x38, 0x05, 0x06, 0x68, 0xF1, 0x0B, 0x32, 0x40, 0xFE, 0x3C, 0xC6, 0x51, 0xE4, 0x28, 0x69, 0x71, 0x09, 0x11, 0x7E, 0xF1, 0xDB, 0x23, 0x47, 0xF1, 0xB2, 0x83, 0x16, 0x45, 0xBE, 0x46, 0x4A, 0x3C, 0x42, 0x8A, 0xFC, 0x89, 0x53, 0x8F, 0xF7, 0x89, 0x3D, 0xD7, 0x7C, 0x41, 0x26, 0xA9, 0x09, 0x45, 0xBE, 0x8E, 0x7F, 0x4E, 0x3D, 0x44, 0x1A, 0xC6, 0xD6, 0xB2, 0x38, 0x0D, 0x14, 0x1A, 0x70, 0xA3, 0x44, 0x87, 0xA7, 0x1E, 0xA3, 0x8A, 0xE0, 0x3C, 0x81, 0x03, 0xFB, 0xEB, 0x01, 0x1F, 0x68, 0xA7, 0xF8, 0x00, 0xBE, 0xE1, 0x4E, 0xC0, 0x6F, 0xB6, 0x5A, 0x95, 0x49, 0x73, 0x52, 0xC1, 0xCE, 0x34, 0x1C, 0x00, 0x33, 0xF8, 0xED, 0x16, 0xFE, 0xE9, 0xBD, 0x13, 0x7A, 0x2C, 0x6D, 0x5A, 0xBC, 0xBF, 0xA2, 0x91, 0xE5, 0x3D, 0x13, 0x7A, 0xCC, 0x31, 0x89, 0xD5, 0x64, 0xF3, 0x6D, 0x8E, 0x2F, 0x8F, 0xBA, 0x74, 0x09, 0x4E, 0x49, 0x33, 0x73, 0xE7, 0x58, 0x85, 0x1D, 0xC2, 0x9E, 0x39, 0xE2, 0x19, 0xA0, 0xF3, 0xD2, 0x92, 0x9D, 0x6C, 0xD0, 0x79, 0x01, 0xE0, 0xE4, 0xBD, 0xA4, 0x30, 0xFF, 0xD5, 0x8E, 0xB0, 0x04, 0x03, 0xEF, 0x8B, 0x12, 0x92, 0x98, 0x80, 0x26, 0xE7, 0x19, 0xBC, 0x24, 0x71, 0x31, 0x39, 0x3D, 0x00, 0x87, 0xB0, 0xCE, 0xCE, 0xDF, 0x01, 0x7C, 0x37, 0xBE, 0xA3, 0xF8, 0x5E, 0xE1, 0x6B, 0x1A, 0xBD, 0xD5, 0x57, 0xFA, 0x02, 0x0A, 0xCC, 0x60, 0x4D, 0x69, 0x32, 0x53, 0x14, 0x10, 0x37, 0xE0, 0x76, 0xF1, 0x2D, 0xDE, 0x43, 0x5F, 0x13, 0x9B, 0x33, 0x05, 0x5B, 0xD7, 0x9B, 0x02, 0x1E, 0x71, 0x9E, 0x3C, 0xBD, 0x14, 0x00, 0xC9, 0xBE, 0xF2, 0xE7, 0xE7, 0xB5, 0x1E, 0xAC, 0xCD, 0xFD, 0xA9, 0xD1, 0x16, 0x4B, 0x4E, 0xCB, 0x6E, 0x03, 0x4C, 0x69, 0x9E, 0x34, 0x0F, 0xA4, 0xD4, 0xB7, 0xE4, 0x24, 0x17, 0x0B, 0xB3, 0x79, 0xC9, 0x52, 0x33, 0x4C, 0x3B, 0xB7, 0x83, 0x01, 0x83, 0xF8, 0xAE, 0x96, 0x5F, 0x0E, 0x40, 0xF0, 0x64, 0xFE, 0x8E, 0x57, 0xA3, 0x37, 0xC2, 0x96, 0x9C, 0x30, 0xEF, 0xDE, 0xEB, 0x37, 0x4E, 0xA4, 0x5E, 0xA2, 0xF0, 0xC4, 0xE2, 0xAF, 0x48, 0x00, 0x76, 0x6A, 0x1E, 0xBC, 0x23, 0xC9, 0x18, 0x38, 0x0C, 0x19, 0x4F, 0x4B, 0xE6, 0x6B, 0x8C, 0xF7, 0x1B, 0x5F, 0x39, 0xFC, 0x46, 0xB2, 0x8D, 0x19, 0x74, 0x29, 0x75, 0x80, 0x70, 0xB1, 0xEE, 0x53, 0x44, 0xDE, 0xD3, 0x68, 0x22, 0x15, 0xEF, 0xB3, 0xF1, 0x34, 0x2B, 0x9E, 0xF8, 0x3A, 0x8C, 0x64, 0x6C, 0xE5, 0x84, 0xD6, 0x5D, 0x42, 0xC5, 0xBB, 0xE7, 0x83, 0xB8, 0x4F, 0x62, 0x0A, 0x19, 0x85, 0x1F, 0x46, 0x8F, 0x5E, 0xA0, 0x9D, 0xD7, 0x91, 0xF7, 0x33, 0x84, 0x0B, 0x38, 0xF7, 0x2B, 0x27, 0x73, 0xCD, 0x67, 0x65, 0x71, 0x9C, 0x64, 0xBA, 0x4C, 0x68, 0x48, 0x49, 0x53, 0x0C, 0xFB, 0xCD, 0x23, 0xE7, 0x08, 0xBE, 0x02, 0x1E, 0xDE, 0x4A, 0x7F, 0x50, 0xB3, 0x7A, 0x48, 0x59, 0x85, 0x2D, 0x3F, 0x1A, 0x51, 0x9E, 0x01, 0xB9, 0x6E, 0xEF, 0x1D, 0xD4, 0xF9, 0xE7, 0x0B, 0x7D, 0xB1, 0x96, 0x1A, 0xC6, 0x53, 0x98, 0x53, 0x31, 0x4C, 0xFB, 0xDE, 0x3D, 0x9E, 0xA4, 0xAE, 0xF1, 0x3D, 0x16, 0xD3, 0xFC, 0x1A, 0x41, 0x22, 0xD9, 0x53, 0xE8, 0x4B, 0xFE, 0xAE, 0x91, 0x3E, 0xD7, 0xFD, 0x01, 0x41, 0xB2, 0x9C, 0x53, 0x9F, 0x69, 0x6A, 0x4C, 0x54, 0x7D, 0xB7, 0xB6, 0xBA, 0x6E, 0xB9, 0x44, 0xAD, 0xDA, 0x2F, 0xD0, 0x7C, 0xED, 0x36, 0x8A, 0xDF, 0xD6, 0x45, 0xF3, 0x0C, 0x60, 0x1A, 0xCD, 0xF8, 0x0D, 0x01, 0x68, 0xAC, 0xE4, 0xF9, 0x2A, 0x84, 0x00, 0xB0, 0x89, 0x7C, 0x55, 0x40, 0x00, 0xC0, 0xCC, 0x13, 0x3A, 0xD4, 0x2A, 0x33, 0x3E, 0x9D, 0xDD, 0xD8, 0xF7, 0x73, 0x84, 0x04, 0x7C, 0x1F, 0xC2, 0xE7, 0x00, 0x3E, 0x3B, 0x30, 0xE6, 0xF3, 0xF8, 0xBC, 0x80, 0xFD, 0x19, 0x38, 0x7F, 0x1E, 0x27, 0x13, 0xFC, 0x06, 0x6C, 0x6B, 0x15, 0xB0, 0x7D, 0x01, 0xF0, 0xD2, 0x14, 0xE0, 0xAF, 0x62, 0x2D, 0x9C, 0xC4, 0xE7, 0xF7, 0x58, 0x17, 0x0D, 0xF8, 0xC8, 0xFF, 0x0D, 0x78, 0x7D, 0x2B, 0xC5, 0x83, 0x1F, 0x52, 0xBC, 0x50, 0x47, 0xF1, 0xB3, 0x9B, 0x28, 0x7E, 0xEE, 0x6F, 0xF1, 0x3F, 0xA0, 0xF8, 0x10, 0x8B, 0xFF, 0xB1, 0x6F, 0x7F, 0x1B, 0xC5, 0x43, 0x7C, 0x0E, 0xD9, 0x29, 0xFE, 0xC0, 0x3F, 0x51, 0xFC, 0x0D, 0x37, 0xC5, 0xBF, 0x8E, 0x6F, 0xE0, 0x00, 0xFC, 0x4B, 0x38, 0x6E, 0x73, 0x0C, 0x58, 0xC7, 0xB1, 0xFA, 0xEC, 0xFD, 0xE2, 0xA7, 0x2B, 0xF3, 0xEF, 0x1B, 0x41, 0x99, 0xB7, 0xF4, 0xA5, 0x77, 0xD5, 0xEA, 0x05, 0x35, 0xCA, 0x02, 0x9B, 0xEE, 0xB9, 0x05, 0xD5, 0xAE, 0x27, 0x7F, 0x29, 0x4D, 0x73, 0xAA, 0x22, 0xBF, 0x68, 0x37, 0x34, 0x7D, 0xAE, 0x36, 0x72, 0xE6, 0xE6, 0x93, 0xA0, 0x91, 0x63, 0xB1, 0xC3, 0x9E, 0x22, 0x4E, 0x91, 0xE4, 0x5A, 0x7D, 0xE7, 0x28, 0xCF, 0x99, 0xE1, 0x5A, 0x3E, 0x69, 0xD6, 0x61, 0xE5, 0xD5, 0xD1, 0xCF, 0x70, 0x71, 0x0A, 0x58, 0x87, 0x50, 0xE9, 0x3B, 0x08, 0xEA, 0x2B, 0xCA, 0x6E, 0x13, 0x2D, 0xC7, 0x10, 0x7C, 0x46, 0x89, 0xD9, 0x48, 0xB5, 0x8F, 0x10, 0xD7, 0x4F, 0x44, 0x71, 0x2A, 0x8A, 0xAA, 0xEF, 0x24, 0xBA, 0x39, 0x4B, 0xF1, 0x5A, 0x9C, 0x5B, 0x47, 0x97, 0x46, 0x90, 0xF5, 0x3F, 0x13, 0x65, 0xCD, 0x1A, 0x25, 0x43, 0x28, 0x73, 0xAB, 0xC1, 0x7A, 0x42, 0x8D, 0x9D, 0x50, 0x23, 0x34, 0x2C, 0x11, 0xFF, 0x4D, 0xC5, 0xE5, 0xE0, 0xF1, 0x6D, 0x69, 0xD0, 0x24, 0xBE, 0x4F, 0x4A, 0x0F, 0xFE, 0x2B, 0x82, 0x10, 0xF6, 0x89, 0xC3, 0xE4, 0xA1, 0x28, 0x40, 0x2C, 0xD3, 0xAC, 0x61, 0x14, 0xA1, 0xEB, 0x65, 0x4A, 0x7C, 0x87, 0xBC, 0x22, 0xB4, 0x68, 0x5F, 0xB9, 0xCF, 0x91, 0xBB, 0xB4, 0x17, 0x69, 0xF3, 0xED, 0x58, 0xE9, 0xD6, 0x60, 0x02, 0x60, 0xF0, 0xE7, 0x68, 0xC2, 0x04, 0xF7, 0x88, 0xA7, 0xB5, 0x80, 0x00, 0xAA, 0xEF, 0xA7, 0xB4, 0x98, 0xF5, 0xA6, 0x2F, 0xA3, 0xC4, 0x5C, 0xE2, 0x12, 0xFB, 0xC9, 0xD7, 0xFA, 0x13, 0x0D, 0x81, 0x1E, 0x7F, 0x3F, 0xEF, 0xB2, 0x83, 0x33, 0x73, 0xA3, 0x8B, 0xF0, 0xAF, 0xD8, 0x37, 0xBA, 0x60, 0x9A, 0xD8, 0x47, 0xDC, 0x77, 0x7E, 0x8C, 0x60, 0x3E, 0xCC, 0x1B, 0x92, 0xA9, 0x99, 0x7E, 0xC0, 0x5F, 0xB7, 0x80, 0x71, 0x8B, 0x30, 0x42, 0x29, 0x32, 0x10, 0x7B, 0xB5, 0xEC, 0x83, 0xE8, 0x39, 0xA3, 0x5A, 0xBC, 0xBD, 0xF9, 0xDF, 0x4B, 0xE2, 0x99, 0x58, 0x22, 0x00, 0x63, 0x95, 0xA5, 0x02, 0x87, 0xA3, 0x23, 0xF3, 0xAE, 0x1E, 0xCF, 0x80, 0x9F, 0x5C, 0x0D, 0x10, 0x13, 0xAA, 0x36, 0x52, 0x5B, 0xF4, 0xAC, 0x45, 0xFC, 0xB1, 0x56, 0xFB, 0x27, 0xE4, 0xDB, 0xF6, 0x12, 0xEA, 0x9C, 0xC5, 0x21, 0x95, 0xA9, 0xCA, 0xDB, 0x48, 0x28, 0x37, 0x9B, 0xCF, 0x92, 0x4E, 0xB7, 0xA4, 0xAE, 0xC4, 0x68, 0xDF, 0x2F, 0x55, 0xDD, 0xB6, 0x43, 0x63, 0x52, 0x9F, 0x39, 0xF4, 0x08, 0xA6, 0x92, 0x1C, 0x3D, 0x4C, 0xC7, 0xD7, 0x41, 0x3D, 0x57, 0x9D, 0xC7, 0xE9, 0x28, 0x68, 0x3B, 0x28, 0x72, 0xD5, 0xF9, 0x9E, 0xE7, 0x56, 0xE7, 0x55, 0xB8, 0xD3, 0x0B, 0xF2, 0x6A, 0xDC, 0xE9, 0x6B, 0x5B, 0x82, 0x85, 0x9C, 0x4E, 0xD7, 0xAE, 0xA3, 0x05, 0xCE, 0xD2, 0xCA, 0xB1, 0x2D, 0x4F, 0x65, 0xD9, 0x0A, 0xB4, 0x59, 0xED, 0x62, 0x9C, 0x06, 0x20, 0x8F, 0xF3, 0xE2, 0x86, 0xE1, 0x28, 0xF7, 0xDC, 0x6A, 0xC2, 0xE7, 0x49, 0x34, 0x24, 0x33, 0x4A, 0x2C, 0x8F, 0x10, 0x1A, 0x41, 0xED, 0x3A, 0x1D, 0x87, 0x13, 0xDD, 0x16, 0xD6, 0xCD, 0x5A, 0x79, 0xC4, 0xB2, 0xF7, 0xDC, 0x43, 0x39, 0x8A, 0x1C, 0x25, 0x4C, 0xBE, 0x81, 0x14, 0xF9, 0x73, 0x42, 0xB7, 0x82, 0x48, 0x70, 0x3F, 0x32, 0x4C, 0x21, 0xDC, 0x42, 0x5E, 0x6D, 0x51, 0x65, 0xC5, 0x03, 0x2E, 0xD7, 0xF0, 0x10, 0x70, 0xA3, 0x4F, 0xB2, 0x6C, 0xC7, 0x7B, 0x4F, 0xD1, 0xCE, 0x42, 0x42, 0xA3, 0xC0, 0xC9, 0x36, 0x5A, 0xC6, 0x25, 0xB1, 0x43, 0xC5, 0x8E, 0x3C, 0x5B, 0xD1, 0x30, 0xED, 0xBC, 0x0D, 0xC4, 0xF5, 0x5F, 0xB9, 0x3C, 0xA3, 0x0E, 0x41, 0xE8, 0x78, 0xAF, 0xE1, 0x43, 0xEF, 0x67, 0x60, 0x7D, 0x1D, 0x64, 0x38, 0x39, 0x7A, 0x34, 0x8B, 0xF6, 0xDE, 0x04, 0x7E, 0x11, 0xB6, 0xBF, 0xC6, 0x0C, 0xA4, 0x92, 0x7A, 0xC7, 0x90, 0x76, 0xAF, 0x3B, 0x46, 0xEA, 0xDE, 0x0C, 0x6B, 0xD5, 0xC3, 0x08, 0xFE, 0x14, 0x77, 0x9D, 0xC6, 0x11, 0xD3, 0x71, 0xE4, 0x2A, 0x4B, 0x78, 0x9F, 0x04, 0x30, 0xDD, 0x95, 0xB5, 0x69, 0x34, 0x66, 0xBE, 0x94, 0x3A, 0x90, 0x2A, 0x7E, 0x93, 0xAC, 0xCF, 0x95, 0xB3, 0x71, 0x48, 0x86, 0x4A, 0xCC, 0x4C, 0x72, 0xFA, 0x90, 0xE1, 0x57, 0x64, 0xF4, 0x74, 0xD7, 0x85, 0x32, 0xB1, 0x88, 0xB8, 0x0D, 0x25, 0xA0, 0xD0, 0x67, 0x80, 0xE9, 0xDE, 0x38, 0xB6, 0x1F, 0x28, 0xB0, 0x95, 0xB3, 0x3E, 0x56, 0x10, 0xCE, 0xBB, 0x86, 0x55, 0x12, 0xFF, 0x0F, 0xA8, 0xD8, 0x7D, 0x3C, 0xC7, 0xFB, 0x10, 0x01, 0xF9, 0xAD, 0x6A, 0x31, 0x2F, 0x89, 0x97, 0xE0, 0x3E, 0x9E, 0x67, 0x7F, 0x19, 0x1D, 0xE7, 0x0C, 0xC7, 0x00, 0x90, 0x85, 0x7B, 0xAE, 0x6C, 0xD5, 0xAB, 0x07, 0xB2, 0x7C, 0xDF, 0x1F, 0x13, 0x33, 0x48, 0x88, 0x14, 0x73, 0xFD, 0x66, 0x49, 0xE0, 0xA2, 0x30, 0x1B, 0x48, 0x16, 0x1C, 0x59, 0x54, 0x39, 0xED, 0xD5, 0x69, 0x08, 0x69, 0x1A, 0xC2, 0xD2, 0x62, 0x12, 0xC1, 0xA5, 0xA8, 0xCE, 0xC3, 0xB8, 0x1B, 0x32, 0x73, 0xA1, 0x8F, 0xF6, 0x46, 0xF0, 0xEF, 0x06, 0x26, 0x7E, 0x1A, 0x14, 0x5E, 0xB8, 0xEF, 0xED, 0xC4, 0x5D, 0x16, 0x5E, 0xA0, 0xBD, 0x32, 0x18, 0x2E, 0x8F, 0x14, 0xB4, 0xCB, 0x80, 0xCC, 0xDF, 0x83, 0xE4, 0xA2, 0xAE, 0xF8, 0x31, 0x00, 0xD7, 0xB4, 0x5C, 0xF8, 0xFE, 0x81, 0xA7, 0xD9, 0x33, 0x16, 0x92, 0x3C, 0xEA, 0x7E, 0x9F, 0x76, 0x86, 0xC1, 0xF0, 0xCE, 0x48, 0x41, 0xB0, 0xE9, 0x09, 0x12, 0xF7, 0x03, 0x14, 0x9A, 0x86, 0xB4, 0x1C, 0xEC, 0xF2, 0xAE, 0xD2, 0x62, 0x4B, 0xFF, 0x6F, 0xEC, 0xCF, 0x80, 0xAD, 0x9C, 0x44, 0xB3, 0x6E, 0x4F, 0x78, 0x9A, 0xC4, 0xBF, 0x88, 0xAC, 0xAE, 0x04, 0x64, 0x42, 0xD3, 0xFE, 0x66, 0xEE, 0xE3, 0x92, 0x83, 0x9C, 0x1C, 0xEA, 0xDA, 0x60, 0x8C, 0x8B, 0xA0, 0x67, 0x07, 0xB6, 0x2A, 0x46, 0xC0, 0xC9, 0x71, 0x5F, 0x1F, 0xED, 0x14, 0x80, 0x54, 0xD0, 0xFE, 0xEB, 0x79, 0xDC, 0xAE, 0x3B, 0x44, 0xD9, 0x76, 0x43, 0x26, 0x28, 0x7F, 0xE1, 0xA4, 0xC1, 0xE1, 0x37, 0x14, 0x53, 0x76, 0xAE, 0x24, 0x87, 0x1D, 0x6E, 0xDB, 0x42, 0xBB, 0x2E, 0xC5, 0xA3, 0xD3, 0x63, 0xFD, 0x08, 0x6E, 0xD6, 0xA3, 0x33, 0xE0, 0x0D, 0xB4, 0x4A, 0x6C, 0xBB, 0x2E, 0x55, 0x70, 0x53, 0xD8, 0xD2, 0x1A, 0x8E, 0xB6, 0xCB, 0x31, 0xC8, 0x74, 0x17, 0xF5, 0xC6, 0xF7, 0x83, 0xB6, 0xCA, 0x04, 0x46, 0x0E, 0xA6, 0x82, 0x23, 0xC6, 0xCC, 0xDD, 0x39, 0xA1, 0x0A, 0xD2, 0xE0, 0x98, 0x6F, 0x0D, 0x6D, 0x68, 0x01, 0xB6, 0xEF, 0x05, 0x6B, 0x80, 0xB3, 0x09, 0xE4, 0xF9, 0x21, 0x03, 0xD3, 0xB1, 0x22, 0x0C, 0x4D, 0x60, 0xF1, 0xD5, 0xD9, 0xBD, 0x53, 0x3B, 0xC7, 0x9E, 0x26, 0x0B, 0x81, 0xA9, 0xE2, 0xA0, 0x8A, 0x97, 0x79, 0xC4, 0x84, 0x37, 0x62, 0xD8, 0x43, 0x96, 0x55, 0x43, 0x3B, 0x77, 0x81, 0x9E, 0xA3, 0xAA, 0x78, 0x54, 0xC5, 0x62, 0x3F, 0x60, 0xE4, 0x39, 0xDC, 0x83, 0x19, 0xCB, 0x38, 0x52, 0x80, 0xDF, 0x07, 0x8D, 0x3D, 0x41, 0x15, 0xA6, 0x69, 0x9E, 0xA4, 0x39, 0x69, 0xFC, 0x99, 0xFA, 0x17, 0xA6, 0xC3, 0xFF, 0x6B, 0x2A, 0x22, 0x26, 0xBB, 0x51, 0xFC, 0x17, 0x52, 0xCB, 0xF0, 0x37, 0xA0, 0x55, 0xDE, 0xA8, 0xD1, 0xE5, 0xCB, 0xA1, 0xE3, 0xDB, 0x40, 0xEB, 0xF9, 0xEA, 0x9F, 0xF6, 0xBE, 0x66, 0xEA, 0x5C, 0x36, 0x3C, 0x01, 0x40, 0x64, 0x4B, 0x78, 0xFA, 0x62, 0xEC, 0xCA, 0xA4, 0x78, 0x88, 0xC4, 0x86, 0xA6, 0x87, 0x63, 0x36, 0xBB, 0xB4, 0x26, 0x62, 0x1C, 0x9B, 0x14, 0x3C, 0xE6, 0x42, 0x7A, 0x15, 0x06, 0x9A, 0x32, 0xB1, 0xEB, 0x1D, 0x57, 0x39, 0x33, 0x2B, 0x11, 0x58, 0xBF, 0x29, 0xD7, 0x1D, 0xBC, 0x62, 0xBE, 0x50, 0xF1, 0xA1, 0x53, 0x44, 0x2D, 0x35, 0x74, 0xFC, 0x9F, 0x91, 0x86, 0xED, 0x2D, 0x4C, 0x52, 0x1F, 0xB7, 0x02, 0xEB, 0x4B, 0xAA, 0xB4, 0xF3, 0x40, 0x81, 0x9F, 0xB6, 0xFE, 0x40, 0x3D, 0x48, 0x43, 0xDA, 0x90, 0x0F, 0x06, 0xF7, 0xAA, 0x90, 0x99, 0x4A, 0x83, 0x39, 0x98, 0x88, 0x13, 0x58, 0x2E, 0x57, 0x8B, 0xBB, 0x5A, 0xFB, 0x7A, 0xD9, 0xB0, 0x99, 0x70, 0x14, 0x6E, 0x8C, 0x7D, 0x5F, 0x3D, 0x62, 0x9C, 0x85, 0x9C, 0x7C, 0xC5, 0xFD, 0xAD, 0x9D, 0xAD, 0xF3, 0x19, 0x18, 0xCF, 0xF5, 0xB6, 0x7E, 0x83, 0xD1, 0x4B, 0x03, 0x50, 0xDC, 0x1B, 0x7A, 0xF9, 0x19, 0x2E, 0xCC, 0x9C, 0x30, 0xB1, 0x6A, 0xB4, 0xF8, 0x88, 0xBB, 0xEC, 0x76, 0xE6, 0x95, 0xA9, 0x47, 0xD0, 0x9F, 0xE6, 0x6C, 0x42, 0xB8, 0x64, 0x8B, 0x2F, 0xCB, 0xFA, 0x1D, 0x55, 0xA2, 0x03, 0xD9, 0x1E, 0x79, 0x0C, 0xA6, 0x1E, 0xA4, 0xAD, 0x75, 0xA4, 0x68, 0xBA, 0x50, 0xD4, 0x05, 0x19, 0x27, 0x95, 0x14, 0x2A, 0x62, 0xE5, 0x0E, 0x4F, 0x13, 0xC4, 0xA2, 0xD9, 0xD7, 0x8C, 0xA4, 0x98, 0x20, 0x77, 0xE0, 0xDF, 0x53, 0x4D, 0x88, 0x18, 0x1A, 0x91, 0x8B, 0x7E, 0x97, 0xD3, 0x51, 0x79, 0x45, 0x45, 0x15, 0x7F, 0xFD, 0xA0, 0x8C, 0xF6, 0x5E, 0x55, 0xB9, 0xD1, 0x04, 0xCB, 0x76, 0xC0, 0x87, 0x45, 0x17, 0x68, 0xC3, 0x84, 0xDA, 0xB6, 0x59, 0x6D, 0xE5, 0x64, 0x1B, 0x2D, 0xD3, 0xA0, 0x5D, 0xFE, 0xD8, 0x9D, 0xFE, 0x77, 0xED, 0xF2, 0xEF, 0xDD, 0x41, 0xDA, 0x60, 0x05, 0xF1, 0x8F, 0x54, 0x00, 0x0E, 0x94, 0x57, 0x16, 0x10, 0x35, 0x7E, 0x17, 0x1D, 0x31, 0xB9, 0x5E, 0x39, 0xA7, 0x28, 0x6D, 0xD1, 0xB3, 0x16, 0x7F, 0x4C, 0x74, 0x90, 0x85, 0x5A, 0x6D, 0x6A, 0x8F, 0x9D, 0x10, 0x63, 0xA3, 0xA5, 0x18, 0x7B, 0x7E, 0x53, 0x94, 0xB3, 0x74, 0xE3, 0x4D, 0x8E, 0xB0, 0xAD, 0x23, 0x9E, 0x01, 0xC6, 0x31, 0x32, 0x2A, 0x6E, 0x26, 0x61, 0xCA, 0x1B, 0xB3, 0xE2, 0x5A, 0xF2, 0xE3, 0x1C, 0xC4, 0x88, 0x5F, 0xAA, 0x85, 0x74, 0xB7, 0x1F, 0x79, 0xDF, 0x52, 0x87, 0x74, 0x3A, 0x4E, 0x47, 0x0B, 0x23, 0x16, 0x9C, 0x38, 0xF4, 0xDB, 0x79, 0xE5, 0x72, 0x36, 0x76, 0xDD, 0xAC, 0x40, 0xF1, 0x53, 0x38, 0x9A, 0xD3, 0xE9, 0xDA, 0xB1, 0x93, 0xB3, 0xB4, 0x72, 0x6C, 0x12, 0xA4, 0xAD, 0x7B, 0x99, 0x1B, 0x9D, 0x97, 0x2A, 0x04, 0x6E, 0x6F, 0x66, 0xFD, 0x2F, 0xA5, 0xAC, 0xC3, 0x1E, 0x21, 0x50, 0x8D, 0x57, 0xE9, 0x8F, 0x91, 0x3E, 0x0B, 0x90, 0xC7, 0x0A, 0x83, 0x45, 0xFA, 0xD3, 0x6B, 0xF4, 0xA1, 0xA2, 0xA3, 0x91, 0x3F, 0x11, 0x5B, 0x2E, 0xCA, 0x7C, 0x05, 0x45, 0xB2, 0x26, 0xE8, 0xA1, 0xCB, 0xD9, 0x62, 0x06, 0xC1, 0x08, 0x6C, 0x2D, 0x93, 0x3F, 0xDC, 0xF2, 0xBD, 0xCA, 0xAC, 0xE2, 0xF2, 0x2D, 0x59, 0x95, 0x15, 0x6C, 0x41, 0xD4, 0x5E, 0x21, 0x3E, 0x41, 0x3C, 0x5E, 0x29, 0x59, 0xD4, 0xA3, 0xA3, 0xDB, 0x2F, 0x67, 0xE3, 0xBA, 0x95, 0x9B, 0x04, 0x8E, 0xC5, 0x05, 0x5D, 0x97, 0x8D, 0x0F, 0xEA, 0x69, 0xEF, 0x3A, 0x80, 0x69, 0x74, 0x16, 0x83, 0xD2, 0xB9, 0x84, 0xF8, 0x8F, 0xCB, 0xB3, 0x3A, 0x7B, 0xCF, 0x0D, 0x29, 0xEA, 0xAF, 0x96, 0x0A, 0x07, 0x8C, 0xBE, 0x21, 0x0A, 0x6E, 0x0D, 0x4F, 0x9F, 0x99, 0xFC, 0x13, 0xE9, 0x64, 0x5F, 0x0E, 0x8A, 0x4C, 0x8A, 0x7F, 0x4C, 0xCC, 0xC6, 0xCE, 0x50, 0xFD, 0x33, 0x89, 0xEB, 0xCC, 0xA5, 0xD4, 0xD1, 0xD8, 0xDA, 0x85, 0x98, 0x19, 0x2F, 0xEF, 0x7E, 0x02, 0x57, 0x1A, 0x2E, 0x9C, 0x30, 0x45, 0x7A, 0x42, 0xD3, 0xF2, 0x48, 0xF4, 0x62, 0xA1, 0xCC, 0x45, 0x87, 0x75, 0x67, 0xDD, 0x91, 0x6A, 0x29, 0x76, 0x76, 0x04, 0x9A, 0x2E, 0xEA, 0xA2, 0x67, 0xBA, 0x84, 0x91, 0xA8, 0x7C, 0xB5, 0x63, 0xBC, 0x6F, 0xE6, 0x9A, 0x30, 0xB0, 0xEA, 0xC6, 0x99, 0xAE, 0xCC, 0x5B, 0xD4, 0x00, 0xE3, 0x8F, 0x85, 0xA7, 0xAF, 0x4C, 0x92, 0x05, 0xAD, 0xC3, 0x54, 0x87, 0xA6, 0xC7, 0x26, 0xFD, 0x3A, 0xA2, 0x03, 0x00, 0xF3, 0x4E, 0xC0, 0xC0, 0x50, 0xE5, 0xA6, 0xC0, 0xAB, 0xD1, 0xAA, 0xD2, 0x68, 0x79, 0xF4, 0x17, 0xEF, 0xDC, 0xFF, 0x8F, 0x00, 0x6E, 0xF6, 0xD7, 0xF6, 0x5D, 0xDE, 0x9D, 0x2A, 0x70, 0xBD, 0xF5, 0xBA, 0x6D, 0x53, 0x66, 0xFD, 0xEB, 0x9C, 0x3C, 0x16, 0x5F, 0x42, 0xB6, 0x02, 0x97, 0xD2, 0x4B, 0x56, 0xF3, 0x2C, 0x4A, 0x32, 0x2A, 0x7E, 0x40, 0x5A, 0x22, 0x96, 0x72, 0x24, 0xFE, 0x8E, 0xFC, 0x3B, 0x9D, 0x2A, 0xB0, 0x95, 0x67, 0x96, 0xF5, 0x10, 0x2D, 0xD5, 0x21, 0xC2, 0xE1, 0x3B, 0x2B, 0x31, 0x37, 0x1D, 0xE8, 0x06, 0x0D, 0x0C, 0xDF, 0x52, 0xB5, 0x04, 0x07, 0xCA, 0x9F, 0x07, 0x60, 0x73, 0x35, 0x38, 0x41, 0x7B, 0xE4, 0xA8, 0x4D, 0xE7, 0x0B, 0xAF, 0x1E, 0x2F, 0x83, 0xE9, 0xDE, 0x54, 0x00, 0x69, 0xBB, 0xAE, 0x73, 0xC6, 0xBB, 0x1A, 0x14, 0xA6, 0xA7, 0x16, 0x72, 0xD9, 0x5E, 0x1D, 0x6E, 0xD3, 0x23, 0x5F, 0x13, 0xEC, 0x05, 0xBE, 0x70, 0x31, 0xE4, 0xB0, 0x73, 0xC1, 0xC9, 0x60, 0x1B, 0x27, 0x7F, 0x52, 0x14, 0x36, 0xC1, 0x74, 0xBB, 0x6E, 0x03, 0x63, 0xD0, 0x6B, 0x41, 0xD7, 0x3B, 0x17, 0x7C, 0x61, 0x03, 0x31, 0x71, 0xF2, 0x35, 0x82, 0xFF, 0x3F, 0x19, 0x47, 0xAB, 0x24
     },
+    .text_zlen = 3443,
     .text_len = 4444,
     .data = (uint8_t const[]){
-        0x58, 0x00, 0xFD, 0x3F, 0x4B, 0x8B, 0x02, 0x40, 0xDD, 0x8B, 0x02, 0x40, 0xF2, 0x90, 0x02, 0x40, 0x66, 0x8C, 0x02, 0x40, 0xFE, 0x8B, 0x02, 0x40, 0x66, 0x8C, 0x02, 0x40, 0xC5, 0x8C, 0x02, 0x40, 0xDE, 0x8D, 0x02, 0x40, 0x51, 0x8E, 0x02, 0x40, 0xF9, 0x8D, 0x02, 0x40, 0xD5, 0x8A, 0x02, 0x40, 0x77, 0x8D, 0x02, 0x40, 0xD0, 0x8D, 0x02, 0x40, 0xE8, 0x8C, 0x02, 0x40, 0x74, 0x8E, 0x02, 0x40, 0x10, 0x8D, 0x02, 0x40, 0x74, 0x8E, 0x02, 0x40, 0xCB, 0x8B, 0x02, 0x40, 0x2A, 0x8C, 0x02, 0x40, 0x66, 0x8C, 0x02, 0x40, 0xC5, 0x8C, 0x02, 0x40, 0xE3, 0x8B, 0x02, 0x40, 0x17, 0x8B, 0x02, 0x40, 0x37, 0x8F, 0x02, 0x40, 0xAA, 0x90, 0x02, 0x40, 0xEA, 0x89, 0x02, 0x40, 0xD1, 0x90, 0x02, 0x40, 0xEA, 0x89, 0x02, 0x40, 0xEA, 0x89, 0x02, 0x40, 0xEA, 0x89, 0x02, 0x40, 0xEA, 0x89, 0x02, 0x40, 0xEA, 0x89, 0x02, 0x40, 0xEA, 0x89, 0x02, 0x40, 0xEA, 0x89, 0x02, 0x40, 0xEA, 0x89, 0x02, 0x40, 0xD4, 0x8E, 0x02, 0x40, 0xEA, 0x89, 0x02, 0x40, 0xC9, 0x8F, 0x02, 0x40, 0xAA, 0x90, 0x02, 0x40
+        0x28, 0xCF, 0x8B, 0x60, 0xF8, 0x6B, 0xEF, 0xDD, 0xCD, 0xE4, 0x70, 0x17, 0x88, 0x3F, 0x4D, 0x60, 0x72, 0x48, 0xEB, 0x61, 0x72, 0xF8, 0xD7, 0x0D, 0xA1, 0x8F, 0x02, 0xF1, 0xBD, 0x5E, 0x26, 0x87, 0xC0, 0x3E, 0x26, 0x87, 0x9F, 0x40, 0xFA, 0x6A, 0x17, 0x93, 0x43, 0x39, 0x90, 0xBE, 0x00, 0xC4, 0x2F, 0x80, 0x72, 0x25, 0x40, 0x71, 0x81, 0x5E, 0x08, 0x7D, 0x1A, 0xA8, 0x47, 0xAB, 0x07, 0xA1, 0xEF, 0x31, 0x90, 0x2F, 0x0E, 0xC4, 0xE6, 0xFD, 0x4C, 0x0E, 0xAB, 0x80, 0xE6, 0xBE, 0xEA, 0x64, 0x72, 0xB8, 0x08, 0xA5, 0xF1, 0xE1, 0x2B, 0x7D, 0x10, 0xFA, 0x24, 0x54, 0x1F, 0x00, 0x89, 0x72, 0x3B, 0xF8
     },
+    .data_zlen = 98,
     .data_len = 160,
     .text_start = 0x40028000,
     .data_start = 0x3FFE2BFC,
@@ -1,17 +1,20 @@
 // WARNING: This is a generated file, do not edit it!
 // clang-format off
 // Generated from esp-idf-tools/python_env/idf5.3_py3.12_env/lib/python3.12/site-packages/esptool/targets/stub_flasher/stub_flasher_32s3.json
+// The text and data segments are zlib streams with a 1024 byte window
 
 #include "chips.h"
 
 et2_stub_t const stub_esp32s3 = {
     .text = (uint8_t const[]){
-        0x14, 0x80, 0x03, 0x60, 0x00, 0x80, 0x03, 0x60, 0x4C, 0x00, 0xCA, 0x3F, 0x04, 0x80, 0x03, 0x60, 0x36, 0x41, 0x00, 0x81, 0xFB, 0xFF, 0x0C, 0x49, 0xC0, 0x20, 0x00, 0x99, 0x08, 0xC6, 0x04, 0x00, 0x00, 0x81, 0xF8, 0xFF, 0xC0, 0x20, 0x00, 0xA8, 0x08, 0x81, 0xF7, 0xFF, 0xA0, 0xA0, 0x74, 0x88, 0x08, 0xE0, 0x08, 0x00, 0x21, 0xF6, 0xFF, 0xC0, 0x20, 0x00, 0x88, 0x02, 0x27, 0xE8, 0xE1, 0x1D, 0xF0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x60, 0x1C, 0x00, 0x00, 0x60, 0x10, 0x00, 0x00, 0x60, 0x36, 0x41, 0x00, 0x21, 0xFC, 0xFF, 0xC0, 0x20, 0x00, 0x38, 0x02, 0x41, 0xFB, 0xFF, 0xC0, 0x20, 0x00, 0x28, 0x04, 0x20, 0x20, 0x94, 0x9C, 0xE2, 0x41, 0xE8, 0xFF, 0x46, 0x04, 0x00, 0x0C, 0x38, 0x30, 0x88, 0x01, 0xC0, 0x20, 0x00, 0xA8, 0x08, 0x88, 0x04, 0xA0, 0xA0, 0x74, 0xE0, 0x08, 0x00, 0x0B, 0x22, 0x66, 0x02, 0xE8, 0x86, 0xF4, 0xFF, 0x21, 0xF1, 0xFF, 0xC0, 0x20, 0x00, 0x39, 0x02, 0x1D, 0xF0, 0x00, 0x00, 0xF4, 0x2B, 0xCB, 0x3F, 0x6C, 0xAB, 0xCA, 0x3F, 0x84, 0x80, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xAC, 0xEB, 0xCA, 0x3F, 0xF8, 0x2B, 0xCB, 0x3F, 0x36, 0x41, 0x00, 0xB1, 0xF9, 0xFF, 0x20, 0xA0, 0x74, 0x10, 0x11, 0x20, 0x25, 0x39, 0x01, 0x96, 0x1A, 0x06, 0x81, 0xF6, 0xFF, 0x92, 0xA1, 0x01, 0x90, 0x99, 0x11, 0x9A, 0x98, 0xC0, 0x20, 0x00, 0xB8, 0x09, 0x91, 0xF3, 0xFF, 0xA0, 0xA0, 0x74, 0x9A, 0x88, 0xC0, 0x20, 0x00, 0x92, 0x18, 0x00, 0x90, 0x90, 0xF4, 0x1B, 0xC9, 0xC0, 0xC0, 0xF4, 0xC0, 0x20, 0x00, 0xC2, 0x58, 0x00, 0x9A, 0x9B, 0xC0, 0x20, 0x00, 0xA2, 0x49, 0x00, 0xC0, 0x20, 0x00, 0x92, 0x18, 0x00, 0x81, 0xEA, 0xFF, 0x90, 0x90, 0xF4, 0x80, 0x80, 0xF4, 0x87, 0x99, 0x47, 0x81, 0xE5, 0xFF, 0x92, 0xA1, 0x01, 0x90, 0x99, 0x11, 0x9A, 0x98, 0xC0, 0x20, 0x00, 0xC8, 0x09, 0xA1, 0xE5, 0xFF, 0xB1, 0xE3, 0xFF, 0x87, 0x9C, 0x17, 0xC6, 0x01, 0x00, 0x7C, 0xE8, 0x87, 0x1A, 0xDE, 0xC6, 0x08, 0x00, 0xC0, 0x20, 0x00, 0x89, 0x0A, 0xC0, 0x20, 0x00, 0xB9, 0x09, 0x46, 0x02, 0x00, 0xC0, 0x20, 0x00, 0xB9, 0x0A, 0xC0, 0x20, 0x00, 0x89, 0x09, 0x91, 0xD7, 0xFF, 0x9A, 0x88, 0x0C, 0x09, 0xC0, 0x20, 0x00, 0x92, 0x58, 0x00, 0x1D, 0xF0, 0x00, 0x00, 0x54, 0x20, 0x00, 0x60, 0x54, 0x30, 0x00, 0x60, 0x36, 0x41, 0x00, 0x91, 0xFD, 0xFF, 0xC0, 0x20, 0x00, 0x88, 0x09, 0x80, 0x80, 0x24, 0x56, 0x48, 0xFF, 0x91, 0xFA, 0xFF, 0xC0, 0x20, 0x00, 0x88, 0x09, 0x80, 0x80, 0x24, 0x56, 0x48, 0xFF, 0x1D, 0xF0, 0x00, 0x00, 0x00, 0x2C, 0x20, 0x00, 0x60, 0x00, 0x20, 0x00, 0x60, 0x00, 0x00, 0x00, 0x08, 0x36, 0x41, 0x00, 0x10, 0x11, 0x20, 0xA5, 0xFC, 0xFF, 0x21, 0xFA, 0xFF, 0x0C, 0x08, 0xC0, 0x20, 0x00, 0x82, 0x62, 0x00, 0x91, 0xFA, 0xFF, 0x81, 0xF8, 0xFF, 0xC0, 0x20, 0x00, 0x92, 0x68, 0x00, 0xC0, 0x20, 0x00, 0x98, 0x08, 0x56, 0x79, 0xFF, 0xC0, 0x20, 0x00, 0x88, 0x02, 0x7C, 0xF2, 0x80, 0x22, 0x30, 0x20, 0x20, 0x04, 0x1D, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x36, 0x41, 0x00, 0x10, 0x11, 0x20, 0xE5, 0xFB, 0xFF, 0x16, 0x6A, 0xFF, 0x81, 0xEC, 0xFF, 0x91, 0xFB, 0xFF, 0xC0, 0x20, 0x00, 0x92, 0x68, 0x00, 0xC0, 0x20, 0x00, 0x98, 0x08, 0x56, 0x79, 0xFF, 0x1D, 0xF0, 0x00, 0x00, 0xE8, 0x08, 0x00, 0x40, 0xB8, 0x08, 0x00, 0x40, 0x36, 0x81, 0x00, 0x81, 0xFD, 0xFF, 0xE0, 0x08, 0x00, 0x1C, 0x06, 0x06, 0x0C, 0x00, 0x00, 0x00, 0x60, 0x54, 0x43, 0x0C, 0x08, 0x0C, 0x1A, 0xD0, 0x95, 0x11, 0x0C, 0x8D, 0x39, 0x31, 0xED, 0x02, 0x89, 0x61, 0xA9, 0x51, 0x99, 0x41, 0x89, 0x21, 0x89, 0x11, 0xD9, 0x01, 0x2C, 0x0F, 0x0C, 0xCC, 0x0C, 0x4B, 0x81, 0xF2, 0xFF, 0xE0, 0x08, 0x00, 0x50, 0x44, 0xC0, 0x5A, 0x33, 0x5A, 0x22, 0xE6, 0x14, 0xCD, 0x0C, 0x02, 0x1D, 0xF0, 0x00, 0x00, 0x14, 0x28, 0x00, 0x40, 0x36, 0x41, 0x00, 0x20, 0xA2, 0x20, 0x81, 0xFD, 0xFF, 0xE0, 0x08, 0x00, 0x1D, 0xF0, 0x00, 0x00, 0x70, 0xE2, 0xFA, 0x3F, 0x08, 0x20, 0x00, 0x60, 0xBC, 0x0A, 0x00, 0x40, 0xC8, 0x0A, 0x00, 0x40, 0x36, 0x61, 0x00, 0x10, 0x11, 0x20, 0x65, 0xEF, 0xFF, 0x31, 0xF9, 0xFF, 0xBD, 0x01, 0xAD, 0x03, 0x81, 0xFA, 0xFF, 0xE0, 0x08, 0x00, 0x4D, 0x0A, 0x0C, 0x12, 0xEC, 0xEA, 0x88, 0x01, 0x92, 0xA2, 0x00, 0x90, 0x88, 0x10, 0x89, 0x01, 0x10, 0x11, 0x20, 0xE5, 0xF3, 0xFF, 0x91, 0xF2, 0xFF, 0xA0, 0xA2, 0x01, 0xC0, 0x20, 0x00, 0x88, 0x09, 0xA0, 0x88, 0x20, 0xC0, 0x20, 0x00, 0x89, 0x09, 0xB8, 0x01, 0xAD, 0x03, 0x81, 0xEE, 0xFF, 0xE0, 0x08, 0x00, 0xA0, 0x24, 0x83, 0x1D, 0xF0, 0x00, 0x00, 0x5C, 0x80, 0xCA, 0x3F, 0xFF, 0x0F, 0x00, 0x00, 0x68, 0xAB, 0xCA, 0x3F, 0x36, 0x41, 0x00, 0x81, 0xFC, 0xFF, 0x0C, 0x19, 0x92, 0x48, 0x00, 0x30, 0x9C, 0x41, 0x99, 0x28, 0x91, 0xFA, 0xFF, 0x39, 0x18, 0x29, 0x38, 0x30, 0x30, 0xB4, 0x9A, 0x22, 0x2A, 0x33, 0x30, 0x3C, 0x41, 0x39, 0x48, 0x31, 0xF6, 0xFF, 0x22, 0xA0, 0x00, 0x32, 0x03, 0x00, 0x22, 0x68, 0x05, 0x27, 0x13, 0x09, 0x81, 0xBF, 0xFF, 0xE0, 0x08, 0x00, 0x46, 0x03, 0x00, 0x00, 0x10, 0x11, 0x20, 0x65, 0xF6, 0xFF, 0x2D, 0x0A, 0x8C, 0x1A, 0x22, 0xA0, 0xC5, 0x1D, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x20, 0x00, 0x60, 0xF4, 0x08, 0x00, 0x40, 0x0C, 0x09, 0x00, 0x40, 0x00, 0x09, 0x00, 0x40, 0x36, 0x81, 0x00, 0x31, 0xE4, 0xFF, 0x28, 0x43, 0x16, 0x82, 0x11, 0x10, 0x11, 0x20, 0x25, 0xE6, 0xFF, 0x16, 0xFA, 0x10, 0x0C, 0xF8, 0x0C, 0x04, 0x27, 0xA8, 0x0C, 0x88, 0x23, 0x0C, 0x12, 0x80, 0x80, 0x34, 0x80, 0x24, 0x93, 0x20, 0x40, 0x74, 0x10, 0x11, 0x20, 0x25, 0xE8, 0xFF, 0x10, 0x11, 0x20, 0xE5, 0xE0, 0xFF, 0x21, 0xDA, 0xFF, 0x22, 0x02, 0x00, 0x16, 0x32, 0x0A, 0xA8, 0x23, 0x81, 0xEB, 0xFF, 0x40, 0x2A, 0x11, 0x16, 0xF4, 0x04, 0x27, 0x28, 0x3C, 0x81, 0xA1, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0xE8, 0xFF, 0xE0, 0x08, 0x00, 0xE8, 0x23, 0x0C, 0x02, 0x0C, 0x1A, 0xA9, 0x61, 0xA9, 0x51, 0x1C, 0x8F, 0x40, 0xEE, 0x11, 0x0C, 0x8D, 0xC2, 0xA0, 0xD8, 0x0C, 0x5B, 0x29, 0x41, 0x29, 0x31, 0x29, 0x21, 0x29, 0x11, 0x29, 0x01, 0x81, 0x97, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0x94, 0xFF, 0xE0, 0x08, 0x00, 0x86, 0x02, 0x00, 0x00, 0x00, 0xA0, 0xA4, 0x21, 0x81, 0xDB, 0xFF, 0xE0, 0x08, 0x00, 0x1C, 0x0A, 0x06, 0x20, 0x00, 0x00, 0x00, 0x27, 0x28, 0x39, 0x81, 0x8D, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0xD4, 0xFF, 0xE0, 0x08, 0x00, 0xE8, 0x23, 0x0C, 0x12, 0x1C, 0x8F, 0x40, 0xEE, 0x11, 0x0C, 0x8D, 0x2C, 0x0C, 0x0C, 0x5B, 0xAD, 0x02, 0x29, 0x61, 0x29, 0x51, 0x49, 0x41, 0x49, 0x31, 0x49, 0x21, 0x49, 0x11, 0x49, 0x01, 0x81, 0x83, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0x81, 0xFF, 0xE0, 0x08, 0x00, 0x46, 0x01, 0x00, 0x81, 0xC9, 0xFF, 0xE0, 0x08, 0x00, 0x0C, 0x1A, 0x86, 0x0D, 0x00, 0x00, 0x28, 0x23, 0x0C, 0x19, 0x40, 0x22, 0x11, 0x90, 0x89, 0x01, 0xCC, 0x14, 0x80, 0x89, 0x01, 0x91, 0xBF, 0xFF, 0x90, 0x22, 0x10, 0x91, 0xBE, 0xFF, 0xC0, 0x20, 0x00, 0x22, 0x69, 0x00, 0x21, 0x5A, 0xFF, 0xC0, 0x20, 0x00, 0x82, 0x62, 0x00, 0xC0, 0x20, 0x00, 0x88, 0x02, 0x56, 0x78, 0xFF, 0x1C, 0x0A, 0x0C, 0x12, 0x40, 0xA2, 0x83, 0x28, 0x43, 0xA0, 0x22, 0xC0, 0x29, 0x43, 0x28, 0x23, 0xAA, 0x22, 0x29, 0x23, 0x1D, 0xF0, 0x00, 0x00, 0x36, 0x81, 0x00, 0x81, 0x69, 0xFF, 0xE0, 0x08, 0x00, 0x2C, 0x06, 0x86, 0x0F, 0x00, 0x00, 0x00, 0x81, 0xAF, 0xFF, 0xE0, 0x08, 0x00, 0x60, 0x54, 0x43, 0x0C, 0x08, 0x0C, 0x1A, 0xD0, 0x95, 0x11, 0xED, 0x02, 0xA9, 0x61, 0xA9, 0x51, 0x89, 0x41, 0x89, 0x31, 0x99, 0x21, 0x39, 0x11, 0x89, 0x01, 0x2C, 0x0F, 0x0C, 0x8D, 0xC2, 0xA0, 0x12, 0xB2, 0xA0, 0x04, 0x81, 0x5C, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0x5A, 0xFF, 0xE0, 0x08, 0x00, 0x5A, 0x33, 0x5A, 0x22, 0x50, 0x44, 0xC0, 0xE6, 0x14, 0xBF, 0x1D, 0xF0, 0x00, 0x00, 0x14, 0x0A, 0x00, 0x40, 0x36, 0x61, 0x00, 0x41, 0x84, 0xFF, 0x58, 0x34, 0x50, 0x33, 0x63, 0x16, 0x63, 0x0B, 0x58, 0x14, 0x5A, 0x53, 0x50, 0x5C, 0x41, 0x46, 0x01, 0x00, 0x10, 0x11, 0x20, 0x65, 0xE6, 0xFF, 0x68, 0x44, 0xA6, 0x16, 0x04, 0x68, 0x24, 0x67, 0xA5, 0xEF, 0x10, 0x11, 0x20, 0x65, 0xCC, 0xFF, 0x16, 0x6A, 0xFF, 0x51, 0x7A, 0xFF, 0x68, 0x14, 0x52, 0x05, 0x00, 0x16, 0x45, 0x06, 0x81, 0x45, 0xFF, 0xE0, 0x08, 0x00, 0x60, 0x50, 0x74, 0x82, 0xA1, 0x00, 0x50, 0x78, 0xC0, 0x77, 0xB3, 0x08, 0xCD, 0x03, 0xBD, 0x02, 0xAD, 0x06, 0x86, 0x0E, 0x00, 0xCD, 0x07, 0xBD, 0x02, 0xAD, 0x06, 0x52, 0xD5, 0xFF, 0x10, 0x11, 0x20, 0x65, 0xF4, 0xFF, 0x3A, 0x55, 0x50, 0x58, 0x41, 0x0C, 0x09, 0x46, 0x05, 0x00, 0x00, 0xC2, 0xA1, 0x00, 0x99, 0x01, 0x10, 0x11, 0x20, 0xE5, 0xF2, 0xFF, 0x98, 0x01, 0x72, 0xD7, 0x01, 0x1B, 0x99, 0x90, 0x90, 0x74, 0x60, 0xA7, 0x80, 0x70, 0xB2, 0x80, 0x57, 0x39, 0xE1, 0x70, 0xC3, 0xC0, 0x10, 0x11, 0x20, 0x25, 0xF1, 0xFF, 0x81, 0x2E, 0xFF, 0xE0, 0x08, 0x00, 0x86, 0x05, 0x00, 0xCD, 0x03, 0xBD, 0x02, 0xAD, 0x06, 0x81, 0xD5, 0xFF, 0xE0, 0x08, 0x00, 0xA0, 0xA0, 0x74, 0x8C, 0x4A, 0x22, 0xA0, 0xC4, 0x22, 0x64, 0x05, 0x28, 0x14, 0x3A, 0x22, 0x29, 0x14, 0x28, 0x34, 0x30, 0x22, 0xC0, 0x29, 0x34, 0x1D, 0xF0, 0x00, 0x5C, 0x07, 0x00, 0x40, 0x36, 0x41, 0x00, 0x81, 0xFE, 0xFF, 0xE0, 0x08, 0x00, 0x82, 0x0A, 0x18, 0x0C, 0x09, 0x82, 0xC8, 0xFC, 0x0C, 0x12, 0x80, 0x29, 0x93, 0x1D, 0xF0, 0x36, 0x41, 0x00, 0x81, 0xF8, 0xFF, 0xE0, 0x08, 0x00, 0x82, 0x0A, 0x18, 0x0C, 0x09, 0x82, 0xC8, 0xFD, 0x0C, 0x12, 0x80, 0x29, 0x93, 0x1D, 0xF0, 0xBC, 0xFF, 0xCE, 0x3F, 0x48, 0x00, 0xCA, 0x3F, 0x50, 0x00, 0xCA, 0x3F, 0x40, 0x26, 0x00, 0x40, 0x34, 0x26, 0x00, 0x40, 0xD0, 0x26, 0x00, 0x40, 0x36, 0x61, 0x00, 0x7C, 0xC8, 0xAD, 0x02, 0x87, 0x93, 0x2D, 0x31, 0xF7, 0xFF, 0xC6, 0x05, 0x00, 0x00, 0xA8, 0x03, 0x0C, 0x1C, 0xBD, 0x01, 0x81, 0xF7, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0x8F, 0xFE, 0xA2, 0x01, 0x00, 0x88, 0x08, 0xE0, 0x08, 0x00, 0xA8, 0x03, 0x81, 0xF3, 0xFF, 0xE0, 0x08, 0x00, 0xE6, 0x1A, 0xDD, 0xC6, 0x0A, 0x00, 0x00, 0x00, 0x66, 0x03, 0x26, 0x0C, 0x03, 0xCD, 0x01, 0x0C, 0x2B, 0x32, 0x61, 0x00, 0x81, 0xEE, 0xFF, 0xE0, 0x08, 0x00, 0x98, 0x01, 0x81, 0xE8, 0xFF, 0x37, 0x99, 0x0D, 0xA8, 0x08, 0x66, 0x1A, 0x08, 0x31, 0xE6, 0xFF, 0xC0, 0x20, 0x00, 0xA2, 0x43, 0x00, 0x99, 0x08, 0x1D, 0xF0, 0x44, 0x00, 0xCA, 0x3F, 0x02, 0x00, 0xCA, 0x3F, 0x28, 0x26, 0x00, 0x40, 0x36, 0x41, 0x00, 0x21, 0xFC, 0xFF, 0x81, 0xDC, 0xFF, 0xC8, 0x02, 0xA8, 0x08, 0xB1, 0xFA, 0xFF, 0x81, 0xFB, 0xFF, 0xE0, 0x08, 0x00, 0x0C, 0x08, 0x89, 0x02, 0x1D, 0xF0, 0x90, 0x06, 0x00, 0x40, 0x36, 0x41, 0x00, 0x10, 0x11, 0x20, 0xA5, 0xF3, 0xFF, 0x8C, 0xBA, 0x81, 0xF2, 0xFF, 0x88, 0x08, 0x8C, 0x48, 0x10, 0x11, 0x20, 0xA5, 0xFC, 0xFF, 0x10, 0x11, 0x20, 0xE5, 0xF0, 0xFF, 0x16, 0x2A, 0x00, 0xA2, 0xA0, 0x04, 0x81, 0xF6, 0xFF, 0xE0, 0x08, 0x00, 0x1D, 0xF0, 0x00, 0x00, 0xCA, 0x3F, 0x48, 0x06, 0x00, 0x40, 0x36, 0x41, 0x00, 0x10, 0x11, 0x20, 0x65, 0xF0, 0xFF, 0x4D, 0x0A, 0xBC, 0x3A, 0x31, 0xE4, 0xFF, 0x0C, 0x19, 0x88, 0x03, 0x0C, 0x0A, 0x1B, 0x48, 0x49, 0x03, 0x31, 0xE2, 0xFF, 0x8A, 0x33, 0x82, 0xC8, 0xC1, 0x80, 0xA9, 0x83, 0x22, 0x43, 0x00, 0xA0, 0x40, 0x74, 0xCC, 0xAA, 0x32, 0xAF, 0x40, 0x30, 0x32, 0x80, 0x30, 0x94, 0x93, 0x16, 0x69, 0x04, 0x10, 0x11, 0x20, 0xE5, 0xF6, 0xFF, 0x46, 0x0F, 0x00, 0xAD, 0x02, 0x81, 0xEE, 0xFF, 0xE0, 0x08, 0x00, 0x10, 0x11, 0x20, 0x65, 0xEA, 0xFF, 0xAC, 0xCA, 0x31, 0xE9, 0xFF, 0x3C, 0xE9, 0x82, 0x13, 0x00, 0x1B, 0x88, 0x80, 0x80, 0xF4, 0x82, 0x53, 0x00, 0x87, 0x39, 0x0F, 0x82, 0xAF, 0x40, 0x8A, 0x22, 0x0C, 0x1A, 0x20, 0xA4, 0x93, 0xA0, 0xA0, 0x74, 0x16, 0xAA, 0x00, 0x0C, 0x02, 0x10, 0x11, 0x20, 0x25, 0xF5, 0xFF, 0x22, 0x53, 0x00, 0x1D, 0xF0, 0x00, 0x00, 0x36, 0x41, 0x00, 0xA2, 0xA0, 0xC0, 0x10, 0x11, 0x20, 0x25, 0xF7, 0xFF, 0x1D, 0xF0, 0x00, 0x00, 0x36, 0x41, 0x00, 0x82, 0xA0, 0xC0, 0xAD, 0x02, 0x87, 0x92, 0x11, 0xA2, 0xA0, 0xDB, 0x10, 0x11, 0x20, 0xA5, 0xF5, 0xFF, 0xA2, 0xA0, 0xDC, 0x46, 0x04, 0x00, 0x00, 0x00, 0x00, 0x82, 0xA0, 0xDB, 0x87, 0x92, 0x08, 0x10, 0x11, 0x20, 0x65, 0xF4, 0xFF, 0xA2, 0xA0, 0xDD, 0x10, 0x11, 0x20, 0xE5, 0xF3, 0xFF, 0x1D, 0xF0, 0x36, 0x41, 0x00, 0x3A, 0x32, 0xC6, 0x02, 0x00, 0x00, 0xA2, 0x02, 0x00, 0x1B, 0x22, 0x10, 0x11, 0x20, 0xA5, 0xFB, 0xFF, 0x37, 0x92, 0xF1, 0x1D, 0xF0, 0x00, 0x00, 0x00, 0x5C, 0x1C, 0x00, 0x40, 0x20, 0x0A, 0x00, 0x40, 0x68, 0x1C, 0x00, 0x40, 0x74, 0x1C, 0x00, 0x40, 0x36, 0x21, 0x21, 0xA2, 0xD1, 0x10, 0x81, 0xFA, 0xFF, 0xE0, 0x08, 0x00, 0x86, 0x0F, 0x00, 0x00, 0x51, 0xD0, 0xFE, 0x0C, 0x14, 0x40, 0x44, 0x11, 0x82, 0x05, 0x00, 0x40, 0x43, 0x63, 0xCD, 0x04, 0xBD, 0x01, 0xAD, 0x02, 0x8C, 0x98, 0x10, 0x11, 0x20, 0x25, 0xA6, 0xFF, 0xC6, 0x01, 0x00, 0x00, 0x00, 0x81, 0xF0, 0xFF, 0xE0, 0x08, 0x00, 0xA0, 0xA0, 0x74, 0xFC, 0x3A, 0xCD, 0x04, 0xBD, 0x01, 0xA2, 0xD1, 0x10, 0x81, 0xED, 0xFF, 0xE0, 0x08, 0x00, 0x4A, 0x22, 0x40, 0x33, 0xC0, 0x56, 0xE3, 0xFB, 0x22, 0xA2, 0x0B, 0x10, 0x22, 0xB0, 0xAD, 0x02, 0xB2, 0xD1, 0x10, 0x81, 0xE8, 0xFF, 0xE0, 0x08, 0x00, 0xAD, 0x02, 0x1C, 0x0B, 0x10, 0x11, 0x20, 0xA5, 0xF6, 0xFF, 0x2D, 0x03, 0x86, 0x00, 0x00, 0x22, 0xA0, 0x63, 0x1D, 0xF0, 0x00, 0x00, 0x88, 0x26, 0x00, 0x40, 0x84, 0x1B, 0x00, 0x40, 0x94, 0x26, 0x00, 0x40, 0x90, 0x1B, 0x00, 0x40, 0x36, 0x41, 0x00, 0x10, 0x11, 0x20, 0xA5, 0xD8, 0xFF, 0xAC, 0x8A, 0x0C, 0x13, 0x41, 0x66, 0xFF, 0xF0, 0x33, 0x01, 0x8C, 0xB2, 0xA8, 0x04, 0x81, 0xF6, 0xFF, 0xE0, 0x08, 0x00, 0xAD, 0x03, 0xC6, 0x09, 0x00, 0xAD, 0x03, 0x81, 0xF4, 0xFF, 0xE0, 0x08, 0x00, 0xA8, 0x04, 0x81, 0xF3, 0xFF, 0xE0, 0x08, 0x00, 0x06, 0x09, 0x00, 0x10, 0x11, 0x20, 0xE5, 0xD3, 0xFF, 0x0C, 0x18, 0xF0, 0x88, 0x01, 0x2C, 0x03, 0xA0, 0x83, 0x83, 0xAD, 0x08, 0x16, 0x92, 0x00, 0x81, 0xEC, 0xFF, 0xE0, 0x08, 0x00, 0x86, 0x01, 0x00, 0x00, 0x81, 0xE8, 0xFF, 0xE0, 0x08, 0x00, 0x1D, 0xF0, 0x60, 0x06, 0x00, 0x40, 0x36, 0x41, 0x21, 0x62, 0xA4, 0x1D, 0xE0, 0x66, 0x11, 0x1A, 0x66, 0x59, 0x06, 0x0C, 0x17, 0x52, 0xA0, 0x00, 0x62, 0xD1, 0x10, 0x50, 0xA5, 0x20, 0x40, 0x77, 0x11, 0x52, 0x66, 0x1A, 0x10, 0x11, 0x20, 0xE5, 0xF7, 0xFF, 0x47, 0xB7, 0x02, 0xC6, 0x42, 0x00, 0xAD, 0x06, 0x81, 0xB7, 0xFF, 0xE0, 0x08, 0x00, 0xC6, 0x2F, 0x00, 0x91, 0x8C, 0xFE, 0x50, 0x73, 0xC0, 0x82, 0x09, 0x00, 0x40, 0x77, 0x63, 0xCD, 0x07, 0xBD, 0x01, 0xAD, 0x02, 0x16, 0xA8, 0x00, 0x10, 0x11, 0x20, 0x65, 0x95, 0xFF, 0xC6, 0x01, 0x00, 0x00, 0x00, 0x81, 0xAD, 0xFF, 0xE0, 0x08, 0x00, 0xA0, 0xA0, 0x74, 0x8C, 0xAA, 0x0C, 0x08, 0x82, 0x66, 0x16, 0x7D, 0x08, 0x46, 0x12, 0x00, 0x00, 0x00, 0x10, 0x11, 0x20, 0xA5, 0xE3, 0xFF, 0xBD, 0x07, 0xAD, 0x01, 0x10, 0x11, 0x20, 0x25, 0xE7, 0xFF, 0x10, 0x11, 0x20, 0xA5, 0xE2, 0xFF, 0xCD, 0x07, 0x10, 0xB1, 0x20, 0x60, 0xA6, 0x20, 0x81, 0xA1, 0xFF, 0xE0, 0x08, 0x00, 0x7A, 0x22, 0x7A, 0x55, 0x37, 0xB5, 0xC8, 0x82, 0xA1, 0x07, 0xC0, 0x88, 0x11, 0x92, 0xA4, 0x1D, 0x1A, 0x88, 0xE0, 0x99, 0x11, 0x88, 0x08, 0x1A, 0x99, 0x98, 0x09, 0x80, 0x75, 0xC0, 0x97, 0x37, 0x83, 0xC6, 0xEA, 0xFF, 0x0C, 0x08, 0x82, 0x46, 0x6C, 0xA2, 0xA4, 0x1B, 0x10, 0xAA, 0xA0, 0x81, 0xCF, 0xFF, 0xE0, 0x08, 0x00, 0x56, 0x0A, 0xFF, 0xB2, 0xA2, 0x0B, 0xA2, 0x06, 0x6C, 0x10, 0xBB, 0xB0, 0x10, 0x11, 0x20, 0xA5, 0xB2, 0x00, 0xF7, 0xEA, 0x12, 0xF6, 0x47, 0x0F, 0x92, 0xA2, 0x0D, 0x10, 0x99, 0xB0, 0x7A, 0x99, 0xA2, 0x49, 0x00, 0x1B, 0x77, 0x86, 0xF1, 0xFF, 0x7C, 0xE9, 0x97, 0x9A, 0xC1, 0x66, 0x47, 0x12, 0x92, 0xA1, 0x07, 0x82, 0x26, 0x1A, 0xC0, 0x99, 0x11, 0x1A, 0x99, 0x89, 0x09, 0x37, 0xB8, 0x02, 0x87, 0xB5, 0x8B, 0x22, 0xA2, 0x0B, 0x10, 0x22, 0xB0, 0xBD, 0x06, 0xAD, 0x02, 0x81, 0x80, 0xFF, 0xE0, 0x08, 0x00, 0x10, 0x11, 0x20, 0xE5, 0xD8, 0xFF, 0xAD, 0x02, 0x1C, 0x0B, 0x10, 0x11, 0x20, 0x65, 0xDC, 0xFF, 0x10, 0x11, 0x20, 0xE5, 0xD7, 0xFF, 0x0C, 0x1A, 0x10, 0x11, 0x20, 0xE5, 0xE6, 0xFF, 0x1D, 0xF0, 0x00, 0x00, 0xCA, 0x3F, 0x4F, 0x48, 0x41, 0x49, 0xB0, 0x80, 0x00, 0x60, 0xA1, 0x3A, 0xD8, 0x50, 0x98, 0x80, 0x00, 0x60, 0xB8, 0x80, 0x00, 0x60, 0x2A, 0x31, 0x1D, 0x8F, 0xB4, 0x80, 0x00, 0x60, 0xFC, 0x2B, 0xCB, 0x3F, 0xAC, 0x80, 0x37, 0x40, 0x98, 0x20, 0x0C, 0x60, 0x3C, 0x82, 0x37, 0x40, 0xAC, 0x85, 0x37, 0x40, 0x08, 0x00, 0x08, 0x60, 0x80, 0x21, 0x0C, 0x60, 0x10, 0x80, 0x37, 0x40, 0x10, 0x80, 0x03, 0x60, 0x50, 0x80, 0x37, 0x40, 0x0C, 0x00, 0x00, 0x60, 0x38, 0x40, 0x00, 0x60, 0x9C, 0x2C, 0xCB, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x2C, 0x81, 0x00, 0x60, 0x10, 0x40, 0x00, 0x00, 0x00, 0x2C, 0xCB, 0x3F, 0x10, 0x2C, 0xCB, 0x3F, 0x7C, 0x90, 0x00, 0x60, 0xFF, 0x8F, 0xFF, 0xFF, 0x80, 0x90, 0x00, 0x60, 0x84, 0x90, 0x00, 0x60, 0x78, 0x90, 0x00, 0x60, 0x54, 0x00, 0xCA, 0x3F, 0x58, 0x00, 0xCA, 0x3F, 0x5C, 0x2C, 0xCB, 0x3F, 0x14, 0x00, 0x00, 0x60, 0xF0, 0xFF, 0xFF, 0x00, 0xFC, 0x2B, 0xCB, 0x3F, 0x5C, 0x00, 0xCA, 0x3F, 0x74, 0x80, 0xCA, 0x3F, 0x80, 0x07, 0x00, 0x40, 0x78, 0x1B, 0x00, 0x40, 0xB8, 0x26, 0x00, 0x40, 0x64, 0x26, 0x00, 0x40, 0x74, 0x1F, 0x00, 0x40, 0xEC, 0x0A, 0x00, 0x40, 0x04, 0x20, 0x00, 0x40, 0x54, 0x09, 0x00, 0x40, 0x50, 0x0A, 0x00, 0x40, 0x00, 0x06, 0x00, 0x40, 0x1C, 0x29, 0x00, 0x40, 0x24, 0x27, 0x00, 0x40, 0x08, 0x28, 0x00, 0x40, 0xE4, 0x06, 0x00, 0x40, 0x74, 0x81, 0x04, 0x40, 0x9C, 0x09, 0x00, 0x40, 0xFC, 0x09, 0x00, 0x40, 0x08, 0x0A, 0x00, 0x40, 0xA8, 0x06, 0x00, 0x40, 0x84, 0x09, 0x00, 0x40, 0x6C, 0x09, 0x00, 0x40, 0x90, 0x09, 0x00, 0x40, 0x28, 0x08, 0x00, 0x40, 0xD8, 0x06, 0x00, 0x40, 0x36, 0x01, 0x01, 0x21, 0xC1, 0xFF, 0x0C, 0x0A, 0x22, 0x61, 0x10, 0x81, 0xE5, 0xFF, 0xE0, 0x08, 0x00, 0x10, 0x11, 0x20, 0xE5, 0xAC, 0xFF, 0x16, 0x8A, 0x04, 0x31, 0xBC, 0xFF, 0x21, 0xBC, 0xFF, 0x41, 0xBD, 0xFF, 0xC0, 0x20, 0x00, 0x29, 0x03, 0x0C, 0x02, 0xC0, 0x20, 0x00, 0x29, 0x04, 0xC0, 0x20, 0x00, 0x29, 0x03, 0x51, 0xB9, 0xFF, 0x31, 0xB9, 0xFF, 0x61, 0xB9, 0xFF, 0xC0, 0x20, 0x00, 0x39, 0x05, 0xC0, 0x20, 0x00, 0x38, 0x06, 0x7C, 0xF4, 0x10, 0x44, 0x01, 0x40, 0x33, 0x20, 0xC0, 0x20, 0x00, 0x39, 0x06, 0xC0, 0x20, 0x00, 0x29, 0x05, 0x86, 0x01, 0x00, 0x49, 0x02, 0x4B, 0x22, 0x06, 0x02, 0x00, 0x21, 0xA8, 0xFF, 0x31, 0xAF, 0xFF, 0x42, 0xA0, 0x00, 0x37, 0x32, 0xEC, 0x10, 0x11, 0x20, 0x25, 0xC0, 0xFF, 0x0C, 0x4B, 0xA2, 0xC1, 0x40, 0x10, 0x11, 0x20, 0xA5, 0xC3, 0xFF, 0x22, 0xA1, 0x01, 0x10, 0x11, 0x20, 0xE5, 0xBE, 0xFF, 0x31, 0x63, 0xFD, 0x90, 0x22, 0x11, 0x2A, 0x23, 0xC0, 0x20, 0x00, 0x39, 0x02, 0x41, 0xA4, 0xFF, 0x21, 0x3B, 0xFD, 0x49, 0x02, 0x10, 0x11, 0x20, 0xA5, 0xA5, 0xFF, 0x2D, 0x0A, 0x16, 0xFA, 0x05, 0x21, 0x9A, 0xFE, 0xC1, 0x9B, 0xFE, 0xA8, 0x02, 0x0C, 0x2B, 0x81, 0x9D, 0xFE, 0xE0, 0x08, 0x00, 0x41, 0x9C, 0xFF, 0xB1, 0x9D, 0xFF, 0x1C, 0x1A, 0x0C, 0x0C, 0xC0, 0x20, 0x00, 0xA9, 0x04, 0x81, 0xB7, 0xFF, 0xE0, 0x08, 0x00, 0x0C, 0x1A, 0xF0, 0xAA, 0x01, 0x81, 0x25, 0xFF, 0xE0, 0x08, 0x00, 0xB1, 0x96, 0xFF, 0xA8, 0x02, 0x0C, 0x15, 0x81, 0xB2, 0xFF, 0xE0, 0x08, 0x00, 0xA8, 0x02, 0x81, 0x1D, 0xFF, 0xE0, 0x08, 0x00, 0xA8, 0x02, 0x81, 0xAF, 0xFF, 0xE0, 0x08, 0x00, 0x41, 0x90, 0xFF, 0xC0, 0x20, 0x00, 0x28, 0x04, 0x50, 0x22, 0x20, 0xC0, 0x20, 0x00, 0x29, 0x04, 0x86, 0x16, 0x00, 0x10, 0x11, 0x20, 0x65, 0x9D, 0xFF, 0xAC, 0x9A, 0x41, 0x8A, 0xFF, 0x1C, 0x1A, 0xB1, 0x8A, 0xFF, 0xC0, 0x20, 0x00, 0xA2, 0x64, 0x00, 0x20, 0xC2, 0x20, 0x81, 0xA0, 0xFF, 0xE0, 0x08, 0x00, 0x21, 0x87, 0xFF, 0x0C, 0x44, 0x0C, 0x1A, 0xC0, 0x20, 0x00, 0x49, 0x02, 0xF0, 0xAA, 0x01, 0xC6, 0x08, 0x00, 0x00, 0x00, 0xB1, 0x83, 0xFF, 0xCD, 0x0A, 0x0C, 0x5A, 0x81, 0x98, 0xFF, 0xE0, 0x08, 0x00, 0x41, 0x80, 0xFF, 0x52, 0xA1, 0x01, 0xC0, 0x20, 0x00, 0x28, 0x04, 0x2C, 0x0A, 0x50, 0x22, 0x20, 0xC0, 0x20, 0x00, 0x29, 0x04, 0x81, 0x02, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0x93, 0xFF, 0xE0, 0x08, 0x00, 0x21, 0x79, 0xFF, 0xC0, 0x20, 0x00, 0x28, 0x02, 0xCC, 0xBA, 0x1C, 0xC4, 0x40, 0x22, 0x10, 0x22, 0xC2, 0xF8, 0x0C, 0x14, 0x20, 0xA4, 0x83, 0x0C, 0x0B, 0x81, 0x8C, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0x8B, 0xFF, 0xE0, 0x08, 0x00, 0x5D, 0x0A, 0x8C, 0x9A, 0x41, 0xA8, 0xFD, 0x0C, 0x12, 0x22, 0x44, 0x00, 0x46, 0x14, 0x00, 0x1C, 0x86, 0x0C, 0x12, 0x69, 0x41, 0x62, 0xC1, 0x20, 0xA9, 0x61, 0x69, 0x31, 0xA9, 0x21, 0xA9, 0x11, 0xA9, 0x01, 0xFD, 0x0A, 0xED, 0x0A, 0x29, 0x51, 0x0C, 0x8D, 0xC2, 0xA0, 0x9F, 0xB2, 0xA0, 0x04, 0x20, 0xA2, 0x20, 0x81, 0x6A, 0xFD, 0xE0, 0x08, 0x00, 0x72, 0x01, 0x22, 0x1C, 0x68, 0x62, 0xC7, 0xE7, 0x60, 0x60, 0x74, 0x67, 0xB8, 0x01, 0x2D, 0x05, 0x3C, 0x86, 0x0C, 0x15, 0x77, 0x36, 0x01, 0x0C, 0x05, 0x41, 0x94, 0xFD, 0x50, 0x22, 0x20, 0x20, 0x20, 0x74, 0x22, 0x44, 0x00, 0x16, 0xE2, 0x00, 0xA1, 0x59, 0xFF, 0x81, 0x72, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0x5B, 0xFD, 0xE0, 0x08, 0x00, 0xF1, 0x56, 0xFF, 0x0C, 0x1D, 0x0C, 0x1C, 0x0C, 0x1B, 0xE2, 0xA1, 0x00, 0x40, 0xDD, 0x11, 0x00, 0xCC, 0x11, 0x60, 0xBB, 0x01, 0x0C, 0x0A, 0x81, 0x6A, 0xFF, 0xE0, 0x08, 0x00, 0x31, 0x84, 0xFD, 0x62, 0xD3, 0x2B, 0x86, 0x16, 0x00, 0xC0, 0x20, 0x00, 0x52, 0x07, 0x00, 0x50, 0x50, 0x74, 0x16, 0x15, 0x05, 0x0C, 0x1A, 0xF0, 0xAA, 0x01, 0xC0, 0x20, 0x00, 0x22, 0x47, 0x00, 0x81, 0xC9, 0xFE, 0xE0, 0x08, 0x00, 0xA2, 0xA2, 0x71, 0xC0, 0xAA, 0x11, 0x81, 0x5F, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0x5E, 0xFF, 0xE0, 0x08, 0x00, 0x71, 0x42, 0xFF, 0x7C, 0xE8, 0xC0, 0x20, 0x00, 0x58, 0x07, 0x7C, 0xFA, 0x80, 0x55, 0x10, 0x10, 0xAA, 0x01, 0xC0, 0x20, 0x00, 0x59, 0x07, 0x81, 0x58, 0xFF, 0xE0, 0x08, 0x00, 0x81, 0x57, 0xFF, 0xE0, 0x08, 0x00, 0x20, 0xA2, 0x20, 0x81, 0x56, 0xFF, 0xE0, 0x08, 0x00, 0x71, 0x27, 0xFE, 0x41, 0xE9, 0xFC, 0xC0, 0x20, 0x00, 0x28, 0x04, 0x16, 0x62, 0xF9, 0x0C, 0x07, 0xC0, 0x20, 0x00, 0x58, 0x04, 0x0C, 0x12, 0xC0, 0x20, 0x00, 0x79, 0x04, 0x22, 0x41, 0x34, 0x22, 0x05, 0x01, 0x0C, 0x28, 0x79, 0xE1, 0x22, 0x41, 0x35, 0x82, 0x51, 0x1B, 0x1C, 0x37, 0x77, 0x12, 0x24, 0x1C, 0x47, 0x77, 0x12, 0x21, 0x66, 0x92, 0x21, 0x22, 0x05, 0x03, 0x72, 0x05, 0x02, 0x80, 0x22, 0x11, 0x70, 0x22, 0x20, 0x66, 0x42, 0x12, 0x28, 0x25, 0xC0, 0x20, 0x00, 0x28, 0x02, 0x29, 0xE1, 0x86, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x22, 0x22, 0x51, 0x1B, 0x10, 0x11, 0x20, 0x65, 0x99, 0xFF, 0xB2, 0xA0, 0x08, 0xA2, 0xC1, 0x34, 0x10, 0x11, 0x20, 0xE5, 0x9C, 0xFF, 0xB2, 0x05, 0x03, 0x22, 0x05, 0x02, 0x80, 0xBB, 0x11, 0x20, 0x4B, 0x20, 0x21, 0x19, 0xFF, 0x20, 0x20, 0xF4, 0x47, 0xB2, 0x1A, 0xA2, 0xA0, 0xC0, 0x10, 0x11, 0x20, 0xA5, 0x97, 0xFF, 0xA2, 0xA0, 0xEE, 0x10, 0x11, 0x20, 0x25, 0x97, 0xFF, 0x10, 0x11, 0x20, 0xE5, 0x95, 0xFF, 0x86, 0xD8, 0xFF, 0x22, 0x05, 0x01, 0x1C, 0x47, 0x27, 0x37, 0x37, 0xF6, 0x22, 0x1B, 0x06, 0x09, 0x01, 0x00, 0x22, 0xC2, 0x2F, 0x20, 0x20, 0x74, 0xB6, 0x42, 0x02, 0x06, 0x25, 0x00, 0x71, 0x0B, 0xFF, 0x70, 0x22, 0xA0, 0x28, 0x02, 0xA0, 0x02, 0x00, 0x00, 0x22, 0xC2, 0xFE, 0x20, 0x20, 0x74, 0x1C, 0x27, 0x27, 0xB7, 0x02, 0x46, 0xFF, 0x00, 0x71, 0x05, 0xFF, 0x70, 0x22, 0xA0, 0x28, 0x02, 0xA0, 0x02, 0x00, 0x72, 0xC2, 0x30, 0x70, 0x70, 0x74, 0xB6, 0x57, 0xC5, 0x86, 0xF9, 0x00, 0x2C, 0x49, 0x0C, 0x07, 0x22, 0xA0, 0xC0, 0x97, 0x14, 0x02, 0x86, 0xF7, 0x00, 0x79, 0xE1, 0x0C, 0x72, 0xAD, 0x07, 0x10, 0x11, 0x20, 0x65, 0x90, 0xFF, 0xAD, 0x07, 0x10, 0x11, 0x20, 0xE5, 0x8F, 0xFF, 0x10, 0x11, 0x20, 0x65, 0x8E, 0xFF, 0x10, 0x11, 0x20, 0x25, 0x8E, 0xFF, 0x0C, 0x8B, 0xA2, 0xC1, 0x34, 0x22, 0xC2, 0xFF, 0x10, 0x11, 0x20, 0x65, 0x91, 0xFF, 0x56, 0x22, 0xFD, 0x46, 0x40, 0x00, 0x0C, 0x12, 0x56, 0xA4, 0x39, 0xC2, 0xC1, 0x20, 0xBD, 0x04, 0xAD, 0x04, 0x81, 0x08, 0xFF, 0xE0, 0x08, 0x00, 0x56, 0xAA, 0x38, 0x1C, 0x4B, 0xA2, 0xC1, 0x20, 0x10, 0x11, 0x20, 0x25, 0x8F, 0xFF, 0x86, 0xC0, 0x00, 0x0C, 0x12, 0x56, 0x74, 0x37, 0x81, 0x02, 0xFF, 0xE0, 0x08, 0x00, 0xA0, 0x24, 0x83, 0xC6, 0xDA, 0x00, 0x26, 0x84, 0x04, 0x0C, 0x12, 0xC6, 0xD8, 0x00, 0x28, 0x25, 0x78, 0x35, 0x70, 0x82, 0x20, 0x80, 0x80, 0xB4, 0x56, 0xD8, 0xFE, 0x10, 0x11, 0x20, 0x65, 0x3E, 0xFF, 0x7A, 0x22, 0xAC, 0x9A, 0x06, 0xF8, 0xFF, 0x41, 0x0D, 0xFD, 0xA0, 0xAC, 0x41, 0x82, 0x04, 0x00, 0x8C, 0xF8, 0x81, 0x22, 0xFD, 0xE0, 0x08, 0x00, 0x46, 0x03, 0x00, 0x72, 0xD7, 0xF0, 0x46, 0x03, 0x00, 0x00, 0x00, 0x81, 0xF1, 0xFE, 0xE0, 0x08, 0x00, 0x16, 0xEA, 0xFE, 0x06, 0xEE, 0xFF, 0x70, 0xA2, 0xC0, 0xCC, 0x17, 0xC6, 0xA7, 0x00, 0xA0, 0x80, 0xF4, 0x56, 0x98, 0xFC, 0x46, 0x0A, 0x00, 0x41, 0xFE, 0xFC, 0xA0, 0xA0, 0xF5, 0x82, 0x04, 0x00, 0x9C, 0x18, 0x81, 0x13, 0xFD, 0xE0, 0x08, 0x00, 0xC6, 0x03, 0x00, 0x7C, 0xF8, 0x00, 0x88, 0x11, 0x8A, 0x77, 0xC6, 0x02, 0x00, 0x81, 0xE3, 0xFE, 0xE0, 0x08, 0x00, 0x16, 0xCA, 0xFE, 0x46, 0xDF, 0xFF, 0x0C, 0x18, 0x00, 0x88, 0x11, 0x70, 0xA2, 0xC0, 0x77, 0x38, 0xCA, 0x86, 0x09, 0x00, 0x41, 0xF0, 0xFC, 0xA0, 0xAC, 0x41, 0x82, 0x04, 0x00, 0x8C, 0xE8, 0x81, 0x06, 0xFD, 0xE0, 0x08, 0x00, 0x06, 0x03, 0x00, 0x72, 0xD7, 0xF0, 0x06, 0x03, 0x00, 0x00, 0x81, 0xD5, 0xFE, 0xE0, 0x08, 0x00, 0x16, 0xFA, 0xFE, 0x06, 0xD2, 0xFF, 0x70, 0xA2, 0xC0, 0x56, 0x27, 0xFD, 0x86, 0x8B, 0x00, 0x0C, 0x07, 0x22, 0xA0, 0xC0, 0x26, 0x84, 0x02, 0x06, 0xAA, 0x00, 0x0C, 0x07, 0x2D, 0x07, 0x46, 0xA8, 0x00, 0x26, 0xB4, 0xF5, 0x06, 0x7E, 0x00, 0x0C, 0x12, 0x26, 0xB4, 0x02, 0x06, 0xA2, 0x00, 0xB8, 0x35, 0xA8, 0x25, 0x0C, 0x07, 0x10, 0x11, 0x20, 0xA5, 0x81, 0xFF, 0xA0, 0x27, 0x83, 0x86, 0x9D, 0x00, 0x0C, 0x19, 0x66, 0xB4, 0x5F, 0x88, 0x45, 0x20, 0xA9, 0x11, 0x0C, 0x07, 0x22, 0xA0, 0xC2, 0x87, 0xBA, 0x02, 0x06, 0x9B, 0x00, 0xB8, 0x55, 0xA8, 0x25, 0x92, 0x61, 0x16, 0x10, 0x11, 0x20, 0x65, 0x34, 0xFF, 0x92, 0x21, 0x16, 0xA0, 0x97, 0x83, 0x46, 0x0E, 0x00, 0x0C, 0x19, 0x66, 0xB4, 0x34, 0x88, 0x45, 0x20, 0xA9, 0x11, 0x0C, 0x07, 0x22, 0xA0, 0xC2, 0x87, 0xBA, 0x02, 0x46, 0x90, 0x00, 0x28, 0x35, 0xB8, 0x55, 0xA8, 0x25, 0x20, 0x78, 0x82, 0x92, 0x61, 0x16, 0x10, 0x11, 0x20, 0x65, 0x31, 0xFF, 0x21, 0xC1, 0xFC, 0x0C, 0x08, 0x92, 0x21, 0x16, 0x89, 0x62, 0x22, 0xD2, 0x2B, 0x72, 0x62, 0x02, 0xA0, 0x98, 0x83, 0x2D, 0x09, 0x06, 0x83, 0x00, 0x91, 0xBB, 0xFC, 0x0C, 0x07, 0xA2, 0x09, 0x00, 0x22, 0xA0, 0xC6, 0x77, 0x9A, 0x02, 0x86, 0x81, 0x00, 0x78, 0x25, 0xB2, 0xC4, 0xF0, 0x22, 0xA0, 0xC0, 0xB7, 0x97, 0x02, 0x22, 0x29, 0x05, 0x0C, 0x07, 0x92, 0xA0, 0xEF, 0x46, 0x02, 0x00, 0x7A, 0x85, 0x82, 0x08, 0x18, 0x1B, 0x77, 0x80, 0x99, 0x30, 0xB7, 0x27, 0xF2, 0x82, 0x05, 0x05, 0x72, 0x05, 0x04, 0x80, 0x88, 0x11, 0x70, 0x88, 0x20, 0x72, 0x05, 0x06, 0x00, 0x77, 0x11, 0x80, 0x77, 0x20, 0x82, 0x05, 0x07, 0x80, 0x88, 0x01, 0x70, 0x88, 0x20, 0x80, 0x99, 0xC0, 0x82, 0xA0, 0xC1, 0x0C, 0x07, 0x90, 0x28, 0x93, 0xC6, 0x6D, 0x00, 0x81, 0xA3, 0xFC, 0x22, 0xA0, 0xC6, 0x92, 0x08, 0x00, 0x7D, 0x09, 0x16, 0x99, 0x1A, 0x98, 0x38, 0x0C, 0x07, 0x22, 0xA0, 0xC8, 0x77, 0x19, 0x02, 0x06, 0x67, 0x00, 0x28, 0x58, 0x92, 0x48, 0x00, 0x46, 0x62, 0x00, 0x1C, 0x89, 0x0C, 0x07, 0x0C, 0x12, 0x97, 0x14, 0x02, 0x06, 0x62, 0x00, 0xF8, 0x75, 0xE8, 0x65, 0xD8, 0x55, 0xC8, 0x45, 0xB8, 0x35, 0xA8, 0x25, 0x81, 0x7A, 0xFE, 0xE0, 0x08, 0x00, 0x0C, 0x08, 0x7D, 0x0A, 0xA0, 0x28, 0x83, 0x06, 0x5B, 0x00, 0x0C, 0x12, 0x26, 0x44, 0x02, 0x46, 0x56, 0x00, 0x91, 0x5F, 0xFE, 0x81, 0x5F, 0xFE, 0xC0, 0x20, 0x00, 0x78, 0x09, 0x40, 0x22, 0x11, 0x80, 0x77, 0x10, 0x20, 0x77, 0x20, 0xA8, 0x25, 0xC0, 0x20, 0x00, 0x79, 0x09, 0x91, 0x5A, 0xFE, 0x0C, 0x0B, 0xC0, 0x20, 0x00, 0x78, 0x09, 0x80, 0x77, 0x10, 0x20, 0x77, 0x20, 0xC0, 0x20, 0x00, 0x79, 0x09, 0x91, 0x56, 0xFE, 0xC0, 0x20, 0x00, 0x78, 0x09, 0x80, 0x77, 0x10, 0x20, 0x77, 0x20, 0xC0, 0x20, 0x00, 0x79, 0x09, 0x91, 0x52, 0xFE, 0xC0, 0x20, 0x00, 0x78, 0x09, 0x80, 0x77, 0x10, 0x20, 0x27, 0x20, 0xC0, 0x20, 0x00, 0x29, 0x09, 0x81, 0x5B, 0xFE, 0xE0, 0x08, 0x00, 0x06, 0x20, 0x00, 0x00, 0x40, 0x90, 0x34, 0x0C, 0x07, 0x22, 0xA0, 0xC0, 0x77, 0x19, 0x02, 0x86, 0x3D, 0x00, 0x40, 0x44, 0x41, 0x8B, 0xC5, 0x7C, 0xF8, 0x46, 0x0F, 0x00, 0xA8, 0x3C, 0x82, 0x61, 0x15, 0x92, 0x61, 0x16, 0xC2, 0x61, 0x14, 0x81, 0x54, 0xFE, 0xE0, 0x08, 0x00, 0xC2, 0x21, 0x14, 0x82, 0x21, 0x15, 0x28, 0x2C, 0x78, 0x1C, 0xA8, 0x0C, 0x92, 0x21, 0x16, 0x70, 0x72, 0x10, 0x26, 0x02, 0x0D, 0xC0, 0x20, 0x00, 0xD8, 0x0A, 0x20, 0x28, 0x30, 0xD0, 0x22, 0x10, 0x20, 0x77, 0x20, 0xC0, 0x20, 0x00, 0x79, 0x0A, 0x1B, 0x99, 0xC2, 0xCC, 0x10, 0x47, 0x39, 0xBE, 0xC6, 0x7F, 0xFF, 0x66, 0x44, 0x02, 0x46, 0x7E, 0xFF, 0x0C, 0x07, 0x22, 0xA0, 0xC0, 0x86, 0x26, 0x00, 0x0C, 0x12, 0x26, 0xB4, 0x02, 0xC6, 0x21, 0x00, 0x21, 0x2F, 0xFE, 0x88, 0x55, 0x78, 0x25, 0x89, 0x02, 0x21, 0x2E, 0xFE, 0x79, 0x02, 0x0C, 0x02, 0x06, 0x1D, 0x00, 0xF1, 0x2A, 0xFE, 0x0C, 0x07, 0xC8, 0x0F, 0x0C, 0x19, 0xB2, 0xC4, 0xF0, 0x8D, 0x07, 0x2D, 0x07, 0xB0, 0x29, 0x93, 0xC0, 0x89, 0x83, 0x20, 0x88, 0x10, 0x22, 0xA0, 0xC6, 0x77, 0x98, 0x60, 0xA1, 0x24, 0xFE, 0x7D, 0x08, 0xD8, 0x0A, 0x22, 0xA0, 0xC9, 0xB7, 0x3D, 0x53, 0xB0, 0xE0, 0x14, 0x22, 0xA0, 0xC0, 0x56, 0xAE, 0x04, 0x2D, 0x08, 0x86, 0x02, 0x00, 0x00, 0x2A, 0x85, 0x88, 0x68, 0x4B, 0x22, 0x89, 0x07, 0x8D, 0x09, 0x20, 0xED, 0xC0, 0x2A, 0x7C, 0xB7, 0x32, 0xED, 0x16, 0x68, 0xD8, 0xE9, 0x0A, 0x79, 0x0F, 0xC6, 0x5F, 0xFF, 0x0C, 0x12, 0x66, 0x84, 0x18, 0x21, 0x14, 0xFE, 0x82, 0x22, 0x00, 0x8C, 0x18, 0x82, 0xA0, 0xC8, 0x0C, 0x07, 0x79, 0x02, 0x21, 0x10, 0xFE, 0x79, 0x02, 0x0C, 0x12, 0x80, 0x27, 0x83, 0x0C, 0x07, 0x46, 0x01, 0x00, 0x00, 0x0C, 0x07, 0x22, 0xA0, 0xFF, 0x20, 0xA0, 0x74, 0x10, 0x11, 0x20, 0xA5, 0x52, 0xFF, 0x70, 0xA0, 0x74, 0x10, 0x11, 0x20, 0xE5, 0x51, 0xFF, 0x10, 0x11, 0x20, 0xA5, 0x50, 0xFF, 0x56, 0xF2, 0xB0, 0x22, 0x05, 0x01, 0x1C, 0x27, 0x27, 0x37, 0x1F, 0xF6, 0x32, 0x02, 0x46, 0xC0, 0xFE, 0x22, 0xC2, 0xFD, 0x20, 0x20, 0x74, 0x0C, 0xF7, 0x27, 0xB7, 0x02, 0xC6, 0xBC, 0xFE, 0x71, 0xFF, 0xFD, 0x70, 0x22, 0xA0, 0x28, 0x02, 0xA0, 0x02, 0x00, 0x00, 0x72, 0xA0, 0xD2, 0x77, 0x12, 0x5F, 0x72, 0xA0, 0xD4, 0x77, 0x92, 0x02, 0x06, 0x21, 0x00, 0x46, 0xB5, 0xFE, 0x28, 0x35, 0x58, 0x25, 0x10, 0x11, 0x20, 0xA5, 0x34, 0xFF, 0x8D, 0x0A, 0x56, 0x6A, 0xAC, 0xA2, 0xA2, 0x71, 0xC0, 0xAA, 0x11, 0x82, 0x61, 0x15, 0x81, 0x00, 0xFE, 0xE0, 0x08, 0x00, 0x71, 0xF1, 0xFD, 0x91, 0xF1, 0xFD, 0xC0, 0x20, 0x00, 0x78, 0x07, 0x82, 0x21, 0x15, 0x70, 0xB4, 0x35, 0xC0, 0x77, 0x11, 0x90, 0x77, 0x10, 0x70, 0xBB, 0x20, 0x20, 0xBB, 0x82, 0xAD, 0x08, 0x50, 0xBB, 0xC2, 0x81, 0xFF, 0xFD, 0xE0, 0x08, 0x00, 0xA2, 0xA3, 0xE8, 0x81, 0xF4, 0xFD, 0xE0, 0x08, 0x00, 0xC6, 0xA0, 0xFE, 0x00, 0x00, 0xD8, 0x55, 0xC8, 0x45, 0xB8, 0x35, 0xA8, 0x25, 0x10, 0x11, 0x20, 0x25, 0x5C, 0xFF, 0x06, 0x9C, 0xFE, 0x00, 0xB2, 0x05, 0x03, 0x22, 0x05, 0x02, 0x80, 0xBB, 0x11, 0x20, 0xBB, 0x20, 0xB2, 0xCB, 0xF0, 0xA2, 0xC5, 0x18, 0x10, 0x11, 0x20, 0x25, 0x1F, 0xFF, 0x06, 0x95, 0xFE, 0x00, 0x22, 0x05, 0x03, 0x72, 0x05, 0x02, 0x80, 0x22, 0x11, 0x70, 0x22, 0x20, 0x81, 0xED, 0xFD, 0xE0, 0x08, 0x00, 0x71, 0xFB, 0xFB, 0x22, 0xC2, 0xF0, 0x88, 0x37, 0x80, 0x22, 0x63, 0x16, 0x32, 0xA3, 0x88, 0x17, 0x8A, 0x82, 0x80, 0x8C, 0x41, 0x46, 0x03, 0x00, 0x00, 0x00, 0x82, 0x61, 0x15, 0x10, 0x11, 0x20, 0xA5, 0x03, 0xFF, 0x82, 0x21, 0x15, 0x92, 0x27, 0x04, 0xA6, 0x19, 0x05, 0x92, 0x27, 0x02, 0x97, 0xA8, 0xE7, 0x10, 0x11, 0x20, 0x65, 0xE9, 0xFE, 0x16, 0x6A, 0xFF, 0xA8, 0x17, 0xCD, 0x02, 0xB2, 0xC5, 0x18, 0x81, 0xDC, 0xFD, 0xE0, 0x08, 0x00, 0x8C, 0x3A, 0x52, 0xA0, 0xC4, 0x59, 0x57, 0x58, 0x17, 0x2A, 0x55, 0x59, 0x17, 0x58, 0x37, 0x20, 0x25, 0xC0, 0x29, 0x37, 0x81, 0xD6, 0xFD, 0xE0, 0x08, 0x00, 0x06, 0x77, 0xFE, 0x00, 0x00, 0x22, 0x05, 0x03, 0x82, 0x05, 0x02, 0x72, 0xC5, 0x18, 0x80, 0x22, 0x11, 0x58, 0x33, 0x80, 0x22, 0x20, 0x22, 0xC2, 0xF0, 0x56, 0x45, 0x0A, 0xF6, 0x52, 0x02, 0x86, 0x27, 0x00, 0x22, 0xA0, 0xC9, 0x46, 0x2C, 0x00, 0x51, 0xB3, 0xFD, 0x81, 0xD8, 0xFB, 0xA8, 0x05, 0x29, 0xF1, 0xA0, 0x88, 0xC0, 0x89, 0x81, 0x88, 0x26, 0xAD, 0x09, 0x87, 0xB2, 0x01, 0x0C, 0x3A, 0x92, 0x61, 0x16, 0xA2, 0x61, 0x14, 0x10, 0x11, 0x20, 0xE5, 0xFA, 0xFE, 0xA2, 0x21, 0x14, 0x81, 0xAA, 0xFD, 0xA9, 0x01, 0xE8, 0x05, 0xA1, 0xA9, 0xFD, 0xDD, 0x08, 0xBD, 0x07, 0xC2, 0xC1, 0x3C, 0xF2, 0xC1, 0x20, 0x82, 0x61, 0x15, 0x81, 0xBC, 0xFD, 0xE0, 0x08, 0x00, 0xB8, 0x26, 0xCD, 0x0A, 0xA8, 0xF1, 0x92, 0x21, 0x16, 0xA0, 0xBB, 0xC0, 0xB9, 0x26, 0xA0, 0x22, 0xC0, 0xB8, 0x05, 0xAA, 0x77, 0xA8, 0x81, 0x82, 0x21, 0x15, 0xAA, 0xBB, 0x0C, 0x0A, 0xB9, 0x05, 0xC0, 0xA9, 0x83, 0x80, 0xBB, 0xC0, 0xA0, 0xD0, 0x74, 0xCC, 0x8A, 0xE2, 0xDB, 0x80, 0xAD, 0x0D, 0xE0, 0xA9, 0x83, 0xAC, 0x2A, 0xAD, 0x08, 0x82, 0x61, 0x15, 0x92, 0x61, 0x16, 0xC2, 0x61, 0x14, 0x10, 0x11, 0x20, 0xA5, 0x0C, 0xFF, 0x82, 0x21, 0x15, 0x92, 0x21, 0x16, 0xC2, 0x21, 0x14, 0x89, 0x05, 0x06, 0x01, 0x00, 0x00, 0x0C, 0x1C, 0x9D, 0x0C, 0x8C, 0xB2, 0x58, 0x33, 0x8C, 0x75, 0xC0, 0x5F, 0x31, 0xC0, 0x55, 0xC0, 0x96, 0x35, 0xF5, 0xD6, 0x7C, 0x00, 0x22, 0xA0, 0xC7, 0x29, 0x53, 0x06, 0x40, 0xFE, 0x56, 0xDC, 0x8F, 0x28, 0x33, 0x16, 0x82, 0x8F, 0x22, 0xA0, 0xC8, 0x06, 0xFB, 0xFF, 0x28, 0x25, 0x56, 0xD2, 0x8E, 0x10, 0x11, 0x20, 0x65, 0x22, 0xFF, 0xA2, 0xA2, 0x71, 0xC0, 0xAA, 0x11, 0x81, 0x89, 0xFD, 0xE0, 0x08, 0x00, 0x81, 0x96, 0xFD, 0xE0, 0x08, 0x00, 0x86, 0x34, 0xFE, 0x28, 0x35, 0x16, 0xD2, 0x8C, 0x10, 0x11, 0x20, 0x65, 0x20, 0xFF, 0xA2, 0xA3, 0xE8, 0x81, 0x82, 0xFD, 0xE0, 0x08, 0x00, 0xE0, 0x02, 0x00, 0x06, 0x2E, 0xFE, 0x1D, 0xF0, 0x00, 0x00, 0x00, 0x36, 0x41, 0x00, 0x9D, 0x02, 0x82, 0xA0, 0xC0, 0x28, 0x03, 0x87, 0x99, 0x0F, 0xCC, 0x32, 0x0C, 0x12, 0x86, 0x07, 0x00, 0x0C, 0x02, 0x29, 0x03, 0x7C, 0xE2, 0x86, 0x0F, 0x00, 0x26, 0x12, 0x07, 0x26, 0x22, 0x18, 0x86, 0x03, 0x00, 0x00, 0x00, 0x82, 0xA0, 0xDB, 0x80, 0x29, 0x23, 0x87, 0x99, 0x2A, 0x0C, 0x22, 0x29, 0x03, 0x7C, 0xF2, 0x46, 0x08, 0x00, 0x00, 0x00, 0x22, 0xA0, 0xDC, 0x27, 0x99, 0x0A, 0x0C, 0x12, 0x29, 0x03, 0x2D, 0x08, 0x06, 0x04, 0x00, 0x00, 0x00, 0x82, 0xA0, 0xDD, 0x7C, 0xF2, 0x87, 0x99, 0x06, 0x0C, 0x12, 0x29, 0x03, 0x22, 0xA0, 0xDB, 0x1D, 0xF0, 0x00, 0x00
+        0x28, 0xCF, 0x65, 0x52, 0x7D, 0x54, 0x53, 0x67, 0x9E, 0xFE, 0xE5, 0xE6, 0x3B, 0xBE, 0x0E, 0x09, 0xA5, 0x11, 0x21, 0x9C, 0xDE, 0x5C, 0x05, 0x12, 0xC4, 0x16, 0x14, 0x45, 0x5C, 0x67, 0xB9, 0xA9, 0x36, 0xCA, 0xB8, 0x73, 0x16, 0xAD, 0x52, 0x6A, 0xDD, 0x15, 0xB0, 0x52, 0xDB, 0xD3, 0x3D, 0x07, 0x59, 0x7A, 0x50, 0x0F, 0x9D, 0xBD, 0x37, 0xD8, 0x10, 0x14, 0x2B, 0x60, 0x5B, 0x09, 0xD5, 0xB3, 0x97, 0x54, 0x3B, 0x81, 0x85, 0xAD, 0x32, 0x76, 0xC4, 0xA2, 0x6D, 0x60, 0x6A, 0x86, 0x5A, 0xDD, 0xED, 0x74, 0xA6, 0x53, 0x76, 0xB4, 0xBB, 0xD6, 0x16, 0x8B, 0x4E, 0x6D, 0xC1, 0x52, 0xB4, 0x7C, 0xE4, 0xDD, 0xDF, 0x7B, 0xA1, 0x9D, 0xCE, 0xEE, 0x1F, 0xEF, 0xD7, 0xEF, 0xFB, 0x7D, 0x9E, 0x27, 0x41, 0xD2, 0x96, 0x00, 0xAE, 0xBF, 0x83, 0x8B, 0xF9, 0x3A, 0x3C, 0x97, 0x7B, 0x40, 0x9E, 0xA4, 0xA4, 0x20, 0xC2, 0x43, 0xD0, 0x14, 0xD5, 0x01, 0xC8, 0xF7, 0x28, 0xDE, 0xC3, 0x26, 0xF9, 0x2E, 0x55, 0x94, 0xAA, 0x80, 0xE9, 0x9A, 0x09, 0x9C, 0xE3, 0xCC, 0x14, 0xE0, 0xD2, 0x87, 0x3F, 0x4D, 0x19, 0x01, 0x00, 0x13, 0x40, 0x89, 0x03, 0x97, 0x15, 0x17, 0xE6, 0x3B, 0xA7, 0x98, 0x7B, 0x05, 0xE7, 0x99, 0x64, 0xA7, 0x4B, 0xC7, 0xF3, 0x2F, 0x1D, 0xBD, 0xEE, 0x19, 0xA6, 0x5E, 0x1D, 0x90, 0x15, 0x59, 0x01, 0x8D, 0x5A, 0x2E, 0xA0, 0xC3, 0x6A, 0x58, 0x6B, 0x8E, 0x50, 0xCE, 0x0D, 0xFB, 0xC7, 0xA8, 0x73, 0x94, 0x05, 0xE7, 0x71, 0xAC, 0xE0, 0xD8, 0xA2, 0xF7, 0xF3, 0x9F, 0xFD, 0xB7, 0x8B, 0xF9, 0xFB, 0x24, 0x00, 0x51, 0x04, 0xE8, 0xFC, 0xF3, 0xC5, 0xFC, 0x7B, 0x68, 0xC3, 0xDA, 0xA7, 0xBE, 0xA3, 0xBC, 0x52, 0x65, 0xB5, 0xF1, 0xA9, 0x79, 0x9A, 0x57, 0x92, 0x0C, 0xF2, 0x38, 0x6D, 0x6E, 0xD3, 0x34, 0x06, 0x6D, 0xAD, 0x2D, 0x98, 0xDD, 0x63, 0x6E, 0xFA, 0x86, 0x0D, 0xD9, 0x1A, 0xC0, 0x47, 0x73, 0x22, 0x34, 0x36, 0x8E, 0x25, 0xBF, 0x17, 0x89, 0x8C, 0xE1, 0xAB, 0xBF, 0x18, 0x5A, 0x5F, 0xC5, 0x33, 0x54, 0x00, 0x33, 0x3E, 0xF9, 0x16, 0x45, 0xB7, 0x24, 0x8D, 0xD5, 0x05, 0xD7, 0xCA, 0x43, 0x3F, 0xAE, 0x32, 0x60, 0x6E, 0x1B, 0xA2, 0xA7, 0x3E, 0xA3, 0x75, 0x47, 0xE7, 0x45, 0x35, 0x50, 0x33, 0x5C, 0x97, 0xF4, 0xDF, 0x51, 0x13, 0xCB, 0xAA, 0xB7, 0xE0, 0x76, 0xD6, 0xEC, 0xE5, 0xD8, 0xE3, 0x2C, 0x7B, 0xD4, 0x9B, 0x9B, 0x3E, 0xA6, 0xAD, 0x01, 0x62, 0x66, 0x35, 0x8B, 0x81, 0xCD, 0xBE, 0x89, 0x87, 0x92, 0x4D, 0x59, 0x2A, 0x0E, 0x4D, 0xD3, 0x2A, 0x4C, 0x66, 0x49, 0x5A, 0x58, 0xB4, 0x8E, 0x36, 0x4D, 0xFC, 0xF8, 0xA5, 0xE2, 0x96, 0x89, 0xB1, 0xC0, 0x16, 0x42, 0x88, 0xF1, 0xF8, 0xAB, 0x13, 0x53, 0xD4, 0x39, 0x41, 0x89, 0x09, 0x23, 0x7D, 0x65, 0x80, 0x29, 0x33, 0xE8, 0x37, 0xEF, 0x64, 0x2D, 0x5B, 0x4C, 0x45, 0x7B, 0x66, 0x80, 0xAF, 0xB9, 0x23, 0x09, 0x59, 0x3C, 0xAF, 0x53, 0xAB, 0x80, 0x38, 0x93, 0x3B, 0x34, 0x49, 0xED, 0xCF, 0x50, 0xF9, 0x4B, 0xDA, 0x34, 0xF9, 0x7F, 0x72, 0x58, 0xD8, 0xB0, 0x09, 0xC4, 0x1E, 0x5C, 0xCB, 0x65, 0x90, 0xA7, 0x29, 0x02, 0xEF, 0x30, 0x18, 0x08, 0x26, 0x97, 0x6C, 0x5A, 0x4D, 0x4C, 0x24, 0xE9, 0x83, 0x97, 0x6D, 0xE4, 0x60, 0x5E, 0xF6, 0x6D, 0xAE, 0xBE, 0xB4, 0x7D, 0x43, 0xD0, 0x53, 0xEF, 0xAC, 0xB7, 0xFD, 0x97, 0x26, 0x33, 0x8E, 0x5C, 0x22, 0xEB, 0xE5, 0x3B, 0x2C, 0xBC, 0x70, 0x4D, 0x64, 0xCB, 0xD2, 0x2D, 0xC2, 0x8D, 0x84, 0xCB, 0x44, 0xE5, 0x28, 0xC1, 0xA5, 0xF6, 0xE5, 0x43, 0xFC, 0x4C, 0x39, 0x66, 0xAB, 0xB8, 0x3E, 0x91, 0x6F, 0xC2, 0xFF, 0x9C, 0xB3, 0x80, 0x38, 0x80, 0x6B, 0x79, 0x29, 0x9B, 0x6B, 0xC7, 0xD7, 0x34, 0xFB, 0x3B, 0x7A, 0x5E, 0xD3, 0xA5, 0x95, 0x27, 0x58, 0xE4, 0xCF, 0x2D, 0x24, 0xFE, 0xCB, 0x5B, 0x01, 0x4D, 0x73, 0x08, 0x1A, 0x03, 0xD6, 0x7A, 0x0D, 0x1B, 0xFD, 0x1B, 0xDA, 0x74, 0x87, 0x2A, 0x21, 0x8D, 0x8A, 0x90, 0x12, 0xE0, 0x55, 0x6C, 0x7B, 0x58, 0xCA, 0x57, 0x2C, 0x45, 0x59, 0x58, 0xCB, 0xEA, 0x6F, 0x95, 0x2E, 0xE6, 0xD3, 0x38, 0x80, 0x9D, 0xA8, 0x0D, 0xA6, 0xD3, 0x29, 0x4A, 0xE6, 0x37, 0xAF, 0x83, 0xAC, 0xA3, 0x9E, 0xA0, 0x0B, 0xB1, 0xCA, 0x4B, 0x74, 0xAF, 0xC8, 0xCA, 0x3A, 0xDD, 0x2A, 0x64, 0x2C, 0xCD, 0x5A, 0xE5, 0xC9, 0x5B, 0x97, 0x3D, 0x4E, 0x05, 0x05, 0x96, 0x68, 0x41, 0xD8, 0xA9, 0x4F, 0xBF, 0xCF, 0x2C, 0xBF, 0xC3, 0x4A, 0x79, 0xB5, 0xA0, 0x0E, 0x35, 0x4E, 0x17, 0x5B, 0x1A, 0x92, 0x04, 0xE5, 0x02, 0x16, 0xA6, 0x94, 0x82, 0x0E, 0xE7, 0x1E, 0x43, 0x7C, 0x88, 0x19, 0x44, 0x30, 0xAB, 0x38, 0x65, 0x7F, 0x4E, 0x5D, 0xAB, 0xED, 0x3E, 0x1B, 0x53, 0xDB, 0x0D, 0x6A, 0x9F, 0xB0, 0x92, 0x7B, 0x44, 0x97, 0x1E, 0x26, 0x81, 0x05, 0x24, 0x5E, 0x92, 0x72, 0xA4, 0x85, 0x87, 0x79, 0x51, 0x95, 0xE2, 0x30, 0x65, 0x7F, 0xB8, 0x46, 0x9D, 0x7F, 0xA2, 0x02, 0x07, 0xF6, 0x25, 0x96, 0xF0, 0x02, 0xF9, 0xCF, 0x54, 0xCC, 0xB0, 0xD9, 0xC7, 0x74, 0xE9, 0xAE, 0x55, 0x72, 0x1B, 0x6B, 0x2C, 0x0F, 0xB3, 0x7D, 0x78, 0x01, 0xE1, 0x48, 0x52, 0x3B, 0x82, 0xEC, 0x38, 0x24, 0x7E, 0x85, 0x98, 0xF7, 0x2B, 0x83, 0xE4, 0x09, 0xB7, 0xC7, 0x9D, 0xED, 0x76, 0xBA, 0x6D, 0x6E, 0x8D, 0x7C, 0x44, 0x8D, 0x7D, 0x89, 0xED, 0x7E, 0x0E, 0xF9, 0x51, 0x8E, 0x3B, 0xE5, 0x2B, 0x2A, 0x5F, 0x16, 0x03, 0x8F, 0xEF, 0x74, 0x57, 0x9E, 0x7C, 0x50, 0x8D, 0xF9, 0xC3, 0x6C, 0xBD, 0xF8, 0xD9, 0x4A, 0x99, 0x84, 0x3C, 0xD1, 0xC5, 0xB9, 0x4B, 0xDD, 0x1B, 0x0A, 0x3C, 0x05, 0xD9, 0x05, 0xCE, 0x02, 0x5B, 0x81, 0x46, 0xAE, 0x55, 0x43, 0x65, 0xF5, 0xE7, 0x1A, 0x90, 0xDF, 0x63, 0x17, 0x92, 0xE4, 0x9F, 0x0B, 0xE0, 0x5A, 0x40, 0xE6, 0x8B, 0x82, 0xAD, 0xB1, 0x5E, 0x73, 0x29, 0x41, 0xAA, 0xD7, 0x34, 0xBD, 0x43, 0x1B, 0x05, 0x6B, 0xD3, 0xDB, 0x4C, 0x3A, 0xC2, 0xD3, 0xE0, 0xDC, 0x42, 0x67, 0x34, 0xA8, 0xEA, 0xAD, 0x68, 0x37, 0x75, 0x20, 0x6B, 0x62, 0xA8, 0xD6, 0xB5, 0x5A, 0x11, 0x22, 0xEE, 0xD5, 0xAE, 0x05, 0x1D, 0x82, 0x7B, 0x01, 0xE3, 0x84, 0xE9, 0xE9, 0x69, 0x56, 0x35, 0xD3, 0xE0, 0x47, 0x6A, 0x40, 0x7E, 0x83, 0x3D, 0xFE, 0xA2, 0xAA, 0xDB, 0x1C, 0xFB, 0x6C, 0xBD, 0xA7, 0x3E, 0x3B, 0xE8, 0xCC, 0xB3, 0xD5, 0x33, 0x4D, 0xE1, 0x9F, 0xE3, 0xBB, 0x15, 0x9D, 0xBC, 0x55, 0x9D, 0x6D, 0x0B, 0xDB, 0x99, 0xB4, 0x50, 0x61, 0x37, 0x12, 0xDE, 0x51, 0xB5, 0x35, 0xA3, 0x1D, 0xCF, 0x3E, 0x5A, 0x9C, 0x53, 0xB8, 0x74, 0xBB, 0x7D, 0xFB, 0x9C, 0xE2, 0x84, 0x2D, 0x8F, 0x16, 0x6E, 0xF5, 0xE0, 0x17, 0x18, 0x77, 0x37, 0xE8, 0xCE, 0x35, 0xAF, 0xDB, 0x75, 0x3B, 0x17, 0x3E, 0x75, 0xE2, 0x6B, 0xF6, 0xBE, 0xC4, 0x84, 0xBF, 0x61, 0x2F, 0xDD, 0x99, 0xB0, 0x51, 0x0F, 0xF6, 0x47, 0x0C, 0xF2, 0x23, 0xEA, 0x0C, 0x85, 0x55, 0xBE, 0x36, 0x28, 0xDC, 0x1D, 0xA9, 0xFE, 0x95, 0xE9, 0xB2, 0xF6, 0x3C, 0xD7, 0x65, 0xF0, 0xFF, 0x04, 0x2E, 0x1B, 0xD9, 0x65, 0xE3, 0x47, 0x8C, 0xB1, 0x1D, 0x63, 0x74, 0xE5, 0xE6, 0xC2, 0x62, 0x0F, 0x31, 0x7B, 0xF5, 0x00, 0xFD, 0x6D, 0x10, 0x54, 0xB5, 0x78, 0x87, 0xB6, 0x68, 0x2A, 0x3F, 0xD6, 0x24, 0x07, 0x1B, 0x1B, 0xAB, 0x4A, 0x7E, 0x29, 0x55, 0x74, 0x4B, 0x8F, 0xE5, 0x7D, 0x5A, 0xF1, 0x9B, 0x08, 0x63, 0x7A, 0x94, 0xCA, 0x0F, 0xAA, 0xD4, 0xE8, 0x61, 0xA6, 0xA4, 0xFC, 0x91, 0xAA, 0x4F, 0xA5, 0xAA, 0xE1, 0x67, 0x82, 0xF2, 0xAE, 0xF0, 0xA4, 0xDE, 0x95, 0xB0, 0x52, 0x70, 0x27, 0xB8, 0x72, 0xB2, 0x10, 0xA6, 0x1C, 0xFC, 0xCC, 0x56, 0x23, 0xFE, 0x05, 0xB5, 0x1A, 0x63, 0x71, 0x3E, 0x4B, 0x22, 0x31, 0xFB, 0x06, 0xA6, 0x50, 0x3F, 0xEE, 0xC3, 0x29, 0x23, 0xCC, 0x7E, 0xEF, 0x47, 0xF6, 0xE9, 0x59, 0xFB, 0x39, 0xFA, 0x1F, 0xF9, 0xEB, 0xE0, 0x62, 0x7E, 0x21, 0x2E, 0x31, 0x0D, 0xC4, 0x1C, 0x5C, 0x1F, 0xA4, 0xA9, 0x98, 0xD4, 0x0C, 0x74, 0x71, 0x75, 0x87, 0x17, 0x67, 0xDF, 0xA5, 0x51, 0x9C, 0x39, 0xAC, 0x25, 0x8E, 0xF3, 0x1A, 0xF9, 0xAE, 0x0A, 0xE4, 0xA1, 0x58, 0x48, 0x03, 0x01, 0x13, 0x5E, 0xC3, 0x5A, 0xF9, 0x1B, 0x66, 0xBA, 0x91, 0xF4, 0x49, 0xD4, 0x82, 0x9C, 0x94, 0x6B, 0xD3, 0x88, 0xF6, 0xB2, 0x86, 0x2C, 0x5A, 0x52, 0x0A, 0xF2, 0x57, 0xCC, 0xD3, 0xA2, 0x41, 0x39, 0xE6, 0x06, 0xE7, 0x86, 0x4D, 0xE5, 0x49, 0xA6, 0xEC, 0x1B, 0x8C, 0xEB, 0xD0, 0x6A, 0x08, 0x9A, 0x52, 0x46, 0xD6, 0x60, 0x4F, 0x0E, 0x97, 0x2B, 0x4D, 0x9D, 0xDB, 0x39, 0x45, 0xE5, 0xAB, 0x74, 0x80, 0x0B, 0x9B, 0x4E, 0x4D, 0x50, 0x79, 0x52, 0x95, 0x8F, 0xA9, 0x9E, 0x4B, 0x19, 0x69, 0x34, 0xA8, 0x7E, 0x04, 0xE5, 0xC4, 0x37, 0xB4, 0xE1, 0x2D, 0xF9, 0x0E, 0x0D, 0x98, 0x1A, 0xD6, 0xB1, 0xE7, 0x14, 0xC3, 0x76, 0x68, 0x84, 0xDA, 0x33, 0x20, 0x84, 0x2C, 0x8F, 0xB3, 0x1C, 0xC6, 0xEA, 0xC5, 0xFC, 0x75, 0x3F, 0xE4, 0xEC, 0x18, 0xA1, 0x3F, 0xB7, 0x9C, 0x5B, 0x99, 0xFD, 0x39, 0x25, 0xF3, 0x03, 0x5A, 0x62, 0x49, 0x5E, 0x57, 0xA0, 0xCD, 0xBE, 0x4E, 0xF7, 0x2F, 0xF5, 0x0D, 0xF4, 0x49, 0xED, 0xB5, 0xC2, 0x6A, 0x50, 0xC4, 0xAA, 0x4B, 0x1D, 0x4B, 0xDE, 0x10, 0xB3, 0x96, 0x48, 0x59, 0x2F, 0x1D, 0xB6, 0x3F, 0xAD, 0x63, 0x45, 0xC7, 0xA9, 0x37, 0x0E, 0xBA, 0xB8, 0x99, 0x3F, 0xB0, 0x32, 0xB7, 0x68, 0xE7, 0xC5, 0xEC, 0x9B, 0x74, 0xD5, 0x4D, 0xDF, 0x7D, 0x90, 0x1C, 0x90, 0xA4, 0x31, 0xDF, 0xA3, 0x50, 0x97, 0x17, 0xE7, 0x7B, 0x43, 0xDC, 0x2F, 0x90, 0x24, 0xFE, 0xF8, 0x61, 0x64, 0xC6, 0xDE, 0x01, 0x84, 0x63, 0xE4, 0x7D, 0x4B, 0x85, 0x47, 0xD5, 0x49, 0x70, 0x86, 0x90, 0xA2, 0xF2, 0x79, 0x97, 0xCE, 0xBE, 0x7D, 0x4A, 0x04, 0x81, 0x6D, 0xB6, 0x85, 0x94, 0x2B, 0xEC, 0x0F, 0xDF, 0xD2, 0x90, 0x72, 0xD5, 0xAB, 0x43, 0xEC, 0xD0, 0x73, 0xA5, 0xAE, 0xD9, 0x34, 0x23, 0x97, 0x90, 0xF2, 0x09, 0x1B, 0xE3, 0x1B, 0xAA, 0x72, 0xB7, 0x72, 0x49, 0x94, 0x03, 0x08, 0x71, 0x90, 0x2C, 0xB0, 0x9C, 0x49, 0x9A, 0xDB, 0x3C, 0xCA, 0xCA, 0xC1, 0x56, 0x07, 0x88, 0x3C, 0x6A, 0x78, 0x27, 0x9E, 0x55, 0xB8, 0x96, 0x3B, 0x9D, 0xA1, 0xDF, 0x59, 0xE5, 0x09, 0x55, 0x39, 0x71, 0x00, 0x1B, 0x3E, 0x88, 0x91, 0x04, 0x71, 0x8D, 0xCD, 0xA7, 0x07, 0x71, 0xF5, 0xF6, 0xCB, 0xBA, 0xF3, 0x9A, 0x2E, 0xAE, 0xA1, 0x85, 0xCD, 0xF3, 0x3A, 0x8D, 0x6A, 0xB0, 0x80, 0x3C, 0x32, 0xAB, 0xAA, 0xA9, 0x95, 0xCC, 0xCB, 0x92, 0x6F, 0x33, 0xCB, 0xCF, 0x04, 0x71, 0x69, 0xA4, 0xE8, 0xB3, 0x49, 0x21, 0x34, 0xC7, 0x2A, 0x9C, 0xEC, 0xE2, 0xBA, 0xD1, 0x31, 0xCC, 0x1C, 0x5D, 0x9C, 0x63, 0x0E, 0x9B, 0x61, 0x9C, 0x2E, 0xD6, 0xFA, 0x01, 0x04, 0x65, 0x3B, 0x1B, 0x24, 0x80, 0x1C, 0xEE, 0x4B, 0x06, 0xF1, 0x25, 0x3C, 0x1B, 0x93, 0x7F, 0xE0, 0x6B, 0x90, 0x76, 0xEE, 0x27, 0xF7, 0x79, 0xCA, 0xE9, 0xC8, 0x52, 0x4D, 0x43, 0x77, 0x78, 0x96, 0xA2, 0x2E, 0x6D, 0xD4, 0x8C, 0x9B, 0x3C, 0xC6, 0x1E, 0x68, 0x54, 0x15, 0x64, 0x30, 0xB3, 0x8C, 0xA1, 0xDF, 0x53, 0x92, 0x38, 0x12, 0xD0, 0x64, 0x6A, 0x95, 0xDA, 0xDA, 0x2E, 0x93, 0xBD, 0x19, 0xE4, 0x2F, 0xD5, 0xBF, 0xE0, 0xAC, 0x33, 0xFD, 0x53, 0x46, 0x4A, 0x54, 0x6E, 0x9D, 0x65, 0xC7, 0x53, 0xAE, 0x95, 0xDB, 0x92, 0xCA, 0x1F, 0x37, 0x90, 0x79, 0x1B, 0x15, 0x28, 0xFB, 0x9D, 0xB5, 0xF0, 0x04, 0x2F, 0x56, 0xDB, 0x36, 0x96, 0x27, 0xB1, 0x42, 0x77, 0xE9, 0xDA, 0x33, 0x5C, 0xF4, 0x61, 0xE8, 0x32, 0xC8, 0x67, 0x58, 0x5E, 0xF4, 0x21, 0x68, 0x6A, 0x88, 0x15, 0xFE, 0x73, 0xC4, 0x67, 0x06, 0xB1, 0x7A, 0xFB, 0x65, 0x23, 0x83, 0xC2, 0x1E, 0x56, 0xB9, 0x7D, 0x79, 0x16, 0x8B, 0xAE, 0x59, 0x2C, 0x1A, 0x3A, 0x88, 0xC9, 0x57, 0x6E, 0x7F, 0xDE, 0xE4, 0x8D, 0x47, 0x33, 0xFB, 0xC8, 0x67, 0xF4, 0xBC, 0xB1, 0x4B, 0xC3, 0x70, 0xFB, 0x82, 0x69, 0xEE, 0xC4, 0x75, 0x7A, 0xD9, 0x68, 0x3D, 0xC5, 0x97, 0xBC, 0xCE, 0xCB, 0x6D, 0x2C, 0x69, 0xAF, 0xB0, 0x77, 0x73, 0xEE, 0x9B, 0x03, 0xBE, 0x36, 0x63, 0x24, 0x60, 0x6B, 0x3E, 0x9E, 0x92, 0x14, 0xB8, 0x16, 0xB4, 0x05, 0x4C, 0x49, 0xC1, 0x16, 0xB3, 0xF4, 0x5C, 0xE4, 0x48, 0x6E, 0x6D, 0xF4, 0x16, 0xC5, 0x9A, 0xDE, 0x67, 0x43, 0xC7, 0x93, 0xAD, 0x1D, 0x8A, 0xFC, 0x9F, 0x2C, 0xA9, 0xC8, 0x42, 0xBB, 0x43, 0x73, 0x42, 0x86, 0x67, 0xAD, 0xBD, 0x27, 0x59, 0xD1, 0x6E, 0xB8, 0x7B, 0x2B, 0x7E, 0x7C, 0x6D, 0x5C, 0x73, 0x68, 0xAE, 0x35, 0x78, 0x72, 0x6F, 0x30, 0x54, 0x00, 0xC9, 0xD5, 0xFE, 0x51, 0x5A, 0x73, 0xF3, 0x48, 0x6B, 0x5F, 0xF9, 0xDA, 0xF8, 0xE6, 0x36, 0xA3, 0x2F, 0x2D, 0x29, 0x12, 0xB4, 0x25, 0x05, 0xEB, 0xCD, 0xB9, 0x3D, 0x5C, 0xDD, 0x9B, 0x07, 0x66, 0xE8, 0x39, 0x6F, 0x40, 0xA5, 0x4A, 0xB3, 0x4A, 0x1D, 0x1A, 0xA4, 0xB3, 0x1C, 0xED, 0xB8, 0xCA, 0x66, 0x1D, 0xFA, 0x98, 0x12, 0x15, 0x91, 0x1B, 0xAA, 0x02, 0x2F, 0xE6, 0xFF, 0xFD, 0x3A, 0x4F, 0xC1, 0x49, 0x09, 0x4A, 0xDA, 0x56, 0x0E, 0x16, 0xB6, 0xE0, 0xD9, 0x83, 0x2B, 0x23, 0x3B, 0xE5, 0xD0, 0x69, 0x3C, 0xA7, 0x16, 0xBD, 0x9F, 0xDF, 0x29, 0xE5, 0x8A, 0x2D, 0x3C, 0x29, 0x59, 0xE5, 0xCB, 0x15, 0x3B, 0x5F, 0xC8, 0x15, 0x4D, 0x60, 0x2A, 0x91, 0x9C, 0xA4, 0xC4, 0x8A, 0x76, 0xAB, 0xA4, 0x2D, 0x29, 0xC4, 0x93, 0x00, 0x94, 0xAC, 0x10, 0xA1, 0xE4, 0x68, 0xE6, 0xFB, 0xF9, 0x94, 0x02, 0x64, 0xCA, 0x50, 0x62, 0x15, 0x11, 0x2C, 0x7C, 0x5B, 0x71, 0xD5, 0x34, 0x42, 0x09, 0x3D, 0x44, 0xA9, 0x84, 0xE7, 0x3E, 0x5C, 0xBB, 0x71, 0x6D, 0xC2, 0xDE, 0xC5, 0xB8, 0xB6, 0xA2, 0x3F, 0x01, 0xF3, 0x47, 0x30, 0x91, 0xF5, 0xDB, 0x8A, 0xB6, 0x2A, 0xE9, 0x62, 0xBE, 0x64, 0x04, 0x71, 0x37, 0x6A, 0xA7, 0x07, 0x35, 0xF4, 0x24, 0xAE, 0xAA, 0x07, 0x40, 0xFC, 0x12, 0xB5, 0xAD, 0xE3, 0x41, 0xDC, 0x84, 0xA4, 0x15, 0xE2, 0x1D, 0x90, 0x7B, 0x87, 0x1B, 0xC4, 0x85, 0xE9, 0x20, 0x9A, 0x5C, 0x20, 0x7E, 0x8E, 0xEF, 0x2A, 0x59, 0x27, 0x1E, 0x45, 0xFF, 0x14, 0x2E, 0x13, 0xC6, 0x84, 0xD1, 0xB6, 0x0F, 0xEF, 0xCF, 0xE2, 0x6A, 0xC4, 0xE5, 0x32, 0x81, 0x38, 0xC8, 0x34, 0xA3, 0xD1, 0x38, 0xFB, 0x28, 0xB1, 0x08, 0xA5, 0x56, 0x79, 0xE8, 0x7B, 0xB0, 0x3A, 0xA9, 0x7D, 0xBF, 0x2E, 0xFB, 0x1C, 0x75, 0x9E, 0xA3, 0x9E, 0xF3, 0x34, 0xC2, 0x83, 0x5B, 0x4B, 0x38, 0x76, 0xE8, 0xD4, 0xFB, 0x86, 0xB3, 0x34, 0xFB, 0x2C, 0x2D, 0x3D, 0xCB, 0x3C, 0x79, 0x7A, 0xDC, 0x56, 0x18, 0x6A, 0xC6, 0xAC, 0x6B, 0x34, 0xE2, 0x52, 0x9E, 0x59, 0x0C, 0x2C, 0x48, 0x8F, 0xE2, 0x2C, 0xE0, 0xD6, 0x0B, 0x06, 0x0E, 0x9C, 0x61, 0x9A, 0xFD, 0x06, 0x7D, 0x58, 0x81, 0xDC, 0x25, 0x5F, 0x32, 0xB1, 0x44, 0x28, 0x59, 0x1F, 0xEA, 0x13, 0x19, 0xB9, 0xBF, 0xA1, 0x42, 0x1B, 0x13, 0xD0, 0xD0, 0xDB, 0x34, 0x7B, 0xFB, 0x74, 0xA3, 0x60, 0xCB, 0x58, 0xC0, 0x2A, 0x70, 0x9E, 0xE3, 0xD4, 0xF9, 0x37, 0xD3, 0x05, 0x1C, 0x8B, 0x39, 0x41, 0x17, 0x5B, 0xEC, 0x13, 0x7A, 0x67, 0x6B, 0xAC, 0xEF, 0xD5, 0x58, 0x98, 0x23, 0x8B, 0xE4, 0x63, 0x31, 0x9C, 0xD3, 0x73, 0x94, 0x9E, 0x3A, 0x46, 0x1D, 0x49, 0x84, 0x60, 0x46, 0xBB, 0x6E, 0x46, 0xCF, 0x24, 0x69, 0xA4, 0x43, 0x23, 0xA7, 0xB2, 0xEB, 0xA9, 0x57, 0x28, 0x06, 0xDF, 0x2F, 0x77, 0xB3, 0x47, 0x98, 0x93, 0x53, 0x66, 0xCF, 0x37, 0xD8, 0xE9, 0x69, 0x64, 0xB3, 0xBB, 0x74, 0x85, 0x02, 0xAF, 0x7E, 0xCB, 0x6F, 0x57, 0x25, 0x7F, 0x8C, 0x76, 0xB6, 0x7A, 0xF6, 0x63, 0xD1, 0x53, 0xFB, 0x99, 0x3F, 0xF4, 0x24, 0xF0, 0xFD, 0xBC, 0xAC, 0xB0, 0x0C, 0x67, 0x1D, 0x25, 0x6B, 0x48, 0x12, 0x5A, 0x0B, 0x38, 0xEC, 0x11, 0x35, 0x21, 0xAD, 0xA7, 0x6A, 0xE9, 0x65, 0x0B, 0xD9, 0x22, 0xB7, 0xA8, 0x25, 0x25, 0xBA, 0xB1, 0x4D, 0xA3, 0x56, 0xCD, 0xB4, 0x7C, 0x5F, 0x57, 0xE6, 0x98, 0x4B, 0x3E, 0xAC, 0x56, 0xD8, 0xA3, 0xF6, 0xE4, 0x2E, 0xBD, 0xE5, 0x78, 0x57, 0x14, 0xAC, 0x42, 0xFF, 0x3D, 0x92, 0xC0, 0x1F, 0xAF, 0x25, 0x73, 0xE4, 0x06, 0x35, 0xE8, 0x00, 0xDB, 0xFF, 0xC1, 0xD2, 0xD0, 0xEA, 0x09, 0x4F, 0x93, 0x78, 0x61, 0x0D, 0x78, 0x13, 0xC0, 0xE1, 0x27, 0xF1, 0x4F, 0x7B, 0xCA, 0xFA, 0xF8, 0xF6, 0xD2, 0xA7, 0xB3, 0xDB, 0x9D, 0xED, 0xB6, 0x76, 0xCD, 0xB4, 0xE5, 0xB6, 0xC5, 0xBD, 0x81, 0x1C, 0xEC, 0x57, 0xFE, 0xB5, 0x5B, 0xD1, 0xF1, 0x21, 0x5E, 0x7E, 0x66, 0x1A, 0x13, 0x2B, 0x35, 0x82, 0x63, 0x67, 0xD9, 0x6F, 0xBF, 0x28, 0x29, 0xA9, 0x7A, 0xAA, 0x47, 0xB3, 0x58, 0xBF, 0xCA, 0x4F, 0xEE, 0xAF, 0x5E, 0xAE, 0x21, 0x7A, 0xCF, 0x4B, 0xD3, 0x38, 0x0D, 0xCF, 0x57, 0x61, 0x45, 0xFB, 0x75, 0x68, 0x7B, 0x9C, 0xCA, 0x95, 0x6A, 0xBF, 0x27, 0x58, 0xDA, 0x68, 0x11, 0x25, 0x29, 0xC4, 0x41, 0x92, 0xAF, 0xB7, 0x81, 0xF8, 0x89, 0x0D, 0x2E, 0xD9, 0x4A, 0x7A, 0x35, 0xC4, 0x22, 0x3F, 0xC3, 0x42, 0xB2, 0xF7, 0x4D, 0x97, 0xFD, 0x7E, 0x11, 0x62, 0x83, 0x73, 0x6F, 0x34, 0x42, 0x61, 0x61, 0x95, 0xFD, 0x7E, 0xBD, 0x0A, 0x31, 0x1A, 0x84, 0xB5, 0x20, 0xBF, 0xC7, 0x88, 0x08, 0x85, 0x76, 0x45, 0x3A, 0x6C, 0xF2, 0x36, 0xB5, 0xE8, 0x3F, 0xB2, 0x7D, 0xD7, 0xC3, 0xB4, 0x66, 0x18, 0x43, 0x8A, 0x8D, 0x35, 0x13, 0xD2, 0x66, 0xAB, 0x55, 0x8D, 0x7F, 0xDC, 0x28, 0x17, 0xAB, 0x21, 0x8F, 0xB1, 0x9D, 0xCD, 0x5D, 0xA4, 0xC6, 0xA6, 0xC7, 0x3C, 0x37, 0xA7, 0x54, 0xD8, 0xEC, 0x65, 0xDF, 0x11, 0x23, 0x4B, 0xD3, 0x91, 0x78, 0x3C, 0xF6, 0xE8, 0x04, 0x4F, 0x8E, 0xA0, 0xD7, 0x10, 0xD7, 0x9E, 0x4F, 0x05, 0xCF, 0x32, 0xDF, 0x86, 0x64, 0x47, 0x6E, 0x75, 0xFC, 0x42, 0xC7, 0xDA, 0xEA, 0x78, 0x67, 0x79, 0xB3, 0x53, 0xD0, 0x6B, 0x2B, 0xF5, 0x9C, 0x24, 0xD8, 0x2A, 0x04, 0xBE, 0xFC, 0xE1, 0x78, 0x57, 0xAA, 0x0A, 0xAE, 0xFB, 0x53, 0xD4, 0x1D, 0x80, 0x43, 0x10, 0x36, 0x24, 0x33, 0x46, 0x83, 0xB4, 0x5B, 0x31, 0x85, 0xFA, 0x72, 0x98, 0xC6, 0x8E, 0xD2, 0x6E, 0xBD, 0x56, 0xC0, 0x9C, 0x5E, 0x1B, 0xBF, 0x9E, 0x77, 0xCE, 0xA7, 0x3C, 0x3F, 0xB6, 0xB6, 0x3B, 0x29, 0xA4, 0x44, 0x98, 0xCC, 0x8E, 0xD0, 0x90, 0xF2, 0x15, 0x93, 0xE7, 0x11, 0xCA, 0x82, 0x5F, 0xA6, 0xFE, 0x41, 0x8A, 0xDD, 0x1D, 0x6B, 0xD3, 0x73, 0x73, 0xC7, 0x85, 0x64, 0x83, 0x59, 0x03, 0x42, 0xFF, 0x43, 0x88, 0xE3, 0xAF, 0x1F, 0xE6, 0x0C, 0xA9, 0xB0, 0x6B, 0x0E, 0xAD, 0x10, 0x14, 0x17, 0xA7, 0x70, 0x80, 0xF6, 0x18, 0xDA, 0x1D, 0xE9, 0xE9, 0x67, 0x38, 0x2F, 0x85, 0x5D, 0xFA, 0x1F, 0x3C, 0x95, 0xFD, 0x59, 0x15, 0x15, 0x55, 0xBF, 0x7E, 0xEC, 0x82, 0xFF, 0x3B, 0xC8, 0x2C, 0x20, 0x46, 0x41, 0x89, 0x1C, 0x49, 0xE0, 0xFC, 0x77, 0x61, 0xCF, 0xA7, 0xA4, 0xB2, 0xCB, 0xC8, 0x06, 0x6C, 0xA4, 0xEA, 0x39, 0x74, 0x88, 0x75, 0xDD, 0xF1, 0x22, 0xDB, 0x53, 0x5F, 0xA4, 0xE4, 0x00, 0xCE, 0x2C, 0xF4, 0xAB, 0xB6, 0x26, 0x5A, 0x24, 0x4C, 0x7B, 0x45, 0x20, 0xF1, 0x45, 0xC7, 0xF3, 0xFA, 0xFB, 0xF8, 0xF3, 0xBA, 0x2E, 0x9D, 0x6C, 0x62, 0xD8, 0x15, 0x75, 0xAC, 0x70, 0xAC, 0x0F, 0xF5, 0xF1, 0x2C, 0xE7, 0x10, 0xF5, 0x47, 0x58, 0x48, 0x55, 0xEE, 0x8C, 0xE6, 0x94, 0x85, 0xB5, 0xD1, 0x3F, 0x41, 0xDA, 0x3E, 0xC4, 0x32, 0x3A, 0x08, 0xAE, 0xD4, 0xDD, 0xCB, 0x2A, 0x7C, 0xBC, 0x24, 0x9D, 0x2E, 0x1A, 0x8C, 0xB1, 0xA2, 0x7F, 0x4B, 0xF7, 0x0A, 0x9D, 0xAD, 0x86, 0x7B, 0xD4, 0x33, 0x77, 0x5A, 0xE9, 0xF4, 0xF8, 0x74, 0xD0, 0x70, 0x4F, 0x16, 0x98, 0x22, 0xBC, 0x5A, 0xA8, 0xFC, 0x78, 0x04, 0x77, 0x00, 0x79, 0x94, 0xF1, 0x6B, 0xBF, 0x15, 0x33, 0x7C, 0x45, 0x2B, 0x42, 0x91, 0x4B, 0xF3, 0xA2, 0xBF, 0x04, 0x45, 0x1A, 0x2B, 0x6A, 0x99, 0xF2, 0x5A, 0xC0, 0x13, 0x9B, 0x52, 0x94, 0x6F, 0x31, 0xF1, 0x68, 0xA2, 0x7C, 0x1F, 0x4B, 0x8C, 0x6A, 0xA1, 0xE6, 0x1E, 0x04, 0x6C, 0xFB, 0xAB, 0xA3, 0x1C, 0xC8, 0x9F, 0xA9, 0xA9, 0x17, 0x63, 0xDE, 0xFF, 0xA1, 0x24, 0x11, 0xAD, 0x98, 0x5F, 0xBD, 0xE2, 0xA2, 0xDF, 0x0C, 0x9E, 0x91, 0xA9, 0xD9, 0x86, 0xC3, 0xB2, 0x81, 0xE5, 0x19, 0xD4, 0x86, 0xB8, 0x83, 0xFC, 0x91, 0x9A, 0x34, 0x11, 0x33, 0x7C, 0xC8, 0xFA, 0x15, 0xA5, 0x4F, 0xFB, 0x0F, 0x80, 0x8A, 0x5A, 0xDA, 0x3E, 0xCE, 0xD0, 0x81, 0xD7, 0xC5, 0x46, 0x6F, 0x18, 0xD2, 0x4E, 0x7F, 0x6B, 0xF8, 0x05, 0xFE, 0x35, 0xED, 0x34, 0x67, 0x08, 0x41, 0xCF, 0xB2, 0x70, 0x2A, 0x61, 0x10, 0x9E, 0x90, 0xA9, 0x92, 0x5E, 0xEB, 0x3F, 0x06, 0x64, 0x7E, 0xF9, 0xE9, 0x6D, 0x81, 0x47, 0xF8, 0x76, 0x1B, 0xCB, 0xED, 0xAF, 0x7B, 0x8B, 0x33, 0xBC, 0x0A, 0x3D, 0x9B, 0xC3, 0xA9, 0xCD, 0xA5, 0x76, 0xF6, 0xF7, 0x1C, 0xDA, 0xEC, 0xB4, 0x2B, 0x47, 0x6A, 0xBD, 0x3F, 0x51, 0x43, 0x73, 0xFE, 0x2A, 0xD4, 0xDB, 0x08, 0xAE, 0x65, 0x2C, 0x98, 0xDF, 0xED, 0x9B, 0x8D, 0xCF, 0xA6, 0xCE, 0xBE, 0x29, 0x62, 0xC2, 0xA4, 0xFA, 0x32, 0xE1, 0xC3, 0x45, 0x95, 0x65, 0x9C, 0xD2, 0x52, 0xBB, 0xD8, 0x6C, 0xA8, 0x85, 0xA6, 0xDE, 0x29, 0x62, 0x0C, 0x99, 0x41, 0x50, 0xA2, 0xD5, 0xAD, 0x9C, 0x5F, 0x86, 0xDD, 0xA9, 0xDD, 0xEF, 0x8E, 0xE0, 0xBC, 0x67, 0x8E, 0x70, 0x82, 0x5B, 0x4F, 0x8C, 0xCD, 0xCA, 0xD7, 0x5E, 0x0E, 0xF6, 0xBE, 0xE0, 0x33, 0x25, 0x26, 0x57, 0x4B, 0xC1, 0xAC, 0x33, 0xE9, 0x77, 0x7C, 0x7A, 0x7D, 0xA5, 0x5E, 0x27, 0x21, 0x22, 0x01, 0xBE, 0x52, 0x6F, 0x80, 0x6A, 0x9B, 0x54, 0xCD, 0xFB, 0xF4, 0x46, 0x29, 0xA0, 0x41, 0x8B, 0x14, 0x8C, 0xF8, 0x94, 0x3E, 0x62, 0x6C, 0x74, 0x1D, 0x8E, 0xFE, 0x13, 0xC8, 0xAF, 0x4D, 0x61, 0xE9, 0x66, 0x13, 0x3C, 0x6F, 0xB6, 0x07, 0x93, 0x5A, 0x56, 0xB0, 0x21, 0x07, 0xAA, 0xE7, 0x73, 0x86, 0xA7, 0xC0, 0x55, 0xDC, 0xBC, 0x0E, 0xBC, 0x65, 0xE0, 0xA8, 0x27, 0x46, 0x12, 0x8F, 0xAA, 0x32, 0x94, 0xC1, 0xBD, 0xE7, 0x86, 0x77, 0x0C, 0x6E, 0x1E, 0x78, 0x84, 0x41, 0x22, 0xEF, 0x65, 0x58, 0x12, 0xD3, 0xF3, 0x16, 0xC5, 0x55, 0x6B, 0x78, 0x82, 0xC1, 0xB5, 0x86, 0xF3, 0x16, 0x41, 0xD3, 0xB6, 0x98, 0xBC, 0x2D, 0x16, 0xE1, 0x61, 0xB7, 0x59, 0x14, 0xB0, 0xB5, 0x95, 0xAF, 0xE6, 0xC3, 0xA9, 0xF8, 0xDE, 0x63, 0x6E, 0xDA, 0x12, 0x23, 0x73, 0x54, 0xCF, 0x8C, 0x79, 0xC6, 0x58, 0x14, 0xFB, 0x7F, 0xA6, 0x8D, 0x7F, 0x31, 0xA5, 0x33, 0x93, 0xDB, 0x2C, 0x3F, 0xC1, 0xBA, 0x19, 0x78, 0x00, 0xB1, 0x31, 0x47, 0x65, 0x0C, 0xA7, 0xF4, 0xFF, 0x14, 0xC4, 0x35, 0x9E, 0x03, 0x17, 0x6A, 0xEE, 0x79, 0xE3, 0x20, 0xBC, 0xCA, 0x57, 0x7A, 0x3F, 0x02, 0xDA, 0x5F, 0x9A, 0x20, 0x6F, 0x62, 0xC1, 0xFD, 0xCE, 0x04, 0x9F, 0xF3, 0x7E, 0x57, 0xE6, 0x6E, 0x47, 0x98, 0x20, 0xB4, 0x15, 0x95, 0xD6, 0x34, 0x6E, 0x2E, 0x16, 0x1B, 0xB4, 0xF0, 0xAE, 0xAC, 0x0F, 0x84, 0xEF, 0xBB, 0x59, 0x92, 0x83, 0xFD, 0x97, 0xAC, 0x6B, 0xF3, 0xDE, 0x8E, 0xFE, 0x0B, 0x2D, 0xC7, 0x1F, 0xFC, 0x82, 0xAA, 0xE5, 0xFD, 0x69, 0x33, 0x02, 0x88, 0x3A, 0xC1, 0xF9, 0x50, 0x2C, 0xB0, 0x79, 0x77, 0x6A, 0x3D, 0xE7, 0x7C, 0x30, 0xB6, 0x87, 0x23, 0x9C, 0x21, 0x05, 0x46, 0x33, 0x62, 0xC4, 0x38, 0x10, 0x47, 0xE6, 0x23, 0x1B, 0x07, 0x51, 0x34, 0x27, 0xDD, 0x87, 0x23, 0xF5, 0xB5, 0x7C, 0xC0, 0xCA, 0x88, 0x6A, 0x29, 0x69, 0x5B, 0x18, 0x7B, 0xDE, 0x34, 0x68, 0x11, 0x94, 0xF7, 0xCE, 0xFC, 0xF4, 0xD1, 0x93, 0xD7, 0x12, 0xB0, 0x5E, 0xD1, 0xBF, 0xEB, 0x16, 0x9B, 0xFC, 0x1C, 0x40, 0xC6, 0x0B, 0x81, 0x9D, 0xEB, 0x85, 0x7A, 0xE3, 0x41, 0x33, 0x7F, 0x3B, 0x92, 0x51, 0x73, 0x66, 0xC9, 0x6D, 0xFB, 0xCE, 0xC1, 0x9B, 0x96, 0x3D, 0x71, 0xD1, 0x6D, 0x94, 0xC4, 0x97, 0xEF, 0x4B, 0x74, 0x26, 0xC4, 0x7C, 0x02, 0x34, 0x24, 0xFA, 0x94, 0x01, 0x62, 0xDC, 0xC3, 0x39, 0xAD, 0xAC, 0x69, 0xBC, 0x94, 0x5E, 0x4B, 0x8C, 0x5E, 0x0D, 0xA8, 0x72, 0xA5, 0xBC, 0x52, 0xC5, 0x04, 0xB9, 0x91, 0x56, 0xA8, 0x97, 0xA1, 0x0D, 0x94, 0x3D, 0x0B, 0x69, 0xD1, 0x9D, 0x93, 0x82, 0x5E, 0xE3, 0x48, 0x4F, 0xCF, 0x7D, 0x60, 0x7C, 0x09, 0xE7, 0x8D, 0xC4, 0x84, 0xFE, 0x69, 0x9E, 0xAF, 0x22, 0x77, 0xD3, 0xCF, 0x70, 0xD1, 0x73, 0xB1, 0x5D, 0x74, 0xBA, 0x42, 0x50, 0x5C, 0x9C, 0x82, 0x73, 0x54, 0x2A, 0x1F, 0x56, 0xC7, 0x6F, 0xAB, 0x54, 0xFE, 0x50, 0xDD, 0xCC, 0x19, 0x9C, 0xE0, 0x7D, 0x33, 0xE6, 0x5A, 0x56, 0x9C, 0xCA, 0xCA, 0xE4, 0xD0, 0x83, 0x96, 0xA2, 0x67, 0x3A, 0x43, 0xA1, 0x5D, 0x91, 0x0E, 0x1B, 0x82, 0x2A, 0x03, 0x83, 0x73, 0xD7, 0xE8, 0x74, 0xD3, 0xE8, 0x34, 0xE3, 0xC5, 0x88, 0xB0, 0x56, 0x9C, 0x5E, 0x16, 0xA9, 0xB6, 0x35, 0x56, 0x5B, 0x2B, 0x7A, 0x79, 0xBE, 0xD7, 0xD7, 0x65, 0x2A, 0xEC, 0xED, 0x97, 0xE9, 0x34, 0xC6, 0x85, 0x5E, 0x1B, 0x96, 0xC7, 0xD8, 0x25, 0xAA, 0xC4, 0x00, 0xBE, 0x57, 0x0B, 0xD6, 0x4D, 0xDD, 0x4A, 0x0D, 0x47, 0x63, 0xD0, 0xAD, 0xD7, 0x0A, 0x7A, 0x4E, 0xEA, 0xB5, 0xF1, 0xBD, 0x7C, 0xF7, 0xFB, 0x23, 0xA1, 0x0B, 0x89, 0xCC, 0xF7, 0x00, 0x35, 0xBC, 0x1C, 0x03, 0x41, 0xAF, 0xAD, 0x44, 0x9F, 0x60, 0xAB, 0x10, 0x78, 0xF9, 0x36, 0x2B, 0xB2, 0x6B, 0x72, 0x52, 0xE8, 0x1F, 0x09, 0xE4, 0x4A, 0xC2, 0x76, 0xFB, 0x92, 0xD7, 0x02, 0xF3, 0xF6, 0xFB, 0xA4, 0x06, 0x8F, 0x57, 0x0B, 0x00, 0x38, 0x18, 0x1B, 0x56, 0x4B, 0x71, 0x9A, 0xE6, 0x74, 0xDD, 0xEB, 0xF3, 0xF5, 0xCD, 0xE9, 0xDC, 0x91, 0xF0, 0x17, 0x68, 0xDC, 0x71, 0x33, 0x66, 0x7F, 0x86, 0x86, 0xE7, 0x5D, 0xE6, 0xBA, 0x2F, 0x24, 0xCA, 0x57, 0x59, 0x9D, 0x86, 0x95, 0x1B, 0x95, 0x77, 0x1F, 0x7F, 0xAC, 0x78, 0x5E, 0xC6, 0xE6, 0xC7, 0xE7, 0x15, 0xE7, 0xF2, 0xA9, 0x11, 0x77, 0xAE, 0xFC, 0x47, 0xE6, 0x31, 0x54, 0xE3, 0x98, 0xD8, 0xD8, 0xA7, 0xE7, 0x2A, 0x2F, 0x24, 0x62, 0xEF, 0xE2, 0xA5, 0x92, 0xC0, 0x63, 0xD3, 0xA2, 0x47, 0x2C, 0xE3, 0x1B, 0x39, 0x7F, 0x3A, 0x20, 0x8D, 0xDE, 0x4C, 0xD8, 0xF0, 0xAB, 0x69, 0x79, 0x70, 0x32, 0xAC, 0x77, 0x8F, 0x2A, 0x81, 0x48, 0xBD, 0x1C, 0x48, 0xEB, 0x32, 0xD7, 0x75, 0x6B, 0xC8, 0x4A, 0x94, 0x5C, 0xA8, 0x34, 0x81, 0x91, 0x30, 0x11, 0x0B, 0x39, 0x13, 0xE4, 0x8E, 0xE9, 0x76, 0xCD, 0xB0, 0xBE, 0xAD, 0x7D, 0xFA, 0x13, 0xD3, 0x79, 0x63, 0x7F, 0xDF, 0xAA, 0x3B, 0x7D, 0x3C, 0xC3, 0xF0, 0x1C, 0xEB, 0xD5, 0x93, 0x76, 0xD9, 0x12, 0x1E, 0x45, 0x31, 0x2A, 0xBD, 0x91, 0xB3, 0x69, 0x8A, 0x10, 0xE9, 0xD1, 0x77, 0x54, 0x87, 0x65, 0xFC, 0x41, 0x47, 0x2F, 0xB1, 0x9C, 0xD5, 0x47, 0xDA, 0x6B, 0xA5, 0xDE, 0x88, 0xF2, 0x41, 0xD5, 0xA5, 0xFD, 0xD7, 0xAF, 0x48, 0x5D, 0x73, 0xAF, 0xB5, 0xD7, 0x76, 0x66, 0x74, 0x99, 0x7E, 0x10, 0x36, 0xFB, 0x30, 0x51, 0x3F, 0xEC, 0xB4, 0xA3, 0xBC, 0xEB, 0xF5, 0x06, 0x26, 0x08, 0xC7, 0x31, 0xD2, 0xD0, 0x5D, 0xBC, 0xB4, 0xE1, 0xB9, 0xC8, 0xB6, 0xEC, 0xC8, 0xE6, 0xC8, 0x2B, 0xCB, 0xBE, 0xFD, 0x63, 0x0D, 0x0E, 0xFD, 0x5B, 0xF7, 0xA3, 0x06, 0x31, 0x56, 0x74, 0xF5, 0x90, 0x6B, 0xA9, 0xDD, 0x77, 0x48, 0x50, 0x06, 0x0C, 0x93, 0xD4, 0x95, 0x5A, 0xF4, 0xE1, 0x8B, 0x0C, 0x21, 0x81, 0xCE, 0xD0, 0x2B, 0xD7, 0xB3, 0xB9, 0xE4, 0x57, 0xD8, 0xEE, 0xCF, 0x41, 0x09, 0xD8, 0x3F, 0x6C, 0x60, 0x7E, 0x9E, 0x32, 0x1E, 0x7D, 0xCC, 0x7C, 0x8D, 0x03, 0xC3, 0x83, 0xB1, 0x94, 0x11, 0xC4, 0x7C, 0xB9, 0x07, 0x8E, 0x71, 0x3E, 0x25, 0xE2, 0xD2, 0xD6, 0x05, 0xE3, 0x2E, 0x2D, 0x21, 0xF1, 0x7E, 0x23, 0x10, 0xCE, 0xAD, 0xAD, 0xB9, 0xEE, 0x8F, 0x83, 0xB4, 0x78, 0x63, 0x9A, 0x90, 0xE8, 0x57, 0xB9, 0x51, 0xAE, 0x48, 0xEE, 0x05, 0x75, 0xC1, 0x0C, 0x22, 0xA0, 0xF3, 0x8E, 0xD7, 0x84, 0x36, 0x41, 0xB9, 0x9A, 0x1E, 0xB4, 0x90, 0x78, 0xB7, 0x76, 0xB1, 0xC9, 0xA0, 0x53, 0x83, 0x3E, 0xA9, 0xB9, 0x53, 0x17, 0x34, 0x30, 0x93, 0xA0, 0x5C, 0x61, 0x0D, 0xFE, 0x17, 0xF6, 0x7C, 0xA8, 0x1C
     },
+    .text_zlen = 4055,
     .text_len = 5292,
     .data = (uint8_t const[]){
-        0x5C, 0x00, 0xCA, 0x3F, 0x5E, 0x8E, 0x37, 0x40, 0x33, 0x8F, 0x37, 0x40, 0x47, 0x94, 0x37, 0x40, 0xBD, 0x8F, 0x37, 0x40, 0x53, 0x8F, 0x37, 0x40, 0xBD, 0x8F, 0x37, 0x40, 0x1D, 0x90, 0x37, 0x40, 0x3A, 0x91, 0x37, 0x40, 0xAC, 0x91, 0x37, 0x40, 0x55, 0x91, 0x37, 0x40, 0xE9, 0x8D, 0x37, 0x40, 0xD0, 0x90, 0x37, 0x40, 0x2C, 0x91, 0x37, 0x40, 0x40, 0x90, 0x37, 0x40, 0xD0, 0x91, 0x37, 0x40, 0x68, 0x90, 0x37, 0x40, 0xD0, 0x91, 0x37, 0x40, 0x21, 0x8F, 0x37, 0x40, 0x7E, 0x8F, 0x37, 0x40, 0xBD, 0x8F, 0x37, 0x40, 0x1D, 0x90, 0x37, 0x40, 0x39, 0x8F, 0x37, 0x40, 0x2A, 0x8E, 0x37, 0x40, 0x90, 0x92, 0x37, 0x40, 0x0D, 0x94, 0x37, 0x40, 0x00, 0x8D, 0x37, 0x40, 0x2D, 0x94, 0x37, 0x40, 0x00, 0x8D, 0x37, 0x40, 0x00, 0x8D, 0x37, 0x40, 0x00, 0x8D, 0x37, 0x40, 0x00, 0x8D, 0x37, 0x40, 0x00, 0x8D, 0x37, 0x40, 0x00, 0x8D, 0x37, 0x40, 0x00, 0x8D, 0x37, 0x40, 0x00, 0x8D, 0x37, 0x40, 0x2A, 0x92, 0x37, 0x40, 0x00, 0x8D, 0x37, 0x40, 0x25, 0x93, 0x37, 0x40, 0x0D, 0x94, 0x37, 0x40, 0x04, 0x08, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x04, 0x08, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x04, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x11, 0x04, 0x08, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x11, 0x04, 0x08, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x01, 0x04, 0x08, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x11, 0x20, 0x28, 0x0C, 0x00, 0x10, 0x01, 0x00, 0x00
+        0x28, 0xCF, 0x8B, 0x61, 0x38, 0x65, 0x1F, 0xD7, 0x67, 0xEE, 0x60, 0xDC, 0x6F, 0xEE, 0xE0, 0x3E, 0xC5, 0xDC, 0x61, 0x2F, 0x90, 0x0E, 0xEE, 0x87, 0xD0, 0xB2, 0x13, 0xCC, 0x1D, 0xAC, 0x26, 0x9A, 0x3B, 0xAC, 0x01, 0xE2, 0x50, 0x20, 0x7E, 0xD9, 0x6B, 0xEE, 0x70, 0x01, 0x28, 0xA6, 0x03, 0x64, 0x3B, 0x00, 0xE9, 0x0B, 0x40, 0x3A, 0x03, 0x4A, 0x2B, 0x02, 0xD5, 0xD7, 0x21, 0xE9, 0xB3, 0x04, 0xD2, 0x5A, 0x40, 0x73, 0x27, 0x4C, 0x32, 0x77, 0xE0, 0x05, 0x9A, 0xCB, 0x00, 0xD4, 0xAB, 0x0B, 0xA5, 0xF1, 0x61, 0xAD, 0x49, 0x10, 0x5A, 0x75, 0x32, 0x44, 0x1F, 0x0B, 0xC7, 0x7C, 0x06, 0x08, 0x90, 0x60, 0x64, 0xE1, 0x60, 0x85, 0xB2, 0x39, 0x80, 0x6C, 0x36, 0x28, 0x9B, 0x01, 0xC8, 0x56, 0x04, 0x33, 0x14, 0x18, 0x18, 0x04, 0x59, 0x38, 0xEE, 0x20, 0xB1, 0x79, 0x60, 0x6C, 0xA0, 0x1A, 0x21, 0xB8, 0xB8, 0x82, 0x06, 0x0F, 0x83, 0x00, 0x23, 0x03, 0x03, 0x00, 0x3F, 0x74, 0x37, 0xE8
     },
+    .data_zlen = 144,
     .data_len = 252,
     .text_start = 0x40378000,
     .data_start = 0x3FCB2BFC,
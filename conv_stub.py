@@ -1,29 +1,88 @@
 #!/usr/bin/env python3
 
-import json, os, argparse, base64
+import json, os, argparse, base64, zlib, struct
 
 parser = argparse.ArgumentParser(
-    usage="Converts esptool.py flasher stub JSON files into esptoolsquared C constants"
+    usage="Converts esptool.py flasher stub JSON files into esptoolsquared C constants or a stub pack"
 )
-parser.add_argument("infile", action="store", help="Input JSON file")
+parser.add_argument("infile", action="store", nargs="+",
+                    help="Input JSON file; with --pack, "
+                         "JSON:CHIP_ID[:STUB_STATUS_LEN[:RAM_BLOCK[:FLASH_BLOCK[:ROM_STATUS_LEN[:FLASH_ENC]]]]]")
 parser.add_argument("--id",   action="store", help="ROM ID prefix [flashstub]", default="flashstub")
+parser.add_argument("--window-bits", action="store", type=int, default=10,
+                    help="Compression window size (log2) [10], also the memory needed to inflate the stub")
+parser.add_argument("--pack", action="store", metavar="OUTFILE",
+                    help="Write a stub pack for et2_registry_load() instead of C constants")
 args = parser.parse_args()
 
-with open(args.infile, "r") as fd:
-    obj = json.load(fd)
+def compress(data: bytes) -> bytes:
+    comp = zlib.compressobj(9, zlib.DEFLATED, args.window_bits, 9)
+    return comp.compress(data) + comp.flush()
 
 def mkrom(id: str, data: bytes):
+    zdata = compress(data)
     print(f"    .{id} = (uint8_t const[]){{")
-    print(f"        {", ".join(map(lambda x: f"0x{x:02X}", data))}")
+    print("        " + ", ".join(map(lambda x: f"0x{x:02X}", zdata)))
     print( "    },")
+    print(f"    .{id}_zlen = {len(zdata)},")
     print(f"    .{id}_len = {len(data)},")
 
 def mkconst(id: str, data: int):
     print(f"    .{id} = 0x{data:08X},")
 
+# Stub pack layout, see src/et2_registry.c.
+PACK_MAGIC     = 0x53325445
+PACK_VERSION   = 1
+PACK_HDR       = "<IHHII"
+PACK_ENTRY     = "<IIIIBBHIIIIIIIIIII"
+PACK_FLASH_ENC = 0x01
+
+def mkpack(outfile: str):
+    specs = []
+    for spec in args.infile:
+        path, *params = spec.split(":")
+        if not params:
+            parser.error(f"{spec}: a chip ID is required with --pack")
+        if len(params) > 6:
+            parser.error(f"{spec}: too many parameters")
+        params = [int(x, 0) for x in params] + [4, 0x1800, 0x4000, 4, 1][len(params) - 1:]
+        with open(path, "r") as fd:
+            specs.append((json.load(fd), *params))
+
+    offset  = struct.calcsize(PACK_HDR) + len(specs) * struct.calcsize(PACK_ENTRY)
+    entries = b""
+    blobs   = b""
+    for obj, chip_id, stub_status, ram_block, flash_block, rom_status, flash_enc in specs:
+        text = base64.b64decode(obj['text'])
+        data = base64.b64decode(obj['data'])
+        ztext = compress(text)
+        zdata = compress(data)
+        flags    = PACK_FLASH_ENC if flash_enc else 0
+        entries += struct.pack(PACK_ENTRY, chip_id, flags, ram_block, flash_block, rom_status, stub_status, 0,
+                               obj['text_start'], obj['data_start'], obj['bss_start'], obj['entry'],
+                               offset + len(blobs), len(ztext), len(text),
+                               offset + len(blobs) + len(ztext), len(zdata), len(data), 0)
+        blobs += ztext + zdata
+
+    body = entries + blobs
+    size = struct.calcsize(PACK_HDR) + len(body)
+    with open(outfile, "wb") as fd:
+        fd.write(struct.pack(PACK_HDR, PACK_MAGIC, PACK_VERSION, len(specs), size, zlib.crc32(body)))
+        fd.write(body)
+
+if args.pack:
+    mkpack(args.pack)
+    exit(0)
+elif len(args.infile) != 1:
+    parser.error("exactly one input file is required without --pack")
+
+with open(args.infile[0], "r") as fd:
+    obj = json.load(fd)
+
 print("// WARNING: This is a generated file, do not edit it!")
 print("// clang-format off")
-print(f"// Generated from {os.path.relpath(args.infile)}")
+print(f"// Generated from {os.path.relpath(args.infile[0])}")
+print(f"// The text and data segments are zlib streams with a {1 << args.window_bits} byte window")
 print("")
 print("#include \"chips.h\"")
 print("")
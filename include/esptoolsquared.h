@@ -3,9 +3,19 @@
 
 #pragma once
 
-#include <driver/uart.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include "esp_system.h"
+#include "et2_journal.h"
+#include "et2_transport.h"
+#ifndef CONFIG_IDF_TARGET_LINUX
+#include "esp_partition.h"
+#endif
+
+// Size of the data blocks sent by the flash write functions
+#define ET2_FLASH_WRITE_SIZE  0x4000
+// Size of the smallest flash erase unit
+#define ET2_FLASH_SECTOR_SIZE 0x1000
 
 // ESP flashing protocol commands
 typedef enum {
@@ -34,45 +44,471 @@ typedef enum {
     ET2_CMD_FLASH_ENCRYPT_DATA = 0xD4,
 } et2_cmd_t;
 
+// Connection to one target; every function below has an et2_session_ variant that takes one as its first argument
+// The functions without a session argument use a default session, set up by et2_setif or et2_setif_uart
+typedef struct et2_session et2_session_t;
+
+// Create a session on a transport; the transport is not owned by the session and must outlive it
+esp_err_t      et2_session_create(et2_transport_t* tp, et2_session_t** out_session);
+// Destroy a session; the transport is not destroyed
+void           et2_session_destroy(et2_session_t* session);
+// Get the default session
+et2_session_t* et2_default_session(void);
+
+// Set interface used to a transport
+esp_err_t et2_setif(et2_transport_t* tp);
+
+#ifndef CONFIG_IDF_TARGET_LINUX
 // Set interface used to a UART
 esp_err_t et2_setif_uart(uart_port_t uart);
+#endif
+
+// Load flasher stubs and chip parameters from a stub pack made by conv_stub.py --pack; the pack is used in place and
+// must stay valid until unloaded. Loaded chips take precedence over the built-in ones, and loading replaces the
+// previous pack. A session detecting a loaded chip keeps the pack in use until the session is destroyed or set to
+// another transport; while the pack is in use, loading and unloading return ESP_ERR_INVALID_STATE.
+esp_err_t et2_registry_load(void const* pack, size_t len);
+#ifndef CONFIG_IDF_TARGET_LINUX
+// Load a stub pack from a data partition, which stays memory-mapped until unloaded
+esp_err_t et2_registry_load_partition(char const* label);
+#endif
+// Forget the loaded stub pack
+esp_err_t et2_registry_unload(void);
 
 // Try to connect to and synchronize with the ESP32
 esp_err_t et2_sync();
+esp_err_t et2_session_sync(et2_session_t* session);
+
+// Reset sequence used by et2_connect to start the target in download mode
+typedef enum {
+    // Do not reset the target, e.g. because it is already waiting for download
+    ET2_RESET_NONE,
+    // esptool's classic reset, for EN and BOOT wired to GPIOs or to an auto-reset circuit on DTR and RTS
+    ET2_RESET_CLASSIC,
+    // esptool's reset for targets connected through their USB-Serial/JTAG port; needs DTR and RTS on the transport
+    ET2_RESET_USB_JTAG,
+} et2_reset_t;
+
+// Configuration of et2_connect
+typedef struct {
+    et2_reset_t reset;
+    // GPIOs wired to the EN and BOOT pins of the target, or -1 to use the DTR and RTS lines of the transport
+    int         en_gpio;
+    int         boot_gpio;
+    // Time BOOT is held low after EN is released, in microseconds
+    uint32_t    boot_hold_us;
+    // Time to keep sending SYNC frames before giving up, in microseconds
+    int64_t     timeout_us;
+} et2_connect_config_t;
+
+#define ET2_CONNECT_CONFIG_DEFAULT() \
+    {.reset = ET2_RESET_CLASSIC, .en_gpio = -1, .boot_gpio = -1, .boot_hold_us = 50000, .timeout_us = 2000000}
+
+// Reset the target into download mode and send SYNC frames until it responds, without waiting for the
+// "waiting for download" message; if `config` is NULL, ET2_CONNECT_CONFIG_DEFAULT() is used
+// `out_connect_us` receives the time from the start of the reset to the first response and may be NULL
+esp_err_t et2_connect(et2_connect_config_t const* config, int64_t* out_connect_us);
+esp_err_t et2_session_connect(et2_session_t* session, et2_connect_config_t const* config, int64_t* out_connect_us);
+
+// Change the baudrate of both the target and the transport
+esp_err_t et2_change_baudrate(uint32_t baudrate);
+esp_err_t et2_session_change_baudrate(et2_session_t* session, uint32_t baudrate);
+
+// Raise the baudrate as far as the link allows, up to `max_baudrate`; call this after et2_run_stub
+// If too many commands fail afterwards, the baudrate is lowered one step at a time automatically
+esp_err_t et2_set_baudrate_auto(uint32_t max_baudrate);
+esp_err_t et2_session_set_baudrate_auto(et2_session_t* session, uint32_t max_baudrate);
+
+// Get the current baudrate
+uint32_t et2_get_baudrate(void);
+uint32_t et2_session_get_baudrate(et2_session_t* session);
 
 // Detect an ESP32 and, if present, read its chip ID
 // If a pointer is NULL, the property is not read
 esp_err_t et2_detect(uint32_t* chip_id);
+esp_err_t et2_session_detect(et2_session_t* session, uint32_t* chip_id);
 
 // Upload and start the flasher stub
 esp_err_t et2_run_stub();
+esp_err_t et2_session_run_stub(et2_session_t* session);
 
 // Write to a range of memory
 esp_err_t et2_mem_write(uint32_t addr, void const* wdata, uint32_t len);
+esp_err_t et2_session_mem_write(et2_session_t* session, uint32_t addr, void const* wdata, uint32_t len);
 
 // Write application to RAM (sending end command restarts the target into the loaded application)
 esp_err_t et2_cmd_mem_begin(uint32_t size, uint32_t blocks, uint32_t blocksize, uint32_t offset);
 esp_err_t et2_cmd_mem_data(void const* data, uint32_t data_len, uint32_t seq);
 esp_err_t et2_cmd_mem_end(uint32_t entrypoint);
+esp_err_t et2_session_cmd_mem_begin(et2_session_t* session, uint32_t size, uint32_t blocks, uint32_t blocksize,
+                                    uint32_t offset);
+esp_err_t et2_session_cmd_mem_data(et2_session_t* session, void const* data, uint32_t data_len, uint32_t seq);
+esp_err_t et2_session_cmd_mem_end(et2_session_t* session, uint32_t entrypoint);
 
 // Write uncompressed data to flash
 esp_err_t et2_cmd_flash_begin(uint32_t size, uint32_t offset);
 esp_err_t et2_cmd_flash_data(const uint8_t* data, uint32_t data_len, uint32_t seq);
 esp_err_t et2_cmd_flash_finish(bool reboot);
+esp_err_t et2_session_cmd_flash_begin(et2_session_t* session, uint32_t size, uint32_t offset);
+esp_err_t et2_session_cmd_flash_data(et2_session_t* session, const uint8_t* data, uint32_t data_len, uint32_t seq);
+esp_err_t et2_session_cmd_flash_finish(et2_session_t* session, bool reboot);
+
+// Write data to flash that is encrypted by the target; use with et2_cmd_flash_begin and et2_cmd_flash_finish
+esp_err_t et2_cmd_flash_encrypt_data(const uint8_t* data, uint32_t data_len, uint32_t seq);
+esp_err_t et2_session_cmd_flash_encrypt_data(et2_session_t* session, const uint8_t* data, uint32_t data_len,
+                                             uint32_t seq);
+
+// Pipelined writer that keeps several FLASH_DATA, DEFL_DATA or FLASH_ENCRYPT_DATA blocks in flight
+typedef struct {
+    // Session the blocks are sent on
+    et2_session_t* session;
+    // Data command used for every block
+    et2_cmd_t      cmd;
+    // Maximum number of blocks sent but not yet acknowledged
+    uint32_t       window;
+    // Sequence number of the next block to send
+    uint32_t       seq;
+    // Number of blocks acknowledged so far
+    uint32_t       acked;
+} et2_flash_writer_t;
+
+// Prepare a pipelined writer; a window of 0 selects CONFIG_ET2_FLASH_WINDOW
+// Send the matching begin command first and the matching finish command after et2_flash_writer_wait
+void      et2_flash_writer_init(et2_flash_writer_t* writer, et2_cmd_t cmd, uint32_t window);
+void      et2_session_flash_writer_init(et2_session_t* session, et2_flash_writer_t* writer, et2_cmd_t cmd,
+                                        uint32_t window);
+// Send the next block; the data only needs to stay valid until this returns
+esp_err_t et2_flash_writer_write(et2_flash_writer_t* writer, const uint8_t* data, uint32_t data_len);
+// Wait until all blocks sent have been acknowledged
+esp_err_t et2_flash_writer_wait(et2_flash_writer_t* writer);
+
+// Write uncompressed data to flash using a pipelined writer; the caller sends et2_cmd_flash_finish afterwards
+// Every write function takes an `out_md5` that, unless it is NULL, receives the MD5 of the data written, computed
+// while the data is sent; pass it to et2_verify_flash to check the write without reading the data back
+esp_err_t et2_write_flash(uint32_t offset, const uint8_t* data, uint32_t len, uint8_t out_md5[16]);
+esp_err_t et2_session_write_flash(et2_session_t* session, uint32_t offset, const uint8_t* data, uint32_t len,
+                                  uint8_t out_md5[16]);
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+// Write the first `len` bytes of a local partition to flash, sending memory-mapped windows of it without copying them
+// If `validate_app` is set, the partition must hold a valid app image, and a `len` of 0 selects the image size;
+// otherwise a `len` of 0 selects the whole partition. The caller sends et2_cmd_flash_finish afterwards
+esp_err_t et2_write_flash_from_partition(uint32_t offset, esp_partition_t const* part, uint32_t len, bool validate_app,
+                                         uint8_t out_md5[16]);
+esp_err_t et2_session_write_flash_from_partition(et2_session_t* session, uint32_t offset, esp_partition_t const* part,
+                                                 uint32_t len, bool validate_app, uint8_t out_md5[16]);
+#endif
 
 // Write compressed data to flash
 esp_err_t et2_cmd_deflate_begin(uint32_t uncompressed_size, uint32_t compressed_size, uint32_t offset);
 esp_err_t et2_cmd_deflate_data(const uint8_t* data, uint32_t data_len, uint32_t seq);
 esp_err_t et2_cmd_deflate_finish(bool reboot);
+esp_err_t et2_session_cmd_deflate_begin(et2_session_t* session, uint32_t uncompressed_size, uint32_t compressed_size,
+                                        uint32_t offset);
+esp_err_t et2_session_cmd_deflate_data(et2_session_t* session, const uint8_t* data, uint32_t data_len, uint32_t seq);
+esp_err_t et2_session_cmd_deflate_finish(et2_session_t* session, bool reboot);
+
+// Compress data with a zlib level from 0 to 9 (-1 for the default) and write it to flash, keeping several blocks in
+// flight; memory use is bounded by CONFIG_ET2_DEFLATE_WINDOW_BITS
+// The caller sends et2_cmd_deflate_finish afterwards
+esp_err_t et2_write_flash_compressed(uint32_t offset, const uint8_t* data, uint32_t len, int level,
+                                     uint8_t out_md5[16]);
+esp_err_t et2_session_write_flash_compressed(et2_session_t* session, uint32_t offset, const uint8_t* data, uint32_t len,
+                                             int level, uint8_t out_md5[16]);
+
+// Configuration of the compress and transmit pipeline
+typedef struct {
+    // zlib compression level from 0 to 9, or -1 for the default
+    int      level;
+    // Number of compressed blocks buffered between compression and transmission
+    uint32_t ring_blocks;
+    // Core to run the compression and transmission on, or -1 for any core
+    int      compress_core;
+    int      transmit_core;
+} et2_pipeline_config_t;
+
+#define ET2_PIPELINE_CONFIG_DEFAULT() \
+    {.level = -1, .ring_blocks = 3, .compress_core = -1, .transmit_core = -1}
+
+// Time spent by the compress and transmit pipeline stages
+typedef struct {
+    // Time from start to end of each stage, in microseconds
+    int64_t  compress_us;
+    int64_t  transmit_us;
+    // Time each stage spent waiting on the other, in microseconds
+    int64_t  compress_stall_us;
+    int64_t  transmit_stall_us;
+    // Number of compressed blocks and bytes sent
+    uint32_t blocks;
+    size_t   compressed_bytes;
+} et2_pipeline_stats_t;
+
+// Like et2_write_flash_compressed, but compresses and transmits in parallel on two threads
+// If `config` is NULL, ET2_PIPELINE_CONFIG_DEFAULT() is used; `out_stats` may be NULL
+esp_err_t et2_write_flash_pipelined(uint32_t offset, const uint8_t* data, uint32_t len,
+                                    et2_pipeline_config_t const* config, et2_pipeline_stats_t* out_stats,
+                                    uint8_t out_md5[16]);
+esp_err_t et2_session_write_flash_pipelined(et2_session_t* session, uint32_t offset, const uint8_t* data, uint32_t len,
+                                            et2_pipeline_config_t const* config, et2_pipeline_stats_t* out_stats,
+                                            uint8_t out_md5[16]);
 
 // Read a register
 esp_err_t et2_cmd_read_reg(uint32_t address, uint32_t* out_value);
+esp_err_t et2_session_cmd_read_reg(et2_session_t* session, uint32_t address, uint32_t* out_value);
 
 // Read uncompressed data from flash
 esp_err_t et2_cmd_read_flash(uint32_t offset, uint32_t length, uint8_t* out_data);
+esp_err_t et2_session_cmd_read_flash(et2_session_t* session, uint32_t offset, uint32_t length, uint8_t* out_data);
+
+// Receives flash contents while they are being read; a returned error is passed on by et2_read_flash_stream
+typedef esp_err_t (*et2_read_sink_t)(void* cookie, uint32_t offset, uint8_t const* data, size_t len);
+
+// Read flash without buffering all of it, passing each packet to `sink` as it arrives
+// A `packet_size` or `max_inflight` of 0 selects the default of 4 KiB and 64 packets; `out_md5` may be NULL
+esp_err_t et2_read_flash_stream(uint32_t offset, uint32_t length, uint32_t packet_size, uint32_t max_inflight,
+                                et2_read_sink_t sink, void* cookie, uint8_t out_md5[16]);
+esp_err_t et2_session_read_flash_stream(et2_session_t* session, uint32_t offset, uint32_t length, uint32_t packet_size,
+                                        uint32_t max_inflight, et2_read_sink_t sink, void* cookie,
+                                        uint8_t out_md5[16]);
 
 // Erase entire flash
 esp_err_t et2_cmd_erase_flash(void);
+esp_err_t et2_session_cmd_erase_flash(et2_session_t* session);
 
 // Erase a region of flash
 esp_err_t et2_cmd_erase_region(uint32_t offset, uint32_t length);
+esp_err_t et2_session_cmd_erase_region(et2_session_t* session, uint32_t offset, uint32_t length);
+
+// Get the MD5 digest of a region of flash
+esp_err_t et2_cmd_spi_flash_md5(uint32_t offset, uint32_t length, uint8_t out_md5[16]);
+esp_err_t et2_session_cmd_spi_flash_md5(et2_session_t* session, uint32_t offset, uint32_t length, uint8_t out_md5[16]);
+
+// Check that a region of flash has the MD5 digest `expected_md5`, as computed by the target with SPI_FLASH_MD5
+// Returns ESP_ERR_INVALID_CRC if it does not match
+esp_err_t et2_verify_flash(uint32_t offset, uint32_t length, uint8_t const expected_md5[16]);
+esp_err_t et2_session_verify_flash(et2_session_t* session, uint32_t offset, uint32_t length,
+                                   uint8_t const expected_md5[16]);
+
+// Size of the largest flash erase unit
+#define ET2_FLASH_BLOCK_SIZE 0x10000
+
+// Range of flash to erase
+typedef struct {
+    uint32_t start;
+    uint32_t end;
+} et2_erase_range_t;
+
+// Set of flash ranges to erase with as few and as large erase commands as possible
+typedef struct {
+    et2_erase_range_t* ranges;
+    size_t             count;
+    size_t             cap;
+} et2_erase_plan_t;
+
+// Prepare an empty erase plan
+void      et2_erase_plan_init(et2_erase_plan_t* plan);
+// Add a range to an erase plan; every sector the range touches is erased, and ranges may overlap
+esp_err_t et2_erase_plan_add(et2_erase_plan_t* plan, uint32_t offset, uint32_t len);
+// Free the memory used by an erase plan
+void      et2_erase_plan_free(et2_erase_plan_t* plan);
+
+// Erase the ranges in a plan, merging adjacent and overlapping ranges into one ERASE_REGION command
+// If `check` is set, each 64 KiB block is first hashed with SPI_FLASH_MD5 and skipped if it is already erased, and a
+// partly planned block is erased as a whole if the rest of it is already erased. `out_erased` receives the number of
+// bytes erased and may be NULL
+esp_err_t et2_erase_plan_run(et2_erase_plan_t* plan, bool check, uint32_t* out_erased);
+esp_err_t et2_session_erase_plan_run(et2_session_t* session, et2_erase_plan_t* plan, bool check, uint32_t* out_erased);
+
+// Write data to flash, skipping every `chunk_size` chunk whose MD5 already matches the flash contents
+// Changed chunks are written in runs, compressed with zlib `level` unless it is 0; `offset` and `chunk_size` must be
+// multiples of 4 KiB; the caller sends et2_cmd_flash_finish or et2_cmd_deflate_finish afterwards
+esp_err_t et2_write_flash_diff(uint32_t offset, const uint8_t* data, uint32_t len, uint32_t chunk_size, int level,
+                               uint8_t out_md5[16]);
+esp_err_t et2_session_write_flash_diff(et2_session_t* session, uint32_t offset, const uint8_t* data, uint32_t len,
+                                       uint32_t chunk_size, int level, uint8_t out_md5[16]);
+
+// Write data to flash, erasing the 4 KiB sectors that are entirely 0xFF instead of sending them
+// The other sectors are sent in runs, compressed with zlib `level` unless it is 0. The empty sectors are erased
+// afterwards with et2_erase_plan_run, which skips blocks that are already erased. `offset` must be a multiple of
+// 4 KiB; the caller sends et2_cmd_flash_finish or et2_cmd_deflate_finish afterwards
+esp_err_t et2_write_flash_sparse(uint32_t offset, uint8_t const* data, uint32_t len, int level, uint8_t out_md5[16]);
+esp_err_t et2_session_write_flash_sparse(et2_session_t* session, uint32_t offset, uint8_t const* data, uint32_t len,
+                                         int level, uint8_t out_md5[16]);
+
+// Like et2_write_flash_sparse, but for a sparse image made by mk_sparse.py, which lists the chunks holding data
+// `out_md5` receives the MD5 of the expanded image
+esp_err_t et2_write_flash_sparse_image(uint32_t offset, void const* image, size_t len, int level, uint8_t out_md5[16]);
+esp_err_t et2_session_write_flash_sparse_image(et2_session_t* session, uint32_t offset, void const* image, size_t len,
+                                               int level, uint8_t out_md5[16]);
+
+// Compress the region with zlib while sending it
+#define ET2_REGION_COMPRESS     0x01
+// The region's partition must hold a valid app image; a `len` of 0 selects the image size
+#define ET2_REGION_VALIDATE_APP 0x02
+// Erase the region's empty sectors instead of sending them, see et2_write_flash_sparse
+#define ET2_REGION_SKIP_EMPTY   0x04
+// Hash the region while sending it and check it with et2_verify_flash before the finish command
+#define ET2_REGION_VERIFY       0x08
+
+// One region of a flash manifest
+typedef struct {
+    // Flash offset to write to
+    uint32_t       offset;
+    // Data to write, unless `part` is set
+    uint8_t const* data;
+#ifndef CONFIG_IDF_TARGET_LINUX
+    // Local partition to copy from; a `len` of 0 selects the whole partition
+    esp_partition_t const* part;
+#endif
+    // Number of bytes to write
+    uint32_t len;
+    // ET2_REGION_* flags
+    uint32_t flags;
+} et2_region_t;
+
+// Write several regions to flash in one stub session, then send one finish command that reboots if `reboot` is set
+// The regions may be given in any order but must not overlap or share a 4 KiB sector
+esp_err_t et2_write_flash_manifest(et2_region_t const* regions, size_t count, bool reboot);
+esp_err_t et2_session_write_flash_manifest(et2_session_t* session, et2_region_t const* regions, size_t count,
+                                           bool reboot);
+
+// Write data to flash in 256 KiB segments, committing each segment and its MD5 to `journal` once it is acknowledged
+// If the journal holds progress for the same image at the same offset, the last committed segments are checked with
+// SPI_FLASH_MD5 and the write continues after the last one that matches, so after a dropped link only the stub needs
+// to be started again. The journal is cleared once the whole image is written. Segments are compressed with zlib
+// `level` unless it is 0; `offset` must be a multiple of 4 KiB. The caller sends et2_cmd_flash_finish or
+// et2_cmd_deflate_finish afterwards
+esp_err_t et2_write_flash_resumable(uint32_t offset, uint8_t const* data, uint32_t len, int level,
+                                    et2_journal_t* journal, uint8_t out_md5[16]);
+esp_err_t et2_session_write_flash_resumable(et2_session_t* session, uint32_t offset, uint8_t const* data, uint32_t len,
+                                            int level, et2_journal_t* journal, uint8_t out_md5[16]);
+
+#ifndef ESP_ERR_NOT_FINISHED
+#define ESP_ERR_NOT_FINISHED 0x10C
+#endif
+
+// Kind of job run by a job queue
+typedef enum {
+    // Write `data` to flash, compressed with zlib `level` unless it is 0
+    ET2_JOB_WRITE,
+    // Read flash and pass it to `sink`
+    ET2_JOB_READ,
+    // Erase a sector-aligned range of flash
+    ET2_JOB_ERASE,
+    // Check that flash matches `data`, one 64 KiB block at a time
+    ET2_JOB_VERIFY,
+    // Send the finish command matching the last write job, which reboots the target if `reboot` is set
+    ET2_JOB_FINISH,
+} et2_job_kind_t;
+
+// Progress of a running job
+typedef struct {
+    uint32_t id;
+    // Bytes done so far and in total
+    uint32_t done;
+    uint32_t total;
+    // Time since the job started, average throughput so far and estimated time left, or -1 if not known yet
+    int64_t  elapsed_us;
+    uint32_t bytes_per_s;
+    int64_t  eta_us;
+} et2_job_progress_t;
+
+// Called on the worker thread after every block of a job
+typedef void (*et2_job_progress_cb_t)(void* cookie, et2_job_progress_t const* progress);
+// Called on the worker thread once a job is done, failed or cancelled; a cancelled job has ESP_ERR_NOT_FINISHED
+typedef void (*et2_job_done_cb_t)(void* cookie, uint32_t id, esp_err_t res);
+
+// Job for a job queue; all buffers must stay valid until the job is done
+typedef struct {
+    et2_job_kind_t        kind;
+    uint32_t              offset;
+    uint32_t              len;
+    // Data to write or to compare flash with
+    uint8_t const*        data;
+    // zlib level for writes from 0 to 9, or -1 for the default
+    int                   level;
+    // Check writes with et2_verify_flash once they are acknowledged
+    bool                  verify;
+    bool                  reboot;
+    // Receives the data of reads
+    et2_read_sink_t       sink;
+    // Passed to `sink` and the callbacks; either callback may be NULL
+    void*                 cookie;
+    et2_job_progress_cb_t on_progress;
+    et2_job_done_cb_t     on_done;
+} et2_job_t;
+
+// Queue of jobs run one after the other by a worker thread
+typedef struct et2_jobs et2_jobs_t;
+
+// Start a worker thread that runs jobs on the session, pinned to `core` unless it is -1
+// The session must not be used by anything else until the queue is destroyed
+esp_err_t et2_jobs_create(int core, et2_jobs_t** out_jobs);
+esp_err_t et2_session_jobs_create(et2_session_t* session, int core, et2_jobs_t** out_jobs);
+// Cancel all jobs, wait for the worker to stop and free the queue
+void      et2_jobs_destroy(et2_jobs_t* jobs);
+// Add a job to the queue without waiting for it; `out_id` may be NULL
+esp_err_t et2_jobs_submit(et2_jobs_t* jobs, et2_job_t const* job, uint32_t* out_id);
+// Cancel a job; a queued job is dropped and a running job stops at the next block boundary, once the blocks in
+// flight are acknowledged. Returns ESP_ERR_NOT_FOUND if the job is already done
+esp_err_t et2_jobs_cancel(et2_jobs_t* jobs, uint32_t id);
+// Wait until the queue is empty and no job is running
+void      et2_jobs_wait_idle(et2_jobs_t* jobs);
+
+// Number of buckets in a latency histogram; bucket 0 counts latencies below 2 us, bucket `i` counts latencies from
+// 2^i up to 2^(i + 1) us and the last bucket counts everything longer
+#define ET2_STATS_BUCKETS 24
+
+// Latency histogram
+typedef struct {
+    uint32_t buckets[ET2_STATS_BUCKETS];
+    // Number of samples, their sum and the longest sample, in microseconds
+    uint32_t count;
+    int64_t  total_us;
+    int64_t  max_us;
+} et2_histogram_t;
+
+// Counters for one command
+typedef struct {
+    // Number of times the command was sent
+    uint32_t        calls;
+    // Time spent encoding and writing the request to the transport
+    et2_histogram_t send;
+    // Time from the request being written until the first byte of its response arrived
+    et2_histogram_t device;
+    // Time from the first byte of the response arriving until the response was complete
+    et2_histogram_t receive;
+    // Bytes of requests and responses before and after SLIP framing and escaping
+    uint64_t        tx_payload;
+    uint64_t        tx_wire;
+    uint64_t        rx_payload;
+    uint64_t        rx_wire;
+    // Number of responses that took more than one receive, and the number of unrelated frames dropped meanwhile
+    uint32_t        retries;
+    uint32_t        discarded;
+    // Number of responses that did not arrive in time, or arrived broken
+    uint32_t        timeouts;
+    uint32_t        rx_errors;
+    // Number of responses with a failure status, and how many of those reported a bad checksum
+    uint32_t        failures;
+    uint32_t        bad_checksum;
+} et2_cmd_stats_t;
+
+// Get the counters of one command; returns ESP_ERR_NOT_SUPPORTED if CONFIG_ET2_STATS is disabled
+esp_err_t et2_get_cmd_stats(et2_cmd_t cmd, et2_cmd_stats_t* out_stats);
+esp_err_t et2_session_get_cmd_stats(et2_session_t* session, et2_cmd_t cmd, et2_cmd_stats_t* out_stats);
+
+// Reset the counters of all commands
+void et2_reset_stats(void);
+void et2_session_reset_stats(et2_session_t* session);
+
+// Log the counters of every command that was sent at least once
+void et2_dump_stats(void);
+void et2_session_dump_stats(et2_session_t* session);
+
+// Log the counters every `interval_us` microseconds while commands are being sent; 0 to stop
+void et2_set_stats_interval(int64_t interval_us);
+void et2_session_set_stats_interval(et2_session_t* session, int64_t interval_us);
+
+// Approximate a percentile from 0 to 100 of a histogram, in microseconds
+int64_t et2_histogram_percentile(et2_histogram_t const* hist, uint32_t percentile);
@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2025 Julian Scheffers
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stddef.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+typedef struct et2_journal et2_journal_t;
+
+// Small persistent record used by et2_write_flash_resumable to remember how far a write got.
+// Backends embed this as their first member.
+struct et2_journal {
+    // Read the record into `data`, which holds `cap` bytes; ESP_ERR_NOT_FOUND if there is none.
+    esp_err_t (*load)(et2_journal_t* journal, void* data, size_t cap, size_t* out_len);
+    // Replace the record; returns once it is stored persistently.
+    esp_err_t (*save)(et2_journal_t* journal, void const* data, size_t len);
+    // Delete the record, if any.
+    esp_err_t (*clear)(et2_journal_t* journal);
+    // Release the journal.
+    void (*destroy)(et2_journal_t* journal);
+};
+
+// Create a journal stored in a file, which is replaced atomically on every save.
+esp_err_t et2_journal_file_create(char const* path, et2_journal_t** out_journal);
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+// Create a journal stored as an NVS blob; NVS must already be initialized and `key` is at most 15 characters.
+esp_err_t et2_journal_nvs_create(char const* namespace_name, char const* key, et2_journal_t** out_journal);
+#endif
+
+// Destroy a journal created by one of the functions above; the stored record is kept.
+void et2_journal_destroy(et2_journal_t* journal);
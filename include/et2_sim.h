@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2025 Julian Scheffers
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+// Simulated ROM loader and flasher stub, only available when building for the linux target.
+// The simulated target starts in ROM loader mode and switches to flasher stub mode once a RAM image is started.
+
+typedef struct et2_sim et2_sim_t;
+
+// Simulated target configuration; zero-initialized fields select the defaults.
+typedef struct {
+    // File backing the flash contents; NULL to keep the flash in memory only.
+    char const* flash_path;
+    // Flash size in bytes, default 4 MiB.
+    uint32_t    flash_size;
+    // Chip ID reported in the security info, default ESP32-C6.
+    uint32_t    chip_id;
+    // Number of status bytes sent by the ROM loader, default 4.
+    uint8_t     rom_status_len;
+    // Number of status bytes sent by the flasher stub, default 2.
+    uint8_t     stub_status_len;
+    // Create a pty instead of a socket pair.
+    bool        use_pty;
+    // Do not send the "waiting for download" banner on startup.
+    bool        no_banner;
+    // Simulated link baudrate in both directions; 0 for an unlimited link.
+    uint32_t    baudrate;
+    // Highest baudrate the link carries reliably; every response sent at a higher baudrate is corrupted.
+    // 0 for no limit.
+    uint32_t    max_baudrate;
+    // Delay before every response in microseconds.
+    uint32_t    latency_us;
+    // Time to erase a 4 KiB sector in microseconds.
+    uint32_t    sector_erase_us;
+    // Seed for the error injection.
+    uint32_t    seed;
+    // Chance to drop a response, in parts per million.
+    uint32_t    drop_ppm;
+    // Chance to send a response with a broken SLIP escape, in parts per million.
+    uint32_t    corrupt_ppm;
+    // Chance to reject a command with a failure status, in parts per million.
+    uint32_t    fail_ppm;
+} et2_sim_config_t;
+
+// Simulated target counters.
+typedef struct {
+    // Number of commands received.
+    uint32_t commands;
+    // Number of bytes received and sent, including SLIP framing.
+    uint64_t rx_bytes;
+    uint64_t tx_bytes;
+    // Number of injected errors.
+    uint32_t dropped;
+    uint32_t corrupted;
+    uint32_t failed;
+} et2_sim_stats_t;
+
+// Start a simulated target; `out_fd` receives the host end of the link.
+// The caller owns `out_fd` and should close it after destroying the simulated target.
+esp_err_t et2_sim_create(et2_sim_config_t const* config, int* out_fd, et2_sim_t** out_sim);
+
+// Stop a simulated target and write back its flash contents.
+void et2_sim_destroy(et2_sim_t* sim);
+
+// Get a pointer to the simulated flash contents.
+uint8_t* et2_sim_flash(et2_sim_t* sim);
+
+// Get the simulated target counters.
+void et2_sim_get_stats(et2_sim_t* sim, et2_sim_stats_t* out_stats);
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: 2025 Julian Scheffers
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+#ifndef CONFIG_IDF_TARGET_LINUX
+#include <driver/uart.h>
+#endif
+
+typedef struct et2_transport et2_transport_t;
+
+// Byte stream used to talk to the target.
+// Backends embed this as their first member; deadlines are absolute times as returned by `et2_time_us`.
+struct et2_transport {
+    // Write all of `len` bytes; returns once the data is queued for transmission.
+    esp_err_t (*write)(et2_transport_t* tp, uint8_t const* data, size_t len);
+    // Read at least one and at most `len` bytes, waiting no longer than `deadline`.
+    esp_err_t (*read)(et2_transport_t* tp, uint8_t* out_data, size_t len, size_t* out_len, int64_t deadline);
+    // Wait until all written data has been transmitted.
+    esp_err_t (*flush)(et2_transport_t* tp, int64_t deadline);
+    // Drop all received data that has not been read yet.
+    esp_err_t (*discard)(et2_transport_t* tp);
+    // Change the baudrate; NULL if the transport has no notion of baudrate.
+    esp_err_t (*set_baudrate)(et2_transport_t* tp, uint32_t baudrate);
+    // Assert or release the DTR and RTS modem control lines; NULL if the transport has none.
+    esp_err_t (*set_lines)(et2_transport_t* tp, bool dtr, bool rts);
+    // Release the transport.
+    void (*destroy)(et2_transport_t* tp);
+};
+
+// Current time in microseconds, used as the time base for transport deadlines.
+int64_t et2_time_us(void);
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+// Create a transport on a UART; the driver must already be installed.
+esp_err_t et2_transport_uart_create(uart_port_t uart, et2_transport_t** out_tp);
+#endif
+
+// Create a transport on POSIX file descriptors, e.g. a pty, pipe pair or socket.
+// `rfd` and `wfd` may be the same descriptor; they are not closed when the transport is destroyed.
+esp_err_t et2_transport_fd_create(int rfd, int wfd, et2_transport_t** out_tp);
+
+// Destroy a transport created by one of the functions above.
+void et2_transport_destroy(et2_transport_t* tp);
@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+
+import argparse, struct, zlib
+
+parser = argparse.ArgumentParser(
+    usage="Converts a flash image into a sparse image for et2_write_flash_sparse_image, leaving out empty sectors"
+)
+parser.add_argument("infile",  action="store", help="Input flash image")
+parser.add_argument("outfile", action="store", help="Output sparse image")
+parser.add_argument("--min-gap", action="store", type=int, default=1,
+                    help="Minimum number of empty 4 KiB sectors worth leaving out [1]")
+args = parser.parse_args()
+
+# Sparse image layout, see src/et2_sparse.c.
+SPARSE_MAGIC   = 0x50325445
+SPARSE_VERSION = 1
+SPARSE_HDR     = "<IHHII"
+SPARSE_CHUNK   = "<II"
+SECTOR_SIZE    = 4096
+
+with open(args.infile, "rb") as fd:
+    image = fd.read()
+
+# Find runs of sectors holding data, merging those separated by fewer than --min-gap empty sectors.
+chunks = []
+gap    = 0
+for pos in range(0, len(image), SECTOR_SIZE):
+    sector = image[pos:pos + SECTOR_SIZE]
+    if sector.count(0xFF) == len(sector):
+        gap += 1
+        continue
+    if chunks and gap < args.min_gap:
+        chunks[-1][1] = pos + len(sector)
+    else:
+        chunks.append([pos, pos + len(sector)])
+    gap = 0
+
+if len(chunks) > 0xFFFF:
+    parser.error("too many chunks; use a larger --min-gap")
+
+body = b"".join(struct.pack(SPARSE_CHUNK, start, end - start) for start, end in chunks)
+body += b"".join(image[start:end] for start, end in chunks)
+with open(args.outfile, "wb") as fd:
+    fd.write(struct.pack(SPARSE_HDR, SPARSE_MAGIC, SPARSE_VERSION, len(chunks), len(image), zlib.crc32(body)))
+    fd.write(body)
+
+data = sum(end - start for start, end in chunks)
+print(f"{len(chunks)} chunks hold {data} of {len(image)} bytes")
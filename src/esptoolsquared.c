@@ -3,21 +3,51 @@
 // SPDX-License-Identifier: MIT
 
 #include "esptoolsquared.h"
-#include <esp_app_format.h>
 #include <esp_log.h>
+#include <stdlib.h>
 #include <string.h>
 #include "chips.h"
 #include "esp_check.h"
 #include "esp_err.h"
+#include "esp_rom_md5.h"
+#include "et2_deflate.h"
+#include "et2_io.h"
 #include "et2_macros.h"
+#include "et2_registry.h"
+#include "et2_session.h"
 #include "et2_slip.h"
-#include "et2_uart.h"
-#include "rom/md5_hash.h"
+#include "et2_stats.h"
+#ifndef CONFIG_IDF_TARGET_LINUX
+#include "driver/gpio.h"
+#include "esp_image_format.h"
+#endif
 
-#define ET2_TIMEOUT        pdMS_TO_TICKS(1000)
+#define ET2_TIMEOUT_US     (1000 * 1000)
 #define FLASH_SECTOR_SIZE  4096
-#define FLASH_WRITE_SIZE   0x4000
+#define FLASH_WRITE_SIZE   ET2_FLASH_WRITE_SIZE
 #define ESP_CHECKSUM_MAGIC 0xEF
+#define ET2_MAX_DATA_IOV   4
+// Size of the partition windows mapped by partition sources and of the input handed to the compressor at once.
+#define ET2_MMAP_WINDOW (64 * 1024)
+
+// Error codes for a command that was received with a bad checksum.
+#define ET2_ROM_ERR_BAD_CRC       0x07
+#define ET2_STUB_ERR_BAD_CHECKSUM 0xC1
+
+// Timeouts for commands that take time proportional to the size of the flash region.
+#define ET2_ERASE_TIMEOUT_PER_MB_US (30 * 1000 * 1000)
+#define ET2_MD5_TIMEOUT_PER_MB_US   (8 * 1000 * 1000)
+#define ET2_ERASE_FLASH_TIMEOUT_US  (120 * 1000 * 1000)
+
+#define ET2_BAUD_ROM        115200
+#define ET2_BAUD_SETTLE_US  (50 * 1000)
+#define ET2_BAUD_PROBES     8
+#define ET2_LINK_WINDOW     32
+#define ET2_LINK_MAX_ERRORS 3
+
+// Reset pulse length used by esptool, and how long each SYNC frame of et2_connect waits for an answer.
+#define ET2_RESET_HOLD_US (100 * 1000)
+#define ET2_SYNC_POLL_US  (20 * 1000)
 
 // Command header
 typedef struct {
@@ -28,6 +58,13 @@ typedef struct {
 } et2_hdr_t;
 _Static_assert(sizeof(et2_hdr_t) == 8);
 
+// Response to a command; `data` points into the receive buffer and stays valid until the next receive.
+typedef struct {
+    et2_hdr_t      hdr;
+    uint8_t const* data;
+    size_t         len;
+} et2_resp_t;
+
 // Security info data
 typedef struct {
     uint32_t flags;
@@ -37,44 +74,113 @@ typedef struct {
 } et2_sec_info_t;
 _Static_assert(sizeof(et2_sec_info_t) == 16);
 
-static char const        TAG[] = "ET2";
-static uart_port_t       cur_uart;
-static uint32_t          chip_id;    // Current chip ID value
-static et2_chip_t const* chip_attr;  // Current chip attributes
+// One step of a reset sequence: the DTR and RTS levels, and how long to hold them.
+typedef struct {
+    bool     dtr;
+    bool     rts;
+    uint32_t delay_us;
+} et2_reset_step_t;
+
+static char const TAG[] = "ET2";
+
+// Baudrates tried by et2_set_baudrate_auto, in order.
+static uint32_t const baud_ladder[] = {ET2_BAUD_ROM, 230400, 460800, 921600, 1500000, 2000000, 3000000};
 
-// Send a command.
-static esp_err_t et2_send_cmd(et2_cmd_t cmd, uint32_t chk, void const* param, size_t param_len, void** resp,
-                              size_t* resp_len, uint32_t* len, uint32_t* val, const uint8_t* data, uint32_t data_len);
+// Send a command without waiting for the response.
+static esp_err_t et2_send_req(et2_session_t* session, et2_cmd_t cmd, uint32_t chk, void const* param, size_t param_len,
+                              et2_iov_t const* data, size_t data_cnt);
+// Receive the response to a command sent earlier, waiting up to `timeout_us` for data.
+static esp_err_t et2_recv_resp(et2_session_t* session, et2_cmd_t cmd, et2_resp_t* resp, int64_t timeout_us);
+// Check the status bytes of a response.
+static esp_err_t et2_resp_check(et2_session_t* session, et2_cmd_t cmd, et2_resp_t const* resp);
+// Count a command and its response, if one was received, towards the link quality.
+static void      et2_link_result(et2_session_t* session, esp_err_t res, et2_resp_t const* resp);
+// Lower the baudrate one step if the link quality asked for it.
+static esp_err_t et2_link_fallback(et2_session_t* session);
+// Send a command; if there are data segments, the checksum is computed over them.
+static esp_err_t et2_send_cmd(et2_session_t* session, et2_cmd_t cmd, uint32_t chk, void const* param, size_t param_len,
+                              et2_iov_t const* data, size_t data_cnt, et2_resp_t* resp);
 // Send a command and check response code.
-static esp_err_t et2_send_cmd_check(et2_cmd_t cmd, uint32_t chk, void const* param, size_t param_len, void** resp,
-                                    size_t* resp_len, uint32_t* len, uint32_t* val, const uint8_t* data,
-                                    uint32_t data_len);
+static esp_err_t et2_send_cmd_check(et2_session_t* session, et2_cmd_t cmd, uint32_t chk, void const* param,
+                                    size_t param_len, et2_iov_t const* data, size_t data_cnt, et2_resp_t* resp);
 
 static uint32_t et2_checksum(const uint8_t* data, uint32_t data_length, uint32_t state) {
-    for (uint32_t i = 0; i < data_length; i++) {
+    // XOR a word at a time, then fold the word into a single byte.
+    uint32_t i    = 0;
+    uint32_t word = 0;
+    for (; i + sizeof(uint32_t) <= data_length; i += sizeof(uint32_t)) {
+        uint32_t tmp;
+        memcpy(&tmp, data + i, sizeof(tmp));
+        word ^= tmp;
+    }
+    word ^= word >> 16;
+    word ^= word >> 8;
+    state ^= word & 0xFF;
+    for (; i < data_length; i++) {
         state ^= data[i];
     }
     return state;
 }
 
-esp_err_t et2_read_magic_reg(uint32_t* out_magic) {
-    return et2_cmd_read_reg(0x40001000, out_magic);
+// Read a register with a known value, to check that the target responds.
+static esp_err_t et2_read_magic_reg(et2_session_t* session, uint32_t* out_magic) {
+    return et2_session_cmd_read_reg(session, 0x40001000, out_magic);
+}
+
+// Prepare a session in place.
+void et2_session_init(et2_session_t* session, et2_transport_t* tp) {
+    memset(session, 0, sizeof(et2_session_t));
+    session->tp       = tp;
+    session->baudrate = ET2_BAUD_ROM;
+    et2_slip_init(&session->slip, tp);
+}
+
+// Release the buffers of a session prepared by et2_session_init.
+void et2_session_deinit(et2_session_t* session) {
+    if (session->reg_chip) {
+        et2_registry_release();
+        session->reg_chip = false;
+    }
+    et2_slip_deinit(&session->slip);
+    free(session->stats.cmds);
+    session->stats.cmds = NULL;
 }
 
-// Set interface used to a UART.
-esp_err_t et2_setif_uart(uart_port_t uart) {
-    cur_uart = uart;
+// Report progress to the job running on a session.
+esp_err_t et2_session_progress(et2_session_t* session, uint32_t bytes) {
+    if (!session->progress.func) {
+        return ESP_OK;
+    }
+    return session->progress.func(session->progress.cookie, bytes);
+}
+
+// Create a session on a transport.
+esp_err_t et2_session_create(et2_transport_t* tp, et2_session_t** out_session) {
+    et2_session_t* session = malloc(sizeof(et2_session_t));
+    if (!session) {
+        return ESP_ERR_NO_MEM;
+    }
+    et2_session_init(session, tp);
+    *out_session = session;
     return ESP_OK;
 }
 
+// Destroy a session; the transport is left alone.
+void et2_session_destroy(et2_session_t* session) {
+    if (session) {
+        et2_session_deinit(session);
+        free(session);
+    }
+}
+
 // Wait for the ROM "waiting for download" message.
-static esp_err_t et2_wait_dl() {
+static esp_err_t et2_wait_dl(et2_session_t* session) {
     char const msg[] = "waiting for download\r\n";
     size_t     i     = 0;
-    TickType_t lim   = xTaskGetTickCount() + ET2_TIMEOUT * 5;
-    while (xTaskGetTickCount() < lim) {
+    int64_t    lim   = et2_time_us() + ET2_TIMEOUT_US * 5;
+    while (et2_time_us() < lim) {
         char rxd = 0;
-        if (et2_uart_read(cur_uart, (uint8_t*)&rxd, 1) == ESP_OK) {
+        if (et2_io_read(session->tp, (uint8_t*)&rxd, 1, lim) == ESP_OK) {
             if (rxd != msg[i]) {
                 ESP_LOGV(TAG, "NE %zu", i);
                 i = 0;
@@ -93,25 +199,26 @@ static esp_err_t et2_wait_dl() {
     return ESP_ERR_TIMEOUT;
 }
 
+// Payload of the SYNC command.
+// clang-format off
+static uint8_t const sync_rom[] = {
+    0x07, 0x07, 0x12, 0x20,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+};
+// clang-format on
+
 // Try to connect to and synchronize with the ESP32.
-esp_err_t et2_sync() {
-    RETURN_ON_ERR(et2_wait_dl());
-    // clang-format off
-    uint8_t const sync_rom[] = {
-        0x07, 0x07, 0x12, 0x20,
-        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    };
-    // clang-format on
+esp_err_t et2_session_sync(et2_session_t* session) {
+    RETURN_ON_ERR(et2_wait_dl(session));
 
     for (int i = 0; i < 5; i++) {
-        uint32_t len;
-        uint32_t val;
-        if (et2_send_cmd(ET2_CMD_SYNC, 0, sync_rom, sizeof(sync_rom), NULL, NULL, &len, &val, NULL, 0) == ESP_OK) {
-            ESP_LOGI(TAG, "SYNC %" PRIx32 " / %" PRIx32, len, val);
-            if (len != 0) {
+        et2_resp_t resp;
+        if (et2_send_cmd(session, ET2_CMD_SYNC, 0, sync_rom, sizeof(sync_rom), NULL, 0, &resp) == ESP_OK) {
+            ESP_LOGI(TAG, "SYNC %" PRIx16 " / %" PRIx32, resp.hdr.len, resp.hdr.chk);
+            if (resp.hdr.len != 0) {
                 ESP_LOGI(TAG, "Sync received");
                 return ESP_OK;
             }
@@ -122,412 +229,1216 @@ esp_err_t et2_sync() {
     return ESP_ERR_TIMEOUT;
 }
 
+// Set the reset lines: DTR pulls BOOT low and RTS pulls EN low, through GPIOs or through the transport.
+static esp_err_t et2_reset_lines(et2_session_t* session, et2_connect_config_t const* config, bool dtr, bool rts) {
+    if (config->en_gpio >= 0) {
+#ifdef CONFIG_IDF_TARGET_LINUX
+        return ESP_ERR_NOT_SUPPORTED;
+#else
+        RETURN_ON_ERR(gpio_set_level(config->boot_gpio, !dtr));
+        return gpio_set_level(config->en_gpio, !rts);
+#endif
+    } else if (!session->tp->set_lines) {
+        ESP_LOGE(TAG, "Transport has no DTR and RTS lines to reset the target with");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    return session->tp->set_lines(session->tp, dtr, rts);
+}
+
+// Reset the target into download mode using one of esptool's DTR and RTS sequences.
+static esp_err_t et2_reset(et2_session_t* session, et2_connect_config_t const* config) {
+    // clang-format off
+    et2_reset_step_t const classic[] = {
+        {.dtr = false, .rts = true,  .delay_us = ET2_RESET_HOLD_US},
+        {.dtr = true,  .rts = false, .delay_us = config->boot_hold_us},
+        {.dtr = false, .rts = false, .delay_us = 0},
+    };
+    // The USB-Serial/JTAG peripheral latches BOOT when RTS is asserted while DTR is.
+    et2_reset_step_t const usb_jtag[] = {
+        {.dtr = false, .rts = false, .delay_us = ET2_RESET_HOLD_US},
+        {.dtr = true,  .rts = false, .delay_us = ET2_RESET_HOLD_US},
+        {.dtr = true,  .rts = true,  .delay_us = 0},
+        {.dtr = false, .rts = true,  .delay_us = ET2_RESET_HOLD_US},
+        {.dtr = false, .rts = false, .delay_us = 0},
+    };
+    // clang-format on
+
+    et2_reset_step_t const* steps;
+    size_t                  steps_len;
+    if (config->reset == ET2_RESET_NONE) {
+        return ESP_OK;
+    } else if (config->reset == ET2_RESET_CLASSIC) {
+        steps     = classic;
+        steps_len = sizeof(classic) / sizeof(classic[0]);
+    } else if (config->reset == ET2_RESET_USB_JTAG && config->en_gpio < 0) {
+        steps     = usb_jtag;
+        steps_len = sizeof(usb_jtag) / sizeof(usb_jtag[0]);
+    } else {
+        ESP_LOGE(TAG, "Invalid reset sequence for this configuration");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if ((config->en_gpio < 0) != (config->boot_gpio < 0)) {
+        ESP_LOGE(TAG, "EN and BOOT must both be GPIOs or both be left to the transport");
+        return ESP_ERR_INVALID_ARG;
+    }
+#ifndef CONFIG_IDF_TARGET_LINUX
+    if (config->en_gpio >= 0) {
+        // Open drain, so the pins are only ever pulled low and the target's own pull-ups stay in charge.
+        gpio_config_t io = {
+            .pin_bit_mask = (1ULL << config->en_gpio) | (1ULL << config->boot_gpio),
+            .mode         = GPIO_MODE_OUTPUT_OD,
+            .pull_up_en   = GPIO_PULLUP_ENABLE,
+        };
+        RETURN_ON_ERR(gpio_set_level(config->en_gpio, 1));
+        RETURN_ON_ERR(gpio_set_level(config->boot_gpio, 1));
+        RETURN_ON_ERR(gpio_config(&io));
+    }
+#endif
+
+    for (size_t i = 0; i < steps_len; i++) {
+        RETURN_ON_ERR(et2_reset_lines(session, config, steps[i].dtr, steps[i].rts));
+        if (steps[i].delay_us) {
+            et2_io_delay_us(steps[i].delay_us);
+        }
+    }
+    return ESP_OK;
+}
+
+// Reset the target into download mode and send SYNC frames until it responds.
+esp_err_t et2_session_connect(et2_session_t* session, et2_connect_config_t const* config, int64_t* out_connect_us) {
+    et2_connect_config_t const default_config = ET2_CONNECT_CONFIG_DEFAULT();
+    if (!config) {
+        config = &default_config;
+    }
+    int64_t start = et2_time_us();
+    RETURN_ON_ERR(et2_reset(session, config));
+    if (session->tp->discard) {
+        session->tp->discard(session->tp);
+    }
+
+    // Don't wait for the boot message; it may have been missed already, and the ROM listens before printing it.
+    // Each SYNC is only given a short time to be answered, so one lost during boot costs little.
+    int64_t    deadline = start + config->timeout_us;
+    uint32_t   sent     = 0;
+    esp_err_t  res      = ESP_ERR_TIMEOUT;
+    et2_resp_t resp;
+    while (res != ESP_OK && et2_time_us() < deadline) {
+        RETURN_ON_ERR(et2_send_req(session, ET2_CMD_SYNC, 0, sync_rom, sizeof(sync_rom), NULL, 0));
+        sent++;
+        res = et2_recv_resp(session, ET2_CMD_SYNC, &resp, ET2_SYNC_POLL_US);
+    }
+    if (res != ESP_OK) {
+        et2_stats_forget_pending(session);
+        ESP_LOGE(TAG, "No response after %" PRIu32 " SYNC frames", sent);
+        return ESP_ERR_TIMEOUT;
+    }
+    int64_t connect_us = et2_time_us() - start;
+
+    // The ROM answers every SYNC several times; drop the remaining answers before the next command.
+    uint8_t const* frame;
+    size_t         frame_len;
+    while (et2_slip_receive_timeout(&session->slip, &frame, &frame_len, ET2_SYNC_POLL_US) == ESP_OK) {
+        ESP_LOGD(TAG, "Dropped %zu byte frame", frame_len);
+    }
+    et2_stats_forget_pending(session);
+
+    ESP_LOGI(TAG, "Connected in %" PRId64 " ms after %" PRIu32 " SYNC frames", connect_us / 1000, sent);
+    if (out_connect_us) {
+        *out_connect_us = connect_us;
+    }
+    return ESP_OK;
+}
+
 // Set attributes according to chip ID.
-void check_chip_id() {
-    switch (chip_id & 0xffff) {
+static void et2_check_chip_id(et2_session_t* session) {
+    // Chips loaded at runtime take precedence over the built-in ones.
+    if (session->reg_chip) {
+        et2_registry_release();
+    }
+    session->chip_attr = et2_registry_find(session->chip_id & 0xffff);
+    session->reg_chip  = session->chip_attr != NULL;
+    if (session->chip_attr) {
+        return;
+    }
+    switch (session->chip_id & 0xffff) {
 #ifdef CONFIG_ET2_SUPPORT_ESP32C3
-        case ESP_CHIP_ID_ESP32C3:
-            chip_attr = &et2_chip_esp32c3;
+        case ET2_CHIP_ID_ESP32C3:
+            session->chip_attr = &et2_chip_esp32c3;
             break;
 #else
-        case ESP_CHIP_ID_ESP32C3:
+        case ET2_CHIP_ID_ESP32C3:
             ESP_LOGW(TAG, "ESP32-C3 not supported!");
             break;
 #endif
 #ifdef CONFIG_ET2_SUPPORT_ESP32C2
-        case ESP_CHIP_ID_ESP32C2:
-            chip_attr = &et2_chip_esp32c2;
+        case ET2_CHIP_ID_ESP32C2:
+            session->chip_attr = &et2_chip_esp32c2;
             break;
 #else
-        case ESP_CHIP_ID_ESP32C2:
+        case ET2_CHIP_ID_ESP32C2:
             ESP_LOGW(TAG, "ESP32-C2 not supported!");
             break;
 #endif
 #ifdef CONFIG_ET2_SUPPORT_ESP32C6
-        case ESP_CHIP_ID_ESP32C6:
-            chip_attr = &et2_chip_esp32c6;
+        case ET2_CHIP_ID_ESP32C6:
+            session->chip_attr = &et2_chip_esp32c6;
             break;
 #else
-        case ESP_CHIP_ID_ESP32C6:
+        case ET2_CHIP_ID_ESP32C6:
             ESP_LOGW(TAG, "ESP32-C6 not supported!");
             break;
 #endif
 #ifdef CONFIG_ET2_SUPPORT_ESP32P4
-        case ESP_CHIP_ID_ESP32P4:
-            chip_attr = &et2_chip_esp32p4;
+        case ET2_CHIP_ID_ESP32P4:
+            session->chip_attr = &et2_chip_esp32p4;
             break;
 #else
-        case ESP_CHIP_ID_ESP32P4:
+        case ET2_CHIP_ID_ESP32P4:
             ESP_LOGW(TAG, "ESP32-P4 not supported!");
             break;
 #endif
 #ifdef CONFIG_ET2_SUPPORT_ESP32S2
-        case ESP_CHIP_ID_ESP32S2:
-            chip_attr = &et2_chip_esp32s2;
+        case ET2_CHIP_ID_ESP32S2:
+            session->chip_attr = &et2_chip_esp32s2;
             break;
 #else
-        case ESP_CHIP_ID_ESP32S2:
+        case ET2_CHIP_ID_ESP32S2:
             ESP_LOGW(TAG, "ESP32-S2 not supported!");
             break;
 #endif
 #ifdef CONFIG_ET2_SUPPORT_ESP32S3
-        case ESP_CHIP_ID_ESP32S3:
-            chip_attr = &et2_chip_esp32s3;
+        case ET2_CHIP_ID_ESP32S3:
+            session->chip_attr = &et2_chip_esp32s3;
             break;
 #else
-        case ESP_CHIP_ID_ESP32S3:
+        case ET2_CHIP_ID_ESP32S3:
             ESP_LOGW(TAG, "ESP32-S3 not supported!");
             break;
 #endif
         default:
-            ESP_LOGW(TAG, "Unknown chip ID 0x%04" PRIX32, chip_id & 0xffff);
+            ESP_LOGW(TAG, "Unknown chip ID 0x%04" PRIX32, session->chip_id & 0xffff);
             break;
     }
 }
 
 // Detect an ESP32 and, if present, read its chip ID.
 // If a pointer is NULL, the property is not read.
-esp_err_t et2_detect(uint32_t* chip_id_out) {
-    void*  resp;
-    size_t resp_len;
-    RETURN_ON_ERR(et2_send_cmd(ET2_CMD_SEC_INFO, 0, NULL, 0, &resp, &resp_len, NULL, NULL, NULL, 0));
-    LEN_CHECK_MIN(resp, resp_len, sizeof(et2_sec_info_t));
-    chip_id = ((et2_sec_info_t*)resp)->chip_id;
-    check_chip_id();
-    *chip_id_out = chip_id;
-    free(resp);
+esp_err_t et2_session_detect(et2_session_t* session, uint32_t* chip_id_out) {
+    et2_resp_t     resp;
+    et2_sec_info_t info;
+    RETURN_ON_ERR(et2_send_cmd(session, ET2_CMD_SEC_INFO, 0, NULL, 0, NULL, 0, &resp));
+    LEN_CHECK_MIN(resp.len, sizeof(et2_sec_info_t));
+    memcpy(&info, resp.data, sizeof(info));
+    session->chip_id = info.chip_id;
+    et2_check_chip_id(session);
+    if (chip_id_out) {
+        *chip_id_out = session->chip_id;
+    }
     return ESP_OK;
 }
 
+// Upload a compressed stub segment, inflating it one RAM block at a time so no inflated copy is kept.
+static esp_err_t et2_stub_upload(et2_session_t* session, uint32_t addr, uint8_t const* zdata, size_t zlen,
+                                 size_t len) {
+    uint32_t block  = session->chip_attr->ram_block;
+    uint32_t blocks = (len + block - 1) / block;
+    RETURN_ON_ERR(et2_session_cmd_mem_begin(session, len, blocks, block, addr));
+
+    et2_inflater_t* inflater = NULL;
+    uint8_t*        buf      = malloc(block);
+    esp_err_t       res      = buf ? et2_inflater_create(&inflater) : ESP_ERR_NO_MEM;
+    size_t          sent     = 0;
+    uint32_t        seq      = 0;
+    bool            done     = false;
+    if (res == ESP_OK) {
+        et2_inflater_input(inflater, zdata, zlen);
+    }
+    while (res == ESP_OK && !done) {
+        // Fill a whole block unless the stream ends first.
+        size_t fill = 0;
+        while (res == ESP_OK && !done && fill < block) {
+            size_t got;
+            res = et2_inflater_output(inflater, buf + fill, block - fill, &got, &done);
+            if (res == ESP_OK && !got && !done) {
+                ESP_LOGE(TAG, "Stub segment is truncated");
+                res = ESP_ERR_INVALID_SIZE;
+            }
+            fill += got;
+        }
+        if (res == ESP_OK && fill) {
+            res   = et2_session_cmd_mem_data(session, buf, fill, seq++);
+            sent += fill;
+        }
+    }
+    if (res == ESP_OK && sent != len) {
+        ESP_LOGE(TAG, "Stub segment inflated to %zu bytes instead of %zu", sent, len);
+        res = ESP_ERR_INVALID_SIZE;
+    }
+
+    et2_inflater_destroy(inflater);
+    free(buf);
+    return res;
+}
+
 // Upload and start a flasher stub.
-esp_err_t et2_run_stub() {
-    uint32_t chip_id;
-    RETURN_ON_ERR(et2_detect(&chip_id));
-    if (!chip_attr) {
+esp_err_t et2_session_run_stub(et2_session_t* session) {
+    RETURN_ON_ERR(et2_session_detect(session, NULL));
+    if (!session->chip_attr) {
         return ESP_ERR_NOT_SUPPORTED;
     }
 
     // Upload the stub.
-    ESP_LOGI(TAG, "Uploading flasher stub text @ 0x%" PRIx32 " (0x%" PRIx32 " bytes)...", chip_attr->stub->text_start,
-             chip_attr->stub->text_len);
-    RETURN_ON_ERR(et2_mem_write(chip_attr->stub->text_start, chip_attr->stub->text, chip_attr->stub->text_len),
+    et2_stub_t const* stub = session->chip_attr->stub;
+    ESP_LOGI(TAG, "Uploading flasher stub text @ 0x%zx (0x%zx bytes)...", stub->text_start, stub->text_len);
+    RETURN_ON_ERR(et2_stub_upload(session, stub->text_start, stub->text, stub->text_zlen, stub->text_len),
                   ESP_LOGE(TAG, "Failed to upload stub"));
 
-    ESP_LOGI(TAG, "Uploading flasher stub data @ 0x%" PRIx32 " (0x%" PRIx32 " bytes)...", chip_attr->stub->data_start,
-             chip_attr->stub->data_len);
-    RETURN_ON_ERR(et2_mem_write(chip_attr->stub->data_start, chip_attr->stub->data, chip_attr->stub->data_len),
+    ESP_LOGI(TAG, "Uploading flasher stub data @ 0x%zx (0x%zx bytes)...", stub->data_start, stub->data_len);
+    RETURN_ON_ERR(et2_stub_upload(session, stub->data_start, stub->data, stub->data_zlen, stub->data_len),
                   ESP_LOGE(TAG, "Failed to upload stub"));
 
     // Start the stub.
     ESP_LOGI(TAG, "Starting flasher stub...");
-    ESP_LOGD(TAG, "Entrypoint 0x%08zx", chip_attr->stub->entry);
-    RETURN_ON_ERR(et2_cmd_mem_end(chip_attr->stub->entry), ESP_LOGE(TAG, "Failed to start stub"));
+    ESP_LOGD(TAG, "Entrypoint 0x%08zx", stub->entry);
+    RETURN_ON_ERR(et2_session_cmd_mem_end(session, stub->entry), ESP_LOGE(TAG, "Failed to start stub"));
 
     // Verify that the stub has successfully started.
-    void*  resp;
-    size_t resp_len;
-    RETURN_ON_ERR(et2_slip_receive(cur_uart, &resp, &resp_len), ESP_LOGE(TAG, "Stub did not respond"));
+    uint8_t const* resp;
+    size_t         resp_len;
+    RETURN_ON_ERR(et2_slip_receive(&session->slip, &resp, &resp_len), ESP_LOGE(TAG, "Stub did not respond"));
     if (resp_len != 4 || memcmp(resp, "OHAI", 4)) {
         ESP_LOGE(TAG, "Unexpected response from stub");
-        free(resp);
         return ESP_ERR_INVALID_RESPONSE;
     } else {
         ESP_LOGI(TAG, "Stub responded correctly");
     }
+    session->stub_run = true;
 
-    if (chip_attr == &et2_chip_esp32c6) {
-        ESP_LOGW(TAG, "Switched chip type to ESP32C6 with stub");
-        chip_attr = &et2_chip_esp32c6_stub;
+    if (session->chip_attr->stub_attr) {
+        ESP_LOGW(TAG, "Switched chip attributes for the stub");
+        session->chip_attr = session->chip_attr->stub_attr;
     }
 
     return ESP_OK;
 }
 
-static esp_err_t et2_send_cmd(et2_cmd_t cmd, uint32_t chk, void const* param, size_t param_len, void** resp,
-                              size_t* resp_len, uint32_t* len, uint32_t* val, const uint8_t* data, uint32_t data_len) {
-    void*  resp_dummy;
-    size_t resp_len_dummy;
-    bool   ignore_resp = false;
-    if (!resp && !resp_len) {
-        ignore_resp = true;
-        resp        = &resp_dummy;
-        resp_len    = &resp_len_dummy;
-    } else if (!resp || !resp_len) {
+// Send a command without waiting for the response.
+static esp_err_t et2_send_req(et2_session_t* session, et2_cmd_t cmd, uint32_t chk, void const* param, size_t param_len,
+                              et2_iov_t const* data, size_t data_cnt) {
+    // The header and parameters are followed by the data segments, all encoded in place.
+    et2_hdr_t header                  = {0, cmd, param_len, 0};
+    et2_iov_t iov[2 + ET2_MAX_DATA_IOV] = {{&header, sizeof(header)}, {param, param_len}};
+    if (data_cnt > ET2_MAX_DATA_IOV) {
         return ESP_ERR_INVALID_ARG;
     }
-
-    if (data != NULL && data_len > 0) {
-        chk = et2_checksum(data, data_len, ESP_CHECKSUM_MAGIC);
+    if (data_cnt) {
+        chk = ESP_CHECKSUM_MAGIC;
+        for (size_t i = 0; i < data_cnt; i++) {
+            chk         = et2_checksum(data[i].base, data[i].len, chk);
+            header.len += data[i].len;
+            iov[2 + i]  = data[i];
+        }
     }
+    header.chk = chk;
 
-    ESP_LOGI(TAG, "Send command op=0x%02X len=%zd byte%c chk=%" PRIx32, cmd, (param_len + data_len),
-             (param_len + data_len) != 1 ? 's' : 0, chk);
-
-    et2_hdr_t header = {0, cmd, param_len + data_len, chk};
+    ESP_LOGI(TAG, "Send command op=0x%02X len=%" PRIu16 " byte%c chk=%" PRIx32, cmd, header.len,
+             header.len != 1 ? 's' : 0, chk);
 
-    RETURN_ON_ERR(et2_slip_send_startstop(cur_uart));
-    RETURN_ON_ERR(et2_slip_send_data(cur_uart, (uint8_t*)&header, sizeof(header)));
-    RETURN_ON_ERR(et2_slip_send_data(cur_uart, (uint8_t*)param, param_len));
-    if (data != NULL && data_len > 0) {
-        RETURN_ON_ERR(et2_slip_send_data(cur_uart, data, data_len));
-    }
-    RETURN_ON_ERR(et2_slip_send_startstop(cur_uart));
+    int64_t  start = et2_time_us();
+    uint64_t wire  = session->slip.tx_wire;
+    RETURN_ON_ERR(et2_slip_send_frame(&session->slip, iov, 2 + data_cnt));
+    et2_stats_sent(session, cmd, sizeof(header) + header.len, session->slip.tx_wire - wire, start);
+    return ESP_OK;
+}
 
+// Receive the response to a command sent earlier, waiting up to `timeout_us` for data.
+static esp_err_t et2_recv_resp(et2_session_t* session, et2_cmd_t cmd, et2_resp_t* resp, int64_t timeout_us) {
     // Wait for max 100 tries for a response.
-    for (int try = 0;; try++) {
-        ESP_LOGD(TAG, "Receive try %d", try);
-        RETURN_ON_ERR(et2_slip_receive(cur_uart, resp, resp_len));
-        if (*resp_len < sizeof(et2_hdr_t) || ((et2_hdr_t*)*resp)->resp != 1) {
-            continue;
-        } else if (((et2_hdr_t*)*resp)->cmd == cmd) {
+    uint8_t const* frame;
+    size_t         frame_len;
+    uint32_t       discarded = 0;
+    esp_err_t      res;
+    while (true) {
+        ESP_LOGD(TAG, "Receive try %" PRIu32, discarded);
+        res = et2_slip_receive_timeout(&session->slip, &frame, &frame_len, timeout_us);
+        if (res != ESP_OK || (frame_len >= sizeof(et2_hdr_t) && frame[0] == 1 && frame[1] == cmd)) {
             break;
-        } else if (try >= 100) {
+        } else if (++discarded > 100) {
             ESP_LOGE(TAG, "Receive timeout");
-            return ESP_ERR_TIMEOUT;
+            res = ESP_ERR_TIMEOUT;
+            break;
         }
     }
+    et2_stats_received(session, cmd, res, discarded);
+    RETURN_ON_ERR(res);
 
-    ESP_LOGD(TAG, "Receive len=%u", *resp_len);
+    ESP_LOGD(TAG, "Receive len=%zu", frame_len);
 
-    // Trim the header off of the response.
-    if (len) {
-        *len = ((et2_hdr_t*)*resp)->len;
-    }
-    if (val) {
-        *val = ((et2_hdr_t*)*resp)->chk;
-    }
-    if (ignore_resp) {
-        free(*resp);
-    } else if (*resp_len == sizeof(et2_hdr_t)) {
-        free(*resp);
-        *resp     = NULL;
-        *resp_len = 0;
-    } else {
-        *resp_len -= sizeof(et2_hdr_t);
-        memmove(*resp, *resp + sizeof(et2_hdr_t), *resp_len);
-    }
+    // Expose the data past the header without copying it.
+    memcpy(&resp->hdr, frame, sizeof(et2_hdr_t));
+    resp->data = frame + sizeof(et2_hdr_t);
+    resp->len  = frame_len - sizeof(et2_hdr_t);
 
     return ESP_OK;
 }
 
-// Send a command and check response code.
-static esp_err_t et2_send_cmd_check(et2_cmd_t cmd, uint32_t chk, void const* param, size_t param_len, void** resp,
-                                    size_t* resp_len, uint32_t* len, uint32_t* val, const uint8_t* data,
-                                    uint32_t data_len) {
-    void*  resp_dummy;
-    size_t resp_len_dummy;
-    bool   ignore_resp = false;
-    if (!resp && !resp_len) {
-        ignore_resp = true;
-        resp        = &resp_dummy;
-        resp_len    = &resp_len_dummy;
-    } else if (!resp || !resp_len) {
-        return ESP_ERR_INVALID_ARG;
+// Send a command and wait up to `timeout_us` for the response.
+static esp_err_t et2_send_cmd_timeout(et2_session_t* session, et2_cmd_t cmd, uint32_t chk, void const* param,
+                                      size_t param_len, et2_iov_t const* data, size_t data_cnt, et2_resp_t* resp,
+                                      int64_t timeout_us) {
+    et2_resp_t resp_dummy;
+    if (!resp) {
+        resp = &resp_dummy;
     }
 
-    esp_err_t res = et2_send_cmd(cmd, chk, param, param_len, resp, resp_len, len, val, data, data_len);
-    if (res) {
-        return res;
-    } else if (*resp_len < chip_attr->status_len) {
-        free(*resp);
+    RETURN_ON_ERR(et2_link_fallback(session));
+    RETURN_ON_ERR(et2_send_req(session, cmd, chk, param, param_len, data, data_cnt));
+    esp_err_t res = et2_recv_resp(session, cmd, resp, timeout_us);
+    et2_link_result(session, res, resp);
+    return res;
+}
+
+static esp_err_t et2_send_cmd(et2_session_t* session, et2_cmd_t cmd, uint32_t chk, void const* param, size_t param_len,
+                              et2_iov_t const* data, size_t data_cnt, et2_resp_t* resp) {
+    return et2_send_cmd_timeout(session, cmd, chk, param, param_len, data, data_cnt, resp, ET2_IO_TIMEOUT_US);
+}
+
+// Whether the status bytes of a response say that the target received a corrupted command.
+static bool et2_resp_bad_checksum(et2_session_t* session, et2_resp_t const* resp) {
+    if (!session->chip_attr || resp->len < session->chip_attr->status_len) {
+        return false;
+    }
+    uint8_t const* status   = resp->data + resp->len - session->chip_attr->status_len;
+    uint8_t        bad_code = session->stub_run ? ET2_STUB_ERR_BAD_CHECKSUM : ET2_ROM_ERR_BAD_CRC;
+    return status[0] && status[1] == bad_code;
+}
+
+// Check the status bytes of a response.
+static esp_err_t et2_resp_check(et2_session_t* session, et2_cmd_t cmd, et2_resp_t const* resp) {
+    if (resp->len < session->chip_attr->status_len) {
         return ESP_ERR_INVALID_RESPONSE;
-    } else {
-        uint8_t status, error;
-        if (chip_attr->status_len == 2) {
-            status = ((uint8_t*)*resp)[(*resp_len) - 2];
-            error  = ((uint8_t*)*resp)[(*resp_len) - 1];
-        } else {
-            status = ((uint8_t*)*resp)[(*resp_len) - 4];
-            error  = ((uint8_t*)*resp)[(*resp_len) - 3];
-        }
-        if (status) {
-            free(*resp);
-            ESP_LOGE(TAG, "Command 0x%02x failed with code 0x%02x", cmd, error);
-            return ESP_FAIL;
-        }
     }
 
-    if (ignore_resp) {
-        free(*resp);
+    uint8_t const* status = resp->data + resp->len - session->chip_attr->status_len;
+    if (status[0]) {
+        et2_stats_failed(session, cmd, et2_resp_bad_checksum(session, resp));
+        ESP_LOGE(TAG, "Command 0x%02x failed with code 0x%02x", cmd, status[1]);
+        return ESP_FAIL;
     }
 
     return ESP_OK;
 }
 
+// Send a command, wait up to `timeout_us` for the response and check the response code.
+static esp_err_t et2_send_cmd_check_timeout(et2_session_t* session, et2_cmd_t cmd, void const* param, size_t param_len,
+                                            int64_t timeout_us) {
+    et2_resp_t resp;
+    RETURN_ON_ERR(et2_send_cmd_timeout(session, cmd, 0, param, param_len, NULL, 0, &resp, timeout_us));
+    return et2_resp_check(session, cmd, &resp);
+}
+
+// Timeout for a command that takes time proportional to `size`.
+static int64_t et2_size_timeout(uint32_t size, int64_t per_mb_us) {
+    int64_t timeout = per_mb_us * size / (1024 * 1024);
+    return timeout > ET2_IO_TIMEOUT_US ? timeout : ET2_IO_TIMEOUT_US;
+}
+
+// Send a command and check response code.
+static esp_err_t et2_send_cmd_check(et2_session_t* session, et2_cmd_t cmd, uint32_t chk, void const* param,
+                                    size_t param_len, et2_iov_t const* data, size_t data_cnt, et2_resp_t* resp) {
+    et2_resp_t resp_dummy;
+    if (!resp) {
+        resp = &resp_dummy;
+    }
+
+    RETURN_ON_ERR(et2_send_cmd(session, cmd, chk, param, param_len, data, data_cnt, resp));
+    return et2_resp_check(session, cmd, resp);
+}
+
 // Write to a range of memory.
-esp_err_t et2_mem_write(uint32_t addr, void const* _wdata, uint32_t len) {
+esp_err_t et2_session_mem_write(et2_session_t* session, uint32_t addr, void const* _wdata, uint32_t len) {
     uint8_t const* wdata = _wdata;
     ESP_LOGD(TAG, "Writing to RAM at 0x%08" PRIx32, addr);
 
     // Compute number of blocks.
-    uint32_t blocks = (len + chip_attr->ram_block - 1) / chip_attr->ram_block;
+    uint32_t blocks = (len + session->chip_attr->ram_block - 1) / session->chip_attr->ram_block;
 
     // Initiate write sequence.
-    uint32_t payload[] = {len, blocks, chip_attr->ram_block, addr};
-    RETURN_ON_ERR(et2_send_cmd_check(ET2_CMD_MEM_BEGIN, 0, payload, sizeof(payload), NULL, NULL, NULL, NULL, NULL, 0));
+    RETURN_ON_ERR(et2_session_cmd_mem_begin(session, len, blocks, session->chip_attr->ram_block, addr));
 
     // Send write data in blocks.
     for (uint32_t i = 0; i < blocks; i++) {
-        uint32_t chunk_size = len - i * chip_attr->ram_block;
-        if (chunk_size > chip_attr->ram_block) {
-            chunk_size = chip_attr->ram_block;
+        uint32_t chunk_size = len - i * session->chip_attr->ram_block;
+        if (chunk_size > session->chip_attr->ram_block) {
+            chunk_size = session->chip_attr->ram_block;
         }
-        RETURN_ON_ERR(et2_cmd_mem_data(wdata + i * chip_attr->ram_block, chunk_size, i));
+        RETURN_ON_ERR(et2_session_cmd_mem_data(session, wdata + i * session->chip_attr->ram_block, chunk_size, i));
     }
 
     return ESP_OK;
 }
 
-// Send MEM_DATA command to send memory write payload.
-esp_err_t et2_cmd_mem_data(void const* _data, uint32_t data_len, uint32_t seq) {
-    uint8_t const* data     = _data;
-    uint32_t       header[] = {data_len, seq, 0, 0};
-    uint8_t*       payload  = malloc(sizeof(header) + data_len);
-    if (!payload) {
-        return ESP_ERR_NO_MEM;
+// Send one block of a MEM_DATA, FLASH_DATA, DEFL_DATA or FLASH_ENCRYPT_DATA sequence without waiting for the ack.
+// The block may be spread over several segments, which are sent without copying them.
+static esp_err_t et2_send_data(et2_session_t* session, et2_cmd_t cmd, et2_iov_t const* data, size_t data_cnt,
+                               uint32_t seq) {
+    uint32_t data_len = 0;
+    for (size_t i = 0; i < data_cnt; i++) {
+        data_len += data[i].len;
     }
-    memcpy(payload, header, sizeof(header));
-    memcpy(payload + sizeof(header), data, data_len);
-    uint32_t chk = 239;
-    for (uint32_t i = 0; i < data_len; i++) {
-        chk ^= data[i];
-    }
-    esp_err_t res =
-        et2_send_cmd_check(ET2_CMD_MEM_DATA, chk, payload, sizeof(header) + data_len, NULL, NULL, NULL, NULL, NULL, 0);
-    free(payload);
-    return res;
+    uint32_t params[] = {data_len, seq, 0, 0};
+    return et2_send_req(session, cmd, 0, params, sizeof(params), data, data_cnt);
+}
+
+// Send one block of a data sequence and wait for the ack.
+static esp_err_t et2_cmd_data(et2_session_t* session, et2_cmd_t cmd, et2_iov_t const* data, size_t data_cnt,
+                              uint32_t seq) {
+    et2_resp_t resp;
+    RETURN_ON_ERR(et2_send_data(session, cmd, data, data_cnt, seq));
+    esp_err_t res = et2_recv_resp(session, cmd, &resp, ET2_IO_TIMEOUT_US);
+    et2_link_result(session, res, &resp);
+    RETURN_ON_ERR(res);
+    return et2_resp_check(session, cmd, &resp);
+}
+
+// Send MEM_DATA command to send memory write payload.
+esp_err_t et2_session_cmd_mem_begin(et2_session_t* session, uint32_t size, uint32_t blocks, uint32_t blocksize,
+                                    uint32_t offset) {
+    uint32_t payload[] = {size, blocks, blocksize, offset};
+    return et2_send_cmd_check(session, ET2_CMD_MEM_BEGIN, 0, payload, sizeof(payload), NULL, 0, NULL);
+}
+
+esp_err_t et2_session_cmd_mem_data(et2_session_t* session, void const* data, uint32_t data_len, uint32_t seq) {
+    return et2_cmd_data(session, ET2_CMD_MEM_DATA, &(et2_iov_t){data, data_len}, 1, seq);
 }
 
 // Send MEM_END command to restart into application.
-esp_err_t et2_cmd_mem_end(uint32_t entrypoint) {
+esp_err_t et2_session_cmd_mem_end(et2_session_t* session, uint32_t entrypoint) {
     uint32_t payload[] = {entrypoint == 0, entrypoint};
     ESP_LOGD(TAG, "Mem end, entrypoint: 0x%08" PRIx32, entrypoint);
-    return et2_send_cmd_check(ET2_CMD_MEM_END, 0, payload, sizeof(payload), NULL, NULL, NULL, NULL, NULL, 0);
+    return et2_send_cmd_check(session, ET2_CMD_MEM_END, 0, payload, sizeof(payload), NULL, 0, NULL);
 }
 
-esp_err_t et2_cmd_read_reg(uint32_t address, uint32_t* out_value) {
-    uint32_t val = 0;
-    ESP_RETURN_ON_ERROR(
-        et2_send_cmd_check(ET2_CMD_READ_REG, 0, &address, sizeof(uint32_t), NULL, NULL, NULL, &val, NULL, 0), TAG,
-        "Failed to read register");
-    *out_value = val;
+esp_err_t et2_session_cmd_read_reg(et2_session_t* session, uint32_t address, uint32_t* out_value) {
+    et2_resp_t resp;
+    ESP_RETURN_ON_ERROR(et2_send_cmd_check(session, ET2_CMD_READ_REG, 0, &address, sizeof(uint32_t), NULL, 0, &resp),
+                        TAG, "Failed to read register");
+    *out_value = resp.hdr.chk;
     return ESP_OK;
 }
 
-esp_err_t et2_cmd_read_flash(uint32_t offset, uint32_t length, uint8_t* out_data) {
+// Acknowledge a READ_FLASH data packet, counting both towards the statistics.
+static esp_err_t et2_read_flash_ack(et2_session_t* session, uint32_t received_length, size_t packet_len) {
+    uint64_t  wire = session->slip.tx_wire;
+    esp_err_t res  = et2_slip_send_frame(&session->slip, &(et2_iov_t){&received_length, sizeof(uint32_t)}, 1);
+    et2_stats_bytes(session, ET2_CMD_READ_FLASH, sizeof(uint32_t), session->slip.tx_wire - wire, packet_len,
+                    session->slip.rx_frame_wire);
+    return res;
+}
+
+esp_err_t et2_session_cmd_read_flash(et2_session_t* session, uint32_t offset, uint32_t length, uint8_t* out_data) {
     uint32_t params[] = {offset, length, FLASH_SECTOR_SIZE, 64};
-    ESP_RETURN_ON_ERROR(
-        et2_send_cmd_check(ET2_CMD_READ_FLASH, 0, params, sizeof(params), NULL, NULL, NULL, NULL, NULL, 0), TAG,
-        "Failed to read flash");
+    ESP_RETURN_ON_ERROR(et2_send_cmd_check(session, ET2_CMD_READ_FLASH, 0, params, sizeof(params), NULL, 0, NULL), TAG,
+                        "Failed to read flash");
 
-    // Receive data
+    // Receive data straight into the output buffer, hashing each packet as it arrives.
+    md5_context_t context;
+    esp_rom_md5_init(&context);
     uint32_t received_length = 0;
     while (received_length < length) {
-        uint8_t*  part        = NULL;
         size_t    part_length = 0;
-        esp_err_t res         = et2_slip_receive(cur_uart, (void**)&part, &part_length);
+        esp_err_t res =
+            et2_slip_receive_into(&session->slip, &out_data[received_length], length - received_length, &part_length);
         if (res != ESP_OK) {
             ESP_LOGE(TAG, "Failed to receive data: %s", esp_err_to_name(res));
             return res;
         }
         if ((received_length + part_length) < length && part_length < FLASH_SECTOR_SIZE) {
-            ESP_LOGE(TAG, "Corrupt data, expected 0x%" PRIx16 " bytes but received 0x%" PRIx16 "bytes",
-                     FLASH_SECTOR_SIZE, part_length);
-            return res;
+            ESP_LOGE(TAG, "Corrupt data, expected 0x%x bytes but received 0x%zx bytes", FLASH_SECTOR_SIZE,
+                     part_length);
+            return ESP_ERR_INVALID_RESPONSE;
         }
-        memcpy(&out_data[received_length], part, part_length);
-        free(part);
+        esp_rom_md5_update(&context, &out_data[received_length], part_length);
         received_length += part_length;
         ESP_LOGI(TAG, "Reading flash... %u%% (%" PRIu32 " of %" PRIu32 " bytes)", (received_length * 100 / length),
                  received_length, length);
-        et2_slip_send_startstop(cur_uart);
-        et2_slip_send_data(cur_uart, (uint8_t*)&received_length, sizeof(uint32_t));
-        et2_slip_send_startstop(cur_uart);
+        et2_read_flash_ack(session, received_length, part_length);
     }
 
     // Receive digest
-    uint8_t*  digest        = NULL;
-    size_t    digest_length = 0;
-    esp_err_t res           = et2_slip_receive(cur_uart, (void**)&digest, &digest_length);
+    uint8_t const* digest        = NULL;
+    size_t         digest_length = 0;
+    esp_err_t      res           = et2_slip_receive(&session->slip, &digest, &digest_length);
     if (res != ESP_OK) {
         ESP_LOGE(TAG, "Failed to receive digest");
         return res;
     }
     if (digest_length != 16) {
-        free(digest);
         ESP_LOGE(TAG, "Received corrupted digest");
         return ESP_FAIL;
     }
 
-    struct MD5Context context;
-
     uint8_t calculated_digest[16] = {0};
-    MD5Init(&context);
-    MD5Update(&context, out_data, length);
-    MD5Final(calculated_digest, &context);
+    esp_rom_md5_final(calculated_digest, &context);
 
     if (memcmp(calculated_digest, digest, 16) != 0) {
         ESP_LOGE(TAG, "Digest does not match");
-        free(digest);
         return ESP_FAIL;
     }
 
-    free(digest);
     return ESP_OK;
 }
 
+// Read flash in packets of `packet_size` bytes with up to `max_inflight` packets unacknowledged, passing each packet
+// to `sink` as it arrives while updating the MD5 digest.
+esp_err_t et2_session_read_flash_stream(et2_session_t* session, uint32_t offset, uint32_t length, uint32_t packet_size,
+                                        uint32_t max_inflight, et2_read_sink_t sink, void* cookie,
+                                        uint8_t out_md5[16]) {
+    packet_size  = packet_size ? packet_size : FLASH_SECTOR_SIZE;
+    max_inflight = max_inflight ? max_inflight : 64;
+    uint32_t params[] = {offset, length, packet_size, max_inflight};
+    ESP_RETURN_ON_ERROR(et2_send_cmd_check(session, ET2_CMD_READ_FLASH, 0, params, sizeof(params), NULL, 0, NULL), TAG,
+                        "Failed to read flash");
+
+    md5_context_t context;
+    esp_rom_md5_init(&context);
+    esp_err_t sink_res        = ESP_OK;
+    uint32_t  received_length = 0;
+    while (received_length < length) {
+        uint8_t const* packet;
+        size_t         packet_len;
+        esp_err_t      res = et2_slip_receive(&session->slip, &packet, &packet_len);
+        if (res != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to receive data: %s", esp_err_to_name(res));
+            return res;
+        }
+        if (packet_len > length - received_length ||
+            (received_length + packet_len < length && packet_len != packet_size)) {
+            ESP_LOGE(TAG, "Corrupt data, expected 0x%" PRIx32 " bytes but received 0x%zx bytes", packet_size,
+                     packet_len);
+            return ESP_ERR_INVALID_RESPONSE;
+        }
+        esp_rom_md5_update(&context, packet, packet_len);
+        // Once the sink fails, the rest is still received and acknowledged so the stub finishes the command.
+        if (sink_res == ESP_OK) {
+            sink_res = sink(cookie, offset + received_length, packet, packet_len);
+        }
+        received_length += packet_len;
+        RETURN_ON_ERR(et2_read_flash_ack(session, received_length, packet_len));
+    }
+
+    uint8_t const* digest;
+    size_t         digest_length;
+    RETURN_ON_ERR(et2_slip_receive(&session->slip, &digest, &digest_length), ESP_LOGE(TAG, "Failed to receive digest"));
+    LEN_CHECK(digest_length, 16);
+    uint8_t calculated_digest[16];
+    esp_rom_md5_final(calculated_digest, &context);
+    if (memcmp(calculated_digest, digest, 16) != 0) {
+        ESP_LOGE(TAG, "Digest does not match");
+        return ESP_ERR_INVALID_CRC;
+    }
+    if (out_md5) {
+        memcpy(out_md5, calculated_digest, 16);
+    }
+    return sink_res;
+}
+
 // Send FLASH_BEGIN command to initiate memory writes
-esp_err_t et2_cmd_flash_begin(uint32_t size, uint32_t offset) {
+esp_err_t et2_session_cmd_flash_begin(et2_session_t* session, uint32_t size, uint32_t offset) {
     uint32_t num_blocks = (size + FLASH_WRITE_SIZE - 1) / FLASH_WRITE_SIZE;
     uint32_t erase_size = size;
     uint32_t params[]   = {erase_size, num_blocks, FLASH_WRITE_SIZE, offset};
-    return et2_send_cmd_check(ET2_CMD_FLASH_BEGIN, 0, params, sizeof(params), NULL, NULL, NULL, NULL, NULL, 0);
+    return et2_send_cmd_check_timeout(session, ET2_CMD_FLASH_BEGIN, params, sizeof(params),
+                                      et2_size_timeout(erase_size, ET2_ERASE_TIMEOUT_PER_MB_US));
 }
 
 // Send FLASH_DATA command to send memory write payload
-esp_err_t et2_cmd_flash_data(const uint8_t* data, uint32_t data_len, uint32_t seq) {
-    uint32_t params[] = {data_len, seq, 0, 0};
-    ESP_RETURN_ON_ERROR(
-        et2_send_cmd_check(ET2_CMD_FLASH_DATA, 0, params, sizeof(params), NULL, NULL, NULL, NULL, data, data_len), TAG,
-        "Failed to write to flash");
+esp_err_t et2_session_cmd_flash_data(et2_session_t* session, const uint8_t* data, uint32_t data_len, uint32_t seq) {
+    ESP_RETURN_ON_ERROR(et2_cmd_data(session, ET2_CMD_FLASH_DATA, &(et2_iov_t){data, data_len}, 1, seq), TAG,
+                        "Failed to write to flash");
+    return ESP_OK;
+}
+
+// Send FLASH_ENCRYPT_DATA command to send memory write payload that is encrypted by the target
+esp_err_t et2_session_cmd_flash_encrypt_data(et2_session_t* session, const uint8_t* data, uint32_t data_len,
+                                             uint32_t seq) {
+    ESP_RETURN_ON_ERROR(et2_cmd_data(session, ET2_CMD_FLASH_ENCRYPT_DATA, &(et2_iov_t){data, data_len}, 1, seq), TAG,
+                        "Failed to write to flash");
     return ESP_OK;
 }
 
+// Count a command and its response, if one was received, towards the link quality.
+static void et2_link_result(et2_session_t* session, esp_err_t res, et2_resp_t const* resp) {
+    if (res == ESP_ERR_TIMEOUT || res == ESP_ERR_INVALID_RESPONSE || res == ESP_ERR_INVALID_SIZE) {
+        session->link.errors++;
+    } else if (res == ESP_OK && et2_resp_bad_checksum(session, resp)) {
+        // The target received a corrupted command.
+        session->link.errors++;
+    }
+    session->link.commands++;
+    if (session->link.errors >= ET2_LINK_MAX_ERRORS) {
+        session->link.fallback = session->baudrate > ET2_BAUD_ROM;
+    }
+    if (session->link.commands >= ET2_LINK_WINDOW || session->link.fallback) {
+        session->link.commands = 0;
+        session->link.errors   = 0;
+    }
+}
+
+// Send CHANGE_BAUDRATE and switch the transport once the target has acknowledged it.
+esp_err_t et2_session_change_baudrate(et2_session_t* session, uint32_t new_baudrate) {
+    // The stub wants to know the old baudrate, the ROM loader wants 0.
+    uint32_t params[] = {new_baudrate, session->stub_run ? session->baudrate : 0};
+    RETURN_ON_ERR(et2_send_cmd_check(session, ET2_CMD_CHANGE_BAUDRATE, 0, params, sizeof(params), NULL, 0, NULL));
+
+    // The target answers at the old baudrate and switches right after.
+    RETURN_ON_ERR(et2_io_set_baudrate(session->tp, new_baudrate));
+    session->baudrate = new_baudrate;
+    et2_io_delay_us(ET2_BAUD_SETTLE_US);
+    if (session->tp->discard) {
+        session->tp->discard(session->tp);
+    }
+    ESP_LOGI(TAG, "Changed baudrate to %" PRIu32, new_baudrate);
+    return ESP_OK;
+}
+
+// Check that the link works by reading a known register a few times.
+static esp_err_t et2_baud_probe(et2_session_t* session, uint32_t expected) {
+    for (int i = 0; i < ET2_BAUD_PROBES; i++) {
+        uint32_t magic;
+        RETURN_ON_ERR(et2_read_magic_reg(session, &magic));
+        if (magic != expected) {
+            return ESP_ERR_INVALID_RESPONSE;
+        }
+    }
+    return ESP_OK;
+}
+
+// Go back to a lower baudrate after the link at the current one failed.
+static esp_err_t et2_baud_revert(et2_session_t* session, uint32_t lower) {
+    // Ask the target first; if it can't be reached, it may never have switched.
+    if (et2_session_change_baudrate(session, lower) != ESP_OK) {
+        RETURN_ON_ERR(et2_io_set_baudrate(session->tp, lower));
+        session->baudrate = lower;
+        if (session->tp->discard) {
+            session->tp->discard(session->tp);
+        }
+    }
+    uint32_t magic;
+    return et2_read_magic_reg(session, &magic);
+}
+
+// Raise the baudrate step by step up to `max_baudrate`, keeping the highest one that passes a probe.
+esp_err_t et2_session_set_baudrate_auto(et2_session_t* session, uint32_t max_baudrate) {
+    uint32_t magic;
+    RETURN_ON_ERR(et2_read_magic_reg(session, &magic));
+    for (size_t i = 0; i < sizeof(baud_ladder) / sizeof(baud_ladder[0]); i++) {
+        uint32_t prev = session->baudrate;
+        if (baud_ladder[i] <= prev) {
+            continue;
+        } else if (baud_ladder[i] > max_baudrate) {
+            break;
+        }
+        esp_err_t res = et2_session_change_baudrate(session, baud_ladder[i]);
+        if (res == ESP_OK) {
+            res = et2_baud_probe(session, magic);
+        }
+        if (res != ESP_OK) {
+            ESP_LOGW(TAG, "Baudrate %" PRIu32 " does not work, staying at %" PRIu32, baud_ladder[i], prev);
+            return et2_baud_revert(session, prev);
+        }
+    }
+    session->link.commands = 0;
+    session->link.errors   = 0;
+    return ESP_OK;
+}
+
+// Lower the baudrate one step if too many recent commands failed on the link.
+static esp_err_t et2_link_fallback(et2_session_t* session) {
+    if (!session->link.fallback) {
+        return ESP_OK;
+    }
+    session->link.fallback = false;
+    uint32_t lower = ET2_BAUD_ROM;
+    for (size_t i = 0; i < sizeof(baud_ladder) / sizeof(baud_ladder[0]) && baud_ladder[i] < session->baudrate; i++) {
+        lower = baud_ladder[i];
+    }
+    ESP_LOGW(TAG, "Too many link errors at %" PRIu32 " baud, falling back to %" PRIu32, session->baudrate, lower);
+    return et2_baud_revert(session, lower);
+}
+
+// Get the current baudrate.
+uint32_t et2_session_get_baudrate(et2_session_t* session) {
+    return session->baudrate;
+}
+
+// Prepare a pipelined writer for FLASH_DATA, DEFL_DATA or FLASH_ENCRYPT_DATA blocks.
+void et2_session_flash_writer_init(et2_session_t* session, et2_flash_writer_t* writer, et2_cmd_t cmd, uint32_t window) {
+    writer->session = session;
+    writer->cmd     = cmd;
+    writer->window  = window ? window : CONFIG_ET2_FLASH_WINDOW;
+    writer->seq     = 0;
+    writer->acked   = 0;
+}
+
+// Wait for the ack of the oldest block in flight.
+static esp_err_t et2_flash_writer_ack(et2_flash_writer_t* writer) {
+    // The target handles commands in order, so acks arrive in the same order as the blocks.
+    et2_session_t* session = writer->session;
+    et2_resp_t     resp;
+    esp_err_t      res = et2_recv_resp(session, writer->cmd, &resp, ET2_IO_TIMEOUT_US);
+    et2_link_result(session, res, &resp);
+    if (res == ESP_OK) {
+        res = et2_resp_check(session, writer->cmd, &resp);
+    }
+    if (res != ESP_OK) {
+        ESP_LOGE(TAG, "Block %" PRIu32 " was not acknowledged", writer->acked);
+        // Drop the acks of the blocks after it; they belong to a sequence that is being aborted.
+        writer->acked = writer->seq;
+        et2_stats_forget_pending(session);
+        if (session->tp->discard) {
+            session->tp->discard(session->tp);
+        }
+        return res;
+    }
+    writer->acked++;
+    return ESP_OK;
+}
+
+// Send the next block, first waiting for an ack if the window is full.
+esp_err_t et2_flash_writer_write(et2_flash_writer_t* writer, const uint8_t* data, uint32_t data_len) {
+    while (writer->seq - writer->acked >= writer->window) {
+        RETURN_ON_ERR(et2_flash_writer_ack(writer));
+    }
+    RETURN_ON_ERR(et2_send_data(writer->session, writer->cmd, &(et2_iov_t){data, data_len}, 1, writer->seq));
+    writer->seq++;
+    return ESP_OK;
+}
+
+// Wait until all blocks sent have been acknowledged.
+esp_err_t et2_flash_writer_wait(et2_flash_writer_t* writer) {
+    while (writer->acked < writer->seq) {
+        RETURN_ON_ERR(et2_flash_writer_ack(writer));
+    }
+    return ESP_OK;
+}
+
+// Get a piece of input that is already in memory.
+static esp_err_t et2_mem_source_read(et2_source_t* src, uint32_t pos, uint32_t len, uint8_t const** out_data) {
+    *out_data = ((et2_mem_source_t*)src)->data + pos;
+    return ESP_OK;
+}
+
+// Prepare a source for data in memory.
+void et2_mem_source_init(et2_mem_source_t* src, uint8_t const* data) {
+    src->base.read = et2_mem_source_read;
+    src->data      = data;
+}
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+// Get a piece of a partition, mapping a new window unless the current one holds it.
+static esp_err_t et2_part_source_read(et2_source_t* _src, uint32_t pos, uint32_t len, uint8_t const** out_data) {
+    et2_part_source_t* src = (et2_part_source_t*)_src;
+    if (src->mapped_len && pos >= src->mapped_pos && pos + len <= src->mapped_pos + src->mapped_len) {
+        *out_data = src->mapped + (pos - src->mapped_pos);
+        return ESP_OK;
+    }
+    et2_part_source_deinit(src);
+    uint32_t    map_len = len > ET2_MMAP_WINDOW ? len : ET2_MMAP_WINDOW;
+    void const* mapped;
+    map_len = src->part->size - pos < map_len ? src->part->size - pos : map_len;
+    ESP_RETURN_ON_ERROR(esp_partition_mmap(src->part, pos, map_len, ESP_PARTITION_MMAP_DATA, &mapped, &src->handle),
+                        TAG, "Failed to map partition %s", src->part->label);
+    src->mapped     = mapped;
+    src->mapped_pos = pos;
+    src->mapped_len = map_len;
+    *out_data       = src->mapped;
+    return ESP_OK;
+}
+
+// Prepare a source for a local partition.
+void et2_part_source_init(et2_part_source_t* src, esp_partition_t const* part) {
+    src->base.read  = et2_part_source_read;
+    src->part       = part;
+    src->mapped_len = 0;
+}
+
+// Unmap the current window of a partition source.
+void et2_part_source_deinit(et2_part_source_t* src) {
+    if (src->mapped_len) {
+        esp_partition_munmap(src->handle);
+        src->mapped_len = 0;
+    }
+}
+#endif
+
+// Write uncompressed data from a source to flash, keeping several blocks in flight.
+static esp_err_t et2_write_flash_plain(et2_session_t* session, uint32_t offset, et2_source_t* src, uint32_t pos,
+                                       uint32_t len, uint8_t out_md5[16]) {
+    RETURN_ON_ERR(et2_session_cmd_flash_begin(session, len, offset));
+
+    md5_context_t      md5;
+    et2_flash_writer_t writer;
+    et2_session_flash_writer_init(session, &writer, ET2_CMD_FLASH_DATA, 0);
+    esp_rom_md5_init(&md5);
+    esp_err_t res = ESP_OK;
+    for (uint32_t done = 0; done < len && res == ESP_OK; done += FLASH_WRITE_SIZE) {
+        uint32_t       chunk = len - done < FLASH_WRITE_SIZE ? len - done : FLASH_WRITE_SIZE;
+        uint8_t const* data;
+        res = src->read(src, pos + done, chunk, &data);
+        if (res != ESP_OK) {
+            break;
+        }
+        // The writer is done with each block once it returns, so the source may move on right after.
+        ESP_RETURN_ON_ERROR(et2_flash_writer_write(&writer, data, chunk), TAG, "Failed to write to flash");
+        // Hash the block while it is in flight.
+        if (out_md5) {
+            esp_rom_md5_update(&md5, data, chunk);
+        }
+        res = et2_session_progress(session, chunk);
+    }
+    // The blocks in flight are still acknowledged if the source or the progress hook stopped the write.
+    ESP_RETURN_ON_ERROR(et2_flash_writer_wait(&writer), TAG, "Failed to write to flash");
+    RETURN_ON_ERR(res);
+    if (out_md5) {
+        esp_rom_md5_final(out_md5, &md5);
+    }
+    return ESP_OK;
+}
+
+// Write uncompressed data to flash, keeping several blocks in flight.
+esp_err_t et2_session_write_flash(et2_session_t* session, uint32_t offset, const uint8_t* data, uint32_t len,
+                                  uint8_t out_md5[16]) {
+    et2_mem_source_t src;
+    et2_mem_source_init(&src, data);
+    return et2_write_flash_plain(session, offset, &src.base, 0, len, out_md5);
+}
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+// Write part of a local partition to flash, mapping one window of it at a time.
+esp_err_t et2_session_write_flash_from_partition(et2_session_t* session, uint32_t offset, esp_partition_t const* part,
+                                                 uint32_t len, bool validate_app, uint8_t out_md5[16]) {
+    if (validate_app) {
+        // Checks the header, segments, checksum and, if enabled, the appended hash.
+        esp_partition_pos_t  pos  = {.offset = part->address, .size = part->size};
+        esp_image_metadata_t  meta = {0};
+        ESP_RETURN_ON_ERROR(esp_image_verify(ESP_IMAGE_VERIFY_SILENT, &pos, &meta), TAG,
+                            "No valid app image in partition %s", part->label);
+        if (!len) {
+            len = meta.image_len;
+        }
+    } else if (!len) {
+        len = part->size;
+    }
+    if (len > part->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    et2_part_source_t src;
+    et2_part_source_init(&src, part);
+    esp_err_t res = et2_write_flash_plain(session, offset, &src.base, 0, len, out_md5);
+    et2_part_source_deinit(&src);
+    return res;
+}
+#endif
+
 // Send FLASH_FINISH command to restart into application.
-esp_err_t et2_cmd_flash_finish(bool reboot) {
+esp_err_t et2_session_cmd_flash_finish(et2_session_t* session, bool reboot) {
     uint32_t params[] = {reboot ? 0 : 1};
-    return et2_send_cmd_check(ET2_CMD_FLASH_END, 0, params, sizeof(params), NULL, NULL, NULL, NULL, NULL, 0);
+    return et2_send_cmd_check(session, ET2_CMD_FLASH_END, 0, params, sizeof(params), NULL, 0, NULL);
 }
 
 // Write compressed data to flash
 
-esp_err_t et2_cmd_deflate_begin(uint32_t uncompressed_size, uint32_t compressed_size, uint32_t offset) {
+esp_err_t et2_session_cmd_deflate_begin(et2_session_t* session, uint32_t uncompressed_size, uint32_t compressed_size,
+                                        uint32_t offset) {
     uint32_t num_blocks = (compressed_size + FLASH_WRITE_SIZE - 1) / FLASH_WRITE_SIZE;
     uint32_t erase_size = uncompressed_size;
     uint32_t params[]   = {erase_size, num_blocks, FLASH_WRITE_SIZE, offset};
-    return et2_send_cmd_check(ET2_CMD_DEFL_BEGIN, 0, params, sizeof(params), NULL, NULL, NULL, NULL, NULL, 0);
+    return et2_send_cmd_check_timeout(session, ET2_CMD_DEFL_BEGIN, params, sizeof(params),
+                                      et2_size_timeout(erase_size, ET2_ERASE_TIMEOUT_PER_MB_US));
 }
 
-esp_err_t et2_cmd_deflate_data(const uint8_t* data, uint32_t data_len, uint32_t seq) {
-    uint32_t params[] = {data_len, seq, 0, 0};
-    ESP_RETURN_ON_ERROR(
-        et2_send_cmd_check(ET2_CMD_DEFL_DATA, 0, params, sizeof(params), NULL, NULL, NULL, NULL, data, data_len), TAG,
-        "Failed to write to flash");
+esp_err_t et2_session_cmd_deflate_data(et2_session_t* session, const uint8_t* data, uint32_t data_len, uint32_t seq) {
+    ESP_RETURN_ON_ERROR(et2_cmd_data(session, ET2_CMD_DEFL_DATA, &(et2_iov_t){data, data_len}, 1, seq), TAG,
+                        "Failed to write to flash");
     return ESP_OK;
 }
 
-esp_err_t et2_cmd_deflate_finish(bool reboot) {
+esp_err_t et2_session_cmd_deflate_finish(et2_session_t* session, bool reboot) {
     uint32_t params[] = {reboot ? 0 : 1};
-    return et2_send_cmd_check(ET2_CMD_DEFL_END, 0, params, sizeof(params), NULL, NULL, NULL, NULL, NULL, 0);
+    return et2_send_cmd_check(session, ET2_CMD_DEFL_END, 0, params, sizeof(params), NULL, 0, NULL);
+}
+
+// Compress data from a source and send it in DEFL_DATA blocks, sending each block as soon as it is full.
+// The input is handed to the compressor one window at a time, once it has consumed the previous one.
+static esp_err_t et2_deflate_blocks(et2_session_t* session, et2_deflater_t* deflater, uint8_t* block, uint32_t offset,
+                                    et2_source_t* src, uint32_t pos, uint32_t len, uint8_t out_md5[16]) {
+    // The compressed size is not known up front; the target only uses it as an upper limit.
+    RETURN_ON_ERR(et2_session_cmd_deflate_begin(session, len, et2_deflater_bound(deflater, len), offset));
+
+    et2_flash_writer_t writer;
+    et2_session_flash_writer_init(session, &writer, ET2_CMD_DEFL_DATA, 0);
+    md5_context_t  md5;
+    uint8_t const* window     = NULL;
+    size_t         window_pos = 0;
+    esp_err_t      res        = ESP_OK;
+    size_t         fed        = 0;
+    size_t         consumed   = 0;
+    size_t         fill       = 0;
+    size_t         compressed = 0;
+    bool           done       = false;
+    esp_rom_md5_init(&md5);
+    while (!done && res == ESP_OK) {
+        if (consumed == fed && fed < len) {
+            uint32_t win_len = len - fed < ET2_MMAP_WINDOW ? len - fed : ET2_MMAP_WINDOW;
+            res              = src->read(src, pos + fed, win_len, &window);
+            if (res != ESP_OK) {
+                break;
+            }
+            et2_deflater_input(deflater, window, win_len);
+            window_pos  = fed;
+            fed        += win_len;
+        }
+        // Blocks are only sent once full, as the compressor may stop early at the end of a window.
+        size_t out_len;
+        RETURN_ON_ERR(
+            et2_deflater_output(deflater, block + fill, FLASH_WRITE_SIZE - fill, fed == len, &out_len, &done));
+        fill += out_len;
+        if (fill == FLASH_WRITE_SIZE || (done && fill)) {
+            RETURN_ON_ERR(et2_flash_writer_write(&writer, block, fill));
+            compressed += fill;
+            fill        = 0;
+        }
+        // Hash the input the compressor just consumed, and report it as progress.
+        size_t total_in = et2_deflater_total_in(deflater);
+        if (out_md5) {
+            esp_rom_md5_update(&md5, window + (consumed - window_pos), total_in - consumed);
+        }
+        res      = et2_session_progress(session, total_in - consumed);
+        consumed = total_in;
+    }
+    RETURN_ON_ERR(et2_flash_writer_wait(&writer));
+    RETURN_ON_ERR(res);
+    if (out_md5) {
+        esp_rom_md5_final(out_md5, &md5);
+    }
+
+    ESP_LOGI(TAG, "Wrote %" PRIu32 " bytes to flash as %zu compressed bytes", len, compressed);
+    return ESP_OK;
+}
+
+// Compress data from a source with a zlib level from 0 to 9 (-1 for the default) and write it to flash.
+static esp_err_t et2_write_flash_deflate(et2_session_t* session, uint32_t offset, et2_source_t* src, uint32_t pos,
+                                         uint32_t len, int level, uint8_t out_md5[16]) {
+    et2_deflater_t* deflater;
+    RETURN_ON_ERR(et2_deflater_create(level, &deflater));
+    uint8_t* block = malloc(FLASH_WRITE_SIZE);
+    if (!block) {
+        et2_deflater_destroy(deflater);
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t res = et2_deflate_blocks(session, deflater, block, offset, src, pos, len, out_md5);
+    if (res != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to write compressed data to flash");
+    }
+
+    free(block);
+    et2_deflater_destroy(deflater);
+    return res;
+}
+
+// Compress data with a zlib level from 0 to 9 (-1 for the default) and write it to flash.
+esp_err_t et2_session_write_flash_compressed(et2_session_t* session, uint32_t offset, const uint8_t* data, uint32_t len,
+                                             int level, uint8_t out_md5[16]) {
+    et2_mem_source_t src;
+    et2_mem_source_init(&src, data);
+    return et2_write_flash_deflate(session, offset, &src.base, 0, len, level, out_md5);
+}
+
+// Write `len` bytes at `pos` of a source to flash, as is if `level` is 0 or compressed with that zlib level otherwise.
+esp_err_t et2_session_write_flash_source(et2_session_t* session, uint32_t offset, et2_source_t* src, uint32_t pos,
+                                         uint32_t len, int level, uint8_t out_md5[16]) {
+    if (level == 0) {
+        return et2_write_flash_plain(session, offset, src, pos, len, out_md5);
+    }
+    return et2_write_flash_deflate(session, offset, src, pos, len, level, out_md5);
+}
+
+// Write data to flash as is if `level` is 0, or compressed with that zlib level otherwise.
+esp_err_t et2_session_write_flash_level(et2_session_t* session, uint32_t offset, const uint8_t* data, uint32_t len,
+                                        int level, uint8_t out_md5[16]) {
+    et2_mem_source_t src;
+    et2_mem_source_init(&src, data);
+    return et2_session_write_flash_source(session, offset, &src.base, 0, len, level, out_md5);
+}
+
+// Send the empty begin command of a write that had nothing to send, so the caller's finish command is accepted.
+esp_err_t et2_session_write_flash_empty(et2_session_t* session, uint32_t offset, int level) {
+    if (level == 0) {
+        return et2_session_cmd_flash_begin(session, 0, offset);
+    }
+    return et2_session_cmd_deflate_begin(session, 0, 0, offset);
 }
 
 // Erase entire flash
-esp_err_t et2_cmd_erase_flash(void) {
-    return et2_send_cmd_check(ET2_CMD_ERASE_FLASH, 0, NULL, 0, NULL, NULL, NULL, NULL, NULL, 0);
+esp_err_t et2_session_cmd_erase_flash(et2_session_t* session) {
+    return et2_send_cmd_check_timeout(session, ET2_CMD_ERASE_FLASH, NULL, 0, ET2_ERASE_FLASH_TIMEOUT_US);
 }
 
 // Erase a region of flash
-esp_err_t et2_cmd_erase_region(uint32_t offset, uint32_t length) {
+esp_err_t et2_session_cmd_erase_region(et2_session_t* session, uint32_t offset, uint32_t length) {
     uint32_t params[] = {offset, length};
-    return et2_send_cmd_check(ET2_CMD_ERASE_REGION, 0, params, sizeof(params), NULL, NULL, NULL, NULL, NULL, 0);
+    return et2_send_cmd_check_timeout(session, ET2_CMD_ERASE_REGION, params, sizeof(params),
+                                      et2_size_timeout(length, ET2_ERASE_TIMEOUT_PER_MB_US));
+}
+
+// Check an SPI_FLASH_MD5 response and get the digest from it.
+static esp_err_t et2_md5_resp(et2_session_t* session, et2_resp_t const* resp, uint8_t out_md5[16]) {
+    ESP_RETURN_ON_ERROR(et2_resp_check(session, ET2_CMD_SPI_FLASH_MD5, resp), TAG, "Failed to hash flash");
+
+    // The stub sends the digest as raw bytes, the ROM loader as hexadecimal text.
+    size_t digest_len = resp->len - session->chip_attr->status_len;
+    if (digest_len == 16) {
+        memcpy(out_md5, resp->data, 16);
+        return ESP_OK;
+    }
+    LEN_CHECK(digest_len, 32);
+    for (int i = 0; i < 16; i++) {
+        char hex[3] = {(char)resp->data[2 * i], (char)resp->data[2 * i + 1], 0};
+        out_md5[i]  = strtoul(hex, NULL, 16);
+    }
+    return ESP_OK;
+}
+
+// Get the MD5 digest of a region of flash
+esp_err_t et2_session_cmd_spi_flash_md5(et2_session_t* session, uint32_t offset, uint32_t length, uint8_t out_md5[16]) {
+    uint32_t   params[] = {offset, length, 0, 0};
+    et2_resp_t resp;
+    ESP_RETURN_ON_ERROR(et2_send_cmd_timeout(session, ET2_CMD_SPI_FLASH_MD5, 0, params, sizeof(params), NULL, 0, &resp,
+                                             et2_size_timeout(length, ET2_MD5_TIMEOUT_PER_MB_US)),
+                        TAG, "Failed to hash flash");
+    return et2_md5_resp(session, &resp, out_md5);
+}
+
+// Check that a region of flash has the expected MD5 digest, without reading it back.
+esp_err_t et2_session_verify_flash(et2_session_t* session, uint32_t offset, uint32_t length,
+                                   uint8_t const expected_md5[16]) {
+    uint8_t actual[16];
+    RETURN_ON_ERR(et2_session_cmd_spi_flash_md5(session, offset, length, actual));
+    if (memcmp(actual, expected_md5, 16) != 0) {
+        ESP_LOGE(TAG, "Flash range 0x%08" PRIx32 "-0x%08" PRIx32 " does not match", offset, offset + length);
+        return ESP_ERR_INVALID_CRC;
+    }
+    return ESP_OK;
+}
+
+// Write a run of chunks that differ from the flash contents.
+static esp_err_t et2_write_flash_run(et2_session_t* session, uint32_t offset, const uint8_t* data, uint32_t len,
+                                     int level) {
+    ESP_LOGI(TAG, "Writing changed range 0x%08" PRIx32 "-0x%08" PRIx32, offset, offset + len);
+    return et2_session_write_flash_level(session, offset, data, len, level, NULL);
+}
+
+// Compare the chunks of an image with the flash contents, keeping several SPI_FLASH_MD5 requests in flight.
+static esp_err_t et2_diff_chunks(et2_session_t* session, uint32_t offset, const uint8_t* data, uint32_t len,
+                                 uint32_t chunk_size, bool* out_differs, md5_context_t* image_md5) {
+    uint32_t  chunks = (len + chunk_size - 1) / chunk_size;
+    uint32_t  sent   = 0;
+    uint32_t  acked  = 0;
+    esp_err_t res    = et2_link_fallback(session);
+    while (acked < chunks && res == ESP_OK) {
+        if (sent < chunks && sent - acked < CONFIG_ET2_FLASH_WINDOW) {
+            uint32_t pos      = sent * chunk_size;
+            uint32_t params[] = {offset + pos, len - pos < chunk_size ? len - pos : chunk_size, 0, 0};
+            res               = et2_send_req(session, ET2_CMD_SPI_FLASH_MD5, 0, params, sizeof(params), NULL, 0);
+            sent++;
+            continue;
+        }
+
+        // The target handles commands in order, so the digests arrive in the same order as the requests.
+        uint32_t   pos   = acked * chunk_size;
+        uint32_t   chunk = len - pos < chunk_size ? len - pos : chunk_size;
+        et2_resp_t resp;
+        uint8_t    local[16], remote[16];
+        res = et2_recv_resp(session, ET2_CMD_SPI_FLASH_MD5, &resp, et2_size_timeout(chunk, ET2_MD5_TIMEOUT_PER_MB_US));
+        et2_link_result(session, res, &resp);
+        if (res == ESP_OK) {
+            res = et2_md5_resp(session, &resp, remote);
+        }
+        if (res != ESP_OK) {
+            break;
+        }
+        // Hash the local chunk while the target hashes the next ones.
+        md5_context_t context;
+        esp_rom_md5_init(&context);
+        esp_rom_md5_update(&context, data + pos, chunk);
+        esp_rom_md5_final(local, &context);
+        if (image_md5) {
+            esp_rom_md5_update(image_md5, data + pos, chunk);
+        }
+        out_differs[acked++] = memcmp(local, remote, 16) != 0;
+    }
+    if (res != ESP_OK && sent > acked) {
+        // Drop the digests still in flight; a late one would be taken for the response to a later command.
+        et2_stats_forget_pending(session);
+        if (session->tp->discard) {
+            session->tp->discard(session->tp);
+        }
+    }
+    return res;
+}
+
+// Write data to flash, skipping chunks whose contents already match.
+esp_err_t et2_session_write_flash_diff(et2_session_t* session, uint32_t offset, const uint8_t* data, uint32_t len,
+                                       uint32_t chunk_size, int level, uint8_t out_md5[16]) {
+    if (offset % FLASH_SECTOR_SIZE || !chunk_size || chunk_size % FLASH_SECTOR_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // Compare every chunk first, so no digest is in flight while the changed runs are written.
+    uint32_t      chunks  = (len + chunk_size - 1) / chunk_size;
+    bool*         differs = malloc(chunks * sizeof(bool));
+    md5_context_t image_md5;
+    if (chunks && !differs) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_rom_md5_init(&image_md5);
+    esp_err_t res = et2_diff_chunks(session, offset, data, len, chunk_size, differs, out_md5 ? &image_md5 : NULL);
+
+    uint32_t run_start = 0;
+    uint32_t run_len   = 0;
+    uint32_t skipped   = 0;
+    for (uint32_t i = 0; i < chunks && res == ESP_OK; i++) {
+        uint32_t pos   = i * chunk_size;
+        uint32_t chunk = len - pos < chunk_size ? len - pos : chunk_size;
+        if (differs[i]) {
+            // Grow the current run of changed chunks.
+            if (!run_len) {
+                run_start = pos;
+            }
+            run_len += chunk;
+            continue;
+        }
+        skipped += chunk;
+        if (run_len) {
+            res     = et2_write_flash_run(session, offset + run_start, data + run_start, run_len, level);
+            run_len = 0;
+        }
+    }
+    free(differs);
+    RETURN_ON_ERR(res);
+    if (run_len) {
+        RETURN_ON_ERR(et2_write_flash_run(session, offset + run_start, data + run_start, run_len, level));
+    } else if (skipped == len) {
+        RETURN_ON_ERR(et2_session_write_flash_empty(session, offset, level));
+    }
+
+    if (out_md5) {
+        esp_rom_md5_final(out_md5, &image_md5);
+    }
+    ESP_LOGI(TAG, "Skipped %" PRIu32 " of %" PRIu32 " bytes that were already up to date", skipped, len);
+    return ESP_OK;
 }
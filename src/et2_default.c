@@ -0,0 +1,220 @@
+// Functions without a session argument, which all use the default session.
+
+#include <stdbool.h>
+#include "esptoolsquared.h"
+#include "et2_macros.h"
+#include "et2_session.h"
+#include "sdkconfig.h"
+
+static et2_session_t default_session;
+static bool          default_ready;
+
+// Get the default session.
+et2_session_t* et2_default_session(void) {
+    if (!default_ready) {
+        et2_session_init(&default_session, NULL);
+        default_ready = true;
+    }
+    return &default_session;
+}
+
+// Set interface used to a transport.
+esp_err_t et2_setif(et2_transport_t* tp) {
+    // A new transport means a new target, so nothing known about the previous one carries over.
+    et2_session_t* session = et2_default_session();
+    et2_session_deinit(session);
+    et2_session_init(session, tp);
+    return ESP_OK;
+}
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+// Set interface used to a UART.
+esp_err_t et2_setif_uart(uart_port_t uart) {
+    static et2_transport_t* uart_tp;
+    et2_transport_t*        new_tp;
+    // The default session keeps the old transport until it is switched, so it is destroyed last.
+    RETURN_ON_ERR(et2_transport_uart_create(uart, &new_tp));
+    esp_err_t res = et2_setif(new_tp);
+    if (res != ESP_OK) {
+        et2_transport_destroy(new_tp);
+        return res;
+    }
+    et2_transport_destroy(uart_tp);
+    uart_tp = new_tp;
+    return ESP_OK;
+}
+#endif
+
+esp_err_t et2_sync() {
+    return et2_session_sync(et2_default_session());
+}
+
+esp_err_t et2_connect(et2_connect_config_t const* config, int64_t* out_connect_us) {
+    return et2_session_connect(et2_default_session(), config, out_connect_us);
+}
+
+esp_err_t et2_change_baudrate(uint32_t baudrate) {
+    return et2_session_change_baudrate(et2_default_session(), baudrate);
+}
+
+esp_err_t et2_set_baudrate_auto(uint32_t max_baudrate) {
+    return et2_session_set_baudrate_auto(et2_default_session(), max_baudrate);
+}
+
+uint32_t et2_get_baudrate(void) {
+    return et2_session_get_baudrate(et2_default_session());
+}
+
+esp_err_t et2_detect(uint32_t* chip_id) {
+    return et2_session_detect(et2_default_session(), chip_id);
+}
+
+esp_err_t et2_run_stub() {
+    return et2_session_run_stub(et2_default_session());
+}
+
+esp_err_t et2_mem_write(uint32_t addr, void const* wdata, uint32_t len) {
+    return et2_session_mem_write(et2_default_session(), addr, wdata, len);
+}
+
+esp_err_t et2_cmd_mem_begin(uint32_t size, uint32_t blocks, uint32_t blocksize, uint32_t offset) {
+    return et2_session_cmd_mem_begin(et2_default_session(), size, blocks, blocksize, offset);
+}
+
+esp_err_t et2_cmd_mem_data(void const* data, uint32_t data_len, uint32_t seq) {
+    return et2_session_cmd_mem_data(et2_default_session(), data, data_len, seq);
+}
+
+esp_err_t et2_cmd_mem_end(uint32_t entrypoint) {
+    return et2_session_cmd_mem_end(et2_default_session(), entrypoint);
+}
+
+esp_err_t et2_cmd_flash_begin(uint32_t size, uint32_t offset) {
+    return et2_session_cmd_flash_begin(et2_default_session(), size, offset);
+}
+
+esp_err_t et2_cmd_flash_data(const uint8_t* data, uint32_t data_len, uint32_t seq) {
+    return et2_session_cmd_flash_data(et2_default_session(), data, data_len, seq);
+}
+
+esp_err_t et2_cmd_flash_finish(bool reboot) {
+    return et2_session_cmd_flash_finish(et2_default_session(), reboot);
+}
+
+esp_err_t et2_cmd_flash_encrypt_data(const uint8_t* data, uint32_t data_len, uint32_t seq) {
+    return et2_session_cmd_flash_encrypt_data(et2_default_session(), data, data_len, seq);
+}
+
+void et2_flash_writer_init(et2_flash_writer_t* writer, et2_cmd_t cmd, uint32_t window) {
+    et2_session_flash_writer_init(et2_default_session(), writer, cmd, window);
+}
+
+esp_err_t et2_write_flash(uint32_t offset, const uint8_t* data, uint32_t len, uint8_t out_md5[16]) {
+    return et2_session_write_flash(et2_default_session(), offset, data, len, out_md5);
+}
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+esp_err_t et2_write_flash_from_partition(uint32_t offset, esp_partition_t const* part, uint32_t len, bool validate_app,
+                                         uint8_t out_md5[16]) {
+    return et2_session_write_flash_from_partition(et2_default_session(), offset, part, len, validate_app, out_md5);
+}
+#endif
+
+esp_err_t et2_cmd_deflate_begin(uint32_t uncompressed_size, uint32_t compressed_size, uint32_t offset) {
+    return et2_session_cmd_deflate_begin(et2_default_session(), uncompressed_size, compressed_size, offset);
+}
+
+esp_err_t et2_cmd_deflate_data(const uint8_t* data, uint32_t data_len, uint32_t seq) {
+    return et2_session_cmd_deflate_data(et2_default_session(), data, data_len, seq);
+}
+
+esp_err_t et2_cmd_deflate_finish(bool reboot) {
+    return et2_session_cmd_deflate_finish(et2_default_session(), reboot);
+}
+
+esp_err_t et2_write_flash_compressed(uint32_t offset, const uint8_t* data, uint32_t len, int level,
+                                     uint8_t out_md5[16]) {
+    return et2_session_write_flash_compressed(et2_default_session(), offset, data, len, level, out_md5);
+}
+
+esp_err_t et2_write_flash_pipelined(uint32_t offset, const uint8_t* data, uint32_t len,
+                                    et2_pipeline_config_t const* config, et2_pipeline_stats_t* out_stats,
+                                    uint8_t out_md5[16]) {
+    return et2_session_write_flash_pipelined(et2_default_session(), offset, data, len, config, out_stats, out_md5);
+}
+
+esp_err_t et2_cmd_read_reg(uint32_t address, uint32_t* out_value) {
+    return et2_session_cmd_read_reg(et2_default_session(), address, out_value);
+}
+
+esp_err_t et2_cmd_read_flash(uint32_t offset, uint32_t length, uint8_t* out_data) {
+    return et2_session_cmd_read_flash(et2_default_session(), offset, length, out_data);
+}
+
+esp_err_t et2_read_flash_stream(uint32_t offset, uint32_t length, uint32_t packet_size, uint32_t max_inflight,
+                                et2_read_sink_t sink, void* cookie, uint8_t out_md5[16]) {
+    return et2_session_read_flash_stream(et2_default_session(), offset, length, packet_size, max_inflight, sink, cookie,
+                                         out_md5);
+}
+
+esp_err_t et2_cmd_erase_flash(void) {
+    return et2_session_cmd_erase_flash(et2_default_session());
+}
+
+esp_err_t et2_cmd_erase_region(uint32_t offset, uint32_t length) {
+    return et2_session_cmd_erase_region(et2_default_session(), offset, length);
+}
+
+esp_err_t et2_cmd_spi_flash_md5(uint32_t offset, uint32_t length, uint8_t out_md5[16]) {
+    return et2_session_cmd_spi_flash_md5(et2_default_session(), offset, length, out_md5);
+}
+
+esp_err_t et2_verify_flash(uint32_t offset, uint32_t length, uint8_t const expected_md5[16]) {
+    return et2_session_verify_flash(et2_default_session(), offset, length, expected_md5);
+}
+
+esp_err_t et2_erase_plan_run(et2_erase_plan_t* plan, bool check, uint32_t* out_erased) {
+    return et2_session_erase_plan_run(et2_default_session(), plan, check, out_erased);
+}
+
+esp_err_t et2_write_flash_diff(uint32_t offset, const uint8_t* data, uint32_t len, uint32_t chunk_size, int level,
+                               uint8_t out_md5[16]) {
+    return et2_session_write_flash_diff(et2_default_session(), offset, data, len, chunk_size, level, out_md5);
+}
+
+esp_err_t et2_write_flash_sparse(uint32_t offset, uint8_t const* data, uint32_t len, int level, uint8_t out_md5[16]) {
+    return et2_session_write_flash_sparse(et2_default_session(), offset, data, len, level, out_md5);
+}
+
+esp_err_t et2_write_flash_sparse_image(uint32_t offset, void const* image, size_t len, int level, uint8_t out_md5[16]) {
+    return et2_session_write_flash_sparse_image(et2_default_session(), offset, image, len, level, out_md5);
+}
+
+esp_err_t et2_write_flash_manifest(et2_region_t const* regions, size_t count, bool reboot) {
+    return et2_session_write_flash_manifest(et2_default_session(), regions, count, reboot);
+}
+
+esp_err_t et2_write_flash_resumable(uint32_t offset, uint8_t const* data, uint32_t len, int level,
+                                    et2_journal_t* journal, uint8_t out_md5[16]) {
+    return et2_session_write_flash_resumable(et2_default_session(), offset, data, len, level, journal, out_md5);
+}
+
+esp_err_t et2_jobs_create(int core, et2_jobs_t** out_jobs) {
+    return et2_session_jobs_create(et2_default_session(), core, out_jobs);
+}
+
+esp_err_t et2_get_cmd_stats(et2_cmd_t cmd, et2_cmd_stats_t* out_stats) {
+    return et2_session_get_cmd_stats(et2_default_session(), cmd, out_stats);
+}
+
+void et2_reset_stats(void) {
+    et2_session_reset_stats(et2_default_session());
+}
+
+void et2_dump_stats(void) {
+    et2_session_dump_stats(et2_default_session());
+}
+
+void et2_set_stats_interval(int64_t interval_us) {
+    et2_session_set_stats_interval(et2_default_session(), interval_us);
+}
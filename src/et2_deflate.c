@@ -0,0 +1,128 @@
+#include "et2_deflate.h"
+#include <stdlib.h>
+#include "esp_log.h"
+#include "sdkconfig.h"
+#include "zlib.h"
+
+static char const TAG[] = "ET2 DEFL";
+
+// Compressor state; zlib allocates (1 << (window_bits + 2)) + (1 << (mem_level + 9)) bytes on top of this.
+struct et2_deflater {
+    z_stream zs;
+};
+
+// Create a compressor; `level` is a zlib compression level from 0 to 9, or -1 for the default.
+esp_err_t et2_deflater_create(int level, et2_deflater_t** out_deflater) {
+    et2_deflater_t* deflater = calloc(1, sizeof(et2_deflater_t));
+    if (!deflater) {
+        return ESP_ERR_NO_MEM;
+    }
+    // Scale the hash table with the window, like zlib does for its default window and memory level.
+    int window_bits = CONFIG_ET2_DEFLATE_WINDOW_BITS;
+    int mem_level   = window_bits - 7;
+    int res         = deflateInit2(&deflater->zs, level, Z_DEFLATED, window_bits, mem_level, Z_DEFAULT_STRATEGY);
+    if (res != Z_OK) {
+        ESP_LOGE(TAG, "Failed to initialize deflate: %d", res);
+        free(deflater);
+        return res == Z_MEM_ERROR ? ESP_ERR_NO_MEM : ESP_ERR_INVALID_ARG;
+    }
+    *out_deflater = deflater;
+    return ESP_OK;
+}
+
+void et2_deflater_destroy(et2_deflater_t* deflater) {
+    if (deflater) {
+        deflateEnd(&deflater->zs);
+        free(deflater);
+    }
+}
+
+// Upper bound on the compressed size of `len` bytes of input.
+size_t et2_deflater_bound(et2_deflater_t* deflater, size_t len) {
+    return deflateBound(&deflater->zs, len);
+}
+
+// Set the next input; it must stay valid until it has been consumed by et2_deflater_output.
+void et2_deflater_input(et2_deflater_t* deflater, void const* data, size_t len) {
+    deflater->zs.next_in  = (Bytef*)data;
+    deflater->zs.avail_in = len;
+}
+
+// Number of input bytes consumed so far.
+size_t et2_deflater_total_in(et2_deflater_t* deflater) {
+    return deflater->zs.total_in;
+}
+
+// Compress into `out` until it is full, the input runs out or, if `finish` is set, the stream has ended.
+esp_err_t et2_deflater_output(et2_deflater_t* deflater, void* out, size_t cap, bool finish, size_t* out_len,
+                              bool* out_done) {
+    deflater->zs.next_out  = out;
+    deflater->zs.avail_out = cap;
+    *out_done              = false;
+    while (deflater->zs.avail_out) {
+        int res = deflate(&deflater->zs, finish ? Z_FINISH : Z_NO_FLUSH);
+        if (res == Z_STREAM_END) {
+            *out_done = true;
+            break;
+        } else if (res == Z_BUF_ERROR || (res == Z_OK && !deflater->zs.avail_in && !finish)) {
+            // No progress possible without more input.
+            break;
+        } else if (res != Z_OK) {
+            ESP_LOGE(TAG, "Deflate error %d", res);
+            return ESP_FAIL;
+        }
+    }
+    *out_len = cap - deflater->zs.avail_out;
+    return ESP_OK;
+}
+
+// Decompressor state; zlib allocates about 7 KiB plus the window of the stream on top of this.
+struct et2_inflater {
+    z_stream zs;
+};
+
+// Create a decompressor.
+esp_err_t et2_inflater_create(et2_inflater_t** out_inflater) {
+    et2_inflater_t* inflater = calloc(1, sizeof(et2_inflater_t));
+    if (!inflater) {
+        return ESP_ERR_NO_MEM;
+    }
+    // A window size of 0 uses the one from the zlib header, so small-window streams need only a small window here.
+    int res = inflateInit2(&inflater->zs, 0);
+    if (res != Z_OK) {
+        ESP_LOGE(TAG, "Failed to initialize inflate: %d", res);
+        free(inflater);
+        return res == Z_MEM_ERROR ? ESP_ERR_NO_MEM : ESP_ERR_INVALID_ARG;
+    }
+    *out_inflater = inflater;
+    return ESP_OK;
+}
+
+void et2_inflater_destroy(et2_inflater_t* inflater) {
+    if (inflater) {
+        inflateEnd(&inflater->zs);
+        free(inflater);
+    }
+}
+
+// Set the next input; it must stay valid until it has been consumed by et2_inflater_output.
+void et2_inflater_input(et2_inflater_t* inflater, void const* data, size_t len) {
+    inflater->zs.next_in  = (Bytef*)data;
+    inflater->zs.avail_in = len;
+}
+
+// Decompress into `out` until it is full, the input runs out or the stream has ended.
+esp_err_t et2_inflater_output(et2_inflater_t* inflater, void* out, size_t cap, size_t* out_len, bool* out_done) {
+    inflater->zs.next_out  = out;
+    inflater->zs.avail_out = cap;
+    *out_done              = false;
+    int res                = inflate(&inflater->zs, Z_NO_FLUSH);
+    if (res == Z_STREAM_END) {
+        *out_done = true;
+    } else if (res != Z_OK && res != Z_BUF_ERROR) {
+        ESP_LOGE(TAG, "Inflate error %d", res);
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+    *out_len = cap - inflater->zs.avail_out;
+    return ESP_OK;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+// Streaming zlib compressor with a memory use bounded by CONFIG_ET2_DEFLATE_WINDOW_BITS.
+typedef struct et2_deflater et2_deflater_t;
+
+esp_err_t et2_deflater_create(int level, et2_deflater_t** out_deflater);
+void      et2_deflater_destroy(et2_deflater_t* deflater);
+size_t    et2_deflater_bound(et2_deflater_t* deflater, size_t len);
+void      et2_deflater_input(et2_deflater_t* deflater, void const* data, size_t len);
+size_t    et2_deflater_total_in(et2_deflater_t* deflater);
+esp_err_t et2_deflater_output(et2_deflater_t* deflater, void* out, size_t cap, bool finish, size_t* out_len,
+                              bool* out_done);
+
+// Streaming zlib decompressor; the window size is taken from the stream header.
+typedef struct et2_inflater et2_inflater_t;
+
+esp_err_t et2_inflater_create(et2_inflater_t** out_inflater);
+void      et2_inflater_destroy(et2_inflater_t* inflater);
+void      et2_inflater_input(et2_inflater_t* inflater, void const* data, size_t len);
+esp_err_t et2_inflater_output(et2_inflater_t* inflater, void* out, size_t cap, size_t* out_len, bool* out_done);
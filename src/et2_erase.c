@@ -0,0 +1,221 @@
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_rom_md5.h"
+#include "esptoolsquared.h"
+#include "et2_erase.h"
+#include "et2_macros.h"
+
+static char const TAG[] = "ET2 ERASE";
+
+// Sectors per block
+#define ET2_BLOCK_SECTORS (ET2_FLASH_BLOCK_SIZE / ET2_FLASH_SECTOR_SIZE)
+// Minimum number of planned sectors for which erasing the whole block is faster than erasing them one by one
+#define ET2_BLOCK_ERASE_MIN_SECTORS 4
+
+// Erase commands waiting to be sent, coalesced while they are adjacent.
+typedef struct {
+    et2_session_t* session;
+    uint32_t       start;
+    uint32_t       end;
+    uint32_t       erased;
+} et2_erase_queue_t;
+
+void et2_erase_plan_init(et2_erase_plan_t* plan) {
+    plan->ranges = NULL;
+    plan->count  = 0;
+    plan->cap    = 0;
+}
+
+esp_err_t et2_erase_plan_add(et2_erase_plan_t* plan, uint32_t offset, uint32_t len) {
+    // Widen the range to whole sectors.
+    uint64_t end = ((uint64_t)offset + len + ET2_FLASH_SECTOR_SIZE - 1) / ET2_FLASH_SECTOR_SIZE * ET2_FLASH_SECTOR_SIZE;
+    if (!len) {
+        return ESP_OK;
+    } else if (end > UINT32_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (plan->count == plan->cap) {
+        size_t             cap    = plan->cap ? plan->cap * 2 : 8;
+        et2_erase_range_t* ranges = realloc(plan->ranges, cap * sizeof(et2_erase_range_t));
+        if (!ranges) {
+            return ESP_ERR_NO_MEM;
+        }
+        plan->ranges = ranges;
+        plan->cap    = cap;
+    }
+    plan->ranges[plan->count++] = (et2_erase_range_t){
+        .start = offset / ET2_FLASH_SECTOR_SIZE * ET2_FLASH_SECTOR_SIZE,
+        .end   = end,
+    };
+    return ESP_OK;
+}
+
+void et2_erase_plan_free(et2_erase_plan_t* plan) {
+    free(plan->ranges);
+    et2_erase_plan_init(plan);
+}
+
+static int et2_erase_range_cmp(void const* a, void const* b) {
+    et2_erase_range_t const* ra = a;
+    et2_erase_range_t const* rb = b;
+    return ra->start < rb->start ? -1 : ra->start > rb->start;
+}
+
+// Sort the ranges and merge those that overlap or touch.
+static void et2_erase_plan_merge(et2_erase_plan_t* plan) {
+    if (!plan->count) {
+        return;
+    }
+    qsort(plan->ranges, plan->count, sizeof(et2_erase_range_t), et2_erase_range_cmp);
+    size_t out = 0;
+    for (size_t i = 1; i < plan->count; i++) {
+        if (plan->ranges[i].start <= plan->ranges[out].end) {
+            if (plan->ranges[i].end > plan->ranges[out].end) {
+                plan->ranges[out].end = plan->ranges[i].end;
+            }
+        } else {
+            plan->ranges[++out] = plan->ranges[i];
+        }
+    }
+    plan->count = out + 1;
+}
+
+// Send the pending erase command.
+static esp_err_t et2_erase_flush(et2_erase_queue_t* queue) {
+    if (queue->end == queue->start) {
+        return ESP_OK;
+    }
+    ESP_LOGD(TAG, "Erasing 0x%08" PRIx32 "-0x%08" PRIx32, queue->start, queue->end);
+    // The stub erases the 64 KiB aligned part of the range in blocks and the rest in sectors.
+    RETURN_ON_ERR(et2_session_cmd_erase_region(queue->session, queue->start, queue->end - queue->start));
+    queue->erased += queue->end - queue->start;
+    queue->start   = queue->end;
+    return ESP_OK;
+}
+
+// Queue a range for erasing, merging it into the pending erase command if they are adjacent.
+static esp_err_t et2_erase_queue(et2_erase_queue_t* queue, uint32_t start, uint32_t end) {
+    if (start != queue->end) {
+        RETURN_ON_ERR(et2_erase_flush(queue));
+        queue->start = start;
+    }
+    queue->end = end;
+    return ESP_OK;
+}
+
+// Add `len` bytes of erased flash to an MD5 digest.
+void et2_md5_update_erased(md5_context_t* context, uint32_t len) {
+    uint8_t ones[64];
+    memset(ones, 0xff, sizeof(ones));
+    for (uint32_t pos = 0; pos < len; pos += sizeof(ones)) {
+        esp_rom_md5_update(context, ones, len - pos < sizeof(ones) ? len - pos : sizeof(ones));
+    }
+}
+
+// Check with SPI_FLASH_MD5 whether a range of flash is entirely 0xFF.
+static esp_err_t et2_erase_check(et2_session_t* session, uint32_t start, uint32_t end, bool* out_erased) {
+    uint8_t       remote[16], local[16];
+    md5_context_t context;
+    esp_rom_md5_init(&context);
+    et2_md5_update_erased(&context, end - start);
+    esp_rom_md5_final(local, &context);
+    RETURN_ON_ERR(et2_session_cmd_spi_flash_md5(session, start, end - start, remote));
+    *out_erased = memcmp(local, remote, 16) == 0;
+    return ESP_OK;
+}
+
+// Erase the planned sectors of one 64 KiB block, given as a bitmap.
+static esp_err_t et2_erase_block(et2_erase_queue_t* queue, uint32_t block, uint32_t planned, bool check) {
+    et2_session_t* session = queue->session;
+    uint32_t       full    = (1 << ET2_BLOCK_SECTORS) - 1;
+    bool           erased;
+    if (check) {
+        // One hash of the whole block usually settles it, e.g. on a blank chip.
+        RETURN_ON_ERR(et2_erase_check(session, block, block + ET2_FLASH_BLOCK_SIZE, &erased));
+        if (erased) {
+            return ESP_OK;
+        }
+    }
+    if (planned == full) {
+        return et2_erase_queue(queue, block, block + ET2_FLASH_BLOCK_SIZE);
+    }
+
+    // Walk the runs of planned and unplanned sectors in the block.
+    uint32_t runs[ET2_BLOCK_SECTORS + 1];
+    size_t   run_count = 0;
+    for (uint32_t i = 0; i <= ET2_BLOCK_SECTORS; i++) {
+        if (i == 0 || i == ET2_BLOCK_SECTORS || ((planned >> i) & 1) != ((planned >> (i - 1)) & 1)) {
+            runs[run_count++] = i;
+        }
+    }
+
+    if (check && __builtin_popcount(planned) >= ET2_BLOCK_ERASE_MIN_SECTORS) {
+        // Erase the whole block if the unplanned sectors in it are already erased.
+        bool others_erased = true;
+        for (size_t i = 0; i + 1 < run_count && others_erased; i++) {
+            if (!((planned >> runs[i]) & 1)) {
+                RETURN_ON_ERR(et2_erase_check(session, block + runs[i] * ET2_FLASH_SECTOR_SIZE,
+                                              block + runs[i + 1] * ET2_FLASH_SECTOR_SIZE, &others_erased));
+            }
+        }
+        if (others_erased) {
+            return et2_erase_queue(queue, block, block + ET2_FLASH_BLOCK_SIZE);
+        }
+    }
+
+    for (size_t i = 0; i + 1 < run_count; i++) {
+        if (!((planned >> runs[i]) & 1)) {
+            continue;
+        }
+        uint32_t start = block + runs[i] * ET2_FLASH_SECTOR_SIZE;
+        uint32_t end   = block + runs[i + 1] * ET2_FLASH_SECTOR_SIZE;
+        if (check) {
+            RETURN_ON_ERR(et2_erase_check(session, start, end, &erased));
+            if (erased) {
+                continue;
+            }
+        }
+        RETURN_ON_ERR(et2_erase_queue(queue, start, end));
+    }
+    return ESP_OK;
+}
+
+// Erase the ranges in a plan one 64 KiB block at a time.
+esp_err_t et2_session_erase_plan_run(et2_session_t* session, et2_erase_plan_t* plan, bool check,
+                                     uint32_t* out_erased) {
+    et2_erase_plan_merge(plan);
+    et2_erase_queue_t queue = {.session = session};
+
+    size_t   range = 0;
+    uint64_t pos   = 0;
+    while (range < plan->count) {
+        // Collect the sectors of the next block touched by the plan.
+        pos              = pos > plan->ranges[range].start ? pos : plan->ranges[range].start;
+        uint32_t block   = pos / ET2_FLASH_BLOCK_SIZE * ET2_FLASH_BLOCK_SIZE;
+        uint64_t next    = (uint64_t)block + ET2_FLASH_BLOCK_SIZE;
+        uint32_t planned = 0;
+        for (size_t i = range; i < plan->count && plan->ranges[i].start < next; i++) {
+            uint32_t start = plan->ranges[i].start > block ? plan->ranges[i].start : block;
+            uint32_t end   = plan->ranges[i].end < next ? plan->ranges[i].end : next;
+            for (uint32_t sector = start; sector < end; sector += ET2_FLASH_SECTOR_SIZE) {
+                planned |= 1 << ((sector - block) / ET2_FLASH_SECTOR_SIZE);
+            }
+        }
+        RETURN_ON_ERR(et2_erase_block(&queue, block, planned, check));
+
+        // Move on to the first range that reaches past this block.
+        while (range < plan->count && plan->ranges[range].end <= next) {
+            range++;
+        }
+        pos = next;
+    }
+    RETURN_ON_ERR(et2_erase_flush(&queue));
+
+    ESP_LOGI(TAG, "Erased %" PRIu32 " KiB in %zu ranges", queue.erased / 1024, plan->count);
+    if (out_erased) {
+        *out_erased = queue.erased;
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_rom_md5.h"
+
+// Add `len` bytes of erased flash to an MD5 digest.
+void et2_md5_update_erased(md5_context_t* context, uint32_t len);
@@ -0,0 +1,213 @@
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+#include <unistd.h>
+#include "esp_log.h"
+#include "et2_io.h"
+#include "et2_transport.h"
+#include "sdkconfig.h"
+#if defined(CONFIG_IDF_TARGET_LINUX) || defined(CONFIG_VFS_SUPPORT_TERMIOS)
+#include <termios.h>
+#define ET2_FD_TERMIOS 1
+#endif
+#ifdef CONFIG_IDF_TARGET_LINUX
+#include <sys/ioctl.h>
+#endif
+
+static char const TAG[] = "ET2 FD";
+
+// File descriptor transport.
+typedef struct {
+    et2_transport_t base;
+    int             rfd;
+    int             wfd;
+} et2_fd_t;
+
+// Wait until `fd` is readable or writable, or until the deadline passes.
+static esp_err_t et2_fd_wait(int fd, bool write, int64_t deadline) {
+    while (true) {
+        int64_t remaining = deadline - et2_time_us();
+        if (remaining < 0) {
+            remaining = 0;
+        }
+        struct timeval tv = {
+            .tv_sec  = remaining / 1000000,
+            .tv_usec = remaining % 1000000,
+        };
+        fd_set fds;
+        FD_ZERO(&fds);
+        FD_SET(fd, &fds);
+        int res = select(fd + 1, write ? NULL : &fds, write ? &fds : NULL, NULL, &tv);
+        if (res > 0) {
+            return ESP_OK;
+        } else if (res == 0) {
+            return ESP_ERR_TIMEOUT;
+        } else if (errno != EINTR) {
+            ESP_LOGE(TAG, "select failed: %s", strerror(errno));
+            return ESP_FAIL;
+        }
+    }
+}
+
+static esp_err_t et2_fd_write(et2_transport_t* tp, uint8_t const* data, size_t len) {
+    et2_fd_t* fd = (et2_fd_t*)tp;
+    while (len) {
+        ssize_t res = write(fd->wfd, data, len);
+        if (res < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            esp_err_t err = et2_fd_wait(fd->wfd, true, et2_time_us() + ET2_IO_TIMEOUT_US);
+            if (err != ESP_OK) {
+                return err;
+            }
+            continue;
+        } else if (res < 0 && errno == EINTR) {
+            continue;
+        } else if (res <= 0) {
+            ESP_LOGE(TAG, "Write failed: %s", strerror(errno));
+            return ESP_FAIL;
+        }
+        data += res;
+        len  -= res;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t et2_fd_read(et2_transport_t* tp, uint8_t* out_data, size_t len, size_t* out_len, int64_t deadline) {
+    et2_fd_t* fd = (et2_fd_t*)tp;
+    while (true) {
+        esp_err_t err = et2_fd_wait(fd->rfd, false, deadline);
+        if (err != ESP_OK) {
+            return err;
+        }
+        ssize_t res = read(fd->rfd, out_data, len);
+        if (res > 0) {
+            *out_len = res;
+            return ESP_OK;
+        } else if (res == 0) {
+            ESP_LOGE(TAG, "Connection closed");
+            return ESP_FAIL;
+        } else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+            ESP_LOGE(TAG, "Read failed: %s", strerror(errno));
+            return ESP_FAIL;
+        }
+    }
+}
+
+static esp_err_t et2_fd_flush(et2_transport_t* tp, int64_t deadline) {
+#ifdef ET2_FD_TERMIOS
+    et2_fd_t* fd = (et2_fd_t*)tp;
+    if (isatty(fd->wfd) && tcdrain(fd->wfd) < 0) {
+        ESP_LOGE(TAG, "tcdrain failed: %s", strerror(errno));
+        return ESP_FAIL;
+    }
+#endif
+    return ESP_OK;
+}
+
+static esp_err_t et2_fd_discard(et2_transport_t* tp) {
+    et2_fd_t* fd = (et2_fd_t*)tp;
+    uint8_t   tmp[64];
+    while (et2_fd_wait(fd->rfd, false, 0) == ESP_OK) {
+        if (read(fd->rfd, tmp, sizeof(tmp)) <= 0) {
+            break;
+        }
+    }
+    return ESP_OK;
+}
+
+#ifdef ET2_FD_TERMIOS
+static esp_err_t et2_fd_set_baudrate(et2_transport_t* tp, uint32_t baudrate) {
+    static struct {
+        uint32_t baudrate;
+        speed_t  speed;
+    } const speeds[] = {
+        {115200, B115200},
+        {230400, B230400},
+#ifdef B460800
+        {460800, B460800},
+#endif
+#ifdef B921600
+        {921600, B921600},
+#endif
+#ifdef B1500000
+        {1500000, B1500000},
+#endif
+#ifdef B2000000
+        {2000000, B2000000},
+#endif
+#ifdef B3000000
+        {3000000, B3000000},
+#endif
+    };
+
+    et2_fd_t* fd = (et2_fd_t*)tp;
+    if (!isatty(fd->wfd)) {
+        // Pipes and sockets have no baudrate.
+        return ESP_OK;
+    }
+    for (size_t i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++) {
+        if (speeds[i].baudrate != baudrate) {
+            continue;
+        }
+        struct termios tio;
+        if (tcgetattr(fd->wfd, &tio) < 0 || cfsetispeed(&tio, speeds[i].speed) < 0 ||
+            cfsetospeed(&tio, speeds[i].speed) < 0 || tcsetattr(fd->wfd, TCSADRAIN, &tio) < 0) {
+            ESP_LOGE(TAG, "Failed to set baudrate: %s", strerror(errno));
+            return ESP_FAIL;
+        }
+        return ESP_OK;
+    }
+    ESP_LOGE(TAG, "Unsupported baudrate %" PRIu32, baudrate);
+    return ESP_ERR_NOT_SUPPORTED;
+}
+#endif
+
+#ifdef TIOCMGET
+static esp_err_t et2_fd_set_lines(et2_transport_t* tp, bool dtr, bool rts) {
+    et2_fd_t* fd = (et2_fd_t*)tp;
+    int       lines;
+    if (!isatty(fd->wfd)) {
+        return ESP_ERR_NOT_SUPPORTED;
+    } else if (ioctl(fd->wfd, TIOCMGET, &lines) < 0) {
+        ESP_LOGE(TAG, "Failed to get modem lines: %s", strerror(errno));
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    lines = dtr ? lines | TIOCM_DTR : lines & ~TIOCM_DTR;
+    lines = rts ? lines | TIOCM_RTS : lines & ~TIOCM_RTS;
+    if (ioctl(fd->wfd, TIOCMSET, &lines) < 0) {
+        ESP_LOGE(TAG, "Failed to set modem lines: %s", strerror(errno));
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+#endif
+
+static void et2_fd_destroy(et2_transport_t* tp) {
+    free(tp);
+}
+
+// Create a transport on POSIX file descriptors.
+esp_err_t et2_transport_fd_create(int rfd, int wfd, et2_transport_t** out_tp) {
+    et2_fd_t* fd = calloc(1, sizeof(et2_fd_t));
+    if (!fd) {
+        return ESP_ERR_NO_MEM;
+    }
+    fd->base.write   = et2_fd_write;
+    fd->base.read    = et2_fd_read;
+    fd->base.flush   = et2_fd_flush;
+    fd->base.discard = et2_fd_discard;
+#ifdef ET2_FD_TERMIOS
+    fd->base.set_baudrate = et2_fd_set_baudrate;
+#endif
+#ifdef TIOCMGET
+    fd->base.set_lines = et2_fd_set_lines;
+#endif
+    fd->base.destroy = et2_fd_destroy;
+    fd->rfd          = rfd;
+    fd->wfd          = wfd;
+    *out_tp          = &fd->base;
+    return ESP_OK;
+}
@@ -0,0 +1,72 @@
+#include "et2_io.h"
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "et2_transport.h"
+#include "sdkconfig.h"
+#ifdef CONFIG_IDF_TARGET_LINUX
+#include <time.h>
+#include <unistd.h>
+#else
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+
+static char const TAG[] = "ET2 IO";
+
+int64_t et2_time_us(void) {
+#ifdef CONFIG_IDF_TARGET_LINUX
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#else
+    return esp_timer_get_time();
+#endif
+}
+
+void et2_transport_destroy(et2_transport_t* tp) {
+    if (tp) {
+        tp->destroy(tp);
+    }
+}
+
+esp_err_t et2_io_write(et2_transport_t* tp, uint8_t const* data, size_t len) {
+    if (len < 1) {
+        return ESP_OK;
+    }
+    return tp->write(tp, data, len);
+}
+
+// Read exactly `len` bytes.
+esp_err_t et2_io_read(et2_transport_t* tp, uint8_t* out_data, size_t len, int64_t deadline) {
+    while (len) {
+        size_t    got = 0;
+        esp_err_t res = tp->read(tp, out_data, len, &got, deadline);
+        if (res != ESP_OK) {
+            return res;
+        } else if (got > len) {
+            ESP_LOGE(TAG, "Incorrect read count; expected at most %zu, got %zu", len, got);
+            return ESP_FAIL;
+        }
+        out_data += got;
+        len      -= got;
+    }
+    return ESP_OK;
+}
+
+esp_err_t et2_io_set_baudrate(et2_transport_t* tp, uint32_t baudrate) {
+    if (!tp->set_baudrate) {
+        return ESP_OK;
+    }
+    return tp->set_baudrate(tp, baudrate);
+}
+
+// Sleep for at least `us` microseconds.
+void et2_io_delay_us(int64_t us) {
+#ifdef CONFIG_IDF_TARGET_LINUX
+    usleep(us);
+#else
+    vTaskDelay(pdMS_TO_TICKS((us + 999) / 1000));
+#endif
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "et2_transport.h"
+
+#define ET2_IO_TIMEOUT_US (2000 * 1000)
+
+esp_err_t et2_io_write(et2_transport_t* tp, uint8_t const* data, size_t len);
+esp_err_t et2_io_read(et2_transport_t* tp, uint8_t* out_data, size_t len, int64_t deadline);
+esp_err_t et2_io_set_baudrate(et2_transport_t* tp, uint32_t baudrate);
+void      et2_io_delay_us(int64_t us);
@@ -0,0 +1,322 @@
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include "esp_log.h"
+#include "esp_rom_md5.h"
+#include "esptoolsquared.h"
+#include "et2_macros.h"
+#include "et2_pipeline.h"
+#include "et2_session.h"
+
+static char const TAG[] = "ET2 JOB";
+
+#define ET2_JOB_STACK_SIZE   6144
+// Length of the READ_FLASH commands of a read job; a cancelled read still receives the rest of its current segment.
+#define ET2_JOB_READ_SEGMENT 0x40000
+
+// Job waiting in the queue or running.
+typedef struct et2_job_entry {
+    struct et2_job_entry* next;
+    et2_job_t             job;
+    uint32_t              id;
+    atomic_bool           cancelled;
+    // Bytes done so far and the time the job started.
+    uint32_t              done;
+    int64_t               start_us;
+} et2_job_entry_t;
+
+// Job queue and its worker.
+struct et2_jobs {
+    et2_session_t*   session;
+    pthread_t        thread;
+    pthread_mutex_t  mutex;
+    // Signalled when a job is queued or the worker should stop, and when the worker runs out of jobs.
+    pthread_cond_t   queued;
+    pthread_cond_t   idle;
+    // Jobs waiting to run, oldest first, and the job that is running.
+    et2_job_entry_t* head;
+    et2_job_entry_t* tail;
+    et2_job_entry_t* running;
+    uint32_t         next_id;
+    bool             stopping;
+    // Whether the last write job was compressed, which selects the finish command.
+    bool             compressed;
+};
+
+// Count bytes done by the running job, report its progress and stop it if it was cancelled.
+static esp_err_t et2_job_advance(void* cookie, uint32_t bytes) {
+    et2_job_entry_t* entry = cookie;
+    entry->done += bytes;
+    if (entry->job.on_progress) {
+        int64_t            elapsed  = et2_time_us() - entry->start_us;
+        uint32_t           rate     = elapsed > 0 ? (uint64_t)entry->done * 1000000 / elapsed : 0;
+        et2_job_progress_t progress = {
+            .id          = entry->id,
+            .done        = entry->done,
+            .total       = entry->job.len,
+            .elapsed_us  = elapsed,
+            .bytes_per_s = rate,
+            .eta_us      = rate ? (int64_t)(entry->job.len - entry->done) * 1000000 / rate : -1,
+        };
+        entry->job.on_progress(entry->job.cookie, &progress);
+    }
+    return atomic_load(&entry->cancelled) ? ESP_ERR_NOT_FINISHED : ESP_OK;
+}
+
+// Pass the data of a read job to its sink, counting it as progress.
+static esp_err_t et2_job_sink(void* cookie, uint32_t offset, uint8_t const* data, size_t len) {
+    et2_job_entry_t* entry = cookie;
+    RETURN_ON_ERR(entry->job.sink(entry->job.cookie, offset, data, len));
+    return et2_job_advance(entry, len);
+}
+
+// Write data, reporting progress after every block through the session's progress hook.
+static esp_err_t et2_job_write(et2_jobs_t* jobs, et2_job_t const* job) {
+    uint8_t   md5[16];
+    esp_err_t res    = et2_session_write_flash_level(jobs->session, job->offset, job->data, job->len, job->level,
+                                                     job->verify ? md5 : NULL);
+    jobs->compressed = job->level != 0;
+    RETURN_ON_ERR(res);
+    if (job->verify) {
+        return et2_session_verify_flash(jobs->session, job->offset, job->len, md5);
+    }
+    return ESP_OK;
+}
+
+// Read flash in segments, so a cancelled read stops early.
+static esp_err_t et2_job_read(et2_session_t* session, et2_job_entry_t* entry) {
+    et2_job_t const* job = &entry->job;
+    for (uint32_t pos = 0; pos < job->len; pos += ET2_JOB_READ_SEGMENT) {
+        uint32_t len = job->len - pos < ET2_JOB_READ_SEGMENT ? job->len - pos : ET2_JOB_READ_SEGMENT;
+        RETURN_ON_ERR(et2_session_read_flash_stream(session, job->offset + pos, len, 0, 0, et2_job_sink, entry, NULL));
+    }
+    return ESP_OK;
+}
+
+// Erase flash one 64 KiB block at a time, so a cancelled erase stops early.
+static esp_err_t et2_job_erase(et2_session_t* session, et2_job_t const* job) {
+    uint64_t end = (uint64_t)job->offset + job->len;
+    for (uint64_t pos = job->offset; pos < end;) {
+        uint64_t next = (pos / ET2_FLASH_BLOCK_SIZE + 1) * ET2_FLASH_BLOCK_SIZE;
+        next          = next < end ? next : end;
+        RETURN_ON_ERR(et2_session_cmd_erase_region(session, pos, next - pos));
+        RETURN_ON_ERR(et2_session_progress(session, next - pos));
+        pos = next;
+    }
+    return ESP_OK;
+}
+
+// Compare flash with the job's data one 64 KiB block at a time.
+static esp_err_t et2_job_verify(et2_session_t* session, et2_job_t const* job) {
+    for (uint32_t pos = 0; pos < job->len; pos += ET2_FLASH_BLOCK_SIZE) {
+        uint32_t      len = job->len - pos < ET2_FLASH_BLOCK_SIZE ? job->len - pos : ET2_FLASH_BLOCK_SIZE;
+        uint8_t       md5[16];
+        md5_context_t context;
+        esp_rom_md5_init(&context);
+        esp_rom_md5_update(&context, job->data + pos, len);
+        esp_rom_md5_final(md5, &context);
+        RETURN_ON_ERR(et2_session_verify_flash(session, job->offset + pos, len, md5));
+        RETURN_ON_ERR(et2_session_progress(session, len));
+    }
+    return ESP_OK;
+}
+
+// Run one job with the session's progress hook pointing at it.
+static esp_err_t et2_job_run(et2_jobs_t* jobs, et2_job_entry_t* entry) {
+    et2_session_t* session   = jobs->session;
+    entry->start_us          = et2_time_us();
+    session->progress.func   = et2_job_advance;
+    session->progress.cookie = entry;
+    esp_err_t res            = ESP_OK;
+    switch (entry->job.kind) {
+        case ET2_JOB_WRITE:
+            res = et2_job_write(jobs, &entry->job);
+            break;
+        case ET2_JOB_READ:
+            res = et2_job_read(session, entry);
+            break;
+        case ET2_JOB_ERASE:
+            res = et2_job_erase(session, &entry->job);
+            break;
+        case ET2_JOB_VERIFY:
+            res = et2_job_verify(session, &entry->job);
+            break;
+        case ET2_JOB_FINISH:
+            if (jobs->compressed) {
+                res = et2_session_cmd_deflate_finish(session, entry->job.reboot);
+            } else {
+                res = et2_session_cmd_flash_finish(session, entry->job.reboot);
+            }
+            break;
+    }
+    session->progress.func   = NULL;
+    session->progress.cookie = NULL;
+    return res;
+}
+
+// Worker: run queued jobs until the queue is destroyed, then complete the remaining ones as cancelled.
+static void* et2_jobs_worker(void* arg) {
+    et2_jobs_t* jobs = arg;
+    pthread_mutex_lock(&jobs->mutex);
+    while (true) {
+        while (!jobs->head && !jobs->stopping) {
+            pthread_cond_wait(&jobs->queued, &jobs->mutex);
+        }
+        et2_job_entry_t* entry = jobs->head;
+        if (!entry) {
+            break;
+        }
+        jobs->head = entry->next;
+        if (!jobs->head) {
+            jobs->tail = NULL;
+        }
+        jobs->running = entry;
+        pthread_mutex_unlock(&jobs->mutex);
+
+        // The next job starts as soon as this one is acknowledged, so the link never waits on the caller.
+        esp_err_t res = ESP_ERR_NOT_FINISHED;
+        if (!atomic_load(&entry->cancelled)) {
+            res = et2_job_run(jobs, entry);
+        }
+        if (res == ESP_OK) {
+            ESP_LOGI(TAG, "Job %" PRIu32 " done in %" PRId64 " us", entry->id, et2_time_us() - entry->start_us);
+        } else if (res == ESP_ERR_NOT_FINISHED) {
+            ESP_LOGW(TAG, "Job %" PRIu32 " cancelled after %" PRIu32 " bytes", entry->id, entry->done);
+        } else {
+            ESP_LOGE(TAG, "Job %" PRIu32 " failed: %s", entry->id, esp_err_to_name(res));
+        }
+        if (entry->job.on_done) {
+            entry->job.on_done(entry->job.cookie, entry->id, res);
+        }
+
+        pthread_mutex_lock(&jobs->mutex);
+        jobs->running = NULL;
+        free(entry);
+        if (!jobs->head) {
+            pthread_cond_broadcast(&jobs->idle);
+        }
+    }
+    pthread_mutex_unlock(&jobs->mutex);
+    return NULL;
+}
+
+// Start a worker that runs jobs on a session.
+esp_err_t et2_session_jobs_create(et2_session_t* session, int core, et2_jobs_t** out_jobs) {
+    et2_jobs_t* jobs = calloc(1, sizeof(et2_jobs_t));
+    if (!jobs) {
+        return ESP_ERR_NO_MEM;
+    }
+    jobs->session = session;
+    pthread_mutex_init(&jobs->mutex, NULL);
+    pthread_cond_init(&jobs->queued, NULL);
+    pthread_cond_init(&jobs->idle, NULL);
+    esp_err_t res = et2_thread_start(&jobs->thread, "et2_jobs", core, ET2_JOB_STACK_SIZE, et2_jobs_worker, jobs);
+    if (res != ESP_OK) {
+        pthread_cond_destroy(&jobs->idle);
+        pthread_cond_destroy(&jobs->queued);
+        pthread_mutex_destroy(&jobs->mutex);
+        free(jobs);
+        return res;
+    }
+    *out_jobs = jobs;
+    return ESP_OK;
+}
+
+// Cancel all jobs, stop the worker and free the queue.
+void et2_jobs_destroy(et2_jobs_t* jobs) {
+    if (!jobs) {
+        return;
+    }
+    pthread_mutex_lock(&jobs->mutex);
+    jobs->stopping = true;
+    for (et2_job_entry_t* entry = jobs->head; entry; entry = entry->next) {
+        atomic_store(&entry->cancelled, true);
+    }
+    if (jobs->running) {
+        atomic_store(&jobs->running->cancelled, true);
+    }
+    pthread_cond_signal(&jobs->queued);
+    pthread_mutex_unlock(&jobs->mutex);
+
+    pthread_join(jobs->thread, NULL);
+    pthread_cond_destroy(&jobs->idle);
+    pthread_cond_destroy(&jobs->queued);
+    pthread_mutex_destroy(&jobs->mutex);
+    free(jobs);
+}
+
+// Check a job before it is queued, so it does not fail halfway through the queue for a bad argument.
+static esp_err_t et2_job_check(et2_job_t const* job) {
+    if ((uint64_t)job->offset + job->len > UINT32_MAX + 1ull) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    switch (job->kind) {
+        case ET2_JOB_WRITE:
+        case ET2_JOB_VERIFY:
+            return job->data || !job->len ? ESP_OK : ESP_ERR_INVALID_ARG;
+        case ET2_JOB_READ:
+            return job->sink ? ESP_OK : ESP_ERR_INVALID_ARG;
+        case ET2_JOB_ERASE:
+            // ERASE_REGION only takes whole sectors.
+            return job->offset % ET2_FLASH_SECTOR_SIZE || job->len % ET2_FLASH_SECTOR_SIZE ? ESP_ERR_INVALID_ARG
+                                                                                            : ESP_OK;
+        case ET2_JOB_FINISH:
+            return ESP_OK;
+    }
+    return ESP_ERR_INVALID_ARG;
+}
+
+// Add a job to the end of the queue.
+esp_err_t et2_jobs_submit(et2_jobs_t* jobs, et2_job_t const* job, uint32_t* out_id) {
+    RETURN_ON_ERR(et2_job_check(job));
+    et2_job_entry_t* entry = calloc(1, sizeof(et2_job_entry_t));
+    if (!entry) {
+        return ESP_ERR_NO_MEM;
+    }
+    entry->job = *job;
+    atomic_init(&entry->cancelled, false);
+
+    // The entry belongs to the worker once it is queued, so the ID is copied out while the queue is locked.
+    pthread_mutex_lock(&jobs->mutex);
+    entry->id = ++jobs->next_id;
+    if (out_id) {
+        *out_id = entry->id;
+    }
+    if (jobs->tail) {
+        jobs->tail->next = entry;
+    } else {
+        jobs->head = entry;
+    }
+    jobs->tail = entry;
+    pthread_cond_signal(&jobs->queued);
+    pthread_mutex_unlock(&jobs->mutex);
+    return ESP_OK;
+}
+
+// Cancel a queued or running job.
+esp_err_t et2_jobs_cancel(et2_jobs_t* jobs, uint32_t id) {
+    esp_err_t res = ESP_ERR_NOT_FOUND;
+    pthread_mutex_lock(&jobs->mutex);
+    if (jobs->running && jobs->running->id == id) {
+        atomic_store(&jobs->running->cancelled, true);
+        res = ESP_OK;
+    }
+    for (et2_job_entry_t* entry = jobs->head; entry && res != ESP_OK; entry = entry->next) {
+        if (entry->id == id) {
+            atomic_store(&entry->cancelled, true);
+            res = ESP_OK;
+        }
+    }
+    pthread_mutex_unlock(&jobs->mutex);
+    return res;
+}
+
+// Wait until every queued job is done.
+void et2_jobs_wait_idle(et2_jobs_t* jobs) {
+    pthread_mutex_lock(&jobs->mutex);
+    while (jobs->head || jobs->running) {
+        pthread_cond_wait(&jobs->idle, &jobs->mutex);
+    }
+    pthread_mutex_unlock(&jobs->mutex);
+}
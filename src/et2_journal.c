@@ -0,0 +1,178 @@
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "esp_log.h"
+#include "et2_journal.h"
+#include "sdkconfig.h"
+#ifndef CONFIG_IDF_TARGET_LINUX
+#include "nvs.h"
+#endif
+
+static char const TAG[] = "ET2 JOURNAL";
+
+// Journal in a file.
+typedef struct {
+    et2_journal_t base;
+    char*         path;
+    // Path the record is written to before it is renamed over `path`.
+    char*         tmp_path;
+} et2_journal_file_t;
+
+static esp_err_t et2_journal_file_load(et2_journal_t* journal, void* data, size_t cap, size_t* out_len) {
+    et2_journal_file_t* file = (et2_journal_file_t*)journal;
+    FILE*               fd   = fopen(file->path, "rb");
+    if (!fd) {
+        return errno == ENOENT ? ESP_ERR_NOT_FOUND : ESP_FAIL;
+    }
+    size_t len      = fread(data, 1, cap, fd);
+    bool   too_long = len == cap && fgetc(fd) != EOF;
+    bool   failed   = ferror(fd);
+    fclose(fd);
+    if (failed) {
+        return ESP_FAIL;
+    } else if (too_long) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    *out_len = len;
+    return ESP_OK;
+}
+
+static esp_err_t et2_journal_file_save(et2_journal_t* journal, void const* data, size_t len) {
+    et2_journal_file_t* file = (et2_journal_file_t*)journal;
+    FILE*               fd   = fopen(file->tmp_path, "wb");
+    if (!fd) {
+        ESP_LOGE(TAG, "Failed to create %s", file->tmp_path);
+        return ESP_FAIL;
+    }
+    // Make sure the new record is on disk before it replaces the old one.
+    bool ok = fwrite(data, 1, len, fd) == len && fflush(fd) == 0 && fsync(fileno(fd)) == 0;
+    ok      = fclose(fd) == 0 && ok;
+    if (!ok || rename(file->tmp_path, file->path)) {
+        ESP_LOGE(TAG, "Failed to write %s", file->path);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t et2_journal_file_clear(et2_journal_t* journal) {
+    et2_journal_file_t* file = (et2_journal_file_t*)journal;
+    if (remove(file->path) && errno != ENOENT) {
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static void et2_journal_file_destroy(et2_journal_t* journal) {
+    et2_journal_file_t* file = (et2_journal_file_t*)journal;
+    free(file->path);
+    free(file->tmp_path);
+    free(file);
+}
+
+// Create a journal stored in a file.
+esp_err_t et2_journal_file_create(char const* path, et2_journal_t** out_journal) {
+    et2_journal_file_t* file = calloc(1, sizeof(et2_journal_file_t));
+    if (!file) {
+        return ESP_ERR_NO_MEM;
+    }
+    file->path     = strdup(path);
+    file->tmp_path = malloc(strlen(path) + sizeof(".tmp"));
+    if (!file->path || !file->tmp_path) {
+        et2_journal_file_destroy(&file->base);
+        return ESP_ERR_NO_MEM;
+    }
+    strcpy(file->tmp_path, path);
+    strcat(file->tmp_path, ".tmp");
+    file->base.load    = et2_journal_file_load;
+    file->base.save    = et2_journal_file_save;
+    file->base.clear   = et2_journal_file_clear;
+    file->base.destroy = et2_journal_file_destroy;
+    *out_journal       = &file->base;
+    return ESP_OK;
+}
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+// Journal in an NVS blob.
+typedef struct {
+    et2_journal_t base;
+    nvs_handle_t  handle;
+    char          key[NVS_KEY_NAME_MAX_SIZE];
+} et2_journal_nvs_t;
+
+static esp_err_t et2_journal_nvs_load(et2_journal_t* journal, void* data, size_t cap, size_t* out_len) {
+    et2_journal_nvs_t* nvs = (et2_journal_nvs_t*)journal;
+    size_t             len = cap;
+    esp_err_t          res = nvs_get_blob(nvs->handle, nvs->key, data, &len);
+    if (res == ESP_ERR_NVS_NOT_FOUND) {
+        return ESP_ERR_NOT_FOUND;
+    } else if (res == ESP_ERR_NVS_INVALID_LENGTH) {
+        return ESP_ERR_INVALID_SIZE;
+    } else if (res != ESP_OK) {
+        return res;
+    }
+    *out_len = len;
+    return ESP_OK;
+}
+
+static esp_err_t et2_journal_nvs_save(et2_journal_t* journal, void const* data, size_t len) {
+    et2_journal_nvs_t* nvs = (et2_journal_nvs_t*)journal;
+    esp_err_t          res = nvs_set_blob(nvs->handle, nvs->key, data, len);
+    if (res == ESP_OK) {
+        res = nvs_commit(nvs->handle);
+    }
+    if (res != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to write NVS key %s: %s", nvs->key, esp_err_to_name(res));
+    }
+    return res;
+}
+
+static esp_err_t et2_journal_nvs_clear(et2_journal_t* journal) {
+    et2_journal_nvs_t* nvs = (et2_journal_nvs_t*)journal;
+    esp_err_t          res = nvs_erase_key(nvs->handle, nvs->key);
+    if (res == ESP_ERR_NVS_NOT_FOUND) {
+        return ESP_OK;
+    } else if (res != ESP_OK) {
+        return res;
+    }
+    return nvs_commit(nvs->handle);
+}
+
+static void et2_journal_nvs_destroy(et2_journal_t* journal) {
+    et2_journal_nvs_t* nvs = (et2_journal_nvs_t*)journal;
+    nvs_close(nvs->handle);
+    free(nvs);
+}
+
+// Create a journal stored as an NVS blob.
+esp_err_t et2_journal_nvs_create(char const* namespace_name, char const* key, et2_journal_t** out_journal) {
+    if (strlen(key) >= NVS_KEY_NAME_MAX_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    et2_journal_nvs_t* nvs = calloc(1, sizeof(et2_journal_nvs_t));
+    if (!nvs) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t res = nvs_open(namespace_name, NVS_READWRITE, &nvs->handle);
+    if (res != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open NVS namespace %s: %s", namespace_name, esp_err_to_name(res));
+        free(nvs);
+        return res;
+    }
+    strcpy(nvs->key, key);
+    nvs->base.load    = et2_journal_nvs_load;
+    nvs->base.save    = et2_journal_nvs_save;
+    nvs->base.clear   = et2_journal_nvs_clear;
+    nvs->base.destroy = et2_journal_nvs_destroy;
+    *out_journal      = &nvs->base;
+    return ESP_OK;
+}
+#endif
+
+void et2_journal_destroy(et2_journal_t* journal) {
+    if (journal) {
+        journal->destroy(journal);
+    }
+}
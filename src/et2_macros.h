@@ -9,21 +9,19 @@
         }                     \
     } while (0)
 
-#define LEN_CHECK_MIN(resp, resp_len, exp_len, ...)                                                                 \
+#define LEN_CHECK_MIN(resp_len, exp_len, ...)                                                                       \
     do {                                                                                                            \
         if ((resp_len) < (exp_len)) {                                                                               \
             ESP_LOGE(TAG, "Invalid response length; expected %zu, got %zu", (size_t)(exp_len), (size_t)(resp_len)); \
-            free((resp));                                                                                           \
             __VA_ARGS__;                                                                                            \
             return ESP_ERR_INVALID_RESPONSE;                                                                        \
         }                                                                                                           \
     } while (0)
 
-#define LEN_CHECK(resp, resp_len, exp_len, ...)                                                                     \
+#define LEN_CHECK(resp_len, exp_len, ...)                                                                           \
     do {                                                                                                            \
         if ((resp_len) != (exp_len)) {                                                                              \
             ESP_LOGE(TAG, "Invalid response length; expected %zu, got %zu", (size_t)(exp_len), (size_t)(resp_len)); \
-            free((resp));                                                                                           \
             __VA_ARGS__;                                                                                            \
             return ESP_ERR_INVALID_RESPONSE;                                                                        \
         }                                                                                                           \
@@ -0,0 +1,166 @@
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_check.h"
+#include "esp_log.h"
+#include "esptoolsquared.h"
+#include "et2_macros.h"
+#include "et2_session.h"
+#include "et2_sparse.h"
+#include "sdkconfig.h"
+#ifndef CONFIG_IDF_TARGET_LINUX
+#include "esp_image_format.h"
+#endif
+
+static char const TAG[] = "ET2 MANIFEST";
+
+// Work out the number of bytes a region writes.
+static esp_err_t et2_region_len(et2_region_t const* region, uint32_t* out_len) {
+    if ((region->flags & ET2_REGION_SKIP_EMPTY) && region->offset % ET2_FLASH_SECTOR_SIZE) {
+        ESP_LOGE(TAG, "Region at 0x%08" PRIx32 " skips empty sectors but is not sector-aligned", region->offset);
+        return ESP_ERR_INVALID_ARG;
+    }
+#ifndef CONFIG_IDF_TARGET_LINUX
+    if (region->part) {
+        uint32_t len = region->len;
+        if (region->flags & ET2_REGION_VALIDATE_APP) {
+            esp_partition_pos_t  pos  = {.offset = region->part->address, .size = region->part->size};
+            esp_image_metadata_t meta = {0};
+            ESP_RETURN_ON_ERROR(esp_image_verify(ESP_IMAGE_VERIFY_SILENT, &pos, &meta), TAG,
+                                "No valid app image in partition %s", region->part->label);
+            len = len ? len : meta.image_len;
+        }
+        len = len ? len : region->part->size;
+        if (len > region->part->size) {
+            ESP_LOGE(TAG, "Region at 0x%08" PRIx32 " is larger than partition %s", region->offset, region->part->label);
+            return ESP_ERR_INVALID_SIZE;
+        }
+        *out_len = len;
+        return ESP_OK;
+    }
+#endif
+    if (!region->data && region->len) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *out_len = region->len;
+    return ESP_OK;
+}
+
+// Write one region, erasing the sectors it covers as part of its begin command.
+static esp_err_t et2_region_write(et2_session_t* session, et2_region_t const* region, uint32_t len,
+                                  et2_erase_plan_t* plan, uint8_t out_md5[16]) {
+    et2_mem_source_t mem;
+    et2_source_t*    src = &mem.base;
+    et2_mem_source_init(&mem, region->data);
+#ifndef CONFIG_IDF_TARGET_LINUX
+    // The compressor and the empty sector scan read a partition one mapped window at a time.
+    et2_part_source_t part;
+    if (region->part) {
+        et2_part_source_init(&part, region->part);
+        src = &part.base;
+    }
+#endif
+
+    esp_err_t res;
+    int       level = region->flags & ET2_REGION_COMPRESS ? -1 : 0;
+    if (region->flags & ET2_REGION_SKIP_EMPTY) {
+        res = et2_sparse_write(session, region->offset, src, len, level, plan, out_md5);
+    } else {
+        res = et2_session_write_flash_source(session, region->offset, src, 0, len, level, out_md5);
+    }
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+    if (region->part) {
+        et2_part_source_deinit(&part);
+    }
+#endif
+    return res;
+}
+
+// Write several regions in one stub session and finish with one end command.
+esp_err_t et2_session_write_flash_manifest(et2_session_t* session, et2_region_t const* regions, size_t count,
+                                           bool reboot) {
+    // Plan the non-empty regions in flash order, resolving their sizes first.
+    size_t*   order        = malloc(count * sizeof(size_t));
+    uint32_t* lens         = malloc(count * sizeof(uint32_t));
+    uint8_t (*digests)[16] = malloc(count * 16);
+    // An empty manifest may get NULL from malloc(0), which is not a failure.
+    esp_err_t res          = !count || (order && lens && digests) ? ESP_OK : ESP_ERR_NO_MEM;
+    size_t    active       = 0;
+    for (size_t i = 0; i < count && res == ESP_OK; i++) {
+        res = et2_region_len(&regions[i], &lens[i]);
+        if (res != ESP_OK || !lens[i]) {
+            continue;
+        }
+        // Insertion sort by offset; manifests are short.
+        size_t j = active++;
+        while (j > 0 && regions[order[j - 1]].offset > regions[i].offset) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    // The begin command of each region erases whole sectors, so regions must not even share a sector.
+    uint32_t erase_total = 0;
+    for (size_t i = 0; i < active && res == ESP_OK; i++) {
+        et2_region_t const* region      = &regions[order[i]];
+        uint64_t            end         = (uint64_t)region->offset + lens[order[i]];
+        uint64_t            sectors_end = (end + ET2_FLASH_SECTOR_SIZE - 1) / ET2_FLASH_SECTOR_SIZE;
+        if (i + 1 < active) {
+            et2_region_t const* next = &regions[order[i + 1]];
+            if (end > next->offset) {
+                ESP_LOGE(TAG, "Regions at 0x%08" PRIx32 " and 0x%08" PRIx32 " overlap", region->offset,
+                         next->offset);
+                res = ESP_ERR_INVALID_ARG;
+            } else if (sectors_end > next->offset / ET2_FLASH_SECTOR_SIZE) {
+                ESP_LOGE(TAG, "Regions at 0x%08" PRIx32 " and 0x%08" PRIx32 " share a flash sector", region->offset,
+                         next->offset);
+                res = ESP_ERR_INVALID_ARG;
+            }
+        }
+        erase_total += sectors_end * ET2_FLASH_SECTOR_SIZE -
+                       region->offset / ET2_FLASH_SECTOR_SIZE * ET2_FLASH_SECTOR_SIZE;
+    }
+    if (res == ESP_OK) {
+        ESP_LOGI(TAG, "Writing %zu regions, erasing %" PRIu32 " KiB", active, erase_total / 1024);
+    }
+
+    // Stream the regions back to back; the stub needs no end command between them.
+    // The empty sectors of all regions are collected and erased together afterwards.
+    // Regions to verify are hashed while they are sent and checked against SPI_FLASH_MD5 at the end.
+    et2_erase_plan_t plan;
+    et2_erase_plan_init(&plan);
+    bool compressed = false;
+    for (size_t i = 0; i < active && res == ESP_OK; i++) {
+        et2_region_t const* region = &regions[order[i]];
+        ESP_LOGI(TAG, "Writing 0x%" PRIx32 " bytes at 0x%08" PRIx32 "%s", lens[order[i]], region->offset,
+                 region->flags & ET2_REGION_COMPRESS ? " compressed" : "");
+        uint8_t* md5 = region->flags & ET2_REGION_VERIFY ? digests[order[i]] : NULL;
+        res          = et2_region_write(session, region, lens[order[i]], &plan, md5);
+        compressed   = region->flags & ET2_REGION_COMPRESS;
+    }
+    if (res == ESP_OK) {
+        res = et2_session_erase_plan_run(session, &plan, true, NULL);
+    }
+    for (size_t i = 0; i < active && res == ESP_OK; i++) {
+        et2_region_t const* region = &regions[order[i]];
+        if (region->flags & ET2_REGION_VERIFY) {
+            res = et2_session_verify_flash(session, region->offset, lens[order[i]], digests[order[i]]);
+        }
+    }
+    et2_erase_plan_free(&plan);
+    free(order);
+    free(lens);
+    free(digests);
+    RETURN_ON_ERR(res);
+
+    // One end command matching the last region, which also reboots the target if requested.
+    if (!active) {
+        RETURN_ON_ERR(et2_session_write_flash_empty(session, 0, 0));
+    }
+    if (compressed) {
+        return et2_session_cmd_deflate_finish(session, reboot);
+    }
+    return et2_session_cmd_flash_finish(session, reboot);
+}
@@ -0,0 +1,304 @@
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_rom_md5.h"
+#include "esptoolsquared.h"
+#include "et2_deflate.h"
+#include "et2_macros.h"
+#include "et2_pipeline.h"
+#include "sdkconfig.h"
+#ifndef CONFIG_IDF_TARGET_LINUX
+#include "esp_pthread.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+
+static char const TAG[] = "ET2 PIPE";
+
+#define ET2_PIPELINE_STACK_SIZE 4096
+
+// One compressed block in the ring.
+typedef struct {
+    uint8_t* data;
+    size_t   len;
+} et2_pipe_slot_t;
+
+// Pipeline state shared by the two workers.
+// The compress worker only writes `head` and the transmit worker only writes `tail`, so the ring needs no lock.
+// A worker that has to wait for the other one sleeps on `changed`, which is signalled after every update.
+typedef struct {
+    et2_pipe_slot_t* slots;
+    uint32_t         slot_count;
+    atomic_uint      head;
+    atomic_uint      tail;
+    // Set by the compress worker once the last block is in the ring.
+    atomic_bool      finished;
+    // Set by either worker when it fails, so the other one stops as well.
+    atomic_bool      aborted;
+    pthread_mutex_t  lock;
+    pthread_cond_t   changed;
+
+    et2_session_t*  session;
+    et2_deflater_t* deflater;
+    uint8_t const*  data;
+    uint32_t        len;
+    // MD5 of the input, updated by the compress worker if requested.
+    md5_context_t*  md5;
+
+    esp_err_t            compress_res;
+    esp_err_t            transmit_res;
+    et2_pipeline_stats_t stats;
+} et2_pipe_t;
+
+// Wake the other worker after changing the ring or the flags.
+static void et2_pipe_notify(et2_pipe_t* pipe) {
+    // Taking the lock orders this after the waiter's check, so the wakeup cannot be missed.
+    pthread_mutex_lock(&pipe->lock);
+    pthread_cond_signal(&pipe->changed);
+    pthread_mutex_unlock(&pipe->lock);
+}
+
+// Stop both workers.
+static void et2_pipe_abort(et2_pipe_t* pipe) {
+    atomic_store(&pipe->aborted, true);
+    et2_pipe_notify(pipe);
+}
+
+// Sleep until the ring has a free slot or the pipeline is aborted.
+static void et2_pipe_wait_free(et2_pipe_t* pipe, unsigned head) {
+    pthread_mutex_lock(&pipe->lock);
+    while (head - atomic_load_explicit(&pipe->tail, memory_order_acquire) >= pipe->slot_count &&
+           !atomic_load(&pipe->aborted)) {
+        pthread_cond_wait(&pipe->changed, &pipe->lock);
+    }
+    pthread_mutex_unlock(&pipe->lock);
+}
+
+// Sleep until the ring has a ready block, the last block was compressed or the pipeline is aborted.
+static void et2_pipe_wait_ready(et2_pipe_t* pipe, unsigned tail) {
+    pthread_mutex_lock(&pipe->lock);
+    while (tail == atomic_load_explicit(&pipe->head, memory_order_acquire) &&
+           !atomic_load_explicit(&pipe->finished, memory_order_acquire) && !atomic_load(&pipe->aborted)) {
+        pthread_cond_wait(&pipe->changed, &pipe->lock);
+    }
+    pthread_mutex_unlock(&pipe->lock);
+}
+
+// Compress worker: fill free slots with compressed blocks.
+static void* et2_pipe_compress(void* arg) {
+    et2_pipe_t* pipe  = arg;
+    int64_t     start = et2_time_us();
+    esp_err_t   res   = ESP_OK;
+
+    et2_deflater_input(pipe->deflater, pipe->data, pipe->len);
+    size_t hashed = 0;
+    bool   done   = false;
+    while (!done) {
+        // Wait for a free slot.
+        unsigned head = atomic_load_explicit(&pipe->head, memory_order_relaxed);
+        if (head - atomic_load_explicit(&pipe->tail, memory_order_acquire) >= pipe->slot_count) {
+            int64_t stall = et2_time_us();
+            et2_pipe_wait_free(pipe, head);
+            pipe->stats.compress_stall_us += et2_time_us() - stall;
+        }
+        if (atomic_load(&pipe->aborted)) {
+            break;
+        }
+
+        et2_pipe_slot_t* slot = &pipe->slots[head % pipe->slot_count];
+        res = et2_deflater_output(pipe->deflater, slot->data, ET2_FLASH_WRITE_SIZE, true, &slot->len, &done);
+        if (res != ESP_OK) {
+            et2_pipe_abort(pipe);
+            break;
+        }
+        pipe->stats.compressed_bytes += slot->len;
+        if (pipe->md5) {
+            size_t consumed = et2_deflater_total_in(pipe->deflater);
+            esp_rom_md5_update(pipe->md5, pipe->data + hashed, consumed - hashed);
+            hashed = consumed;
+        }
+        if (slot->len) {
+            atomic_store_explicit(&pipe->head, head + 1, memory_order_release);
+            et2_pipe_notify(pipe);
+        }
+    }
+    atomic_store_explicit(&pipe->finished, true, memory_order_release);
+    et2_pipe_notify(pipe);
+
+    pipe->stats.compress_us = et2_time_us() - start;
+    pipe->compress_res      = res;
+    return NULL;
+}
+
+// Transmit worker: send ready blocks as DEFL_DATA.
+static void* et2_pipe_transmit(void* arg) {
+    et2_pipe_t* pipe  = arg;
+    int64_t     start = et2_time_us();
+    esp_err_t   res   = ESP_OK;
+
+    et2_flash_writer_t writer;
+    et2_session_flash_writer_init(pipe->session, &writer, ET2_CMD_DEFL_DATA, 0);
+    while (true) {
+        // Wait for a ready block; read `finished` before `head` so the last block is not missed.
+        unsigned tail     = atomic_load_explicit(&pipe->tail, memory_order_relaxed);
+        bool     finished = atomic_load_explicit(&pipe->finished, memory_order_acquire);
+        if (tail == atomic_load_explicit(&pipe->head, memory_order_acquire)) {
+            if (finished || atomic_load(&pipe->aborted)) {
+                break;
+            }
+            int64_t stall = et2_time_us();
+            et2_pipe_wait_ready(pipe, tail);
+            pipe->stats.transmit_stall_us += et2_time_us() - stall;
+            continue;
+        }
+
+        et2_pipe_slot_t* slot = &pipe->slots[tail % pipe->slot_count];
+        res = et2_flash_writer_write(&writer, slot->data, slot->len);
+        if (res != ESP_OK) {
+            et2_pipe_abort(pipe);
+            break;
+        }
+        pipe->stats.blocks++;
+        atomic_store_explicit(&pipe->tail, tail + 1, memory_order_release);
+        et2_pipe_notify(pipe);
+    }
+    if (res == ESP_OK) {
+        // Collect the acks of the blocks in flight even if the compress worker failed, so they are not left on the
+        // link for the next command.
+        esp_err_t wait_res = et2_flash_writer_wait(&writer);
+        if (!atomic_load(&pipe->aborted)) {
+            res = wait_res;
+        }
+    }
+
+    pipe->stats.transmit_us = et2_time_us() - start;
+    pipe->transmit_res      = res;
+    return NULL;
+}
+
+// Start a thread, pinned to a core if `core` is not -1.
+esp_err_t et2_thread_start(pthread_t* thread, char const* name, int core, size_t stack_size, void* (*func)(void*),
+                           void* arg) {
+#ifdef CONFIG_IDF_TARGET_LINUX
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+#ifdef __linux__
+    if (core >= 0) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(core, &cpus);
+        pthread_attr_setaffinity_np(&attr, sizeof(cpus), &cpus);
+    }
+#endif
+    int res = pthread_create(thread, &attr, func, arg);
+    pthread_attr_destroy(&attr);
+#else
+    esp_pthread_cfg_t cfg = esp_pthread_get_default_config();
+    cfg.thread_name       = name;
+    cfg.stack_size        = stack_size;
+    cfg.pin_to_core       = core < 0 ? tskNO_AFFINITY : core;
+    esp_pthread_set_cfg(&cfg);
+    int res = pthread_create(thread, NULL, func, arg);
+    // The configuration only applies to threads created by this one, so restore the defaults right away.
+    cfg = esp_pthread_get_default_config();
+    esp_pthread_set_cfg(&cfg);
+#endif
+    if (res) {
+        ESP_LOGE(TAG, "Failed to start %s thread", name);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+// Run the compress and transmit workers on a prepared pipeline.
+static esp_err_t et2_pipe_run(et2_pipe_t* pipe, uint32_t offset, et2_pipeline_config_t const* config) {
+    // The compressed size is not known up front; the target only uses it as an upper limit.
+    RETURN_ON_ERR(et2_session_cmd_deflate_begin(pipe->session, pipe->len, et2_deflater_bound(pipe->deflater, pipe->len),
+                                                offset));
+
+    pthread_t compress, transmit;
+    RETURN_ON_ERR(et2_thread_start(&compress, "et2_compress", config->compress_core, ET2_PIPELINE_STACK_SIZE,
+                                   et2_pipe_compress, pipe));
+    esp_err_t res = et2_thread_start(&transmit, "et2_transmit", config->transmit_core, ET2_PIPELINE_STACK_SIZE,
+                                     et2_pipe_transmit, pipe);
+    if (res != ESP_OK) {
+        et2_pipe_abort(pipe);
+        pthread_join(compress, NULL);
+        return res;
+    }
+    pthread_join(compress, NULL);
+    pthread_join(transmit, NULL);
+
+    RETURN_ON_ERR(pipe->compress_res);
+    return pipe->transmit_res;
+}
+
+// Compress and write data to flash with compression and transmission running in parallel.
+esp_err_t et2_session_write_flash_pipelined(et2_session_t* session, uint32_t offset, const uint8_t* data, uint32_t len,
+                                            et2_pipeline_config_t const* config, et2_pipeline_stats_t* out_stats,
+                                            uint8_t out_md5[16]) {
+    et2_pipeline_config_t const defaults = ET2_PIPELINE_CONFIG_DEFAULT();
+    if (!config) {
+        config = &defaults;
+    }
+
+    md5_context_t md5;
+    esp_rom_md5_init(&md5);
+    et2_pipe_t pipe = {
+        .slot_count = config->ring_blocks ? config->ring_blocks : defaults.ring_blocks,
+        .session    = session,
+        .data       = data,
+        .len        = len,
+        .md5        = out_md5 ? &md5 : NULL,
+    };
+    pipe.slots = calloc(pipe.slot_count, sizeof(et2_pipe_slot_t));
+    if (!pipe.slots) {
+        return ESP_ERR_NO_MEM;
+    }
+    pthread_mutex_init(&pipe.lock, NULL);
+    pthread_cond_init(&pipe.changed, NULL);
+    esp_err_t res = ESP_OK;
+    for (uint32_t i = 0; i < pipe.slot_count && res == ESP_OK; i++) {
+        pipe.slots[i].data = malloc(ET2_FLASH_WRITE_SIZE);
+        if (!pipe.slots[i].data) {
+            res = ESP_ERR_NO_MEM;
+        }
+    }
+    if (res == ESP_OK) {
+        res = et2_deflater_create(config->level, &pipe.deflater);
+    }
+    if (res == ESP_OK) {
+        res = et2_pipe_run(&pipe, offset, config);
+    }
+
+    if (res == ESP_OK) {
+        ESP_LOGI(TAG,
+                 "Wrote %" PRIu32 " bytes as %zu compressed bytes; compress %" PRId64 " us (stalled %" PRId64
+                 " us), transmit %" PRId64 " us (stalled %" PRId64 " us)",
+                 len, pipe.stats.compressed_bytes, pipe.stats.compress_us, pipe.stats.compress_stall_us,
+                 pipe.stats.transmit_us, pipe.stats.transmit_stall_us);
+    } else {
+        ESP_LOGE(TAG, "Failed to write compressed data to flash");
+    }
+    if (out_stats) {
+        *out_stats = pipe.stats;
+    }
+    if (res == ESP_OK && out_md5) {
+        esp_rom_md5_final(out_md5, &md5);
+    }
+
+    et2_deflater_destroy(pipe.deflater);
+    for (uint32_t i = 0; i < pipe.slot_count; i++) {
+        free(pipe.slots[i].data);
+    }
+    free(pipe.slots);
+    pthread_cond_destroy(&pipe.changed);
+    pthread_mutex_destroy(&pipe.lock);
+    return res;
+}
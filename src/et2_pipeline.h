@@ -0,0 +1,9 @@
+#pragma once
+
+#include <pthread.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+// Start a thread with its own stack size, pinned to a core if `core` is not -1.
+esp_err_t et2_thread_start(pthread_t* thread, char const* name, int core, size_t stack_size, void* (*func)(void*),
+                           void* arg);
@@ -0,0 +1,245 @@
+#include "et2_registry.h"
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esptoolsquared.h"
+#include "et2_macros.h"
+#include "sdkconfig.h"
+#include "zlib.h"
+#ifndef CONFIG_IDF_TARGET_LINUX
+#include "esp_partition.h"
+#endif
+
+static char const TAG[] = "ET2 REG";
+
+#define ET2_PACK_MAGIC   0x53325445 // "ET2S"
+#define ET2_PACK_VERSION 1
+
+// Stub pack header, followed by the entries and the compressed segments; all fields are little-endian.
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    // Size of the whole pack and CRC-32 of everything after this header.
+    uint32_t size;
+    uint32_t crc;
+} et2_pack_hdr_t;
+_Static_assert(sizeof(et2_pack_hdr_t) == 16);
+
+// Flag bits of a pack entry.
+#define ET2_PACK_FLASH_ENC 0x01
+
+// Stub pack entry; segment offsets are relative to the start of the pack.
+typedef struct {
+    uint32_t chip_id;
+    uint32_t flags;
+    uint32_t ram_block;
+    uint32_t flash_block;
+    uint8_t  rom_status_len;
+    uint8_t  stub_status_len;
+    uint16_t reserved0;
+    uint32_t text_start;
+    uint32_t data_start;
+    uint32_t bss_start;
+    uint32_t entry;
+    uint32_t text_off;
+    uint32_t text_zlen;
+    uint32_t text_len;
+    uint32_t data_off;
+    uint32_t data_zlen;
+    uint32_t data_len;
+    uint32_t reserved1;
+} et2_pack_entry_t;
+_Static_assert(sizeof(et2_pack_entry_t) == 64);
+
+// A chip loaded from a pack; the stub segments point into the pack.
+typedef struct {
+    uint32_t   chip_id;
+    et2_stub_t stub;
+    et2_chip_t rom_attr;
+    et2_chip_t stub_attr;
+} et2_reg_chip_t;
+
+// Mapping of the partition holding a pack, if the pack is in one.
+typedef struct {
+#ifndef CONFIG_IDF_TARGET_LINUX
+    esp_partition_mmap_handle_t handle;
+#endif
+    bool mapped;
+} et2_reg_map_t;
+
+// Chips loaded from the current pack, the mapping it lives in and the number of sessions using one of its chips.
+static pthread_mutex_t reg_lock = PTHREAD_MUTEX_INITIALIZER;
+static et2_reg_chip_t* reg_chips;
+static size_t          reg_count;
+static et2_reg_map_t   reg_map;
+static size_t          reg_users;
+
+// Check that a segment lies within the pack.
+static bool et2_pack_in_bounds(uint32_t off, uint32_t len, size_t size) {
+    return off <= size && len <= size - off;
+}
+
+// Build the chip list of a stub pack.
+static esp_err_t et2_registry_parse(void const* pack, size_t len, et2_reg_chip_t** out_chips, size_t* out_count) {
+    et2_pack_hdr_t hdr;
+    if (len < sizeof(hdr)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(&hdr, pack, sizeof(hdr));
+    if (hdr.magic != ET2_PACK_MAGIC || hdr.version != ET2_PACK_VERSION) {
+        ESP_LOGE(TAG, "Not a stub pack or unsupported version");
+        return ESP_ERR_INVALID_VERSION;
+    } else if (hdr.size > len || hdr.size < sizeof(hdr) + hdr.count * sizeof(et2_pack_entry_t)) {
+        ESP_LOGE(TAG, "Stub pack size %" PRIu32 " does not fit %zu bytes", hdr.size, len);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    uint8_t const* base = pack;
+    if (crc32(0, base + sizeof(hdr), hdr.size - sizeof(hdr)) != hdr.crc) {
+        ESP_LOGE(TAG, "Stub pack CRC mismatch");
+        return ESP_ERR_INVALID_CRC;
+    }
+
+    et2_reg_chip_t* chips = calloc(hdr.count, sizeof(et2_reg_chip_t));
+    if (hdr.count && !chips) {
+        return ESP_ERR_NO_MEM;
+    }
+    for (size_t i = 0; i < hdr.count; i++) {
+        et2_pack_entry_t entry;
+        memcpy(&entry, base + sizeof(hdr) + i * sizeof(entry), sizeof(entry));
+        if (!et2_pack_in_bounds(entry.text_off, entry.text_zlen, hdr.size) ||
+            !et2_pack_in_bounds(entry.data_off, entry.data_zlen, hdr.size) || !entry.ram_block ||
+            (entry.rom_status_len != 2 && entry.rom_status_len != 4) ||
+            (entry.stub_status_len != 2 && entry.stub_status_len != 4)) {
+            ESP_LOGE(TAG, "Invalid stub pack entry %zu", i);
+            free(chips);
+            return ESP_ERR_INVALID_ARG;
+        }
+
+        et2_reg_chip_t* chip = &chips[i];
+        chip->chip_id        = entry.chip_id & 0xffff;
+        chip->stub           = (et2_stub_t){
+            .text       = base + entry.text_off,
+            .text_zlen  = entry.text_zlen,
+            .text_len   = entry.text_len,
+            .text_start = entry.text_start,
+            .data       = base + entry.data_off,
+            .data_zlen  = entry.data_zlen,
+            .data_len   = entry.data_len,
+            .data_start = entry.data_start,
+            .bss_start  = entry.bss_start,
+            .entry      = entry.entry,
+        };
+        chip->rom_attr = (et2_chip_t){
+            .stub        = &chip->stub,
+            .flash_enc   = entry.flags & ET2_PACK_FLASH_ENC,
+            .ram_block   = entry.ram_block,
+            .flash_block = entry.flash_block,
+            .status_len  = entry.rom_status_len,
+        };
+        chip->stub_attr = chip->rom_attr;
+        if (entry.stub_status_len != entry.rom_status_len) {
+            chip->stub_attr.status_len = entry.stub_status_len;
+            chip->rom_attr.stub_attr   = &chip->stub_attr;
+        }
+        ESP_LOGI(TAG, "Loaded stub for chip ID 0x%04" PRIX32, chip->chip_id);
+    }
+
+    *out_chips = chips;
+    *out_count = hdr.count;
+    return ESP_OK;
+}
+
+// Release the mapping of a pack, if it has one.
+static void et2_registry_unmap(et2_reg_map_t* map) {
+#ifndef CONFIG_IDF_TARGET_LINUX
+    if (map->mapped) {
+        esp_partition_munmap(map->handle);
+    }
+#endif
+    map->mapped = false;
+}
+
+// Replace the current pack, unless a session is still using one of its chips.
+// The chips and the mapping are owned by the registry afterwards, or released if they are not installed.
+static esp_err_t et2_registry_install(et2_reg_chip_t* chips, size_t count, et2_reg_map_t map) {
+    pthread_mutex_lock(&reg_lock);
+    size_t users = reg_users;
+    if (!users) {
+        free(reg_chips);
+        et2_registry_unmap(&reg_map);
+        reg_chips = chips;
+        reg_count = count;
+        reg_map   = map;
+    }
+    pthread_mutex_unlock(&reg_lock);
+    if (users) {
+        ESP_LOGE(TAG, "%zu sessions still use the loaded stub pack", users);
+        free(chips);
+        et2_registry_unmap(&map);
+        return ESP_ERR_INVALID_STATE;
+    }
+    return ESP_OK;
+}
+
+// Load the chips from a stub pack, which must stay valid until it is unloaded.
+esp_err_t et2_registry_load(void const* pack, size_t len) {
+    et2_reg_chip_t* chips;
+    size_t          count;
+    RETURN_ON_ERR(et2_registry_parse(pack, len, &chips, &count));
+    return et2_registry_install(chips, count, (et2_reg_map_t){0});
+}
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+// Load the chips from a stub pack in a data partition, which stays memory-mapped until it is unloaded.
+esp_err_t et2_registry_load_partition(char const* label) {
+    esp_partition_t const* part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (!part) {
+        ESP_LOGE(TAG, "Partition %s not found", label);
+        return ESP_ERR_NOT_FOUND;
+    }
+    void const*                 pack;
+    esp_partition_mmap_handle_t handle;
+    esp_err_t res = esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &pack, &handle);
+    if (res != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to map partition %s", label);
+        return res;
+    }
+    et2_reg_chip_t* chips;
+    size_t          count;
+    res = et2_registry_parse(pack, part->size, &chips, &count);
+    if (res != ESP_OK) {
+        esp_partition_munmap(handle);
+        return res;
+    }
+    return et2_registry_install(chips, count, (et2_reg_map_t){.handle = handle, .mapped = true});
+}
+#endif
+
+// Forget the chips loaded at runtime.
+esp_err_t et2_registry_unload(void) {
+    return et2_registry_install(NULL, 0, (et2_reg_map_t){0});
+}
+
+// Find a loaded chip, which then stays loaded until et2_registry_release is called.
+et2_chip_t const* et2_registry_find(uint32_t chip_id) {
+    et2_chip_t const* attr = NULL;
+    pthread_mutex_lock(&reg_lock);
+    for (size_t i = 0; i < reg_count && !attr; i++) {
+        if (reg_chips[i].chip_id == chip_id) {
+            attr = &reg_chips[i].rom_attr;
+            reg_users++;
+        }
+    }
+    pthread_mutex_unlock(&reg_lock);
+    return attr;
+}
+
+// Let go of a chip found with et2_registry_find.
+void et2_registry_release(void) {
+    pthread_mutex_lock(&reg_lock);
+    reg_users--;
+    pthread_mutex_unlock(&reg_lock);
+}
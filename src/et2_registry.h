@@ -0,0 +1,10 @@
+#pragma once
+
+#include <stdint.h>
+#include "chips.h"
+
+// Find the attributes of a chip loaded at runtime, or NULL if none was loaded for this chip ID.
+// A chip that is found keeps the pack loaded until et2_registry_release is called.
+et2_chip_t const* et2_registry_find(uint32_t chip_id);
+// Release a chip found with et2_registry_find.
+void              et2_registry_release(void);
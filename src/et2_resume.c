@@ -0,0 +1,141 @@
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_rom_md5.h"
+#include "esptoolsquared.h"
+#include "et2_macros.h"
+#include "et2_session.h"
+
+static char const TAG[] = "ET2 RESUME";
+
+#define ET2_JOURNAL_MAGIC   0x4a325445 // "ET2J"
+#define ET2_JOURNAL_VERSION 1
+// Size of the segments written with their own begin command and committed to the journal one at a time
+#define ET2_RESUME_SEGMENT  0x40000
+// Number of committed segments checked with SPI_FLASH_MD5 before resuming; the stub may acknowledge data before it is
+// written to flash, so the last segments may not have made it if the target was reset
+#define ET2_RESUME_CHECK    2
+
+// Journal record, followed by the MD5 of each committed segment.
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    // Number of segments written and acknowledged, from the start of the image.
+    uint16_t committed;
+    // Image being written, identified by where it goes and its MD5.
+    uint32_t offset;
+    uint32_t len;
+    uint8_t  image_md5[16];
+} et2_journal_hdr_t;
+_Static_assert(sizeof(et2_journal_hdr_t) == 32);
+
+// Journal record as kept in memory.
+typedef struct {
+    et2_journal_hdr_t hdr;
+    uint8_t           digests[][16];
+} et2_journal_rec_t;
+
+// Load the journal and work out how many segments it says were committed; 0 if it is missing or for another image.
+static esp_err_t et2_resume_load(et2_journal_t* journal, et2_journal_rec_t* rec, size_t cap, uint16_t segments) {
+    et2_journal_hdr_t expected = rec->hdr;
+    size_t            len      = 0;
+    esp_err_t         res      = journal->load(journal, rec, cap, &len);
+    if (res != ESP_OK && res != ESP_ERR_NOT_FOUND && res != ESP_ERR_INVALID_SIZE) {
+        ESP_LOGE(TAG, "Failed to load the journal: %s", esp_err_to_name(res));
+        return res;
+    }
+    if (res == ESP_OK && (len < sizeof(rec->hdr) || rec->hdr.magic != expected.magic ||
+                          rec->hdr.version != expected.version || rec->hdr.offset != expected.offset ||
+                          rec->hdr.len != expected.len || memcmp(rec->hdr.image_md5, expected.image_md5, 16) ||
+                          rec->hdr.committed > segments || len != sizeof(rec->hdr) + rec->hdr.committed * 16)) {
+        ESP_LOGW(TAG, "Journal is for another image, starting over");
+        res = ESP_ERR_INVALID_VERSION;
+    }
+    if (res != ESP_OK) {
+        rec->hdr = expected;
+    }
+    return ESP_OK;
+}
+
+// Check the last committed segments against the flash contents and return the segment to continue from.
+static esp_err_t et2_resume_check(et2_session_t* session, et2_journal_rec_t const* rec, uint16_t* out_start) {
+    uint16_t start = rec->hdr.committed;
+    for (uint16_t i = start; i > 0 && i + ET2_RESUME_CHECK > rec->hdr.committed; i--) {
+        uint32_t pos = (uint32_t)(i - 1) * ET2_RESUME_SEGMENT;
+        uint32_t len = rec->hdr.len - pos < ET2_RESUME_SEGMENT ? rec->hdr.len - pos : ET2_RESUME_SEGMENT;
+        uint8_t  md5[16];
+        RETURN_ON_ERR(et2_session_cmd_spi_flash_md5(session, rec->hdr.offset + pos, len, md5));
+        if (memcmp(md5, rec->digests[i - 1], 16)) {
+            ESP_LOGW(TAG, "Committed segment at 0x%08" PRIx32 " did not reach flash", rec->hdr.offset + pos);
+            start = i - 1;
+        }
+    }
+    *out_start = start;
+    return ESP_OK;
+}
+
+// Write the segments from `start` on, committing each one to the journal once it is acknowledged.
+static esp_err_t et2_resume_write(et2_session_t* session, et2_journal_t* journal, et2_journal_rec_t* rec,
+                                  uint16_t start, uint16_t segments, uint8_t const* data, int level) {
+    uint32_t offset = rec->hdr.offset;
+    if (start == segments) {
+        return et2_session_write_flash_empty(session, offset, level);
+    }
+    for (uint16_t i = start; i < segments; i++) {
+        uint32_t pos = (uint32_t)i * ET2_RESUME_SEGMENT;
+        uint32_t len = rec->hdr.len - pos < ET2_RESUME_SEGMENT ? rec->hdr.len - pos : ET2_RESUME_SEGMENT;
+        RETURN_ON_ERR(et2_session_write_flash_level(session, offset + pos, data + pos, len, level, rec->digests[i]));
+        rec->hdr.committed = i + 1;
+        RETURN_ON_ERR(journal->save(journal, rec, sizeof(rec->hdr) + rec->hdr.committed * 16));
+    }
+    return ESP_OK;
+}
+
+// Write data to flash, continuing from where an earlier attempt with the same journal and image stopped.
+esp_err_t et2_session_write_flash_resumable(et2_session_t* session, uint32_t offset, uint8_t const* data, uint32_t len,
+                                            int level, et2_journal_t* journal, uint8_t out_md5[16]) {
+    uint32_t segments = (len + ET2_RESUME_SEGMENT - 1) / ET2_RESUME_SEGMENT;
+    if (offset % ET2_FLASH_SECTOR_SIZE || segments > UINT16_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    size_t             cap = sizeof(et2_journal_hdr_t) + segments * 16;
+    et2_journal_rec_t* rec = malloc(cap);
+    if (!rec) {
+        return ESP_ERR_NO_MEM;
+    }
+    rec->hdr = (et2_journal_hdr_t){
+        .magic   = ET2_JOURNAL_MAGIC,
+        .version = ET2_JOURNAL_VERSION,
+        .offset  = offset,
+        .len     = len,
+    };
+    md5_context_t md5;
+    esp_rom_md5_init(&md5);
+    esp_rom_md5_update(&md5, data, len);
+    esp_rom_md5_final(rec->hdr.image_md5, &md5);
+
+    uint16_t  start = 0;
+    esp_err_t res   = et2_resume_load(journal, rec, cap, segments);
+    if (res == ESP_OK) {
+        res = et2_resume_check(session, rec, &start);
+    }
+    if (res == ESP_OK && start) {
+        uint32_t done = (uint32_t)start * ET2_RESUME_SEGMENT;
+        ESP_LOGI(TAG, "Resuming at 0x%08" PRIx32 ", %" PRIu32 " of %" PRIu32 " bytes already written", offset + done,
+                 done, len);
+        res = et2_session_progress(session, done);
+    }
+    if (res == ESP_OK) {
+        res = et2_resume_write(session, journal, rec, start, segments, data, level);
+    }
+    // The image is complete, so a later write of it starts from scratch.
+    if (res == ESP_OK) {
+        res = journal->clear(journal);
+    }
+    if (res == ESP_OK && out_md5) {
+        memcpy(out_md5, rec->hdr.image_md5, 16);
+    }
+    free(rec);
+    return res;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "chips.h"
+#include "esp_err.h"
+#include "esptoolsquared.h"
+#include "et2_slip.h"
+#include "et2_transport.h"
+#include "sdkconfig.h"
+
+// Number of requests whose send time is remembered until their response arrives.
+#define ET2_STATS_PENDING 16
+
+// Connection to one target.
+struct et2_session {
+    // Transport, owned by the caller.
+    et2_transport_t*  tp;
+    // Chip ID and attributes of the target, once detected.
+    uint32_t          chip_id;
+    et2_chip_t const* chip_attr;
+    // Whether the attributes come from the stub pack registry, which then holds a reference for this session.
+    bool              reg_chip;
+    // Whether the flasher stub is running.
+    bool              stub_run;
+    // Current baudrate.
+    uint32_t          baudrate;
+    // Link quality over the last few commands, used to lower the baudrate when too many responses are lost or broken.
+    struct {
+        uint32_t commands;
+        uint32_t errors;
+        bool     fallback;
+    } link;
+    // Per-command counters, see et2_stats.c.
+    struct {
+        // Counters for each command, allocated on first use.
+        et2_cmd_stats_t* cmds;
+        // Send times of the requests still waiting for a response, oldest first.
+        int64_t          pending_us[ET2_STATS_PENDING];
+        uint32_t         pending_head;
+        uint32_t         pending_count;
+        // Interval of the periodic dump, 0 if disabled, and the time of the last dump.
+        int64_t          interval_us;
+        int64_t          last_dump_us;
+    } stats;
+    // Progress hook of the job running on this session, see et2_job.c.
+    struct {
+        esp_err_t (*func)(void* cookie, uint32_t bytes);
+        void* cookie;
+    } progress;
+    // SLIP framing state, including the send and receive buffers.
+    et2_slip_t slip;
+};
+
+// Input of a write that is read one piece at a time, so inputs too large to map at once can be written.
+typedef struct et2_source et2_source_t;
+struct et2_source {
+    // Get `len` bytes at `pos`; they stay valid until the next call.
+    esp_err_t (*read)(et2_source_t* src, uint32_t pos, uint32_t len, uint8_t const** out_data);
+};
+
+// Input that is already in memory.
+typedef struct {
+    et2_source_t   base;
+    uint8_t const* data;
+} et2_mem_source_t;
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+// Input read from a local partition, which is mapped one window at a time.
+typedef struct {
+    et2_source_t                base;
+    esp_partition_t const*      part;
+    esp_partition_mmap_handle_t handle;
+    // Mapped range of the partition, if `mapped_len` is not 0.
+    uint8_t const*              mapped;
+    uint32_t                    mapped_pos;
+    uint32_t                    mapped_len;
+} et2_part_source_t;
+#endif
+
+// Prepare a session in place.
+void et2_session_init(et2_session_t* session, et2_transport_t* tp);
+// Release the buffers of a session prepared by et2_session_init.
+void et2_session_deinit(et2_session_t* session);
+// Report `bytes` more input written to the progress hook, if any; an error from the hook stops the write.
+esp_err_t et2_session_progress(et2_session_t* session, uint32_t bytes);
+// Prepare a source for data in memory.
+void      et2_mem_source_init(et2_mem_source_t* src, uint8_t const* data);
+#ifndef CONFIG_IDF_TARGET_LINUX
+// Prepare a source for a local partition; et2_part_source_deinit unmaps the last window.
+void      et2_part_source_init(et2_part_source_t* src, esp_partition_t const* part);
+void      et2_part_source_deinit(et2_part_source_t* src);
+#endif
+// Write `len` bytes at `pos` of a source to flash, as is if `level` is 0 or compressed with that zlib level otherwise.
+esp_err_t et2_session_write_flash_source(et2_session_t* session, uint32_t offset, et2_source_t* src, uint32_t pos,
+                                         uint32_t len, int level, uint8_t out_md5[16]);
+// Write data to flash as is if `level` is 0, or compressed with that zlib level otherwise.
+esp_err_t et2_session_write_flash_level(et2_session_t* session, uint32_t offset, const uint8_t* data, uint32_t len,
+                                        int level, uint8_t out_md5[16]);
+// Send the empty begin command of a write that had nothing to send, so the caller's finish command is accepted.
+esp_err_t et2_session_write_flash_empty(et2_session_t* session, uint32_t offset, int level);
@@ -0,0 +1,718 @@
+// SPDX-FileCopyrightText: 2025 Julian Scheffers
+// SPDX-License-Identifier: MIT
+
+#define _GNU_SOURCE
+#include "et2_sim.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <zlib.h>
+#include "chips.h"
+#include "esp_log.h"
+#include "esp_rom_md5.h"
+#include "esptoolsquared.h"
+#include "et2_macros.h"
+#include "et2_transport.h"
+
+#define SLIP_END     0xC0
+#define SLIP_ESC     0xDB
+#define SLIP_ESC_END 0xDC
+#define SLIP_ESC_ESC 0xDD
+
+#define SIM_SECTOR_SIZE    4096
+#define SIM_MAX_FRAME      (0x4000 + 64)
+#define SIM_CHECKSUM_MAGIC 0xEF
+#define SIM_DEFAULT_FLASH  (4 * 1024 * 1024)
+#define SIM_BANNER         "ESP-ROM:sim\r\nwaiting for download\r\n"
+
+// ROM loader error codes.
+#define ROM_ERR_INVALID_MSG 0x05
+#define ROM_ERR_FAILED      0x06
+#define ROM_ERR_BAD_CRC     0x07
+
+// Flasher stub error codes.
+#define STUB_ERR_BAD_LEN      0xC0
+#define STUB_ERR_BAD_CHECKSUM 0xC1
+#define STUB_ERR_BAD_BLOCK    0xC2
+#define STUB_ERR_INVALID_CMD  0xC3
+#define STUB_ERR_NOT_FLASHING 0xC6
+
+static char const TAG[] = "ET2 SIM";
+
+// Command header, same layout as the one used by the host.
+typedef struct {
+    uint8_t  resp;
+    uint8_t  cmd;
+    uint16_t len;
+    uint32_t chk;
+} sim_hdr_t;
+
+// Direction of the simulated link.
+typedef struct {
+    uint32_t baudrate;
+    int64_t  free_at;
+} sim_wire_t;
+
+struct et2_sim {
+    et2_sim_config_t config;
+    et2_sim_stats_t  stats;
+    pthread_t        thread;
+    pthread_mutex_t  mutex;
+    int              fd;
+    volatile bool    stop;
+
+    // Simulated flash.
+    uint8_t* flash;
+    int      flash_fd;
+
+    // Link state.
+    sim_wire_t rx_wire;
+    sim_wire_t tx_wire;
+    uint8_t    tx_buf[2 * SIM_MAX_FRAME + 4];
+    uint8_t    rx_buf[1024];
+    size_t     rx_pos;
+    size_t     rx_len;
+    uint8_t    frame[SIM_MAX_FRAME];
+    size_t     frame_len;
+    uint32_t   rng;
+
+    // Target state.
+    uint32_t baudrate;
+    bool     stub;
+    uint32_t mem_remaining;
+    uint32_t mem_block;
+    uint32_t mem_seq;
+    bool     flashing;
+    bool     deflating;
+    uint32_t write_offset;
+    uint32_t write_remaining;
+    uint32_t write_block;
+    uint32_t write_seq;
+    z_stream inflate;
+};
+
+// Sleep until an absolute time in microseconds.
+static void sim_sleep_until(int64_t when) {
+    int64_t now = et2_time_us();
+    if (when > now) {
+        struct timespec ts = {
+            .tv_sec  = (when - now) / 1000000,
+            .tv_nsec = (when - now) % 1000000 * 1000,
+        };
+        nanosleep(&ts, NULL);
+    }
+}
+
+// Account for `len` bytes on a simulated wire, sleeping as long as the wire would take to transfer them.
+// Bytes that were `queued` while the target was busy are assumed to have followed the previous bytes directly.
+static void sim_wire_transfer(sim_wire_t* wire, size_t len, bool queued) {
+    if (!wire->baudrate) {
+        return;
+    }
+    int64_t now = et2_time_us();
+    if (wire->free_at < now && !queued) {
+        wire->free_at = now;
+    }
+    // 8 data bits plus start and stop bit per byte.
+    wire->free_at += (int64_t)len * 10 * 1000000 / wire->baudrate;
+    sim_sleep_until(wire->free_at);
+}
+
+// Roll the error injection dice.
+static bool sim_chance(et2_sim_t* sim, uint32_t ppm) {
+    if (!ppm) {
+        return false;
+    }
+    sim->rng ^= sim->rng << 13;
+    sim->rng ^= sim->rng >> 17;
+    sim->rng ^= sim->rng << 5;
+    return sim->rng % 1000000 < ppm;
+}
+
+static esp_err_t sim_write(et2_sim_t* sim, uint8_t const* data, size_t len) {
+    sim_wire_transfer(&sim->tx_wire, len, false);
+    pthread_mutex_lock(&sim->mutex);
+    sim->stats.tx_bytes += len;
+    pthread_mutex_unlock(&sim->mutex);
+    while (len) {
+        ssize_t res = write(sim->fd, data, len);
+        if (res < 0 && errno == EINTR) {
+            continue;
+        } else if (res <= 0) {
+            return ESP_FAIL;
+        }
+        data += res;
+        len  -= res;
+    }
+    return ESP_OK;
+}
+
+// Send a SLIP frame built from a header and a payload.
+static esp_err_t sim_send_frame(et2_sim_t* sim, void const* head, size_t head_len, void const* data, size_t data_len,
+                                bool corrupt) {
+    uint8_t* buf = sim->tx_buf;
+    size_t   len = 0;
+    buf[len++]   = SLIP_END;
+    for (int part = 0; part < 2; part++) {
+        uint8_t const* ptr = part ? data : head;
+        size_t         cnt = part ? data_len : head_len;
+        for (size_t i = 0; i < cnt; i++) {
+            if (ptr[i] == SLIP_END) {
+                buf[len++] = SLIP_ESC;
+                buf[len++] = SLIP_ESC_END;
+            } else if (ptr[i] == SLIP_ESC) {
+                buf[len++] = SLIP_ESC;
+                buf[len++] = SLIP_ESC_ESC;
+            } else {
+                buf[len++] = ptr[i];
+            }
+        }
+        if (corrupt && part == 0) {
+            // An escape byte followed by something that is not a valid escape code.
+            buf[len++] = SLIP_ESC;
+            buf[len++] = 0x00;
+        }
+    }
+    buf[len++] = SLIP_END;
+    return sim_write(sim, buf, len);
+}
+
+// Send a response to a command.
+static esp_err_t sim_respond(et2_sim_t* sim, uint8_t cmd, uint32_t val, void const* data, size_t data_len,
+                             uint8_t error) {
+    uint8_t status_len = sim->stub ? sim->config.stub_status_len : sim->config.rom_status_len;
+    uint8_t payload[64 + 4];
+    if (data_len > sizeof(payload) - status_len) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(payload, data, data_len);
+    memset(payload + data_len, 0, status_len);
+    payload[data_len]     = error ? 1 : 0;
+    payload[data_len + 1] = error;
+
+    sim_hdr_t hdr = {
+        .resp = 1,
+        .cmd  = cmd,
+        .len  = data_len + status_len,
+        .chk  = val,
+    };
+
+    if (sim->config.latency_us) {
+        sim_sleep_until(et2_time_us() + sim->config.latency_us);
+    }
+    if (sim_chance(sim, sim->config.drop_ppm)) {
+        pthread_mutex_lock(&sim->mutex);
+        sim->stats.dropped++;
+        pthread_mutex_unlock(&sim->mutex);
+        return ESP_OK;
+    }
+    bool corrupt = sim_chance(sim, sim->config.corrupt_ppm) ||
+                   (sim->config.max_baudrate && sim->baudrate > sim->config.max_baudrate);
+    if (corrupt) {
+        pthread_mutex_lock(&sim->mutex);
+        sim->stats.corrupted++;
+        pthread_mutex_unlock(&sim->mutex);
+    }
+    return sim_send_frame(sim, &hdr, sizeof(hdr), payload, data_len + status_len, corrupt);
+}
+
+// Receive one SLIP frame into `sim->frame`.
+static esp_err_t sim_recv_frame(et2_sim_t* sim) {
+    bool in_frame = false;
+    bool escape   = false;
+    sim->frame_len = 0;
+    while (true) {
+        if (sim->rx_pos >= sim->rx_len) {
+            // Poll so that a stop request is noticed even if the host end stays open.
+            struct pollfd pfd    = {.fd = sim->fd, .events = POLLIN};
+            bool          queued = poll(&pfd, 1, 0) > 0;
+            if (sim->stop) {
+                return ESP_FAIL;
+            } else if (!queued && poll(&pfd, 1, 100) == 0) {
+                continue;
+            }
+            ssize_t res = read(sim->fd, sim->rx_buf, sizeof(sim->rx_buf));
+            if (res < 0 && errno == EINTR) {
+                continue;
+            } else if (res <= 0) {
+                return ESP_FAIL;
+            }
+            sim_wire_transfer(&sim->rx_wire, res, queued);
+            pthread_mutex_lock(&sim->mutex);
+            sim->stats.rx_bytes += res;
+            pthread_mutex_unlock(&sim->mutex);
+            sim->rx_pos = 0;
+            sim->rx_len = res;
+        }
+        uint8_t rxd = sim->rx_buf[sim->rx_pos++];
+        if (!in_frame) {
+            in_frame = rxd == SLIP_END;
+        } else if (rxd == SLIP_END) {
+            if (sim->frame_len) {
+                return ESP_OK;
+            }
+        } else if (sim->frame_len >= sizeof(sim->frame)) {
+            // Oversized frame; skip it.
+            in_frame = false;
+            sim->frame_len = 0;
+        } else if (escape) {
+            escape                       = false;
+            sim->frame[sim->frame_len++] = rxd == SLIP_ESC_END ? SLIP_END : rxd == SLIP_ESC_ESC ? SLIP_ESC : rxd;
+        } else if (rxd == SLIP_ESC) {
+            escape = true;
+        } else {
+            sim->frame[sim->frame_len++] = rxd;
+        }
+    }
+}
+
+// Erase a range of the simulated flash.
+static void sim_erase(et2_sim_t* sim, uint32_t offset, uint32_t len) {
+    uint32_t start = offset / SIM_SECTOR_SIZE * SIM_SECTOR_SIZE;
+    uint32_t end   = (offset + len + SIM_SECTOR_SIZE - 1) / SIM_SECTOR_SIZE * SIM_SECTOR_SIZE;
+    if (end > sim->config.flash_size) {
+        end = sim->config.flash_size;
+    }
+    if (start >= end) {
+        return;
+    }
+    memset(sim->flash + start, 0xFF, end - start);
+    if (sim->config.sector_erase_us) {
+        sim_sleep_until(et2_time_us() + (int64_t)sim->config.sector_erase_us * ((end - start) / SIM_SECTOR_SIZE));
+    }
+}
+
+// Write to the simulated flash; like real NOR flash this can only clear bits.
+static bool sim_program(et2_sim_t* sim, uint8_t const* data, size_t len) {
+    if (len > sim->write_remaining || sim->write_offset + len > sim->config.flash_size) {
+        return false;
+    }
+    for (size_t i = 0; i < len; i++) {
+        sim->flash[sim->write_offset + i] &= data[i];
+    }
+    sim->write_offset    += len;
+    sim->write_remaining -= len;
+    return true;
+}
+
+// Feed compressed data to the inflater and write the output to flash.
+static bool sim_inflate(et2_sim_t* sim, uint8_t const* data, size_t len) {
+    uint8_t out[SIM_SECTOR_SIZE];
+    sim->inflate.next_in  = (uint8_t*)data;
+    sim->inflate.avail_in = len;
+    do {
+        sim->inflate.next_out  = out;
+        sim->inflate.avail_out = sizeof(out);
+        int res                = inflate(&sim->inflate, Z_NO_FLUSH);
+        if (res != Z_OK && res != Z_STREAM_END && res != Z_BUF_ERROR) {
+            ESP_LOGE(TAG, "Inflate error %d", res);
+            return false;
+        }
+        if (!sim_program(sim, out, sizeof(out) - sim->inflate.avail_out)) {
+            return false;
+        }
+        if (res == Z_STREAM_END) {
+            break;
+        }
+    } while (sim->inflate.avail_in || sim->inflate.avail_out == 0);
+    return true;
+}
+
+// Stream a range of flash to the host as done by the flasher stub's READ_FLASH.
+static esp_err_t sim_read_flash(et2_sim_t* sim, uint32_t offset, uint32_t len, uint32_t packet, uint32_t inflight) {
+    md5_context_t md5;
+    esp_rom_md5_init(&md5);
+    uint32_t sent  = 0;
+    uint32_t acked = 0;
+    while (acked < len) {
+        while (sent < len && sent - acked < (uint64_t)packet * inflight) {
+            uint32_t chunk = len - sent < packet ? len - sent : packet;
+            esp_rom_md5_update(&md5, sim->flash + offset + sent, chunk);
+            RETURN_ON_ERR(sim_send_frame(sim, sim->flash + offset + sent, chunk, NULL, 0, false));
+            sent += chunk;
+        }
+        RETURN_ON_ERR(sim_recv_frame(sim));
+        if (sim->frame_len != 4) {
+            ESP_LOGE(TAG, "Invalid READ_FLASH acknowledgement");
+            return ESP_ERR_INVALID_RESPONSE;
+        }
+        memcpy(&acked, sim->frame, 4);
+    }
+    uint8_t digest[16];
+    esp_rom_md5_final(digest, &md5);
+    return sim_send_frame(sim, digest, sizeof(digest), NULL, 0, false);
+}
+
+// Handle one command frame.
+static esp_err_t sim_handle(et2_sim_t* sim) {
+    if (sim->frame_len < sizeof(sim_hdr_t)) {
+        return ESP_OK;
+    }
+    sim_hdr_t hdr;
+    memcpy(&hdr, sim->frame, sizeof(hdr));
+    uint8_t const* data = sim->frame + sizeof(hdr);
+    size_t         len  = sim->frame_len - sizeof(hdr);
+    uint32_t       arg[4] = {0};
+    memcpy(arg, data, len < sizeof(arg) ? len : sizeof(arg));
+
+    uint8_t err_invalid  = sim->stub ? STUB_ERR_INVALID_CMD : ROM_ERR_INVALID_MSG;
+    uint8_t err_checksum = sim->stub ? STUB_ERR_BAD_CHECKSUM : ROM_ERR_BAD_CRC;
+    uint8_t err_failed   = sim->stub ? STUB_ERR_NOT_FLASHING : ROM_ERR_FAILED;
+
+    pthread_mutex_lock(&sim->mutex);
+    sim->stats.commands++;
+    pthread_mutex_unlock(&sim->mutex);
+
+    if (hdr.resp != 0 || hdr.len != len) {
+        return sim_respond(sim, hdr.cmd, 0, NULL, 0, err_invalid);
+    }
+    if (sim_chance(sim, sim->config.fail_ppm)) {
+        pthread_mutex_lock(&sim->mutex);
+        sim->stats.failed++;
+        pthread_mutex_unlock(&sim->mutex);
+        return sim_respond(sim, hdr.cmd, 0, NULL, 0, err_failed);
+    }
+
+    switch (hdr.cmd) {
+        case ET2_CMD_SYNC:
+            if (len != 36) {
+                return sim_respond(sim, hdr.cmd, 0, NULL, 0, err_invalid);
+            }
+            return sim_respond(sim, hdr.cmd, 0, NULL, 0, 0);
+
+        case ET2_CMD_READ_REG:
+            return sim_respond(sim, hdr.cmd, arg[0] == 0x40001000 ? 0x6F51306F : 0, NULL, 0, 0);
+
+        case ET2_CMD_WRITE_REG:
+        case ET2_CMD_SPI_ATTACH:
+        case ET2_CMD_SPI_SET_PARAMS:
+            return sim_respond(sim, hdr.cmd, 0, NULL, 0, 0);
+
+        case ET2_CMD_SEC_INFO: {
+            uint32_t info[5] = {0, 0, 0, sim->config.chip_id, 0};
+            return sim_respond(sim, hdr.cmd, 0, info, sizeof(info), 0);
+        }
+
+        case ET2_CMD_MEM_BEGIN:
+            sim->mem_remaining = arg[0];
+            sim->mem_block     = arg[2];
+            sim->mem_seq       = 0;
+            return sim_respond(sim, hdr.cmd, 0, NULL, 0, 0);
+
+        case ET2_CMD_MEM_DATA:
+        case ET2_CMD_FLASH_DATA:
+        case ET2_CMD_FLASH_ENCRYPT_DATA:
+        case ET2_CMD_DEFL_DATA: {
+            if (len < 16 || arg[0] != len - 16) {
+                return sim_respond(sim, hdr.cmd, 0, NULL, 0, sim->stub ? STUB_ERR_BAD_LEN : ROM_ERR_INVALID_MSG);
+            }
+            uint32_t chk = SIM_CHECKSUM_MAGIC;
+            for (size_t i = 16; i < len; i++) {
+                chk ^= data[i];
+            }
+            if (chk != hdr.chk) {
+                return sim_respond(sim, hdr.cmd, 0, NULL, 0, err_checksum);
+            }
+            if (hdr.cmd == ET2_CMD_MEM_DATA) {
+                if (arg[1] != sim->mem_seq++ || arg[0] > sim->mem_block || arg[0] > sim->mem_remaining) {
+                    return sim_respond(sim, hdr.cmd, 0, NULL, 0, err_invalid);
+                }
+                sim->mem_remaining -= arg[0];
+                return sim_respond(sim, hdr.cmd, 0, NULL, 0, 0);
+            }
+            bool defl = hdr.cmd == ET2_CMD_DEFL_DATA;
+            if (!(defl ? sim->deflating : sim->flashing) || arg[1] != sim->write_seq++ || arg[0] > sim->write_block) {
+                return sim_respond(sim, hdr.cmd, 0, NULL, 0, sim->stub ? STUB_ERR_BAD_BLOCK : ROM_ERR_INVALID_MSG);
+            }
+            // The flasher stub acknowledges data before writing it, the ROM loader after.
+            if (sim->stub) {
+                RETURN_ON_ERR(sim_respond(sim, hdr.cmd, 0, NULL, 0, 0));
+            }
+            bool ok = defl ? sim_inflate(sim, data + 16, arg[0]) : sim_program(sim, data + 16, arg[0]);
+            if (!ok) {
+                ESP_LOGE(TAG, "Flash write failed at 0x%08" PRIx32, sim->write_offset);
+                sim->flashing  = false;
+                sim->deflating = false;
+            }
+            if (!sim->stub) {
+                return sim_respond(sim, hdr.cmd, 0, NULL, 0, ok ? 0 : ROM_ERR_FAILED);
+            }
+            return ESP_OK;
+        }
+
+        case ET2_CMD_MEM_END: {
+            RETURN_ON_ERR(sim_respond(sim, hdr.cmd, 0, NULL, 0, 0));
+            if (arg[0] == 0 && !sim->stub) {
+                // Pretend the uploaded RAM image is the flasher stub.
+                sim->stub = true;
+                return sim_send_frame(sim, "OHAI", 4, NULL, 0, false);
+            }
+            return ESP_OK;
+        }
+
+        case ET2_CMD_FLASH_BEGIN:
+        case ET2_CMD_DEFL_BEGIN:
+            if (arg[3] >= sim->config.flash_size || arg[0] > sim->config.flash_size - arg[3]) {
+                return sim_respond(sim, hdr.cmd, 0, NULL, 0, err_failed);
+            }
+            sim_erase(sim, arg[3], arg[0]);
+            sim->write_offset    = arg[3];
+            sim->write_remaining = arg[0];
+            sim->write_block     = arg[2];
+            sim->write_seq       = 0;
+            sim->flashing        = hdr.cmd == ET2_CMD_FLASH_BEGIN;
+            sim->deflating       = hdr.cmd == ET2_CMD_DEFL_BEGIN;
+            if (sim->deflating) {
+                inflateEnd(&sim->inflate);
+                memset(&sim->inflate, 0, sizeof(sim->inflate));
+                inflateInit(&sim->inflate);
+            }
+            return sim_respond(sim, hdr.cmd, 0, NULL, 0, 0);
+
+        case ET2_CMD_FLASH_END:
+        case ET2_CMD_DEFL_END:
+            sim->flashing  = false;
+            sim->deflating = false;
+            RETURN_ON_ERR(sim_respond(sim, hdr.cmd, 0, NULL, 0, 0));
+            if (arg[0] == 0) {
+                // Reboot; come back up in the ROM loader.
+                sim->stub = false;
+                if (!sim->config.no_banner) {
+                    return sim_write(sim, (uint8_t const*)SIM_BANNER, strlen(SIM_BANNER));
+                }
+            }
+            return ESP_OK;
+
+        case ET2_CMD_SPI_FLASH_MD5: {
+            if (arg[0] > sim->config.flash_size || arg[1] > sim->config.flash_size - arg[0]) {
+                return sim_respond(sim, hdr.cmd, 0, NULL, 0, err_failed);
+            }
+            uint8_t       digest[16];
+            md5_context_t md5;
+            esp_rom_md5_init(&md5);
+            esp_rom_md5_update(&md5, sim->flash + arg[0], arg[1]);
+            esp_rom_md5_final(digest, &md5);
+            if (sim->stub) {
+                return sim_respond(sim, hdr.cmd, 0, digest, sizeof(digest), 0);
+            }
+            // The ROM loader sends the digest as hexadecimal text.
+            char hex[33];
+            for (int i = 0; i < 16; i++) {
+                snprintf(hex + 2 * i, 3, "%02x", digest[i]);
+            }
+            return sim_respond(sim, hdr.cmd, 0, hex, 32, 0);
+        }
+
+        case ET2_CMD_CHANGE_BAUDRATE:
+            // Acknowledge at the old baudrate, then switch.
+            RETURN_ON_ERR(sim_respond(sim, hdr.cmd, 0, NULL, 0, 0));
+            sim->baudrate = arg[0];
+            if (sim->config.baudrate) {
+                sim->rx_wire.baudrate = arg[0];
+                sim->tx_wire.baudrate = arg[0];
+            }
+            return ESP_OK;
+
+        case ET2_CMD_READ_FLASH:
+            if (!sim->stub) {
+                return sim_respond(sim, hdr.cmd, 0, NULL, 0, err_invalid);
+            } else if (arg[0] > sim->config.flash_size || arg[1] > sim->config.flash_size - arg[0] || !arg[2] ||
+                       arg[2] > SIM_MAX_FRAME || !arg[3]) {
+                // Each packet is sent as one frame, which must fit in the send buffer.
+                return sim_respond(sim, hdr.cmd, 0, NULL, 0, STUB_ERR_BAD_LEN);
+            }
+            RETURN_ON_ERR(sim_respond(sim, hdr.cmd, 0, NULL, 0, 0));
+            return sim_read_flash(sim, arg[0], arg[1], arg[2], arg[3]);
+
+        case ET2_CMD_ERASE_FLASH:
+            if (!sim->stub) {
+                return sim_respond(sim, hdr.cmd, 0, NULL, 0, err_invalid);
+            }
+            sim_erase(sim, 0, sim->config.flash_size);
+            return sim_respond(sim, hdr.cmd, 0, NULL, 0, 0);
+
+        case ET2_CMD_ERASE_REGION:
+            if (!sim->stub) {
+                return sim_respond(sim, hdr.cmd, 0, NULL, 0, err_invalid);
+            } else if (arg[0] % SIM_SECTOR_SIZE || arg[1] % SIM_SECTOR_SIZE || arg[0] > sim->config.flash_size ||
+                       arg[1] > sim->config.flash_size - arg[0]) {
+                return sim_respond(sim, hdr.cmd, 0, NULL, 0, STUB_ERR_BAD_LEN);
+            }
+            sim_erase(sim, arg[0], arg[1]);
+            return sim_respond(sim, hdr.cmd, 0, NULL, 0, 0);
+
+        default:
+            return sim_respond(sim, hdr.cmd, 0, NULL, 0, sim->stub ? STUB_ERR_INVALID_CMD : ROM_ERR_INVALID_MSG);
+    }
+}
+
+static void* sim_thread(void* arg) {
+    et2_sim_t* sim = arg;
+    if (!sim->config.no_banner) {
+        sim_write(sim, (uint8_t const*)SIM_BANNER, strlen(SIM_BANNER));
+    }
+    while (!sim->stop) {
+        if (sim_recv_frame(sim) != ESP_OK || sim_handle(sim) != ESP_OK) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+// Open the file backing the flash and map it.
+static esp_err_t sim_map_flash(et2_sim_t* sim) {
+    uint32_t size = sim->config.flash_size;
+    if (!sim->config.flash_path) {
+        sim->flash_fd = -1;
+        sim->flash    = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (sim->flash == MAP_FAILED) {
+            return ESP_ERR_NO_MEM;
+        }
+        memset(sim->flash, 0xFF, size);
+        return ESP_OK;
+    }
+
+    sim->flash_fd = open(sim->config.flash_path, O_RDWR | O_CREAT, 0644);
+    if (sim->flash_fd < 0) {
+        ESP_LOGE(TAG, "Failed to open %s: %s", sim->config.flash_path, strerror(errno));
+        return ESP_FAIL;
+    }
+    off_t old_size = lseek(sim->flash_fd, 0, SEEK_END);
+    if (old_size < size && ftruncate(sim->flash_fd, size) < 0) {
+        ESP_LOGE(TAG, "Failed to resize %s: %s", sim->config.flash_path, strerror(errno));
+        close(sim->flash_fd);
+        return ESP_FAIL;
+    }
+    sim->flash = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, sim->flash_fd, 0);
+    if (sim->flash == MAP_FAILED) {
+        close(sim->flash_fd);
+        return ESP_ERR_NO_MEM;
+    }
+    if (old_size < size) {
+        // Newly added space reads as erased flash.
+        memset(sim->flash + old_size, 0xFF, size - old_size);
+    }
+    return ESP_OK;
+}
+
+// Create the link between the host and the simulated target.
+static esp_err_t sim_open_link(et2_sim_t* sim, int* out_fd) {
+    if (!sim->config.use_pty) {
+        int fds[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0) {
+            ESP_LOGE(TAG, "socketpair failed: %s", strerror(errno));
+            return ESP_FAIL;
+        }
+        sim->fd = fds[0];
+        *out_fd = fds[1];
+        return ESP_OK;
+    }
+
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) < 0 || unlockpt(master) < 0) {
+        ESP_LOGE(TAG, "Failed to create pty: %s", strerror(errno));
+        if (master >= 0) {
+            close(master);
+        }
+        return ESP_FAIL;
+    }
+    int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    if (slave < 0) {
+        ESP_LOGE(TAG, "Failed to open pty: %s", strerror(errno));
+        close(master);
+        return ESP_FAIL;
+    }
+    struct termios tio;
+    tcgetattr(slave, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(slave, TCSANOW, &tio);
+    sim->fd = master;
+    *out_fd = slave;
+    return ESP_OK;
+}
+
+// Start a simulated target.
+esp_err_t et2_sim_create(et2_sim_config_t const* config, int* out_fd, et2_sim_t** out_sim) {
+    et2_sim_t* sim = calloc(1, sizeof(et2_sim_t));
+    if (!sim) {
+        return ESP_ERR_NO_MEM;
+    }
+    sim->config = *config;
+    if (!sim->config.flash_size) {
+        sim->config.flash_size = SIM_DEFAULT_FLASH;
+    }
+    if (!sim->config.chip_id) {
+        sim->config.chip_id = ET2_CHIP_ID_ESP32C6;
+    }
+    if (!sim->config.rom_status_len) {
+        sim->config.rom_status_len = 4;
+    }
+    if (!sim->config.stub_status_len) {
+        sim->config.stub_status_len = 2;
+    }
+    sim->fd               = -1;
+    sim->rng              = config->seed ? config->seed : 0x2545F491;
+    sim->rx_wire.baudrate = config->baudrate;
+    sim->tx_wire.baudrate = config->baudrate;
+    sim->baudrate         = config->baudrate ? config->baudrate : 115200;
+    pthread_mutex_init(&sim->mutex, NULL);
+
+    esp_err_t res = sim_map_flash(sim);
+    if (res != ESP_OK) {
+        pthread_mutex_destroy(&sim->mutex);
+        free(sim);
+        return res;
+    }
+    res = sim_open_link(sim, out_fd);
+    if (res != ESP_OK) {
+        et2_sim_destroy(sim);
+        return res;
+    }
+    if (pthread_create(&sim->thread, NULL, sim_thread, sim)) {
+        close(*out_fd);
+        et2_sim_destroy(sim);
+        return ESP_FAIL;
+    }
+
+    *out_sim = sim;
+    return ESP_OK;
+}
+
+// Stop a simulated target.
+void et2_sim_destroy(et2_sim_t* sim) {
+    if (sim->thread) {
+        sim->stop = true;
+        pthread_join(sim->thread, NULL);
+    }
+    if (sim->fd >= 0) {
+        close(sim->fd);
+    }
+    if (sim->flash_fd >= 0) {
+        msync(sim->flash, sim->config.flash_size, MS_SYNC);
+        close(sim->flash_fd);
+    }
+    munmap(sim->flash, sim->config.flash_size);
+    inflateEnd(&sim->inflate);
+    pthread_mutex_destroy(&sim->mutex);
+    free(sim);
+}
+
+uint8_t* et2_sim_flash(et2_sim_t* sim) {
+    return sim->flash;
+}
+
+void et2_sim_get_stats(et2_sim_t* sim, et2_sim_stats_t* out_stats) {
+    pthread_mutex_lock(&sim->mutex);
+    *out_stats = sim->stats;
+    pthread_mutex_unlock(&sim->mutex);
+}
@@ -1,10 +1,14 @@
 #include "et2_slip.h"
+#include <inttypes.h>
+#include <stdbool.h>
 #include <stdint.h>
-#include "driver/uart.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "esp_err.h"
 #include "esp_log.h"
+#include "et2_io.h"
 #include "et2_macros.h"
-#include "et2_uart.h"
 
 #define SLIP_END     0xC0
 #define SLIP_ESC     0xDB
@@ -13,83 +17,255 @@
 
 static char const TAG[] = "ET2 SLIP";
 
-esp_err_t et2_slip_send_startstop(uart_port_t uart) {
-    return et2_uart_write(uart, (uint8_t[]){SLIP_END}, 1);
-}
+// Repeat a byte over all bytes of a word.
+#define WORD_ONES        ((size_t)-1 / 0xFF)
+#define WORD_REPEAT(x)   (WORD_ONES * (x))
+// Non-zero if any byte of the word is zero.
+#define WORD_HAS_ZERO(x) (((x) - WORD_ONES) & ~(x) & WORD_REPEAT(0x80))
 
-esp_err_t et2_slip_send_data(uart_port_t uart, uint8_t const* data, size_t len) {
-    if (len < 1) {
-        return ESP_OK;
+// Length of the prefix of `data` that needs no escaping, scanned a word at a time.
+static size_t et2_slip_clean_len(uint8_t const* data, size_t len) {
+    size_t i = 0;
+    for (; i + sizeof(size_t) <= len; i += sizeof(size_t)) {
+        size_t word;
+        memcpy(&word, data + i, sizeof(word));
+        if (WORD_HAS_ZERO(word ^ WORD_REPEAT(SLIP_END)) || WORD_HAS_ZERO(word ^ WORD_REPEAT(SLIP_ESC))) {
+            break;
+        }
     }
+    while (i < len && data[i] != SLIP_END && data[i] != SLIP_ESC) {
+        i++;
+    }
+    return i;
+}
+
+// Prepare the framing state for a transport.
+void et2_slip_init(et2_slip_t* slip, et2_transport_t* tp) {
+    memset(slip, 0, sizeof(et2_slip_t));
+    slip->tp = tp;
+}
+
+// Release the buffers owned by the framing state.
+void et2_slip_deinit(et2_slip_t* slip) {
+    free(slip->rx_own);
+    slip->rx_own     = NULL;
+    slip->rx_own_cap = 0;
+}
+
+// Write the staged bytes to the transport.
+static esp_err_t et2_slip_flush(et2_slip_t* slip) {
+    esp_err_t res  = et2_io_write(slip->tp, slip->tx_buf, slip->tx_len);
+    slip->tx_wire += slip->tx_len;
+    slip->tx_len   = 0;
+    return res;
+}
+
+// Stage raw bytes, flushing whenever the buffer fills up.
+static esp_err_t et2_slip_stage(et2_slip_t* slip, uint8_t const* data, size_t len) {
     while (len) {
-        esp_err_t res;
-        if (*data == SLIP_ESC) {
-            res = et2_uart_write(uart, (uint8_t[]){SLIP_ESC, SLIP_ESC_ESC}, 2);
-        } else if (*data == SLIP_END) {
-            res = et2_uart_write(uart, (uint8_t[]){SLIP_ESC, SLIP_ESC_END}, 2);
-        } else {
-            res = et2_uart_write(uart, (uint8_t*)data, 1);
+        if (slip->tx_len == sizeof(slip->tx_buf)) {
+            RETURN_ON_ERR(et2_slip_flush(slip));
         }
-        if (res != ESP_OK) {
-            return res;
+        size_t chunk = sizeof(slip->tx_buf) - slip->tx_len;
+        if (chunk > len) {
+            chunk = len;
         }
-        len--;
-        data++;
+        memcpy(slip->tx_buf + slip->tx_len, data, chunk);
+        slip->tx_len += chunk;
+        data         += chunk;
+        len          -= chunk;
     }
     return ESP_OK;
 }
 
-esp_err_t et2_slip_receive(uart_port_t uart, void** out_resp, size_t* out_resp_len) {
-    // Wait for start of packet.
-    while (true) {
-        uint8_t rxd = 0;
-        RETURN_ON_ERR(et2_uart_read(uart, &rxd, 1));
-        if (rxd == SLIP_END) break;
-        putchar(rxd);
+// Start a frame.
+esp_err_t et2_slip_send_start(et2_slip_t* slip) {
+    slip->tx_len = 0;
+    return et2_slip_stage(slip, (uint8_t[]){SLIP_END}, 1);
+}
+
+// Add data to the current frame, escaping it as needed.
+esp_err_t et2_slip_send_data(et2_slip_t* slip, uint8_t const* data, size_t len) {
+    while (len) {
+        size_t clean = et2_slip_clean_len(data, len);
+        RETURN_ON_ERR(et2_slip_stage(slip, data, clean));
+        data += clean;
+        len  -= clean;
+        if (len) {
+            uint8_t esc[] = {SLIP_ESC, *data == SLIP_END ? SLIP_ESC_END : SLIP_ESC_ESC};
+            RETURN_ON_ERR(et2_slip_stage(slip, esc, sizeof(esc)));
+            data++;
+            len--;
+        }
     }
+    return ESP_OK;
+}
 
-    size_t   len = 0;
-    size_t   cap = 4096;
-    uint8_t* buf = malloc(cap);
-    if (!buf) {
-        return ESP_ERR_NO_MEM;
+// End the current frame and write everything that is still staged.
+esp_err_t et2_slip_send_end(et2_slip_t* slip) {
+    RETURN_ON_ERR(et2_slip_stage(slip, (uint8_t[]){SLIP_END}, 1));
+    return et2_slip_flush(slip);
+}
+
+// Send a complete frame made up of several segments, encoding each of them in place.
+esp_err_t et2_slip_send_frame(et2_slip_t* slip, et2_iov_t const* iov, size_t iov_cnt) {
+    RETURN_ON_ERR(et2_slip_send_start(slip));
+    for (size_t i = 0; i < iov_cnt; i++) {
+        RETURN_ON_ERR(et2_slip_send_data(slip, iov[i].base, iov[i].len));
     }
+    return et2_slip_send_end(slip);
+}
 
-    while (true) {
-        uint8_t rxd = 0;
-        RETURN_ON_ERR(et2_uart_read(uart, &rxd, 1));
+// Append decoded bytes to the frame being received.
+static esp_err_t et2_slip_append(et2_slip_t* slip, uint8_t const* data, size_t len) {
+    if (slip->rx_dst) {
+        if (slip->rx_frame_len + len > slip->rx_dst_cap) {
+            ESP_LOGE(TAG, "Frame does not fit in the receive buffer of %zu bytes", slip->rx_dst_cap);
+            return ESP_ERR_INVALID_SIZE;
+        }
+        memcpy(slip->rx_dst + slip->rx_frame_len, data, len);
+        slip->rx_frame_len += len;
+        return ESP_OK;
+    }
 
-        if (rxd == SLIP_END) {
-            // End of message.
-            break;
+    if (slip->rx_frame_len + len > slip->rx_own_cap) {
+        size_t cap = slip->rx_own_cap ? slip->rx_own_cap : ET2_SLIP_FRAME_SIZE;
+        while (cap < slip->rx_frame_len + len) {
+            cap *= 2;
+        }
+        void* mem = realloc(slip->rx_own, cap);
+        if (!mem) {
+            return ESP_ERR_NO_MEM;
+        }
+        slip->rx_own     = mem;
+        slip->rx_own_cap = cap;
+    }
+    memcpy(slip->rx_own + slip->rx_frame_len, data, len);
+    slip->rx_frame_len += len;
+    return ESP_OK;
+}
+
+// Decode buffered bytes; sets `done` when a complete frame has been received.
+static esp_err_t et2_slip_decode(et2_slip_t* slip, bool* done) {
+    while (slip->rx_pos < slip->rx_len) {
+        uint8_t const* data  = slip->rx_buf + slip->rx_pos;
+        size_t         avail = slip->rx_len - slip->rx_pos;
+        esp_err_t      res   = ESP_OK;
+
+        if (slip->rx_state == SLIP_RX_IDLE) {
+            // Anything before the start of a frame is printed, as it is typically ROM output.
+            uint8_t const* start = memchr(data, SLIP_END, avail);
+            size_t         skip  = start ? start - data : avail;
+            fwrite(data, 1, skip, stdout);
+            slip->rx_pos += skip;
+            if (start) {
+                slip->rx_pos++;
+                slip->rx_state      = SLIP_RX_FRAME;
+                slip->rx_frame_len  = 0;
+                slip->rx_frame_wire = 1;
+                slip->rx_start_us   = slip->rx_read_us;
+            }
 
-        } else if (rxd == SLIP_ESC) {
-            // Handle escape sequences.
-            RETURN_ON_ERR(et2_uart_read(uart, &rxd, 1));
-            if (rxd == SLIP_ESC_END) {
-                rxd = SLIP_END;
-            } else if (rxd == SLIP_ESC_ESC) {
-                rxd = SLIP_ESC;
+        } else if (slip->rx_state == SLIP_RX_DISCARD) {
+            uint8_t const* end = memchr(data, SLIP_END, avail);
+            slip->rx_pos      += end ? end - data + 1 : avail;
+            if (end) {
+                slip->rx_state = SLIP_RX_IDLE;
+                res            = slip->rx_error;
+            }
+
+        } else if (slip->rx_state == SLIP_RX_ESCAPE) {
+            uint8_t rxd = *data == SLIP_ESC_END ? SLIP_END : SLIP_ESC;
+            slip->rx_pos++;
+            slip->rx_frame_wire++;
+            if (*data != SLIP_ESC_END && *data != SLIP_ESC_ESC) {
+                ESP_LOGE(TAG, "Invalid escape sequence 0xDB 0x%02" PRIX8, *data);
+                slip->rx_state = SLIP_RX_DISCARD;
+                slip->rx_error = ESP_ERR_INVALID_RESPONSE;
             } else {
-                ESP_LOGE(TAG, "Invalid escape sequence 0xDB 0x%02" PRIX8, rxd);
-                return ESP_ERR_INVALID_RESPONSE;
+                slip->rx_state = SLIP_RX_FRAME;
+                res            = et2_slip_append(slip, &rxd, 1);
             }
-        }
 
-        // Append character to output.
-        if (len >= cap) {
-            cap       *= 2;
-            void* mem  = realloc(buf, cap);
-            if (!mem) {
-                free(buf);
-                return ESP_ERR_NO_MEM;
+        } else {
+            // Copy everything up to the next special character in one go.
+            size_t clean         = et2_slip_clean_len(data, avail);
+            res                  = et2_slip_append(slip, data, clean);
+            slip->rx_pos        += clean;
+            slip->rx_frame_wire += clean;
+            if (res != ESP_OK || clean == avail) {
+                // Nothing else to do with this chunk.
+            } else if (data[clean] == SLIP_ESC) {
+                slip->rx_pos++;
+                slip->rx_frame_wire++;
+                slip->rx_state = SLIP_RX_ESCAPE;
+            } else if (slip->rx_frame_len) {
+                // End of message.
+                slip->rx_pos++;
+                slip->rx_frame_wire++;
+                slip->rx_state  = SLIP_RX_IDLE;
+                slip->rx_end_us = et2_time_us();
+                *done           = true;
+                return ESP_OK;
+            } else {
+                // An empty frame is treated as the start of the next one.
+                slip->rx_pos++;
+                slip->rx_start_us = slip->rx_read_us;
             }
-            buf = mem;
         }
-        buf[len++] = rxd;
+
+        if (res != ESP_OK && slip->rx_state != SLIP_RX_IDLE) {
+            // Skip the rest of the broken frame before reporting the error.
+            slip->rx_state = SLIP_RX_DISCARD;
+            slip->rx_error = res;
+        } else if (res != ESP_OK) {
+            return res;
+        }
+    }
+    return ESP_OK;
+}
+
+// Receive a frame into `dst`, or into the decoder's own buffer if NULL.
+// Gives up if no data arrives for `timeout_us`.
+static esp_err_t et2_slip_receive_frame(et2_slip_t* slip, uint8_t* dst, size_t dst_cap, int64_t timeout_us) {
+    if (slip->rx_state != SLIP_RX_IDLE && slip->rx_state != SLIP_RX_DISCARD && dst != slip->rx_dst) {
+        // A partial frame was received into a different buffer; it cannot be resumed.
+        slip->rx_state = SLIP_RX_DISCARD;
+        slip->rx_error = ESP_ERR_INVALID_STATE;
     }
+    slip->rx_dst     = dst;
+    slip->rx_dst_cap = dst_cap;
+
+    bool done = false;
+    while (true) {
+        RETURN_ON_ERR(et2_slip_decode(slip, &done));
+        if (done) {
+            return ESP_OK;
+        }
+        // Pull in whatever the transport has available.
+        RETURN_ON_ERR(slip->tp->read(slip->tp, slip->rx_buf, sizeof(slip->rx_buf), &slip->rx_len,
+                                     et2_time_us() + timeout_us));
+        slip->rx_pos     = 0;
+        slip->rx_read_us = et2_time_us();
+    }
+}
+
+// Receive a frame; it stays valid until the next receive.
+esp_err_t et2_slip_receive(et2_slip_t* slip, uint8_t const** out_frame, size_t* out_len) {
+    return et2_slip_receive_timeout(slip, out_frame, out_len, ET2_IO_TIMEOUT_US);
+}
+
+// Receive a frame, waiting up to `timeout_us` for data; it stays valid until the next receive.
+esp_err_t et2_slip_receive_timeout(et2_slip_t* slip, uint8_t const** out_frame, size_t* out_len, int64_t timeout_us) {
+    RETURN_ON_ERR(et2_slip_receive_frame(slip, NULL, 0, timeout_us));
+    *out_frame = slip->rx_own;
+    *out_len   = slip->rx_frame_len;
+    return ESP_OK;
+}
 
-    *out_resp     = buf;
-    *out_resp_len = len;
+// Receive a frame directly into a buffer provided by the caller.
+esp_err_t et2_slip_receive_into(et2_slip_t* slip, void* buf, size_t cap, size_t* out_len) {
+    RETURN_ON_ERR(et2_slip_receive_frame(slip, buf, cap, ET2_IO_TIMEOUT_US));
+    *out_len = slip->rx_frame_len;
     return ESP_OK;
 }
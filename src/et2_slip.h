@@ -1,9 +1,63 @@
 #pragma once
 
 #include <stdint.h>
-#include "driver/uart.h"
 #include "esp_err.h"
+#include "et2_transport.h"
 
-esp_err_t et2_slip_send_startstop(uart_port_t uart);
-esp_err_t et2_slip_send_data(uart_port_t uart, uint8_t const* data, size_t len);
-esp_err_t et2_slip_receive(uart_port_t uart, void** out_resp, size_t* out_resp_len);
+#define ET2_SLIP_TX_BUF_SIZE 2048
+#define ET2_SLIP_RX_BUF_SIZE 1024
+#define ET2_SLIP_FRAME_SIZE  256
+
+// One segment of a frame to send.
+typedef struct {
+    void const* base;
+    size_t      len;
+} et2_iov_t;
+
+// Receive state; kept across calls so that a timeout does not lose a partially received frame.
+typedef enum {
+    SLIP_RX_IDLE,
+    SLIP_RX_FRAME,
+    SLIP_RX_ESCAPE,
+    // Skipping the rest of a frame that could not be received.
+    SLIP_RX_DISCARD,
+} et2_slip_rx_state_t;
+
+// SLIP framing state for one transport.
+typedef struct {
+    et2_transport_t*    tp;
+    // Frames are staged here and written to the transport in large chunks.
+    uint8_t             tx_buf[ET2_SLIP_TX_BUF_SIZE];
+    size_t              tx_len;
+    // Number of bytes written to the transport, including framing and escapes.
+    uint64_t            tx_wire;
+    et2_slip_rx_state_t rx_state;
+    uint8_t             rx_buf[ET2_SLIP_RX_BUF_SIZE];
+    size_t              rx_pos;
+    size_t              rx_len;
+    // Buffer owned by the decoder; grown when needed but only freed by et2_slip_deinit.
+    uint8_t*            rx_own;
+    size_t              rx_own_cap;
+    // Destination of the current frame; NULL for the decoder's own buffer.
+    uint8_t*            rx_dst;
+    size_t              rx_dst_cap;
+    size_t              rx_frame_len;
+    esp_err_t           rx_error;
+    // Number of bytes the last frame took on the wire, including framing and escapes.
+    size_t              rx_frame_wire;
+    // Time of the last transport read, the time the read holding the start of the last frame returned and the time
+    // the last frame was complete.
+    int64_t             rx_read_us;
+    int64_t             rx_start_us;
+    int64_t             rx_end_us;
+} et2_slip_t;
+
+void      et2_slip_init(et2_slip_t* slip, et2_transport_t* tp);
+void      et2_slip_deinit(et2_slip_t* slip);
+esp_err_t et2_slip_send_start(et2_slip_t* slip);
+esp_err_t et2_slip_send_data(et2_slip_t* slip, uint8_t const* data, size_t len);
+esp_err_t et2_slip_send_end(et2_slip_t* slip);
+esp_err_t et2_slip_send_frame(et2_slip_t* slip, et2_iov_t const* iov, size_t iov_cnt);
+esp_err_t et2_slip_receive(et2_slip_t* slip, uint8_t const** out_frame, size_t* out_len);
+esp_err_t et2_slip_receive_timeout(et2_slip_t* slip, uint8_t const** out_frame, size_t* out_len, int64_t timeout_us);
+esp_err_t et2_slip_receive_into(et2_slip_t* slip, void* buf, size_t cap, size_t* out_len);
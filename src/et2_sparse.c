@@ -0,0 +1,253 @@
+#include <inttypes.h>
+#include <string.h>
+#include "esp_check.h"
+#include "esp_log.h"
+#include "esptoolsquared.h"
+#include "et2_erase.h"
+#include "et2_macros.h"
+#include "et2_session.h"
+#include "et2_sparse.h"
+#include "zlib.h"
+
+static char const TAG[] = "ET2 SPARSE";
+
+#define ET2_SPARSE_MAGIC   0x50325445 // "ET2P"
+#define ET2_SPARSE_VERSION 1
+
+// Sparse image header, followed by the chunk table and the chunk data; all fields are little-endian.
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    // Size of the expanded image and CRC-32 of everything after this header.
+    uint32_t image_len;
+    uint32_t crc;
+} et2_sparse_hdr_t;
+_Static_assert(sizeof(et2_sparse_hdr_t) == 16);
+
+// Chunk of data in a sparse image; everything between chunks is erased.
+typedef struct {
+    // Sector-aligned offset of the chunk in the expanded image.
+    uint32_t offset;
+    uint32_t len;
+} et2_sparse_chunk_t;
+_Static_assert(sizeof(et2_sparse_chunk_t) == 8);
+
+// State of one sparse write.
+typedef struct {
+    et2_session_t*    session;
+    uint32_t          offset;
+    int               level;
+    // Whether a begin command was sent, which the caller's finish command needs.
+    bool              begun;
+    uint32_t          skipped;
+    // Empty ranges, erased once all data has been written.
+    et2_erase_plan_t* plan;
+    // MD5 of the expanded image, if requested.
+    md5_context_t*    md5;
+} et2_sparse_t;
+
+// Check whether a buffer is entirely 0xFF, a word at a time.
+static bool et2_is_erased(uint8_t const* data, uint32_t len) {
+    while (len && (uintptr_t)data % sizeof(uint32_t)) {
+        if (*data != 0xff) {
+            return false;
+        }
+        data++;
+        len--;
+    }
+    uint32_t const* words = (uint32_t const*)data;
+    for (; len >= sizeof(uint32_t); len -= sizeof(uint32_t)) {
+        if (*words++ != UINT32_MAX) {
+            return false;
+        }
+    }
+    data = (uint8_t const*)words;
+    while (len--) {
+        if (*data++ != 0xff) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Write `len` bytes at `src_pos` of a source to a range relative to the start of the image.
+static esp_err_t et2_sparse_data(et2_sparse_t* sparse, uint32_t pos, et2_source_t* src, uint32_t src_pos,
+                                 uint32_t len) {
+    sparse->begun = true;
+    return et2_session_write_flash_source(sparse->session, sparse->offset + pos, src, src_pos, len, sparse->level,
+                                          NULL);
+}
+
+// Round a length up to whole sectors.
+static uint32_t et2_sector_align(uint32_t len) {
+    return (len + ET2_FLASH_SECTOR_SIZE - 1) / ET2_FLASH_SECTOR_SIZE * ET2_FLASH_SECTOR_SIZE;
+}
+
+// Plan to erase a range relative to the start of the image instead of sending its contents.
+static esp_err_t et2_sparse_erase(et2_sparse_t* sparse, uint32_t pos, uint32_t len) {
+    sparse->skipped += len;
+    return et2_erase_plan_add(sparse->plan, sparse->offset + pos, len);
+}
+
+// Finish the data of a sparse write, which may not have written anything.
+static esp_err_t et2_sparse_end(et2_sparse_t* sparse, uint32_t len) {
+    ESP_LOGI(TAG, "Left out %" PRIu32 " of %" PRIu32 " bytes that are empty", sparse->skipped, len);
+    if (sparse->begun) {
+        return ESP_OK;
+    }
+    return et2_session_write_flash_empty(sparse->session, sparse->offset, sparse->level);
+}
+
+// Erase the empty ranges of a sparse write, skipping blocks that are already erased.
+static esp_err_t et2_sparse_erase_plan(et2_session_t* session, et2_erase_plan_t* plan, esp_err_t res) {
+    if (res == ESP_OK) {
+        res = et2_session_erase_plan_run(session, plan, true, NULL);
+    }
+    et2_erase_plan_free(plan);
+    return res;
+}
+
+// Write data to flash, adding the sectors that are entirely 0xFF to an erase plan instead of sending them.
+esp_err_t et2_sparse_write(et2_session_t* session, uint32_t offset, et2_source_t* src, uint32_t len, int level,
+                           et2_erase_plan_t* plan, uint8_t out_md5[16]) {
+    if (offset % ET2_FLASH_SECTOR_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    md5_context_t md5;
+    esp_rom_md5_init(&md5);
+    et2_sparse_t sparse = {.session = session, .offset = offset, .level = level, .plan = plan};
+
+    // Alternate between runs of sectors with data and runs of empty sectors.
+    uint32_t run_start = 0;
+    bool     run_empty = true;
+    for (uint32_t pos = 0; pos < len; pos += ET2_FLASH_SECTOR_SIZE) {
+        uint32_t       sector = len - pos < ET2_FLASH_SECTOR_SIZE ? len - pos : ET2_FLASH_SECTOR_SIZE;
+        uint8_t const* data;
+        RETURN_ON_ERR(src->read(src, pos, sector, &data));
+        bool empty = et2_is_erased(data, sector);
+        // Hash each sector right after scanning it.
+        if (out_md5) {
+            esp_rom_md5_update(&md5, data, sector);
+        }
+        if (pos && empty != run_empty) {
+            if (run_empty) {
+                RETURN_ON_ERR(et2_sparse_erase(&sparse, run_start, pos - run_start));
+            } else {
+                RETURN_ON_ERR(et2_sparse_data(&sparse, run_start, src, run_start, pos - run_start));
+            }
+            run_start = pos;
+        }
+        run_empty = empty;
+    }
+    if (run_empty) {
+        RETURN_ON_ERR(et2_sparse_erase(&sparse, run_start, len - run_start));
+    } else {
+        RETURN_ON_ERR(et2_sparse_data(&sparse, run_start, src, run_start, len - run_start));
+    }
+    if (out_md5) {
+        esp_rom_md5_final(out_md5, &md5);
+    }
+    return et2_sparse_end(&sparse, len);
+}
+
+// Write data to flash, erasing sectors that are entirely 0xFF instead of sending them.
+esp_err_t et2_session_write_flash_sparse(et2_session_t* session, uint32_t offset, uint8_t const* data, uint32_t len,
+                                         int level, uint8_t out_md5[16]) {
+    et2_erase_plan_t plan;
+    et2_mem_source_t src;
+    et2_erase_plan_init(&plan);
+    et2_mem_source_init(&src, data);
+    return et2_sparse_erase_plan(session, &plan,
+                                 et2_sparse_write(session, offset, &src.base, len, level, &plan, out_md5));
+}
+
+// Write the chunks of a sparse image, adding the gaps between them to an erase plan.
+static esp_err_t et2_sparse_write_image(et2_sparse_t* sparse, et2_sparse_hdr_t const* hdr, uint8_t const* base) {
+    size_t           data_pos = sizeof(*hdr) + hdr->count * sizeof(et2_sparse_chunk_t);
+    uint32_t         pos      = 0;
+    uint32_t         hashed   = 0;
+    et2_mem_source_t src;
+    et2_mem_source_init(&src, base);
+    for (size_t i = 0; i < hdr->count; i++) {
+        et2_sparse_chunk_t chunk;
+        memcpy(&chunk, base + sizeof(*hdr) + i * sizeof(chunk), sizeof(chunk));
+        // The begin command of the previous chunk erased up to the end of its last sector.
+        RETURN_ON_ERR(et2_sparse_erase(sparse, pos, chunk.offset - pos));
+        if (sparse->md5) {
+            et2_md5_update_erased(sparse->md5, chunk.offset - hashed);
+            esp_rom_md5_update(sparse->md5, base + data_pos, chunk.len);
+            hashed = chunk.offset + chunk.len;
+        }
+        RETURN_ON_ERR(et2_sparse_data(sparse, chunk.offset, &src.base, data_pos, chunk.len));
+        data_pos += chunk.len;
+        pos       = et2_sector_align(chunk.offset + chunk.len);
+    }
+    if (pos < hdr->image_len) {
+        RETURN_ON_ERR(et2_sparse_erase(sparse, pos, hdr->image_len - pos));
+    }
+    if (sparse->md5) {
+        et2_md5_update_erased(sparse->md5, hdr->image_len - hashed);
+    }
+    return et2_sparse_end(sparse, hdr->image_len);
+}
+
+// Write a sparse image made by mk_sparse.py to flash, erasing the gaps between its chunks.
+esp_err_t et2_session_write_flash_sparse_image(et2_session_t* session, uint32_t offset, void const* image, size_t len,
+                                               int level, uint8_t out_md5[16]) {
+    et2_sparse_hdr_t hdr;
+    if (offset % ET2_FLASH_SECTOR_SIZE || len < sizeof(hdr)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memcpy(&hdr, image, sizeof(hdr));
+    if (hdr.magic != ET2_SPARSE_MAGIC || hdr.version != ET2_SPARSE_VERSION) {
+        ESP_LOGE(TAG, "Not a sparse image or unsupported version");
+        return ESP_ERR_INVALID_VERSION;
+    }
+    uint8_t const* base = image;
+    if (crc32(0, base + sizeof(hdr), len - sizeof(hdr)) != hdr.crc) {
+        ESP_LOGE(TAG, "Sparse image CRC mismatch");
+        return ESP_ERR_INVALID_CRC;
+    }
+
+    // Check the whole chunk table before anything is erased.
+    size_t data_pos = sizeof(hdr) + hdr.count * sizeof(et2_sparse_chunk_t);
+    size_t data_len = 0;
+    if (data_pos > len) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    uint32_t end = 0;
+    for (size_t i = 0; i < hdr.count; i++) {
+        // Chunks must be in order and must not share a sector, which the next chunk's begin command would erase.
+        et2_sparse_chunk_t chunk;
+        memcpy(&chunk, base + sizeof(hdr) + i * sizeof(chunk), sizeof(chunk));
+        if (chunk.offset % ET2_FLASH_SECTOR_SIZE || chunk.offset < end || chunk.offset > hdr.image_len ||
+            !chunk.len || chunk.len > hdr.image_len - chunk.offset) {
+            ESP_LOGE(TAG, "Invalid sparse image chunk %zu", i);
+            return ESP_ERR_INVALID_ARG;
+        }
+        end       = et2_sector_align(chunk.offset + chunk.len);
+        data_len += chunk.len;
+    }
+    if (data_len != len - data_pos) {
+        ESP_LOGE(TAG, "Sparse image holds %zu bytes of data, expected %zu", len - data_pos, data_len);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    md5_context_t    md5;
+    et2_erase_plan_t plan;
+    esp_rom_md5_init(&md5);
+    et2_erase_plan_init(&plan);
+    et2_sparse_t sparse = {
+        .session = session,
+        .offset  = offset,
+        .level   = level,
+        .plan    = &plan,
+        .md5     = out_md5 ? &md5 : NULL,
+    };
+    esp_err_t res = et2_sparse_erase_plan(session, &plan, et2_sparse_write_image(&sparse, &hdr, base));
+    if (res == ESP_OK && out_md5) {
+        esp_rom_md5_final(out_md5, &md5);
+    }
+    return res;
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <stdint.h>
+#include "esptoolsquared.h"
+#include "et2_session.h"
+
+// Like et2_session_write_flash_sparse, but reads the data from a source and adds the empty sectors to `plan` instead
+// of erasing them.
+esp_err_t et2_sparse_write(et2_session_t* session, uint32_t offset, et2_source_t* src, uint32_t len, int level,
+                           et2_erase_plan_t* plan, uint8_t out_md5[16]);
@@ -0,0 +1,240 @@
+#include "et2_stats.h"
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "et2_session.h"
+#include "sdkconfig.h"
+
+static char const TAG[] = "ET2 STATS";
+
+// Commands that have their own counters; everything else shares the last slot.
+static struct {
+    et2_cmd_t   cmd;
+    char const* name;
+} const stats_cmds[] = {
+    {ET2_CMD_FLASH_BEGIN, "FLASH_BEGIN"},
+    {ET2_CMD_FLASH_DATA, "FLASH_DATA"},
+    {ET2_CMD_FLASH_END, "FLASH_END"},
+    {ET2_CMD_MEM_BEGIN, "MEM_BEGIN"},
+    {ET2_CMD_MEM_END, "MEM_END"},
+    {ET2_CMD_MEM_DATA, "MEM_DATA"},
+    {ET2_CMD_SYNC, "SYNC"},
+    {ET2_CMD_WRITE_REG, "WRITE_REG"},
+    {ET2_CMD_READ_REG, "READ_REG"},
+    {ET2_CMD_SPI_SET_PARAMS, "SPI_SET_PARAMS"},
+    {ET2_CMD_SPI_ATTACH, "SPI_ATTACH"},
+    {ET2_CMD_READ_FLASH_SLOW, "READ_FLASH_SLOW"},
+    {ET2_CMD_CHANGE_BAUDRATE, "CHANGE_BAUDRATE"},
+    {ET2_CMD_DEFL_BEGIN, "DEFL_BEGIN"},
+    {ET2_CMD_DEFL_DATA, "DEFL_DATA"},
+    {ET2_CMD_DEFL_END, "DEFL_END"},
+    {ET2_CMD_SPI_FLASH_MD5, "SPI_FLASH_MD5"},
+    {ET2_CMD_SEC_INFO, "SEC_INFO"},
+    {ET2_CMD_ERASE_FLASH, "ERASE_FLASH"},
+    {ET2_CMD_ERASE_REGION, "ERASE_REGION"},
+    {ET2_CMD_READ_FLASH, "READ_FLASH"},
+    {ET2_CMD_RUN_USER_CODE, "RUN_USER_CODE"},
+    {ET2_CMD_FLASH_ENCRYPT_DATA, "FLASH_ENCRYPT_DATA"},
+};
+
+#define ET2_STATS_SLOTS (sizeof(stats_cmds) / sizeof(stats_cmds[0]) + 1)
+
+// Slot of a command in the counter array.
+static size_t et2_stats_index(et2_cmd_t cmd) {
+    size_t i = 0;
+    while (i < ET2_STATS_SLOTS - 1 && stats_cmds[i].cmd != cmd) {
+        i++;
+    }
+    return i;
+}
+
+// Get the counters of a command, allocating them on first use; NULL if statistics are disabled or out of memory.
+static et2_cmd_stats_t* et2_stats_get(et2_session_t* session, et2_cmd_t cmd) {
+#ifdef CONFIG_ET2_STATS
+    if (!session->stats.cmds) {
+        session->stats.cmds = calloc(ET2_STATS_SLOTS, sizeof(et2_cmd_stats_t));
+        if (!session->stats.cmds) {
+            return NULL;
+        }
+    }
+    return &session->stats.cmds[et2_stats_index(cmd)];
+#else
+    return NULL;
+#endif
+}
+
+// Add a sample to a histogram.
+static void et2_histogram_add(et2_histogram_t* hist, int64_t us) {
+    if (us < 0) {
+        us = 0;
+    }
+    uint32_t bucket = 0;
+    while (bucket < ET2_STATS_BUCKETS - 1 && us >= ((int64_t)2 << bucket)) {
+        bucket++;
+    }
+    hist->buckets[bucket]++;
+    hist->count++;
+    hist->total_us += us;
+    if (us > hist->max_us) {
+        hist->max_us = us;
+    }
+}
+
+// Approximate a percentile of a histogram by the upper bound of the bucket it falls in.
+int64_t et2_histogram_percentile(et2_histogram_t const* hist, uint32_t percentile) {
+    if (!hist->count) {
+        return 0;
+    }
+    uint64_t target = ((uint64_t)hist->count * percentile + 99) / 100;
+    uint64_t seen   = 0;
+    for (uint32_t i = 0; i < ET2_STATS_BUCKETS - 1; i++) {
+        seen += hist->buckets[i];
+        if (seen >= target) {
+            int64_t bound = ((int64_t)2 << i) - 1;
+            return bound < hist->max_us ? bound : hist->max_us;
+        }
+    }
+    return hist->max_us;
+}
+
+// Count a request that was just written to the transport; `start_us` is when encoding it started.
+void et2_stats_sent(et2_session_t* session, et2_cmd_t cmd, size_t payload, uint64_t wire, int64_t start_us) {
+    et2_cmd_stats_t* stats = et2_stats_get(session, cmd);
+    if (!stats) {
+        return;
+    }
+    int64_t now = et2_time_us();
+    stats->calls++;
+    stats->tx_payload += payload;
+    stats->tx_wire    += wire;
+    et2_histogram_add(&stats->send, now - start_us);
+
+    // Remember when the request went out, dropping the oldest time if too many are outstanding.
+    if (session->stats.pending_count == ET2_STATS_PENDING) {
+        session->stats.pending_head = (session->stats.pending_head + 1) % ET2_STATS_PENDING;
+        session->stats.pending_count--;
+    }
+    uint32_t slot                   = (session->stats.pending_head + session->stats.pending_count) % ET2_STATS_PENDING;
+    session->stats.pending_us[slot] = now;
+    session->stats.pending_count++;
+
+    if (session->stats.interval_us && now - session->stats.last_dump_us >= session->stats.interval_us) {
+        session->stats.last_dump_us = now;
+        et2_session_dump_stats(session);
+    }
+}
+
+// Count the outcome of waiting for a response, using the timestamps of the last frame received.
+void et2_stats_received(et2_session_t* session, et2_cmd_t cmd, esp_err_t res, uint32_t discarded) {
+    et2_cmd_stats_t* stats = et2_stats_get(session, cmd);
+    if (!stats) {
+        return;
+    }
+    int64_t sent_us = -1;
+    if (session->stats.pending_count) {
+        sent_us                     = session->stats.pending_us[session->stats.pending_head];
+        session->stats.pending_head = (session->stats.pending_head + 1) % ET2_STATS_PENDING;
+        session->stats.pending_count--;
+    }
+
+    stats->retries   += discarded > 0;
+    stats->discarded += discarded;
+    if (res == ESP_ERR_TIMEOUT) {
+        stats->timeouts++;
+        return;
+    } else if (res != ESP_OK) {
+        stats->rx_errors++;
+        return;
+    }
+
+    et2_slip_t const* slip = &session->slip;
+    stats->rx_payload += slip->rx_frame_len;
+    stats->rx_wire    += slip->rx_frame_wire;
+    if (sent_us >= 0) {
+        et2_histogram_add(&stats->device, slip->rx_start_us - sent_us);
+    }
+    et2_histogram_add(&stats->receive, slip->rx_end_us - slip->rx_start_us);
+}
+
+// Count frames that belong to a command but are not its request or response, such as READ_FLASH data.
+void et2_stats_bytes(et2_session_t* session, et2_cmd_t cmd, size_t tx_payload, uint64_t tx_wire, size_t rx_payload,
+                     uint64_t rx_wire) {
+    et2_cmd_stats_t* stats = et2_stats_get(session, cmd);
+    if (!stats) {
+        return;
+    }
+    stats->tx_payload += tx_payload;
+    stats->tx_wire    += tx_wire;
+    stats->rx_payload += rx_payload;
+    stats->rx_wire    += rx_wire;
+}
+
+// Count a response with a failure status.
+void et2_stats_failed(et2_session_t* session, et2_cmd_t cmd, bool bad_checksum) {
+    et2_cmd_stats_t* stats = et2_stats_get(session, cmd);
+    if (!stats) {
+        return;
+    }
+    stats->failures++;
+    stats->bad_checksum += bad_checksum;
+}
+
+// Forget the send times of requests whose responses will not be received.
+void et2_stats_forget_pending(et2_session_t* session) {
+    session->stats.pending_head  = 0;
+    session->stats.pending_count = 0;
+}
+
+// Get the counters of one command.
+esp_err_t et2_session_get_cmd_stats(et2_session_t* session, et2_cmd_t cmd, et2_cmd_stats_t* out_stats) {
+#ifdef CONFIG_ET2_STATS
+    if (session->stats.cmds) {
+        *out_stats = session->stats.cmds[et2_stats_index(cmd)];
+    } else {
+        memset(out_stats, 0, sizeof(et2_cmd_stats_t));
+    }
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+// Reset the counters of all commands.
+void et2_session_reset_stats(et2_session_t* session) {
+    if (session->stats.cmds) {
+        memset(session->stats.cmds, 0, ET2_STATS_SLOTS * sizeof(et2_cmd_stats_t));
+    }
+}
+
+// Log the counters of every command that was sent at least once.
+void et2_session_dump_stats(et2_session_t* session) {
+    if (!session->stats.cmds) {
+        return;
+    }
+    for (size_t i = 0; i < ET2_STATS_SLOTS; i++) {
+        et2_cmd_stats_t const* stats = &session->stats.cmds[i];
+        if (!stats->calls && !stats->rx_payload) {
+            continue;
+        }
+        ESP_LOGI(TAG,
+                 "%-18s %6" PRIu32 " calls; p50/p99 us: send %" PRId64 "/%" PRId64 ", device %" PRId64 "/%" PRId64
+                 ", receive %" PRId64 "/%" PRId64,
+                 i < ET2_STATS_SLOTS - 1 ? stats_cmds[i].name : "OTHER", stats->calls,
+                 et2_histogram_percentile(&stats->send, 50), et2_histogram_percentile(&stats->send, 99),
+                 et2_histogram_percentile(&stats->device, 50), et2_histogram_percentile(&stats->device, 99),
+                 et2_histogram_percentile(&stats->receive, 50), et2_histogram_percentile(&stats->receive, 99));
+        ESP_LOGI(TAG,
+                 "%-18s tx %" PRIu64 "/%" PRIu64 " bytes, rx %" PRIu64 "/%" PRIu64
+                 " bytes (payload/wire); retries %" PRIu32 ", discarded %" PRIu32 ", timeouts %" PRIu32
+                 ", rx errors %" PRIu32 ", failures %" PRIu32 " (bad checksum %" PRIu32 ")",
+                 "", stats->tx_payload, stats->tx_wire, stats->rx_payload, stats->rx_wire, stats->retries,
+                 stats->discarded, stats->timeouts, stats->rx_errors, stats->failures, stats->bad_checksum);
+    }
+}
+
+// Log the counters every `interval_us` microseconds while commands are being sent.
+void et2_session_set_stats_interval(et2_session_t* session, int64_t interval_us) {
+    session->stats.interval_us  = interval_us;
+    session->stats.last_dump_us = et2_time_us();
+}
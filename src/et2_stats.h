@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esptoolsquared.h"
+
+// Count a request that was just written to the transport; `start_us` is when encoding it started.
+void et2_stats_sent(et2_session_t* session, et2_cmd_t cmd, size_t payload, uint64_t wire, int64_t start_us);
+// Count the outcome of waiting for a response, using the timestamps of the last frame received.
+void et2_stats_received(et2_session_t* session, et2_cmd_t cmd, esp_err_t res, uint32_t discarded);
+// Count frames that belong to a command but are not its request or response, such as READ_FLASH data.
+void et2_stats_bytes(et2_session_t* session, et2_cmd_t cmd, size_t tx_payload, uint64_t tx_wire, size_t rx_payload,
+                     uint64_t rx_wire);
+// Count a response with a failure status.
+void et2_stats_failed(et2_session_t* session, et2_cmd_t cmd, bool bad_checksum);
+// Forget the send times of requests whose responses will not be received.
+void et2_stats_forget_pending(et2_session_t* session);
@@ -1,15 +1,41 @@
-#include "et2_uart.h"
 #include <stdint.h>
+#include <stdlib.h>
 #include "driver/uart.h"
 #include "esp_log.h"
 #include "et2_macros.h"
+#include "et2_transport.h"
+#include "sdkconfig.h"
 
 static char const TAG[] = "ET2 UART";
 
-#define ET2_UART_TIMEOUT 2000
+#define SLIP_END               0xC0
+#define ET2_UART_PATTERN_QUEUE 32
 
-esp_err_t et2_uart_write(uart_port_t uart, uint8_t const* data, size_t len) {
-    int res = uart_write_bytes(uart, data, len);
+// UART transport.
+typedef struct {
+    et2_transport_t base;
+    uart_port_t     port;
+    // Bytes left up to and including the next frame delimiter found by pattern detection.
+    size_t          pattern_left;
+} et2_uart_t;
+
+#ifdef CONFIG_ET2_UART_PATTERN_DET
+// Number of transports using pattern detection on each UART, so replacing a transport keeps it enabled.
+static uint8_t et2_uart_pattern_users[UART_NUM_MAX];
+#endif
+
+// Convert a deadline into a number of ticks to wait.
+static TickType_t et2_uart_ticks(int64_t deadline) {
+    int64_t remaining = deadline - et2_time_us();
+    if (remaining <= 0) {
+        return 0;
+    }
+    return pdMS_TO_TICKS((remaining + 999) / 1000);
+}
+
+static esp_err_t et2_uart_write(et2_transport_t* tp, uint8_t const* data, size_t len) {
+    et2_uart_t* uart = (et2_uart_t*)tp;
+    int         res  = uart_write_bytes(uart->port, data, len);
     if (res < 0) {
         ESP_LOGE(TAG, "UART write failed");
         return ESP_FAIL;
@@ -20,20 +46,124 @@ esp_err_t et2_uart_write(uart_port_t uart, uint8_t const* data, size_t len) {
     return ESP_OK;
 }
 
-esp_err_t et2_uart_read(uart_port_t uart, uint8_t* out_data, size_t len) {
-    int res = uart_read_bytes(uart, out_data, len, pdMS_TO_TICKS(ET2_UART_TIMEOUT));
-    if (res < 0) {
-        ESP_LOGE(TAG, "UART read failed");
-        return ESP_FAIL;
-    } else if (res == 0) {
-        return ESP_ERR_TIMEOUT;
-    } else if (res != len) {
-        ESP_LOGE(TAG, "Incorrect UART read count; expected %zd, got %d", len, res);
-        return ESP_FAIL;
+static esp_err_t et2_uart_read(et2_transport_t* tp, uint8_t* out_data, size_t len, size_t* out_len,
+                               int64_t deadline) {
+    et2_uart_t* uart  = (et2_uart_t*)tp;
+    size_t      got   = 0;
+    size_t      avail = 0;
+
+#ifdef CONFIG_ET2_UART_PATTERN_DET
+    // If the driver has seen a frame delimiter, read everything up to and including it.
+    if (!uart->pattern_left) {
+        int pos = uart_pattern_pop_pos(uart->port);
+        if (pos >= 0) {
+            uart->pattern_left = pos + 1;
+        }
+    }
+    if (uart->pattern_left) {
+        size_t chunk = uart->pattern_left < len ? uart->pattern_left : len;
+        int    res   = uart_read_bytes(uart->port, out_data, chunk, et2_uart_ticks(deadline));
+        if (res < 0) {
+            ESP_LOGE(TAG, "UART read failed");
+            return ESP_FAIL;
+        } else if (res == 0) {
+            return ESP_ERR_TIMEOUT;
+        }
+        uart->pattern_left -= res;
+        *out_len            = res;
+        return ESP_OK;
+    }
+#endif
+
+    // Only block for the first byte, after that take whatever is already buffered.
+    RETURN_ON_ERR(uart_get_buffered_data_len(uart->port, &avail));
+    if (avail == 0) {
+        int res = uart_read_bytes(uart->port, out_data, 1, et2_uart_ticks(deadline));
+        if (res < 0) {
+            ESP_LOGE(TAG, "UART read failed");
+            return ESP_FAIL;
+        } else if (res == 0) {
+            return ESP_ERR_TIMEOUT;
+        }
+        got = 1;
+        RETURN_ON_ERR(uart_get_buffered_data_len(uart->port, &avail));
+    }
+
+    if (avail > len - got) {
+        avail = len - got;
+    }
+    if (avail) {
+        int res = uart_read_bytes(uart->port, out_data + got, avail, 0);
+        if (res < 0) {
+            ESP_LOGE(TAG, "UART read failed");
+            return ESP_FAIL;
+        }
+        got += res;
     }
+
+    *out_len = got;
     return ESP_OK;
 }
 
-esp_err_t et2_uart_set_baudrate(uart_port_t uart, uint32_t baudrate) {
-    return uart_set_baudrate(uart, baudrate);
+static esp_err_t et2_uart_flush(et2_transport_t* tp, int64_t deadline) {
+    return uart_wait_tx_done(((et2_uart_t*)tp)->port, et2_uart_ticks(deadline));
+}
+
+static esp_err_t et2_uart_discard(et2_transport_t* tp) {
+    et2_uart_t* uart = (et2_uart_t*)tp;
+    uart->pattern_left = 0;
+#ifdef CONFIG_ET2_UART_PATTERN_DET
+    uart_pattern_queue_reset(uart->port, ET2_UART_PATTERN_QUEUE);
+#endif
+    return uart_flush_input(uart->port);
+}
+
+static esp_err_t et2_uart_set_baudrate(et2_transport_t* tp, uint32_t baudrate) {
+    return uart_set_baudrate(((et2_uart_t*)tp)->port, baudrate);
+}
+
+static esp_err_t et2_uart_set_lines(et2_transport_t* tp, bool dtr, bool rts) {
+    et2_uart_t* uart = (et2_uart_t*)tp;
+    RETURN_ON_ERR(uart_set_dtr(uart->port, dtr));
+    return uart_set_rts(uart->port, rts);
+}
+
+static void et2_uart_destroy(et2_transport_t* tp) {
+#ifdef CONFIG_ET2_UART_PATTERN_DET
+    uart_port_t port = ((et2_uart_t*)tp)->port;
+    if (!--et2_uart_pattern_users[port]) {
+        uart_disable_pattern_det_intr(port);
+    }
+#endif
+    free(tp);
+}
+
+// Create a transport on a UART; the driver must already be installed.
+esp_err_t et2_transport_uart_create(uart_port_t port, et2_transport_t** out_tp) {
+    et2_uart_t* uart = calloc(1, sizeof(et2_uart_t));
+    if (!uart) {
+        return ESP_ERR_NO_MEM;
+    }
+#ifdef CONFIG_ET2_UART_PATTERN_DET
+    esp_err_t res = uart_enable_pattern_det_baud_intr(port, SLIP_END, 1, 1, 0, 0);
+    if (res == ESP_OK) {
+        res = uart_pattern_queue_reset(port, ET2_UART_PATTERN_QUEUE);
+    }
+    if (res != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to enable pattern detection");
+        free(uart);
+        return res;
+    }
+    et2_uart_pattern_users[port]++;
+#endif
+    uart->base.write        = et2_uart_write;
+    uart->base.read         = et2_uart_read;
+    uart->base.flush        = et2_uart_flush;
+    uart->base.discard      = et2_uart_discard;
+    uart->base.set_baudrate = et2_uart_set_baudrate;
+    uart->base.set_lines    = et2_uart_set_lines;
+    uart->base.destroy      = et2_uart_destroy;
+    uart->port              = port;
+    *out_tp                 = &uart->base;
+    return ESP_OK;
 }